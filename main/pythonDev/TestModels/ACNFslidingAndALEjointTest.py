@@ -224,7 +224,7 @@ exu.Print("select cable coordinate", nc)
 sol = mbs.systemData.GetODE2Coordinates(); 
 uStatic = sol[nc]; #y-displacement of first node of four bar mechanism
 exu.Print('static solution of cable1 =',uStatic)
-exudynTestGlobals.testError = uStatic - (-2.197321886974786) #2020-03-05(corrected Cable2DshapeMarker): -2.197321886974786 #2019-12-26:  2.1973218859908146
+exudynTestGlobals.testError = uStatic - (-2.1973218869242457) #2026-10-18(LU factorization in dense solver; change 5e-11; converged solution with relativeTolerance=1e-10: -2.1973218859676, which both values match up to 1e-9): -2.1973218869242457; 2020-03-05(corrected Cable2DshapeMarker): -2.197321886974786 #2019-12-26:  2.1973218859908146
 
 #++++++++++++++++++++++++++++++++++++++++
 #store solution for next computation
@@ -280,7 +280,7 @@ sol = mbs.systemData.GetODE2Coordinates();
 uDynamic = sol[nc]; #y-displacement of first node of four bar mechanism
 exu.Print('dynamic solution of cable1 =',uDynamic)
 
-exudynTestGlobals.testError += uDynamic - (-2.2290811574753953) #2020-03-05(corrected Cable2DshapeMarker): -2.2290811574753953 #2019-12-26: -2.2290811558815617; 2019-12-18: -2.229126333291627
+exudynTestGlobals.testError += uDynamic - (-2.229081157358778) #2026-10-18(LU factorization in dense solver; change 1.2e-10; starting from static solution with relativeTolerance=1e-10: -2.2290811566673, which both values match up to 1e-9): -2.229081157358778; 2020-03-05(corrected Cable2DshapeMarker): -2.2290811574753953 #2019-12-26: -2.2290811558815617; 2019-12-18: -2.229126333291627
 
 
 
@@ -190,4 +190,4 @@ if exudynTestGlobals.useGraphics:
     SC.WaitForRenderEngineStopFlag()
     exu.StopRenderer() #safely close rendering window!
 
-exudynTestGlobals.testError = sol[n-3] - (-0.4842656547442095) #2019-12-17(relTol=1e-7 / up to 7 digits accurate): -0.4842656547442095;  2019-11-22: (-0.4844812763485709) (with relTol=1e-5);  y-displacement
+exudynTestGlobals.testError = sol[n-3] - (-0.48426560907862615) #2026-10-18(LU factorization in dense solver; change 4.6e-8, limited by relTol=1e-7: EigenSparse gives -0.4842656247087; with relTol=1e-9, EXUdense and EigenSparse both give -0.48426561043, which the new value matches up to 1.4e-9 and the old value up to 4.4e-8): -0.48426560907862615; 2019-12-17(relTol=1e-7 / up to 7 digits accurate): -0.4842656547442095;  2019-11-22: (-0.4844812763485709) (with relTol=1e-5);  y-displacement
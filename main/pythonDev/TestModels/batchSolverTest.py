@@ -0,0 +1,83 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for batch solver exu.SolveBatch: variants of a mass-spring-damper with different
+#           stiffness and initial displacement are solved in parallel threads; results (sensor values and
+#           ODE2 coordinates) must be identical to sequential solution with modified parameters
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs; first spring stiffness and initial displacement of first mass are varied
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+n1 = mbs.AddNode(Node1D(referenceCoordinates=[1], initialCoordinates=[0], initialVelocities=[0.2]))
+mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n0))
+mbs.AddObject(Mass1D(physicsMass=2, nodeNumber=n1))
+m0 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+m1 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+oSpring0 = mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0], stiffness=100, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0, m1], stiffness=50, damping=0.2))
+mbs.AddLoad(LoadCoordinate(markerNumber=m1, load=2))
+sPos1 = mbs.AddSensor(SensorNode(nodeNumber=n1, writeToFile=False, outputVariableType=exu.OutputVariableType.Coordinates))
+sVel0 = mbs.AddSensor(SensorNode(nodeNumber=n0, writeToFile=False, outputVariableType=exu.OutputVariableType.Coordinates_t))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+parameters = [['Object', oSpring0, 'stiffness'], ['Node', n0, 'initialCoordinates', 0]]
+parameterValues = np.array([[80+10*i, 0.05*i] for i in range(8)])
+
+testError = 0
+for solverType in [exu.DynamicSolverType.GeneralizedAlpha, exu.DynamicSolverType.RK4]:
+    resultsSensors = exu.SolveBatch(mbs, simulationSettings, parameters, parameterValues,
+                                    sensorNumbers=[sPos1, sVel0], solverType=solverType, numberOfThreads=4)
+    resultsODE2 = exu.SolveBatch(mbs, simulationSettings, parameters, parameterValues,
+                                 solverType=solverType, numberOfThreads=3)
+
+    #sequential reference solution with modified parameters in mbs
+    for i in range(len(parameterValues)):
+        mbs.SetObjectParameter(oSpring0, 'stiffness', parameterValues[i,0])
+        mbs.SetNodeParameter(n0, 'initialCoordinates', [parameterValues[i,1]])
+        mbs.Assemble()
+        exu.SolveDynamic(mbs, simulationSettings, solverType=solverType)
+        uRef = np.array(mbs.systemData.GetODE2Coordinates())
+        sensorsRef = np.hstack([mbs.GetSensorValues(sPos1), mbs.GetSensorValues(sVel0)])
+        testError += np.linalg.norm(resultsODE2[i] - uRef) + np.linalg.norm(resultsSensors[i] - sensorsRef)
+
+    exu.Print('batch solver', solverType, ': u0 =', resultsODE2[:,0])
+
+#multithreaded settings are overridden: every system copy runs single-threaded, results must not change
+simulationSettings.numberOfThreads = 2
+resultsThreads = exu.SolveBatch(mbs, simulationSettings, parameters, parameterValues,
+                                solverType=exu.DynamicSolverType.RK4, numberOfThreads=3)
+simulationSettings.numberOfThreads = 1
+testError += np.linalg.norm(resultsThreads - resultsODE2)
+
+mbs.SetObjectParameter(oSpring0, 'stiffness', 100)
+mbs.SetNodeParameter(n0, 'initialCoordinates', [0.1])
+mbs.Assemble()
+
+exu.Print('batch solver test error =', testError)
+exudynTestGlobals.testError = testError
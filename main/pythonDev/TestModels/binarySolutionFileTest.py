@@ -0,0 +1,98 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for binary solution file (solutionSettings.binarySolutionFile);
+#           solution of two-mass oscillator is written as text and binary file (float64 and float32)
+#           and compared after loading with LoadSolutionFile and LoadBinarySolutionFile
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import LoadSolutionFile, LoadBinarySolutionFile
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs; one coordinate constrained to obtain algebraic coordinates
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(NodePoint2D(referenceCoordinates=[0,0], initialCoordinates=[0.1,0]))
+n1 = mbs.AddNode(NodePoint2D(referenceCoordinates=[1,0], initialVelocities=[0,0.5]))
+mbs.AddObject(MassPoint2D(physicsMass=1, nodeNumber=n0))
+mbs.AddObject(MassPoint2D(physicsMass=2, nodeNumber=n1))
+m0x = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+m0y = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=1))
+m1x = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+m1y = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=1))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0x], stiffness=100, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0x, m1x], stiffness=200, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m1y], stiffness=50, damping=0))
+mbs.AddObject(CoordinateConstraint(markerNumbers=[mGround, m0y]))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 1
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.verboseMode = 1
+simulationSettings.solutionSettings.solutionWritePeriod = 0.01
+simulationSettings.solutionSettings.outputPrecision = 17 #text file exactly represents double values
+
+#text solution file as reference:
+textFile = 'solution/binarySolutionFileTest.txt'
+simulationSettings.solutionSettings.coordinatesSolutionFileName = textFile
+exu.SolveDynamic(mbs, simulationSettings)
+solText = LoadSolutionFile(textFile)
+
+#binary files, written by background thread; small buffer size to test buffer swapping:
+simulationSettings.solutionSettings.binarySolutionFile = True
+simulationSettings.solutionSettings.binaryBufferSize = 1000
+
+binaryFile = 'solution/binarySolutionFileTest.sol'
+simulationSettings.solutionSettings.coordinatesSolutionFileName = binaryFile
+exu.SolveDynamic(mbs, simulationSettings)
+solBinary = LoadBinarySolutionFile(binaryFile)
+
+simulationSettings.solutionSettings.binarySinglePrecision = True
+binaryFile32 = 'solution/binarySolutionFileTest32.sol'
+simulationSettings.solutionSettings.coordinatesSolutionFileName = binaryFile32
+exu.SolveDynamic(mbs, simulationSettings)
+solBinary32 = LoadBinarySolutionFile(binaryFile32)
+
+exu.Print('text rows =', solText['nRows'], ', binary rows =', solBinary['nRows'], ', binary float32 rows =', solBinary32['nRows'])
+
+testError = 0
+if solText['nRows'] != solBinary['nRows'] or solText['nRows'] != solBinary32['nRows']: testError += 1
+if solText['columnsExported'] != solBinary['columnsExported']: testError += 1
+
+if testError == 0:
+    errorFloat64 = np.max(abs(solText['data'] - solBinary['data']))
+    errorFloat32 = np.max(abs(solText['data'] - solBinary32['data']))
+    exu.Print('binary solution file: error float64 =', errorFloat64, ', error float32 =', errorFloat32)
+    testError += errorFloat64
+    testError += max(0, errorFloat32 - 1e-6*np.max(abs(solText['data']))) #float32 only accurate up to relative round off
+
+#second run appended to existing binary file: header is not written again, frames are continued
+simulationSettings.solutionSettings.binarySinglePrecision = False
+simulationSettings.solutionSettings.appendToFile = True
+simulationSettings.solutionSettings.writeFileHeader = False #not used for binary files
+simulationSettings.solutionSettings.coordinatesSolutionFileName = binaryFile
+exu.SolveDynamic(mbs, simulationSettings)
+solBinaryAppended = LoadBinarySolutionFile(binaryFile)
+exu.Print('binary rows after appending =', solBinaryAppended['nRows'])
+if solBinaryAppended['nRows'] != 2*solBinary['nRows']: testError += 1
+
+exudynTestGlobals.testError = testError
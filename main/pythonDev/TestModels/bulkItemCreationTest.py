@@ -0,0 +1,76 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for bulk item creation with AddNodes, AddObjects, AddMarkers and AddLoads: a chain of
+#           mass points connected by spring-dampers is created from numpy arrays; the solution must be
+#           identical to the same model created item by item
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+nMasses = 50
+positions = np.array([[i+1.,0,0] for i in range(nMasses)])
+masses = np.linspace(1, 2, nMasses)
+stiffness = np.linspace(1000, 2000, nMasses)
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#chain created with bulk functions
+oGround = mbs.AddObject(ObjectGround())
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround))
+nodes = mbs.AddNodes(NodePoint(), {'referenceCoordinates': positions})
+mbs.AddObjects(MassPoint(), {'nodeNumber': np.array(nodes), 'physicsMass': masses})
+markers = mbs.AddMarkers(MarkerNodePosition(), {'nodeNumber': np.array(nodes)})
+markerPairs = np.array([[int(mGround)]+list(markers)[0:-1], list(markers)]).T
+springs = mbs.AddObjects(SpringDamper(referenceLength=1, damping=1), {'markerNumbers': markerPairs, 'stiffness': stiffness})
+mbs.AddLoads(Force(loadVector=[0,-10,0]), {'markerNumber': np.array(markers)})
+
+testError = abs(len(nodes)-nMasses) + abs(len(springs)-nMasses) + abs(nodes[0]) + abs(markers[0]-1)
+exu.Print('node range =', nodes, ', spring range =', springs)
+
+mbs.Assemble()
+exu.SolveDynamic(mbs, simulationSettings)
+uBulk = np.array(mbs.systemData.GetODE2Coordinates())
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#reference: same chain created item by item
+mbs.Reset()
+oGround = mbs.AddObject(ObjectGround())
+mLast = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround))
+for i in range(nMasses):
+    n = mbs.AddNode(NodePoint(referenceCoordinates=list(positions[i])))
+    mbs.AddObject(MassPoint(nodeNumber=n, physicsMass=masses[i]))
+    m = mbs.AddMarker(MarkerNodePosition(nodeNumber=n))
+    mbs.AddObject(SpringDamper(markerNumbers=[mLast, m], referenceLength=1, damping=1, stiffness=stiffness[i]))
+    mbs.AddLoad(Force(markerNumber=m, loadVector=[0,-10,0]))
+    mLast = m
+
+mbs.Assemble()
+exu.SolveDynamic(mbs, simulationSettings)
+uRef = np.array(mbs.systemData.GetODE2Coordinates())
+
+#node numbers and therefore coordinates are identical in both models, only object numbers differ
+testError += np.linalg.norm(uBulk - uRef)
+
+exu.Print('bulk item creation test error =', testError)
+exudynTestGlobals.testError = testError
@@ -0,0 +1,107 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for binary checkpoint/restart with solver.SaveCheckpoint(...) and solver.LoadCheckpoint(...):
+#           a stepwise simulation is checkpointed at half time; the restarted simulation (in the same and in a
+#           second, identically built system) must give identical results as the uninterrupted simulation
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs, force on second mass; model is built twice for restart in second system
+def BuildModel(mbs):
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+    n0 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+    n1 = mbs.AddNode(Node1D(referenceCoordinates=[1], initialCoordinates=[0], initialVelocities=[0.2]))
+    mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n0))
+    mbs.AddObject(Mass1D(physicsMass=2, nodeNumber=n1))
+    m0 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+    m1 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0], stiffness=100, damping=0.5))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0, m1], stiffness=50, damping=0.2))
+    mbs.AddLoad(LoadCoordinate(markerNumber=m1, load=2))
+    mbs.AddSensor(SensorNode(nodeNumber=n1, storeInternal=True, writeToFile=False, outputVariableType=exu.OutputVariableType.Coordinates))
+    mbs.Assemble()
+
+mbs = SC.AddSystem()
+BuildModel(mbs)
+mbs2 = SC.AddSystem()
+BuildModel(mbs2)
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+controlPeriod = 0.01
+nPeriods = int(simulationSettings.timeIntegration.endTime/controlPeriod)
+checkpointFile = 'solution/checkpointTest.bin'
+
+testError = 0
+for solverType in ['implicit', 'explicit']:
+    def NewSolver():
+        if solverType == 'implicit': return exu.MainSolverImplicitSecondOrder()
+        simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType = exu.DynamicSolverType.RK4
+        return exu.MainSolverExplicit()
+
+    #uninterrupted simulation, checkpoint at half time
+    mbs.Assemble()
+    solver = NewSolver()
+    for i in range(nPeriods):
+        if i == nPeriods//2:
+            testError += 1 - solver.SaveCheckpoint(mbs, checkpointFile)
+        solver.Advance(mbs, simulationSettings, controlPeriod)
+    uRef = np.array(mbs.systemData.GetODE2Coordinates())
+    tRef = mbs.systemData.GetTime()
+    sensorRef = np.array(mbs.GetSensorStoredData(0))
+    solver.FinalizeSolver(mbs, simulationSettings)
+
+    #restart in same system (reset to initial values) and in second system
+    for system in [mbs, mbs2]:
+        system.Assemble()
+        solverRestart = NewSolver()
+        testError += 1 - solverRestart.LoadCheckpoint(system, simulationSettings, checkpointFile)
+        for i in range(nPeriods//2, nPeriods):
+            solverRestart.Advance(system, simulationSettings, controlPeriod)
+        u = np.array(system.systemData.GetODE2Coordinates())
+        t = system.systemData.GetTime()
+        solverRestart.FinalizeSolver(system, simulationSettings)
+        exu.Print(solverType, 'restart: t =', t, ', u =', u, ', diff =', np.linalg.norm(u-uRef))
+        testError += np.linalg.norm(u-uRef) + abs(t-tRef)
+        sensorData = np.array(system.GetSensorStoredData(0))
+        testError += abs(sensorData.shape[0] - sensorRef.shape[0]) + np.linalg.norm(sensorData - sensorRef)
+
+#truncated checkpoint file must be rejected without changing the system state
+with open(checkpointFile, 'rb') as f:
+    checkpointData = f.read()
+truncatedFile = 'solution/checkpointTestTruncated.bin'
+with open(truncatedFile, 'wb') as f:
+    f.write(checkpointData[0:len(checkpointData)-16])
+mbs.Assemble()
+uInit = np.array(mbs.systemData.GetODE2Coordinates())
+solverRestart = exu.MainSolverImplicitSecondOrder()
+try:
+    testError += solverRestart.LoadCheckpoint(mbs, simulationSettings, truncatedFile)
+except:
+    pass
+testError += np.linalg.norm(np.array(mbs.systemData.GetODE2Coordinates()) - uInit)
+
+exu.Print('checkpoint test error =', testError)
+exudynTestGlobals.testError = testError
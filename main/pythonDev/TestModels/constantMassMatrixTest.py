@@ -0,0 +1,127 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for reuse of constant system mass matrix (timeIntegration.reuseConstantMassMatrix);
+#           results with mass matrix computed once must be identical to results with mass matrix recomputed in every step,
+#           for implicit and explicit solvers, dense and sparse matrices; the GenericODE2 with massMatrixUserFunction
+#           leads to a system mass matrix, which is not constant; a mass changed with SetObjectParameter during simulation
+#           must be considered also if the mass matrix is reused; the factorized mass matrix for initial accelerations of
+#           the implicit solver is reused in a second run of the solver, but not after the mass has been changed
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#create chain of mass points and a GenericODE2 with constant mass matrix or mass matrix user function
+def CreateModel(mbs, useMassMatrixUserFunction, useConstraint=True):
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+
+    n0 = mbs.AddNode(NodePoint2D(referenceCoordinates=[0,0], initialCoordinates=[0.1,0]))
+    n1 = mbs.AddNode(NodePoint2D(referenceCoordinates=[1,0], initialVelocities=[0,0.5]))
+    mbs.AddObject(MassPoint2D(physicsMass=1, nodeNumber=n0))
+    mbs.AddObject(MassPoint2D(physicsMass=2, nodeNumber=n1))
+
+    n2 = mbs.AddNode(NodePoint(referenceCoordinates=[2,0,0], initialVelocities=[0.2,0,0]))
+    M = np.diag([1.5,1.5,1.5])
+    K = np.diag([100,100,100])
+    def UFmassMatrix(t, q, q_t):
+        return M
+    if useMassMatrixUserFunction:
+        mbs.AddObject(ObjectGenericODE2(nodeNumbers=[n2], massMatrix=M, stiffnessMatrix=K, massMatrixUserFunction=UFmassMatrix))
+    else:
+        mbs.AddObject(ObjectGenericODE2(nodeNumbers=[n2], massMatrix=M, stiffnessMatrix=K))
+
+    m0x = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+    m0y = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=1))
+    m1x = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+    m1y = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=1))
+    m2x = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n2, coordinate=0))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0x], stiffness=100, damping=0.5))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0x, m1x], stiffness=200, damping=0.5))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m1x, m2x], stiffness=150, damping=0.2))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m1y], stiffness=50, damping=0))
+    if useConstraint:
+        mbs.AddObject(CoordinateConstraint(markerNumbers=[mGround, m0y]))
+    else:
+        mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0y], stiffness=50, damping=0))
+    mbs.Assemble()
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 1
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.verboseMode = 1
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+#solve and return final ODE2 coordinates
+def Solve(solverType, linearSolverType, reuseConstantMassMatrix):
+    simulationSettings.linearSolverType = linearSolverType
+    simulationSettings.timeIntegration.reuseConstantMassMatrix = reuseConstantMassMatrix
+    exu.SolveDynamic(mbs, simulationSettings, solverType=solverType)
+    return mbs.systemData.GetODE2Coordinates()
+
+testError = 0
+for useMassMatrixUserFunction in [False, True]:
+    mbs.Reset()
+    CreateModel(mbs, useMassMatrixUserFunction)
+    for solverType in [exu.DynamicSolverType.GeneralizedAlpha, exu.DynamicSolverType.RK4]:
+        for linearSolverType in [exu.LinearSolverType.EXUdense, exu.LinearSolverType.EigenSparse]:
+            uReuse = Solve(solverType, linearSolverType, True)
+            uRecompute = Solve(solverType, linearSolverType, False)
+            diff = np.linalg.norm(np.array(uReuse) - np.array(uRecompute))
+            exu.Print('constant mass matrix:', solverType, ', user function =', useMassMatrixUserFunction,
+                      ', u =', uReuse[0], ', diff =', diff)
+            testError += diff
+
+#mass of second mass point changed in preStepFunction: constant mass matrix must be recomputed
+def PreStepUserFunction(mbs, t):
+    if t >= 0.5 and mbs.GetObjectParameter(1, 'physicsMass') != 3:
+        mbs.SetObjectParameter(1, 'physicsMass', 3)
+    return True
+
+for solverType in [exu.DynamicSolverType.GeneralizedAlpha, exu.DynamicSolverType.RK4]:
+    u = []
+    for reuseConstantMassMatrix in [True, False]:
+        mbs.Reset()
+        CreateModel(mbs, False)
+        mbs.SetPreStepUserFunction(PreStepUserFunction)
+        u += [np.array(Solve(solverType, exu.LinearSolverType.EXUdense, reuseConstantMassMatrix))]
+    diff = np.linalg.norm(u[0] - u[1])
+    exu.Print('mass changed during simulation:', solverType, ', u =', u[0][0], ', diff =', diff)
+    testError += diff
+
+#persistent solver, system without constraints: factorized mass matrix for initial accelerations is reused in second run,
+#but not after mass has been changed
+mbs.Reset()
+CreateModel(mbs, False, useConstraint=False)
+simulationSettings.linearSolverType = exu.LinearSolverType.EXUdense
+simulationSettings.timeIntegration.reuseConstantMassMatrix = True
+solver = exu.MainSolverImplicitSecondOrder()
+u = []
+for run in range(3):
+    if run == 2:
+        mbs.SetObjectParameter(1, 'physicsMass', 3)
+    solver.SolveSystem(mbs, simulationSettings)
+    u += [np.array(mbs.systemData.GetODE2Coordinates())]
+uNewSolver = np.array(Solve(exu.DynamicSolverType.GeneralizedAlpha, exu.LinearSolverType.EXUdense, True))
+diff = np.linalg.norm(u[0] - u[1]) + np.linalg.norm(u[2] - uNewSolver)
+exu.Print('persistent solver: u =', u[2][0], ', diff =', diff)
+testError += diff
+
+exudynTestGlobals.testError = testError
@@ -0,0 +1,101 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for contact broad phase (newton.useContactBroadPhase): ANCF cable falling onto two rollers,
+#           every cable element has contact objects with the rollers and with further circles far away from the cable;
+#           results with broad phase must be identical to results without broad phase
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+def CreateModel(mbs):
+    oGround=mbs.AddObject(ObjectGround(referencePosition= [0,0,0]))
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0])) #ground node for coordinate constraint
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0)) #Ground node ==> no action
+
+    L=2                     # length of ANCF cable in m
+    E=2.07e11               # Young's modulus of ANCF element in N/m^2
+    rho=7800                # density of ANCF element in kg/m^3
+    b=0.01                  # width of rectangular ANCF element in m
+    h=0.01                  # height of rectangular ANCF element in m
+    A=b*h                   # cross sectional area of ANCF element in m^2
+    I=b*h**3/12             # second moment of area of ANCF element in m^4
+
+    nodeList=[]
+    cableList=[]
+    nc0 = mbs.AddNode(Point2DS1(referenceCoordinates=[0,0,1,0]))
+    nodeList+=[nc0]
+    nElements = 8
+    lElem = L / nElements
+    for i in range(nElements):
+        nLast = mbs.AddNode(Point2DS1(referenceCoordinates=[lElem*(i+1),0,1,0]))
+        nodeList+=[nLast]
+        elem=mbs.AddObject(Cable2D(physicsLength=lElem, physicsMassPerLength=rho*A,
+                                   physicsBendingStiffness=E*I, physicsAxialStiffness=E*A*0.1,
+                                   physicsAxialDamping=E*A*0.1,
+                                   nodeNumbers=[int(nc0)+i,int(nc0)+i+1]))
+        cableList+=[elem]
+
+    for coordinate in [0,1,3]:
+        mANCF = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nc0, coordinate=coordinate))
+        mbs.AddObject(CoordinateConstraint(markerNumbers=[mGround,mANCF]))
+
+    for i in range(len(nodeList)):
+        m = mbs.AddMarker(MarkerNodePosition(nodeNumber=nodeList[i]))
+        fact = 1 #add (half) weight of two elements to node
+        if (i==0) | (i==len(nodeList)-1): fact = 0.5 # first and last node only weighted half
+        mbs.AddLoad(Force(markerNumber = m, loadVector = [0, -40*rho*A*fact*lElem, 0]))
+
+    #two rollers below cable and four circles far away, which are never in contact
+    circles = [[0.25*L,-0.15,0.1], [0.75*L,-0.5,0.3], [0,5,0.2], [1,5,0.2], [2,5,0.2], [3,-5,0.2]] #x, y, radius
+    nSegments = 4
+    initialGapList = [0.1]*nSegments
+    for circle in circles:
+        mCircle = mbs.AddMarker(MarkerBodyPosition(bodyNumber = oGround, localPosition=[circle[0],circle[1],0]))
+        for i in range(len(cableList)):
+            mCable = mbs.AddMarker(MarkerBodyCable2DShape(bodyNumber=cableList[i], numberOfSegments = nSegments))
+            nodeDataContactCable = mbs.AddNode(NodeGenericData(initialCoordinates=initialGapList,numberOfDataCoordinates=nSegments))
+            mbs.AddObject(ObjectContactCircleCable2D(markerNumbers=[mCircle, mCable], nodeNumber = nodeDataContactCable,
+                                                     numberOfContactSegments=nSegments, contactStiffness = 1e3, contactDamping=0,
+                                                     circleRadius = circle[2], offset = 0))
+    mbs.Assemble()
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.newton.relativeTolerance = 1e-8
+simulationSettings.timeIntegration.newton.absoluteTolerance = 1e-8
+simulationSettings.timeIntegration.generalizedAlpha.useNewmark = True
+simulationSettings.timeIntegration.generalizedAlpha.spectralRadius = 0.6
+simulationSettings.timeIntegration.verboseMode = 0
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+uList = []
+for useBroadPhase in [False, True]:
+    simulationSettings.timeIntegration.newton.useContactBroadPhase = useBroadPhase
+    mbs.Reset() #new model, such that both computations start with same initial contact states
+    CreateModel(mbs)
+    exu.SolveDynamic(mbs, simulationSettings)
+    sol = np.array(mbs.systemData.GetODE2Coordinates())
+    exu.Print('useContactBroadPhase =', useBroadPhase, ': tip displacement y =', sol[len(sol)-3])
+    uList += [sol]
+
+testError = np.linalg.norm(uList[1]-uList[0])
+exu.Print('contact broad phase test error =', testError)
+exudynTestGlobals.testError = testError
@@ -0,0 +1,112 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for ObjectContactSpheresTriangleMesh: cube with four spheres at its bottom corners
+#           slides with initial velocity on a ground plane given as triangle mesh and comes to rest due to friction;
+#           computed with numerical and with analytic (automatic differentiation) contact jacobians
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+from exudyn.utilities import *
+from exudyn.graphicsDataUtilities import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+g = 9.81            #gravity in m/s^2
+a = 0.2             #side length of cube in m
+rho = 1000          #density in kg/m^3
+r = 0.01            #radius of contact spheres in m
+k = 1e5             #contact stiffness per sphere in N/m
+d = 200             #contact damping per sphere in N/(m s)
+mu = 0.5            #friction coefficient
+
+#ground plane [-1,1] x [-1,1] as triangle mesh with nGrid x nGrid squares (2 triangles each), normals in z-direction
+nGrid = 20
+L = 2
+meshPoints = []
+for j in range(nGrid+1):
+    for i in range(nGrid+1):
+        meshPoints += [[-0.5*L+L*i/nGrid, -0.5*L+L*j/nGrid, 0]]
+meshTriangles = []
+for j in range(nGrid):
+    for i in range(nGrid):
+        p0 = j*(nGrid+1)+i
+        meshTriangles += [[p0, p0+1, p0+nGrid+2], [p0, p0+nGrid+2, p0+nGrid+1]] #counterclockwise ==> normal in z-direction
+
+gGround = GraphicsDataOrthoCubePoint(centerPoint=[0,0,-0.005],size=[L,L,0.01], color=color4lightgrey)
+oGround = mbs.AddObject(ObjectGround(visualization=VObjectGround(graphicsData=[gGround])))
+mGround = mbs.AddMarker(MarkerBodyRigid(bodyNumber=oGround, localPosition=[0,0,0]))
+
+#cube slightly above ground with initial velocity in x-direction
+inertiaCube = InertiaCuboid(density=rho, sideLengths=[a,a,a])
+m = inertiaCube.mass
+gCube = GraphicsDataOrthoCubePoint(centerPoint=[0,0,0],size=[a,a,a], color=color4lightred)
+[nCube,bCube]=AddRigidBody(mainSys = mbs,
+                           inertia = inertiaCube,
+                           nodeType = str(exu.NodeType.RotationEulerParameters),
+                           position = [0,0,0.5*a+r+0.001],
+                           velocity = [0.5,0,0],
+                           gravity = [0,0,-g],
+                           graphicsDataList = [gCube])
+mCube = mbs.AddMarker(MarkerBodyRigid(bodyNumber=bCube, localPosition=[0,0,0]))
+
+spherePositions = [[-0.5*a,-0.5*a,-0.5*a], [0.5*a,-0.5*a,-0.5*a], [0.5*a,0.5*a,-0.5*a], [-0.5*a,0.5*a,-0.5*a]]
+nSpheres = len(spherePositions)
+nData = mbs.AddNode(NodeGenericData(initialCoordinates=[0.1]*nSpheres, numberOfDataCoordinates=nSpheres))
+oContact = mbs.AddObject(ObjectContactSpheresTriangleMesh(markerNumbers=[mCube, mGround], nodeNumber=nData,
+                                                          spherePositions=spherePositions, sphereRadius=r,
+                                                          meshPoints=meshPoints, meshTriangles=meshTriangles,
+                                                          maximumPenetration=0.01,
+                                                          contactStiffness=k, contactDamping=d,
+                                                          frictionCoefficient=mu, frictionProportionalZone=1e-3,
+                                                          visualization=VObjectContactSpheresTriangleMesh(showMesh=False)))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+tEnd = 0.5
+h = 1e-3
+simulationSettings.timeIntegration.numberOfSteps = int(tEnd/h)
+simulationSettings.timeIntegration.endTime = tEnd
+simulationSettings.timeIntegration.newton.relativeTolerance = 1e-10
+simulationSettings.timeIntegration.newton.absoluteTolerance = 1e-10
+simulationSettings.timeIntegration.generalizedAlpha.useNewmark = True
+simulationSettings.timeIntegration.generalizedAlpha.spectralRadius = 0.8
+simulationSettings.timeIntegration.verboseMode = 0
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+if exudynTestGlobals.useGraphics:
+    exu.StartRenderer()
+    mbs.WaitForUserToContinue()
+
+uList = []
+for useAnalyticJacobians in [False, True]:
+    simulationSettings.timeIntegration.newton.numericalDifferentiation.useAnalyticJacobians = useAnalyticJacobians
+    exu.SolveDynamic(mbs, simulationSettings)
+
+    gap = mbs.GetObjectOutput(oContact, exu.OutputVariableType.Distance)
+    position = mbs.GetNodeOutput(nCube, exu.OutputVariableType.Position)
+    exu.Print('useAnalyticJacobians =', useAnalyticJacobians, ': gap =', gap, ', static gap =', -m*g/(4*k), ', sliding distance =', position[0])
+    uList += [position[0] + position[2]]
+
+#reference values computed with numerical jacobian and with analytic jacobian
+testError = abs(uList[0] - (0.135108738932065)) + abs(uList[1] - (0.13510873893153186)) #2026-10-18: 0.135108738932065, 0.13510873893153186
+exu.Print('contactSpheresTriangleMesh test error =', testError)
+exudynTestGlobals.testError = testError
+
+if exudynTestGlobals.useGraphics:
+    SC.WaitForRenderEngineStopFlag()
+    exu.StopRenderer() #safely close rendering window!
@@ -0,0 +1,119 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for explicit solvers RK4 and RK45 (Dormand-Prince);
+#           mass-spring oscillator compared to Python RK4 and analytical solution;
+#           mathematical pendulum with distance constraint (projection of constraints)
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#oscillator: mass=1 (mass matrix inverse is exact), no damping
+mass = 1
+k = 100
+x0 = 0.1
+omega = np.sqrt(k/mass)
+
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(NodePoint2D(referenceCoordinates=[0,0], initialCoordinates=[x0,0]))
+mbs.AddObject(MassPoint2D(physicsMass=mass, nodeNumber=n0))
+mNode = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, mNode], stiffness=k, damping=0))
+
+mbs.Assemble()
+
+tEnd = 1
+nSteps = 1000
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = tEnd
+simulationSettings.timeIntegration.numberOfSteps = nSteps
+simulationSettings.timeIntegration.adaptiveStep = False
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.timeIntegration.verboseMode = 1
+
+#classical Runge-Kutta:
+exu.SolveDynamic(mbs, simulationSettings, solverType=exu.DynamicSolverType.RK4)
+xRK4 = mbs.GetNodeOutput(n0, exu.OutputVariableType.Coordinates)[0]
+
+#reference: same scheme evaluated in Python (same order of operations)
+h = tEnd/nSteps
+A = [[0,0,0,0],[0.5,0,0,0],[0,0.5,0,0],[0,0,1,0]]
+b = [1/6,1/3,1/3,1/6]
+x = x0
+v = 0
+for i in range(nSteps):
+    V = [0]*4
+    Acc = [0]*4
+    for s in range(4):
+        xs = x
+        vs = v
+        for j in range(s):
+            if A[s][j] != 0:
+                xs += h*A[s][j]*V[j]
+                vs += h*A[s][j]*Acc[j]
+        V[s] = vs
+        Acc[s] = -k/mass*xs
+    for s in range(4):
+        x += h*b[s]*V[s]
+        v += h*b[s]*Acc[s]
+
+exu.Print('oscillator RK4: x =', xRK4, ', reference =', x)
+exudynTestGlobals.testError = xRK4 - x
+
+#adaptive Dormand-Prince, compared to analytical solution:
+simulationSettings.timeIntegration.adaptiveStep = True
+simulationSettings.timeIntegration.numberOfSteps = 10 #maximum step size
+simulationSettings.timeIntegration.explicitIntegration.absoluteTolerance = 1e-10
+simulationSettings.timeIntegration.explicitIntegration.relativeTolerance = 1e-10
+exu.SolveDynamic(mbs, simulationSettings, solverType=exu.DynamicSolverType.RK45)
+xRK45 = mbs.GetNodeOutput(n0, exu.OutputVariableType.Coordinates)[0]
+xAnalytic = x0*np.cos(omega*tEnd)
+exu.Print('oscillator RK45: x =', xRK45, ', analytical =', xAnalytic, ', steps =', mbs.sys['dynamicSolver'].it.currentStepIndex)
+exudynTestGlobals.testError += max(0, abs(xRK45 - xAnalytic) - 1e-6) #only accuracy is checked
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#pendulum with distance constraint, starting in horizontal position:
+mbs.Reset()
+L = 1
+g = 9.81
+oGround = mbs.AddObject(ObjectGround(referencePosition=[0,0,0]))
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,0,0]))
+n1 = mbs.AddNode(NodePoint2D(referenceCoordinates=[L,0]))
+oMass = mbs.AddObject(MassPoint2D(physicsMass=mass, nodeNumber=n1))
+mMass = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oMass, localPosition=[0,0,0]))
+mbs.AddObject(DistanceConstraint(markerNumbers=[mGround, mMass], distance=L))
+mbs.AddLoad(Force(markerNumber=mMass, loadVector=[0,-mass*g,0]))
+
+mbs.Assemble()
+
+simulationSettings.timeIntegration.numberOfSteps = 1000
+exu.SolveDynamic(mbs, simulationSettings, solverType=exu.DynamicSolverType.RK45)
+
+pos = mbs.GetNodeOutput(n1, exu.OutputVariableType.Position)
+vel = mbs.GetNodeOutput(n1, exu.OutputVariableType.Velocity)
+distanceError = np.linalg.norm(pos) - L
+velocityError = np.dot(pos, vel)/L
+energyError = 0.5*mass*np.dot(vel, vel) + mass*g*pos[1] #initial energy is zero
+exu.Print('pendulum RK45: pos =', pos, ', distance error =', distanceError, ', velocity error =', velocityError, ', energy error =', energyError)
+
+exudynTestGlobals.testError += max(0, abs(distanceError) - 1e-10) #projection must remove drift
+exudynTestGlobals.testError += max(0, abs(velocityError) - 1e-10)
+exudynTestGlobals.testError += max(0, abs(energyError) - 1e-5)
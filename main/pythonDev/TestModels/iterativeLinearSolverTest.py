@@ -0,0 +1,120 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for iterative linear solver (LinearSolverType.EigenSparseIterative);
+#           static and dynamic solution of a spring-damper grid with GMRES, BiCGSTAB and CG
+#           and different preconditioners are compared to sparse direct solver (EigenSparse)
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#grid of mass points connected by (diagonal) spring-dampers, left column connected to ground by springs;
+#optional coordinate constraint leads to (indefinite) saddle point system
+nx = 20
+ny = 4
+sqrt2 = 2**0.5
+def CreateModel(mbs, useConstraint):
+    nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+    mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+    markers = []
+    for j in range(ny):
+        for i in range(nx):
+            node = mbs.AddNode(NodePoint2D(referenceCoordinates=[i+1, j]))
+            body = mbs.AddObject(MassPoint2D(physicsMass=10, nodeNumber=node))
+            mBody = mbs.AddMarker(MarkerBodyPosition(bodyNumber=body, localPosition=[0,0,0]))
+            mbs.AddLoad(Force(markerNumber=mBody, loadVector=[0, -0.5, 0]))
+            markers += [mBody]
+    for j in range(ny):
+        oGround = mbs.AddObject(ObjectGround(referencePosition=[0,j,0]))
+        mGroundBody = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround, localPosition=[0,0,0]))
+        mbs.AddObject(SpringDamper(markerNumbers=[mGroundBody, markers[j*nx]], stiffness=4000, damping=10, referenceLength=1))
+        if j < ny-1: #diagonal springs needed for stiffness of straight grid in y-direction
+            mbs.AddObject(SpringDamper(markerNumbers=[mGroundBody, markers[(j+1)*nx]], stiffness=4000, damping=10, referenceLength=sqrt2))
+        for i in range(nx):
+            if i < nx-1:
+                mbs.AddObject(SpringDamper(markerNumbers=[markers[j*nx+i], markers[j*nx+i+1]], stiffness=4000, damping=10, referenceLength=1))
+            if j < ny-1:
+                mbs.AddObject(SpringDamper(markerNumbers=[markers[j*nx+i], markers[(j+1)*nx+i]], stiffness=4000, damping=10, referenceLength=1))
+            if i < nx-1 and j < ny-1:
+                mbs.AddObject(SpringDamper(markerNumbers=[markers[j*nx+i], markers[(j+1)*nx+i+1]], stiffness=4000, damping=10, referenceLength=sqrt2))
+    if useConstraint:
+        mNC = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = 1, coordinate=1))
+        mbs.AddObject(CoordinateConstraint(markerNumbers=[mGround, mNC]))
+    mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.staticSolver.verboseMode = 1
+simulationSettings.timeIntegration.verboseMode = 1
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.linearSolverSettings.iterativeTolerance = 1e-12
+simulationSettings.linearSolverSettings.gmresRestart = 200 #full GMRES for this small system; restarted GMRES stagnates for static (ill-conditioned) problems
+
+#solve and return final ODE2 coordinates; static=False: dynamic solver
+def Solve(linearSolverType, static, iterativeSolverType=exu.IterativeSolverType.GMRES, preconditionerType=exu.PreconditionerType.ILU0):
+    simulationSettings.linearSolverType = linearSolverType
+    simulationSettings.linearSolverSettings.iterativeSolverType = iterativeSolverType
+    simulationSettings.linearSolverSettings.preconditionerType = preconditionerType
+    if static:
+        exu.SolveStatic(mbs, simulationSettings)
+        it = mbs.sys['staticSolver'].it
+    else:
+        exu.SolveDynamic(mbs, simulationSettings)
+        it = mbs.sys['dynamicSolver'].it
+    if linearSolverType == exu.LinearSolverType.EigenSparseIterative:
+        exu.Print('  ', iterativeSolverType, preconditionerType, ': iterations =', it.linearSolverIterationsCount, 
+                  ', preconditioners =', it.preconditionerCount, ', not converged =', it.linearSolverNonConvergedCount)
+        if it.linearSolverIterationsCount == 0 or it.preconditionerCount == 0: #statistics must be available
+            return None
+    return np.array(mbs.systemData.GetODE2Coordinates())
+
+#solutions differ from direct solver within Newton tolerance:
+diffTolerance = 1e-7
+def SolutionError(u, uRef):
+    if u is None: return 1
+    return max(0, np.linalg.norm(u - uRef) - diffTolerance)
+
+testError = 0
+#symmetric positive definite stiffness matrix (static, no constraint): all Krylov methods
+mbs.Reset()
+CreateModel(mbs, False)
+uRef = Solve(exu.LinearSolverType.EigenSparse, True)
+exu.Print('static tip displacement (y) =', uRef[-1])
+for solverType, precType in [(exu.IterativeSolverType.CG, exu.PreconditionerType.Jacobi), 
+                             (exu.IterativeSolverType.CG, exu.PreconditionerType.ILU0),
+                             (exu.IterativeSolverType.GMRES, exu.PreconditionerType.BlockJacobi),
+                             (exu.IterativeSolverType.BiCGSTAB, exu.PreconditionerType.ILU0)]:
+    u = Solve(exu.LinearSolverType.EigenSparseIterative, True, solverType, precType)
+    testError += SolutionError(u, uRef)
+
+#constrained (indefinite) system, static and dynamic: GMRES and BiCGSTAB
+mbs.Reset()
+CreateModel(mbs, True)
+for static in [True, False]:
+    uRef = Solve(exu.LinearSolverType.EigenSparse, static)
+    for solverType, precType in [(exu.IterativeSolverType.GMRES, exu.PreconditionerType.ILU0), 
+                                 (exu.IterativeSolverType.GMRES, exu.PreconditionerType._None),
+                                 (exu.IterativeSolverType.BiCGSTAB, exu.PreconditionerType.ILU0)]:
+        u = Solve(exu.LinearSolverType.EigenSparseIterative, static, solverType, precType)
+        testError += SolutionError(u, uRef)
+
+exu.Print('iterative linear solver: error =', testError)
+exudynTestGlobals.testError = testError
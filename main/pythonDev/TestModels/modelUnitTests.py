@@ -127,16 +127,16 @@ def ANCFCable2DBendingTest(mbs, testInterface):
     sol = mbs.systemData.GetODE2Coordinates(); n = len(sol)
     #tip displacements:
     u = sol[n-4];v = sol[n-3] #15.12.2019:(-1.040678127615946 -1.444419986874761); 20.10.2019: (-1.0406781266430292 -1.4444199866881322); 17.10.2019: sol= -1.040678126647053 -1.4444199866858678; #28.7.2009: -1.040678126643273, -1.444419986688082
-    totalError += u+v - (-1.0391620828192676 -1.4443521331339881)  ###2019-12-26: (-1.0391620828192676 -1.4443521331339881) old (before correct initial accelerations): (-1.040678127615946 -1.444419986874761)
+    totalError += u+v - (-1.0391620828192856 -1.444352133133994)  ###2026-10-18(LU factorization in dense solver; change 2e-14, EigenSparse: (-1.0391620828192627 -1.444352133133997)): (-1.0391620828192856 -1.444352133133994); 2019-12-26: (-1.0391620828192676 -1.4443521331339881) old (before correct initial accelerations): (-1.040678127615946 -1.444419986874761)
     testInterface.exu.Print('sol dynamic=',u,v)
     #testInterface.exu.Print('time integration error =',totalError)
 
     testInterface.exu.SolveStatic(mbs, simulationSettings)
 
     sol = mbs.systemData.GetODE2Coordinates(); n = len(sol)
-    u = sol[n-4]; v = sol[n-3]; #20.10.2019: -0.3622447299987188 -0.9941447593196007; 17.10.2019: sol= -0.3622447299990847 -0.9941447593206921; #28.7.2019: -0.3622447300008477, -0.994144759326213
+    u = sol[n-4]; v = sol[n-3]; #2026-10-18(LU factorization in dense solver; change 1e-12, limited by Newton tolerance; EigenSparse differs by 6.5e-12: -0.3622447299997464 -0.9941447593250934): -0.3622447299990053 -0.9941447593202782; 20.10.2019: -0.3622447299987188 -0.9941447593196007; 17.10.2019: sol= -0.3622447299990847 -0.9941447593206921; #28.7.2019: -0.3622447300008477, -0.994144759326213
     testInterface.exu.Print('sol static (standardTol)=',u,v)
-    totalError += u+v - (-0.3622447299987188 -0.9941447593196007)
+    totalError += u+v - (-0.3622447299990053 -0.9941447593202782)
 
     simulationSettings.staticSolver.newton.relativeTolerance = 1e-14 #in order to converge to MATLAB results
     simulationSettings.staticSolver.newton.absoluteTolerance = 1e-14
@@ -145,9 +145,9 @@ def ANCFCable2DBendingTest(mbs, testInterface):
 
     sol = mbs.systemData.GetODE2Coordinates(); n = len(sol)
     #tip displacements: paper GerstmIschrik2008: 1Element: u=-0.362244729891,  v=-0.994144758725; 4 Elements: 0.507428715119 1.205533702233
-    u = sol[n-4]; v = sol[n-3];                 #2019-12-17: -0.3622447298904951 -0.9941447587249616
+    u = sol[n-4]; v = sol[n-3];                 #2026-10-18(LU factorization in dense solver; change 1e-17): -0.36224472989049517 -0.9941447587249616; 2019-12-17: -0.3622447298904951 -0.9941447587249616
     testInterface.exu.Print('sol static (tol=1e-14)=',u,v)
-    totalError += u+v - (-0.3622447298904951 -0.9941447587249616)
+    totalError += u+v - (-0.36224472989049517 -0.9941447587249616)
 
     
     #totalError -= -1.3563894893270607-2.4850981133313548 #reference solution with one element and standard settings except: gen-alpha=0.6, useModifiedNewton = False
@@ -486,7 +486,7 @@ def SliderCrank2DTest(mbs, testInterface):
     testInterface.exu.SolveDynamic(mbs, simulationSettings)
 
     u = mbs.GetNodeOutput(nMass, testInterface.exu.OutputVariableType.Position) #tip node
-    errorSliderCrankIndex3 = u[0] - 1.353298442702153 #2019-12-26: 1.353298442702153; 15.12.2019: 1.3513750614337234; before 15.12.2019: 1.3513750614326427 #2019-11-22; previous: 1.3513750614331235 #x-position of slider
+    errorSliderCrankIndex3 = u[0] - 1.3532984427020112 #2026-10-18(LDLT factorization of symmetric indefinite jacobian in dense solver; change 1.4e-13, LU: 1.3532984427022439, EigenSparse: 1.353298442702161): 1.3532984427020112; 2019-12-26: 1.353298442702153; 15.12.2019: 1.3513750614337234; before 15.12.2019: 1.3513750614326427 #2019-11-22; previous: 1.3513750614331235 #x-position of slider
     testInterface.exu.Print('solution SliderCrankIndex3  =',u[0])
     testInterface.exu.Print('error errorSliderCrankIndex3=',errorSliderCrankIndex3)
 
@@ -645,7 +645,7 @@ def SlidingJoint2DTest(mbs, testInterface):
     error = 0
     if nRigid != -1:
         u = mbs.GetNodeOutput(nRigid, testInterface.exu.OutputVariableType.Position) #tip node
-        error = u[1] - (-0.14920151345936586) #2019-12-26: -0.14920151345936586; 15.12.2019: (-0.1489879442762764); before 15.12.2019: (-0.14898795617249422) #2019-11-22; #20.10.2019: (-0.1489879501348149); 17.10.2019:-0.14898795468724652; old? :(-0.14898795002032308) #old error before projected sliding joint: (-0.14898792622401774) #y-position of COM of sliding body
+        error = u[1] - (-0.1492015119966799) #2026-10-18(LU factorization in dense solver; change 1.5e-9, limited by Newton tolerance; EigenSparse differs by 4.6e-10 from old and 1.9e-9 from new value: -0.14920151392036463): -0.1492015119966799; 2019-12-26: -0.14920151345936586; 15.12.2019: (-0.1489879442762764); before 15.12.2019: (-0.14898795617249422) #2019-11-22; #20.10.2019: (-0.1489879501348149); 17.10.2019:-0.14898795468724652; old? :(-0.14898795002032308) #old error before projected sliding joint: (-0.14898792622401774) #y-position of COM of sliding body
                         
         testInterface.exu.Print('value SlidingJoint2DTest=',u[1])
         #testInterface.exu.Print('error SlidingJoint2DTest=',error)
@@ -702,7 +702,7 @@ def CartesianSpringDamperTest(mbs, testInterface):
 
     u = mbs.GetNodeOutput(n1, testInterface.exu.OutputVariableType.Position)
     uCartesianSpringDamper= u[0] - L
-    errorCartesianSpringDamper = uCartesianSpringDamper - 0.011834933407594783 #15.12.2019: 0.011834933407594783; beofre 15.12.2019: 0.011834933407038783 #for 1000 steps, endtime=1; accurate up to 3e-6 to exact solution
+    errorCartesianSpringDamper = uCartesianSpringDamper - 0.011834933406129955 #2026-10-18(LU factorization in dense solver; change 1.5e-12; EigenSparse: 0.011834933407793846): 0.011834933406129955; 15.12.2019: 0.011834933407594783; beofre 15.12.2019: 0.011834933407038783 #for 1000 steps, endtime=1; accurate up to 3e-6 to exact solution
     testInterface.exu.Print('solution cartesianSpringDamper=',uCartesianSpringDamper)
 
     return abs(errorCartesianSpringDamper)
@@ -768,7 +768,7 @@ def CoordinateSpringDamperTest(mbs, testInterface):
     
     u = mbs.GetNodeOutput(n1, testInterface.exu.OutputVariableType.Position)
     uCoordinateSpringDamper= u[0] - L
-    errorCoordinateSpringDamper = uCoordinateSpringDamper - 0.011834933406690284 #15.12.2019: 0.011834933406690284; beofre 15.12.2019: 0.011834933407047 #for 1000 steps, endtime=1; this is different from CartesianSpringDamper because of offset L (rounding errors around 1e-14)
+    errorCoordinateSpringDamper = uCoordinateSpringDamper - 0.011834933406448811 #2026-10-18(LU factorization in dense solver; change 2.4e-13; EigenSparse: 0.011834933407240289): 0.011834933406448811; 15.12.2019: 0.011834933406690284; beofre 15.12.2019: 0.011834933407047 #for 1000 steps, endtime=1; this is different from CartesianSpringDamper because of offset L (rounding errors around 1e-14)
 
     testInterface.exu.Print('solution CoordinateSpringDamper=',uCoordinateSpringDamper)
     return abs(errorCoordinateSpringDamper)
@@ -0,0 +1,89 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for parameter handles: stiffness of springs and load vectors of a mass point chain
+#           are modified in a pre-step user function with mbs.SetParameters(handle, ...); the solution must be
+#           identical to the same modification with SetObjectParameter/SetLoadParameter item by item
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#chain of mass points with springs and loads
+nMasses = 20
+oGround = mbs.AddObject(ObjectGround())
+mGround = mbs.AddMarker(MarkerBodyPosition(bodyNumber=oGround))
+nodes = mbs.AddNodes(NodePoint(), {'referenceCoordinates': np.array([[i+1.,0,0] for i in range(nMasses)])})
+mbs.AddObjects(MassPoint(physicsMass=1), {'nodeNumber': np.array(nodes)})
+markers = mbs.AddMarkers(MarkerNodePosition(), {'nodeNumber': np.array(nodes)})
+markerPairs = np.array([[int(mGround)]+list(markers)[0:-1], list(markers)]).T
+springs = np.array(mbs.AddObjects(SpringDamper(referenceLength=1, stiffness=1000, damping=1), {'markerNumbers': markerPairs}))
+loads = np.array(mbs.AddLoads(Force(loadVector=[0,-10,0]), {'markerNumber': np.array(markers)}))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 200
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+hStiffness = mbs.GetParameterHandle('Object', 'stiffness')
+hLoad = mbs.GetParameterHandle('Load', 'loadVector')
+
+testError = 0
+testError += np.linalg.norm(mbs.GetParameters(hStiffness, springs) - 1000)
+testError += np.linalg.norm(mbs.GetParameters(hLoad, loads) - np.array([[0,-10,0]]*nMasses))
+
+#stiffness and loads change with time
+def StiffnessValues(t):
+    return 1000 + 500*np.sin(20*t)*np.linspace(0,1,nMasses)
+def LoadValues(t):
+    return np.array([[5*t,-10,0]]*nMasses)
+
+def PreStepHandles(mbs, t):
+    mbs.SetParameters(hStiffness, springs, StiffnessValues(t))
+    mbs.SetParameters(hLoad, loads, LoadValues(t))
+    return True
+
+def PreStepItems(mbs, t):
+    stiffness = StiffnessValues(t)
+    loadVectors = LoadValues(t)
+    for i in range(nMasses):
+        mbs.SetObjectParameter(int(springs[i]), 'stiffness', stiffness[i])
+        mbs.SetLoadParameter(int(loads[i]), 'loadVector', list(loadVectors[i]))
+    return True
+
+mbs.SetParameters(hStiffness, springs, StiffnessValues(0))
+mbs.SetParameters(hLoad, loads, LoadValues(0))
+mbs.SetPreStepUserFunction(PreStepHandles)
+exu.SolveDynamic(mbs, simulationSettings)
+uHandles = np.array(mbs.systemData.GetODE2Coordinates())
+t = mbs.systemData.GetTime()
+testError += np.linalg.norm(mbs.GetParameters(hStiffness, springs) - StiffnessValues(t))
+
+#same initial parameters in both simulations
+mbs.SetParameters(hStiffness, springs, StiffnessValues(0))
+mbs.SetParameters(hLoad, loads, LoadValues(0))
+mbs.SetPreStepUserFunction(PreStepItems)
+exu.SolveDynamic(mbs, simulationSettings)
+uItems = np.array(mbs.systemData.GetODE2Coordinates())
+
+testError += np.linalg.norm(uHandles - uItems)
+exu.Print('u handles =', uHandles[-3:])
+exu.Print('parameter handles test error =', testError)
+exudynTestGlobals.testError = testError
@@ -158,6 +158,16 @@ exu.Print('solution of rigidBodyCOMtest=',u)
 
 exudynTestGlobals.testError = u - (3.409431467726293) #2020-04-22: 3.409431467726293
 
+#analytic (automatic differentiation) jacobians of rigid bodies with Euler parameters:
+simulationSettings.timeIntegration.newton.numericalDifferentiation.useAnalyticJacobians = True
+exu.SolveDynamic(mbs, simulationSettings)
+
+p0=mbs.GetObjectOutputBody(objectList[0], exu.OutputVariableType.Displacement, mbs.GetObject(objectList[0])['physicsCenterOfMass'])
+p1=mbs.GetObjectOutputBody(objectList[1], exu.OutputVariableType.Displacement, mbs.GetObject(objectList[1])['physicsCenterOfMass'])
+uAnalytic=NormL2(p0) + NormL2(p1)
+exu.Print('solution of rigidBodyCOMtest, analytic jacobians=',uAnalytic)
+exudynTestGlobals.testError += uAnalytic-u #only differences within Newton tolerance expected
+
 
 if exudynTestGlobals.useGraphics:
     SC.WaitForRenderEngineStopFlag()
@@ -141,6 +141,21 @@ testFileList = [
                 'rollingCoinTest.py',
                 'rollingCoinPenaltyTest.py',
                 'mecanumWheelRollingDiscTest.py',
+                'explicitRungeKuttaTest.py',
+                'binarySolutionFileTest.py',
+                'sensorStoreInternalTest.py',
+                'constantMassMatrixTest.py',
+                'iterativeLinearSolverTest.py',
+                'sparseEigenvalueSolverTest.py',
+                'batchSolverTest.py',
+                'stepwiseSolverTest.py',
+                'vectorizedSystemsTest.py',
+                'bulkItemCreationTest.py',
+                'parameterHandlesTest.py',
+                'stateViewTest.py',
+                'checkpointTest.py',
+                'contactBroadPhaseTest.py',
+                'contactSpheresTriangleMeshTest.py',
                 ]
 
 
@@ -0,0 +1,86 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for internal storage of sensor values (storeInternal=True);
+#           stored data of node and object sensors is compared to sensor files
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#mass-spring-damper with sensors writing to file and to internal storage
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(Point(referenceCoordinates=[1,0,0], initialCoordinates=[0.1,0,0], initialVelocities=[0,2,0]))
+mbs.AddObject(MassPoint(physicsMass=2, nodeNumber=n0))
+mNode = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+oSpring = mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, mNode], stiffness=400, damping=2))
+
+fileNode = 'solution/sensorStoreInternalNode.txt'
+fileSpring = 'solution/sensorStoreInternalSpring.txt'
+sNode = mbs.AddSensor(SensorNode(nodeNumber=n0, fileName=fileNode, storeInternal=True,
+                                 outputVariableType=exu.OutputVariableType.Position))
+sSpring = mbs.AddSensor(SensorObject(objectNumber=oSpring, fileName=fileSpring, storeInternal=True,
+                                     outputVariableType=exu.OutputVariableType.Force))
+sOnlyMemory = mbs.AddSensor(SensorNode(nodeNumber=n0, writeToFile=False, storeInternal=True,
+                                       outputVariableType=exu.OutputVariableType.Velocity))
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.timeIntegration.verboseMode = 1
+simulationSettings.solutionSettings.writeSolutionToFile = False
+simulationSettings.solutionSettings.sensorsWritePeriod = 0.005
+simulationSettings.solutionSettings.outputPrecision = 17 #text file exactly represents double values
+
+exu.SolveDynamic(mbs, simulationSettings)
+
+dataNode = mbs.GetSensorStoredData(sNode)
+dataSpring = mbs.GetSensorStoredData(sSpring)
+dataVelocity = mbs.GetSensorStoredData(sOnlyMemory)
+
+fileDataNode = np.loadtxt(fileNode, comments='#', delimiter=',')
+fileDataSpring = np.loadtxt(fileSpring, comments='#', delimiter=',')
+exu.Print('stored sensor data shape =', dataNode.shape, ', sensor file shape =', fileDataNode.shape)
+
+testError = 0
+if dataNode.shape != fileDataNode.shape or dataSpring.shape != fileDataSpring.shape:
+    testError += 1
+else:
+    testError += np.max(abs(dataNode - fileDataNode))
+    testError += np.max(abs(dataSpring - fileDataSpring))
+
+#stored data is a read-only view on sensor memory:
+if dataNode.flags.writeable or dataNode.flags.owndata: testError += 1
+
+#final velocity of memory-only sensor equals current node velocity:
+velocity = mbs.GetNodeOutput(n0, exu.OutputVariableType.Velocity)
+exu.Print('stored velocity =', dataVelocity[-1,1:], ', node velocity =', velocity)
+testError += np.linalg.norm(dataVelocity[-1,1:] - velocity)
+testError += abs(dataVelocity[-1,0] - simulationSettings.timeIntegration.endTime)
+
+#array keeps memory of previous simulation alive, if sensor storage is re-initialized and system is reset:
+dataNodeCopy = np.array(dataNode)
+exu.SolveDynamic(mbs, simulationSettings)
+mbs.Reset()
+testError += np.max(abs(dataNode - dataNodeCopy))
+
+exudynTestGlobals.testError = testError
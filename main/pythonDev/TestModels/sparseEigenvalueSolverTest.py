@@ -0,0 +1,79 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for internal sparse eigenvalue solver; lowest eigenvalues of a spring-mass chain
+#           computed with ComputeODE2Eigenvalues(useSparseSolver=True, useInternalSparseSolver=True) are compared to dense eigenvalues;
+#           ComputeSparseEigenvalues and ComputeSparseGyroscopicEigenvalues are tested with matrices in sparse triplet format
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#chain of mass points, coupled by springs in x-direction and supported by springs in y-direction
+nMasses = 20
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGroundX = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+mGroundY = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=1))
+mLast = mGroundX
+for i in range(nMasses):
+    n = mbs.AddNode(NodePoint2D(referenceCoordinates=[i+1,0]))
+    mbs.AddObject(MassPoint2D(physicsMass=1+0.1*i, nodeNumber=n))
+    mX = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n, coordinate=0))
+    mY = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n, coordinate=1))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mLast, mX], stiffness=1000))
+    mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGroundY, mY], stiffness=200+10*i))
+    mLast = mX
+
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.linearSolverType = exu.LinearSolverType.EigenSparse
+
+nEigenvalues = 6
+[valuesDense, vectorsDense] = exu.ComputeODE2Eigenvalues(mbs)
+[valuesSparse, vectorsSparse] = exu.ComputeODE2Eigenvalues(mbs, simulationSettings, useSparseSolver=True,
+                                                           numberOfEigenvalues=nEigenvalues, useInternalSparseSolver=True)
+exu.Print('dense eigenvalues  =', valuesDense[0:nEigenvalues])
+exu.Print('sparse eigenvalues =', valuesSparse)
+
+testError = 0
+#relative accuracy of numerical jacobian is approx. 1e-8:
+testError += max(0, np.max(abs(valuesSparse - valuesDense[0:nEigenvalues]))/valuesDense[nEigenvalues] - 1e-6)
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#fixed-free chain given by sparse triplets [row, column, value]: lambda_k = 2-2*cos((2k-1)*pi/(2n+1))
+n = 50
+K = [[i, i, 2.] for i in range(n-1)] + [[n-1, n-1, 1.]]
+K += [[i, i+1, -1.] for i in range(n-1)] + [[i+1, i, -1.] for i in range(n-1)]
+M = [[i, i, 1.] for i in range(n)]
+[values, vectors] = exu.ComputeSparseEigenvalues(np.array(K), np.array(M), nEigenvalues)
+valuesRef = 2-2*np.cos((2*np.arange(1,nEigenvalues+1)-1)*np.pi/(2*n+1))
+exu.Print('chain eigenvalues  =', values)
+testError += np.max(abs(values - valuesRef))
+testError += np.linalg.norm(vectors.T @ vectors - np.eye(nEigenvalues)) #mass-normalized with M=I
+
+#isotropic rotor (lambda^2*M + lambda*omega*G + K)*phi = 0, K=4*I, G=[[0,-1],[1,0]], omega=3: lambda = +-1j, +-4j
+K = np.array([[0, 0, 4.], [1, 1, 4.]])
+G = np.array([[0, 1, -1.], [1, 0, 1.]])
+M = np.array([[0, 0, 1.], [1, 1, 1.]])
+[values, vectors] = exu.ComputeSparseGyroscopicEigenvalues(K, G, M, 3., 2)
+exu.Print('rotor eigenvalues  =', values)
+testError += np.max(abs(np.sort(values.imag) - np.array([-1.,1.]))) + np.max(abs(values.real))
+
+exudynTestGlobals.testError = testError
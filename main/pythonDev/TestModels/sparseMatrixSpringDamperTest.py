@@ -103,6 +103,45 @@ exu.Print('static tip displacement (y)=', u[1])
 exudynTestGlobals.testError = u[1]-(-6.779862983766792) #72 x 6 bodies; CPUtime surface: 0.029 seconds
 exudynTestGlobals.testError *= 1e-2 #32bit version shows 2.1e-12 error
 
+#sparse solver with reuse of analyzed sparsity pattern; must give identical results:
+simulationSettings.linearSolverSettings.reuseAnalyzedPattern = True
+exu.SolveStatic(mbs, simulationSettings)
+
+uReuse = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement, reuse pattern (y)=', uReuse[1])
+exu.Print('pattern analyses/reused:', mbs.sys['staticSolver'].it.patternAnalysisCount, '/', mbs.sys['staticSolver'].it.patternReuseCount)
+exudynTestGlobals.testError += uReuse[1]-u[1] #no difference expected
+
+#sparse solver with fixed-pattern assembly (values added in place into sparse matrix):
+simulationSettings.linearSolverSettings.fixedPatternAssembly = True
+exu.SolveStatic(mbs, simulationSettings)
+
+uFixed = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement, fixed pattern (y)=', uFixed[1])
+exudynTestGlobals.testError += uFixed[1]-u[1] #only round-off differences expected
+
+#system wide numerical differentiation with column compression (also for constraint jacobian):
+simulationSettings.staticSolver.newton.useNumericalDifferentiation = True
+simulationSettings.staticSolver.newton.numericalDifferentiation.doSystemWideDifferentiation = True
+simulationSettings.staticSolver.newton.numericalDifferentiation.useColumnCompression = True
+simulationSettings.linearSolverType = exu.LinearSolverType.EXUdense #numerical constraint jacobian requires dense matrix
+exu.SolveStatic(mbs, simulationSettings)
+
+uCompressed = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement, column compression (y)=', uCompressed[1])
+exudynTestGlobals.testError += uCompressed[1]-u[1] #only differences within Newton tolerance expected
+
+#analytic jacobians of spring-dampers (object-local):
+simulationSettings.staticSolver.newton.numericalDifferentiation.doSystemWideDifferentiation = False
+simulationSettings.staticSolver.newton.numericalDifferentiation.useColumnCompression = False
+simulationSettings.staticSolver.newton.numericalDifferentiation.useAnalyticJacobians = True
+simulationSettings.linearSolverType = exu.LinearSolverType.EXUdense #numerical constraint jacobian requires dense matrix
+exu.SolveStatic(mbs, simulationSettings)
+
+uAnalytic = mbs.GetNodeOutput(nBodies-2, exu.OutputVariableType.Position) #tip node
+exu.Print('static tip displacement, analytic jacobians (y)=', uAnalytic[1])
+exudynTestGlobals.testError += uAnalytic[1]-(-6.779862812271383) #2026-10-18: -6.779862812271383; converges further than with numerical jacobians (difference 1.7e-7 within Newton tolerance)
+
 if exudynTestGlobals.useGraphics: 
     SC.WaitForRenderEngineStopFlag()
     exu.StopRenderer() 
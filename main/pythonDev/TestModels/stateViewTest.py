@@ -0,0 +1,93 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for zero-copy views on system state vectors (mbs.systemData.GetODE2CoordinatesView(), ...):
+#           views are read and written in place and compared to copying functions Get/SetODE2Coordinates;
+#           views must become invalid after Assemble(); arrays obtained from views before Assemble() must still be readable;
+#           views on the visualization state are refused
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs, force on second mass
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+n1 = mbs.AddNode(Node1D(referenceCoordinates=[1], initialCoordinates=[0], initialVelocities=[0.2]))
+mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n0))
+mbs.AddObject(Mass1D(physicsMass=2, nodeNumber=n1))
+m0 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+m1 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0], stiffness=100, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0, m1], stiffness=50, damping=0.2))
+mbs.AddLoad(LoadCoordinate(markerNumber=m1, load=2))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.2
+simulationSettings.timeIntegration.numberOfSteps = 100
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+testError = 0
+#views link to system state: read and write in place
+uView = mbs.systemData.GetODE2CoordinatesView()
+vView = mbs.systemData.GetODE2Coordinates_tView()
+u = np.asarray(uView) #no copy
+testError += np.linalg.norm(u - mbs.systemData.GetODE2Coordinates())
+testError += abs(len(vView) - 2) + abs(len(mbs.systemData.GetAECoordinatesView()))
+
+vView[:] = [0.3, -0.1]
+u[1] = 0.05
+testError += np.linalg.norm(mbs.systemData.GetODE2Coordinates_t() - [0.3, -0.1])
+testError += abs(mbs.systemData.GetODE2Coordinates()[1] - 0.05) + abs(uView[1] - 0.05)
+
+#initial conditions set with views and with copying functions must give same solution
+uInitView = mbs.systemData.GetODE2CoordinatesView(exu.ConfigurationType.Initial)
+uInitView[:] = [0.2, 0.1]
+exu.SolveDynamic(mbs, simulationSettings)
+uSolView = np.array(mbs.systemData.GetODE2Coordinates())
+testError += np.linalg.norm(uView[:] - uSolView) #view still links to current coordinates
+
+mbs.systemData.SetODE2Coordinates([0.2, 0.1], exu.ConfigurationType.Initial)
+exu.SolveDynamic(mbs, simulationSettings)
+testError += np.linalg.norm(mbs.systemData.GetODE2Coordinates() - uSolView)
+exu.Print('u =', uSolView)
+
+#views become invalid after Assemble()
+version = mbs.systemData.GetStateVersion()
+testError += 1 - uView.IsValid()
+mbs.Assemble()
+testError += abs(mbs.systemData.GetStateVersion() - version - 1) + uView.IsValid() + uInitView.IsValid()
+testError += 1 - mbs.systemData.GetODE2CoordinatesView().IsValid()
+
+#arrays obtained before Assemble() keep the memory of the old state alive, but are not linked to the system state anymore
+testError += np.linalg.norm(u - uSolView)
+u[0] = 1000.
+testError += (mbs.systemData.GetODE2Coordinates()[0] == 1000.)
+
+#views on visualization state are not available, as the renderer swaps the visualization state buffers
+try:
+    mbs.systemData.GetODE2CoordinatesView(exu.ConfigurationType.Visualization)
+    testError += 1
+except:
+    pass
+
+exu.Print('state view test error =', testError)
+exudynTestGlobals.testError = testError
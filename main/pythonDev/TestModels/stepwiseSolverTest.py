@@ -0,0 +1,79 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for stepwise time integration with solver.Advance(...): the solver is initialized once
+#           and advanced by a control period repeatedly; results must be identical to SolveSystem(...) with
+#           the same step size; a second run changes a load between calls (control in the loop)
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs, force on second mass
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+n1 = mbs.AddNode(Node1D(referenceCoordinates=[1], initialCoordinates=[0], initialVelocities=[0.2]))
+mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n0))
+mbs.AddObject(Mass1D(physicsMass=2, nodeNumber=n1))
+m0 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+m1 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0], stiffness=100, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0, m1], stiffness=50, damping=0.2))
+lForce = mbs.AddLoad(LoadCoordinate(markerNumber=m1, load=2))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.endTime = 0.5
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.timeIntegration.adaptiveStep = False
+simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType = exu.DynamicSolverType.RK4
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+controlPeriod = 0.01
+nPeriods = int(simulationSettings.timeIntegration.endTime/controlPeriod)
+
+testError = 0
+for solver in [exu.MainSolverImplicitSecondOrder(), exu.MainSolverExplicit()]:
+    #reference: solve complete time interval
+    solver.SolveSystem(mbs, simulationSettings)
+    uRef = np.array(mbs.systemData.GetODE2Coordinates())
+
+    #stepwise solution with same step size
+    for i in range(nPeriods):
+        solver.Advance(mbs, simulationSettings, controlPeriod)
+    solver.FinalizeSolver(mbs, simulationSettings)
+    u = np.array(mbs.systemData.GetODE2Coordinates())
+    t = mbs.systemData.GetTime()
+    exu.Print('Advance: t =', t, ', u =', u, ', diff =', np.linalg.norm(u-uRef))
+    testError += np.linalg.norm(u-uRef) + abs(t-simulationSettings.timeIntegration.endTime)
+
+#control in the loop: P-controller force on second mass, updated after every control period
+solver = exu.MainSolverImplicitSecondOrder()
+for i in range(nPeriods):
+    u1 = mbs.GetNodeOutput(n1, exu.OutputVariableType.Coordinates) #scalar for Node1D
+    mbs.SetLoadParameter(lForce, 'load', -20*u1)
+    solver.Advance(mbs, simulationSettings, controlPeriod)
+solver.FinalizeSolver(mbs, simulationSettings)
+exu.Print('controlled: u =', mbs.systemData.GetODE2Coordinates())
+
+mbs.SetLoadParameter(lForce, 'load', 2)
+
+exu.Print('stepwise solver test error =', testError)
+exudynTestGlobals.testError = testError
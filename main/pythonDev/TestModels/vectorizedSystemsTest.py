@@ -0,0 +1,87 @@
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+# This is an EXUDYN example
+#
+# Details:  Test model for exu.VectorizedSystems: copies of a mass-spring-damper are advanced in lockstep
+#           with different force actions (P-controller per copy); observations must be identical to
+#           stepwise solution of the original system with solver.Advance(...)
+#
+# Author:   agent
+# Date:     2026-10-18
+#
+# Copyright:This file is part of Exudyn. Exudyn is free software. You can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+#
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+import sys
+sys.path.append('../TestModels')            #for modelUnitTest as this example may be used also as a unit test
+
+import exudyn as exu
+from exudyn.itemInterface import *
+
+from modelUnitTests import ExudynTestStructure, exudynTestGlobals
+
+import numpy as np
+
+SC = exu.SystemContainer()
+mbs = SC.AddSystem()
+
+#+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#two masses coupled by springs, force (action) on second mass
+nGround = mbs.AddNode(NodePointGround(referenceCoordinates=[0,0,0]))
+mGround = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = nGround, coordinate=0))
+n0 = mbs.AddNode(Node1D(referenceCoordinates=[0], initialCoordinates=[0.1], initialVelocities=[0]))
+n1 = mbs.AddNode(Node1D(referenceCoordinates=[1], initialCoordinates=[0], initialVelocities=[0.2]))
+mbs.AddObject(Mass1D(physicsMass=1, nodeNumber=n0))
+mbs.AddObject(Mass1D(physicsMass=2, nodeNumber=n1))
+m0 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n0, coordinate=0))
+m1 = mbs.AddMarker(MarkerNodeCoordinate(nodeNumber = n1, coordinate=0))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[mGround, m0], stiffness=100, damping=0.5))
+mbs.AddObject(CoordinateSpringDamper(markerNumbers=[m0, m1], stiffness=50, damping=0.2))
+lForce = mbs.AddLoad(LoadCoordinate(markerNumber=m1, load=0))
+sPos1 = mbs.AddSensor(SensorNode(nodeNumber=n1, writeToFile=False, outputVariableType=exu.OutputVariableType.Coordinates))
+sVel1 = mbs.AddSensor(SensorNode(nodeNumber=n1, writeToFile=False, outputVariableType=exu.OutputVariableType.Coordinates_t))
+mbs.Assemble()
+
+simulationSettings = exu.SimulationSettings()
+simulationSettings.timeIntegration.numberOfSteps = 500
+simulationSettings.timeIntegration.endTime = 0.5 #step size = 0.001
+simulationSettings.timeIntegration.adaptiveStep = False
+simulationSettings.solutionSettings.writeSolutionToFile = False
+
+nCopies = 6
+gains = np.array([5.*i for i in range(nCopies)]) #different controller per copy
+controlPeriod = 0.01
+nPeriods = 20
+
+testError = 0
+for solverType in [exu.DynamicSolverType.GeneralizedAlpha, exu.DynamicSolverType.RK4]:
+    vs = exu.VectorizedSystems()
+    vs.Initialize(mbs, nCopies, simulationSettings, [['Load', lForce, 'load']], sensorNumbers=[sPos1, sVel1],
+                  solverType=solverType, numberOfThreads=4)
+    observations = vs.Reset()
+    for i in range(nPeriods):
+        actions = np.array([-gains*observations[:,0]]).T
+        observations = vs.Step(actions, controlPeriod)
+    testError += np.max(abs(vs.GetTimes() - nPeriods*controlPeriod))
+
+    #sequential reference solution of every copy with original system
+    simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType = solverType
+    for k in range(nCopies):
+        mbs.Assemble()
+        solver = exu.MainSolverImplicitSecondOrder()
+        if solverType == exu.DynamicSolverType.RK4:
+            solver = exu.MainSolverExplicit()
+        for i in range(nPeriods):
+            u1 = mbs.GetSensorValues(sPos1) #scalar for Node1D
+            mbs.SetLoadParameter(lForce, 'load', -gains[k]*u1)
+            solver.Advance(mbs, simulationSettings, controlPeriod)
+        solver.FinalizeSolver(mbs, simulationSettings)
+        observationsRef = np.hstack([mbs.GetSensorValues(sPos1), mbs.GetSensorValues(sVel1)])
+        testError += np.linalg.norm(observations[k] - observationsRef)
+
+    exu.Print('vectorized systems', solverType, ': observations =', observations[:,0])
+
+mbs.SetLoadParameter(lForce, 'load', 0)
+mbs.Assemble()
+
+exu.Print('vectorized systems test error =', testError)
+exudynTestGlobals.testError = testError
@@ -1694,23 +1694,33 @@ class FEMinterface:
             
     #**classFunction: get gyroscopic matrix in according format; rotationAxis=[0,1,2] = [x,y,z]
     def GetGyroscopicMatrix(self, rotationAxis=2, sparse=True):
+        #create gyroscopic terms
+        if rotationAxis == 0:
+            X=np.array([[ 0.,  0.,  0.],
+                        [ 0.,  0., -1.],
+                        [ 0.,  1.,  0.]])
+        elif rotationAxis == 1:
+            X=np.array([[ 0.,  0.,  1.],
+                        [ 0.,  0.,  0.],
+                        [-1.,  0.,  0.]])
+        elif rotationAxis == 2:
+            X=np.array([[ 0., -1.,  0.],
+                        [ 1.,  0.,  0.],
+                        [ 0.,  0.,  0.]])
         if sparse:
-            raise ValueError("GetGyroscopicMatrix: not implemented for sparse matrices!")
+            #G = blockdiag(X)*M: row 3*i+j of G is X[j,k]*(row 3*i+k of M); X has one non-zero entry per row
+            M = self.massMatrix
+            localRow = M[:,0].astype(int) % 3
+            sparseG = []
+            for j in range(3):
+                for k in range(3):
+                    if X[j,k] != 0:
+                        entries = M[localRow == k]
+                        sparseG += [np.column_stack((entries[:,0]-k+j, entries[:,1], X[j,k]*entries[:,2]))]
+            G = np.vstack(sparseG)
+            return G[np.lexsort((G[:,1], G[:,0]))] #sorted by rows and columns
         else:
-            #create gyroscopic terms
             nNodes = self.NumberOfNodes()
-            if rotationAxis == 0:
-                X=np.array([[ 0.,  0.,  0.],
-                            [ 0.,  0., -1.],
-                            [ 0.,  1.,  0.]])
-            elif rotationAxis == 1:
-                X=np.array([[ 0.,  0.,  1.],
-                            [ 0.,  0.,  0.],
-                            [-1.,  0.,  0.]])
-            elif rotationAxis == 2:
-                X=np.array([[ 0., -1.,  0.],
-                            [ 1.,  0.,  0.],
-                            [ 0.,  0.,  0.]])
             xBlock = np.kron(np.eye(nNodes), X) #create big block-diagonal matrix
             G=np.dot(xBlock,CompressedRowSparseToDenseMatrix(self.massMatrix))
 
@@ -1763,7 +1773,8 @@ class FEMinterface:
     #**classFunction: compute nModes smallest eigenvalues and eigenmodes from mass and stiffnessMatrix
     #store mode vector in modeBasis, but exclude a number of 'excludeRigidBodyModes' rigid body modes from modeBasis
     #if excludeRigidBodyModes > 0, then the computed modes is nModes + excludeRigidBodyModes, from which excludeRigidBodyModes smallest eigenvalues are excluded
-    def ComputeEigenmodes(self, nModes, excludeRigidBodyModes = 0, useSparseSolver = True):
+    #useSparseSolver uses scipy.sparse.linalg.eigsh; if useInternalSparseSolver=True, the internal sparse shift-invert Lanczos solver (exudyn.ComputeSparseEigenvalues) is used instead
+    def ComputeEigenmodes(self, nModes, excludeRigidBodyModes = 0, useSparseSolver = True, useInternalSparseSolver = False):
         if not useSparseSolver:
             #unsorted, dense eigen vectors
             from scipy.linalg import solve, eigh, eig #eigh for symmetric matrices, positive definite
@@ -1774,6 +1785,17 @@ class FEMinterface:
             [eigVals, eigVecs] = eigh(K,M) #this gives omega^2 ... squared eigen frequencies (rad/s)
             self.modeBasis = {'matrix':eigVecs[:,excludeRigidBodyModes:excludeRigidBodyModes + nModes], 'type':'NormalNodes'}
             self.eigenValues = abs(eigVals)
+        elif useInternalSparseSolver:
+            #sorted, sparse eigen vectors; internal shift-invert Lanczos solver with shift=0 finds the zero-eigenvalues (rigid body modes)
+            import exudyn
+
+            K = self.GetStiffnessMatrix(sparse=True)
+            M = self.GetMassMatrix(sparse=True)
+            [eigVals, eigVecs] = exudyn.ComputeSparseEigenvalues(K, M, nModes+excludeRigidBodyModes) #this gives omega^2 ... squared eigen frequencies (rad/s)
+
+            self.modeBasis = {'matrix':eigVecs[:,excludeRigidBodyModes:excludeRigidBodyModes + nModes], 
+                              'type':'NormalNodes'}
+            self.eigenValues = abs(eigVals[excludeRigidBodyModes:excludeRigidBodyModes + nModes])
         else:
             #sorted, sparse eigen vectors
             from scipy.sparse.linalg import eigsh #eigh for symmetric matrices, positive definite
@@ -1809,7 +1831,7 @@ class FEMinterface:
     #**classFunction: compute Campbell diagram for given mechanical system
     #create a first order system Axd + Bx = 0 with x= [q,qd]' and compute eigenvalues
     #takes mass M, stiffness K and gyroscopic matrix G from FEMinterface
-    #currently only uses dense matrices, so it is limited to approx. 5000 unknowns!
+    #in dense mode, it is limited to approx. 5000 unknowns; use sparse mode for larger systems
     #**input:
     #  terminalFrequency: frequency in Hz, up to which the campbell diagram is computed
     #  nEigenfrequencies: gives the number of computed eigenfrequencies(modes), in addition to the rigid body mode 0
@@ -1817,11 +1839,12 @@ class FEMinterface:
     #  rotationAxis:[0,1,2] = [x,y,z] provides rotation axis
     #  plotDiagram: if True, plots diagram for nEigenfrequencies befor terminating
     #  verbose: if True, shows progress of computation
+    #  useSparseSolver: if True, only the eigenvalues closest to zero are computed with the internal sparse shift-invert Arnoldi solver, using sparse matrices (refactorized for every rotor frequency)
     #**output: [listFrequencies, campbellFrequencies]
     #  listFrequencies: list of computed frequencies
     #  campbellFrequencies: array of campbell frequencies per eigenfrequency of system
     def ComputeCampbellDiagram(self, terminalFrequency, nEigenfrequencies=10, frequencySteps=25, 
-                               rotationAxis=2, plotDiagram=False, verbose=False):
+                               rotationAxis=2, plotDiagram=False, verbose=False, useSparseSolver=False):
         from scipy.linalg import eig #eigh for symmetric matrices, positive definite
         
         #create gyroscopic terms
@@ -1831,14 +1854,19 @@ class FEMinterface:
 #        xBlock = np.kron(np.eye(nNodes), X) #create big block-diagonal matrix
 #        G=np.dot(xBlock,M)
         
-        M = self.GetMassMatrix(sparse=False)
-        K = self.GetStiffnessMatrix(sparse=False)
-        G = self.GetGyroscopicMatrix(rotationAxis=2, sparse=False)
+        M = self.GetMassMatrix(sparse=useSparseSolver)
+        K = self.GetStiffnessMatrix(sparse=useSparseSolver)
+        G = self.GetGyroscopicMatrix(rotationAxis=2, sparse=useSparseSolver)
 
         nODE = self.NumberOfCoordinates()
         #nNodes = self.NumberOfNodes()
-        B = np.block([[                    K, np.zeros((nODE,nODE))],
-                      [np.zeros((nODE,nODE)), -M                   ]])
+        if useSparseSolver:
+            import exudyn
+            #each frequency gives complex conjugate pair; additional eigenvalues for multiple (rigid body) eigenvalues
+            nEigenvalues = min(2*nEigenfrequencies+8, 2*nODE)
+        else:
+            B = np.block([[                    K, np.zeros((nODE,nODE))],
+                          [np.zeros((nODE,nODE)), -M                   ]])
     
 #        terminalFrequencyCampbell = 2*np.pi*225 #rad/s
         campbellFrequencies = []
@@ -1849,13 +1877,17 @@ class FEMinterface:
             omega = val * terminalFrequency * 2*np.pi / frequencySteps
             if verbose:
                 print("compute Campbell for frequency =", round(omega/(2*np.pi),3), " / ", terminalFrequency, '(Hz)')
-            A = np.block([[omega * G, M                    ],
-                          [        M, np.zeros((nODE,nODE))]])
-    
+            if useSparseSolver:
+                #eigenvalues lambda of (lambda^2*M + lambda*omega*G + K)*phi = 0 closest to zero; no eigenvectors needed
+                [eigValues, eigVector] = exudyn.ComputeSparseGyroscopicEigenvalues(K, G, M, omega, nEigenvalues)
+            else:
+                A = np.block([[omega * G, M                    ],
+                              [        M, np.zeros((nODE,nODE))]])
         
-            Amod = -np.dot(np.linalg.inv(A),B)
-            #print("Amod =", Amod)
-            [eigValues, eigVector] = eig(Amod) #this gives omega^2 ... squared eigen frequencies (rad/s)
+            
+                Amod = -np.dot(np.linalg.inv(A),B)
+                #print("Amod =", Amod)
+                [eigValues, eigVector] = eig(Amod) #this gives omega^2 ... squared eigen frequencies (rad/s)
         
             ev = np.sort(eigValues)
         
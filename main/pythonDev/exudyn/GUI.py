@@ -66,14 +66,15 @@ def GetComboBoxListsDict(exu = None):
         dT['OutputVariableType'] = listOfTypesT
 
         
-        listOfTypes = []
-        listOfTypesT = []
-        dTypes = exu.LinearSolverType.__members__
-        for i in dTypes: 
-            listOfTypes+=[str(dTypes[i])]
-            listOfTypesT+=[dTypes[i]]
-        d['LinearSolverType'] = listOfTypes
-        dT['LinearSolverType'] = listOfTypesT
+        for typeName in ['LinearSolverType', 'IterativeSolverType', 'PreconditionerType']:
+            listOfTypes = []
+            listOfTypesT = []
+            dTypes = getattr(exu, typeName).__members__
+            for i in dTypes: 
+                listOfTypes+=[str(dTypes[i])]
+                listOfTypesT+=[dTypes[i]]
+            d[typeName] = listOfTypes
+            dT[typeName] = listOfTypesT
 
     else:
         print('WARNING: exudyn not loaded as "exu"')
@@ -1239,6 +1239,60 @@ class ObjectContactFrictionCircleCable2D:
         yield 'VdrawSize', dict(self.visualization)["drawSize"]
         yield 'Vcolor', dict(self.visualization)["color"]
 
+class VObjectContactSpheresTriangleMesh:
+    def __init__(self, show = True, showMesh = True, drawSize = -1., color = [-1.,-1.,-1.,-1.]):
+        self.show = show
+        self.showMesh = showMesh
+        self.drawSize = drawSize
+        self.color = color
+
+    def __iter__(self):
+        yield 'show', self.show
+        yield 'showMesh', self.showMesh
+        yield 'drawSize', self.drawSize
+        yield 'color', self.color
+
+class ObjectContactSpheresTriangleMesh:
+    def __init__(self, name = '', markerNumbers = [ -1, -1 ], nodeNumber = -1, spherePositions = [], sphereRadius = 0., meshPoints = [], meshTriangles = [], maximumPenetration = 0., contactStiffness = 0., contactDamping = 0., frictionCoefficient = 0., frictionProportionalZone = 0., activeConnector = True, visualization = {'show': True, 'showMesh': True, 'drawSize': -1., 'color': [-1.,-1.,-1.,-1.]}):
+        self.name = name
+        self.markerNumbers = markerNumbers
+        self.nodeNumber = nodeNumber
+        self.spherePositions = spherePositions
+        self.sphereRadius = sphereRadius
+        self.meshPoints = meshPoints
+        self.meshTriangles = meshTriangles
+        self.maximumPenetration = maximumPenetration
+        self.contactStiffness = contactStiffness
+        self.contactDamping = contactDamping
+        self.frictionCoefficient = frictionCoefficient
+        self.frictionProportionalZone = frictionProportionalZone
+        self.activeConnector = activeConnector
+        self.visualization = visualization
+
+    def __iter__(self):
+        yield 'objectType', 'ContactSpheresTriangleMesh'
+        yield 'name', self.name
+        yield 'markerNumbers', self.markerNumbers
+        yield 'nodeNumber', self.nodeNumber
+        yield 'spherePositions', self.spherePositions
+        yield 'sphereRadius', self.sphereRadius
+        yield 'meshPoints', self.meshPoints
+        yield 'meshTriangles', self.meshTriangles
+        yield 'maximumPenetration', self.maximumPenetration
+        yield 'contactStiffness', self.contactStiffness
+        yield 'contactDamping', self.contactDamping
+        yield 'frictionCoefficient', self.frictionCoefficient
+        yield 'frictionProportionalZone', self.frictionProportionalZone
+        yield 'activeConnector', self.activeConnector
+        yield 'Vshow', dict(self.visualization)["show"]
+        yield 'VshowMesh', dict(self.visualization)["showMesh"]
+        yield 'VdrawSize', dict(self.visualization)["drawSize"]
+        yield 'Vcolor', dict(self.visualization)["color"]
+
+#add typedef for short usage:
+ContactSpheresTriangleMesh = ObjectContactSpheresTriangleMesh
+VContactSpheresTriangleMesh = VObjectContactSpheresTriangleMesh
+
 class VObjectJointGeneric:
     def __init__(self, show = True, axesRadius = 0.1, axesLength = 0.4, color = [-1.,-1.,-1.,-1.]):
         self.show = show
@@ -1881,12 +1935,13 @@ class VSensorNode:
         yield 'show', self.show
 
 class SensorNode:
-    def __init__(self, name = '', nodeNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, visualization = {'show': True}):
+    def __init__(self, name = '', nodeNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, storeInternal = False, visualization = {'show': True}):
         self.name = name
         self.nodeNumber = nodeNumber
         self.writeToFile = writeToFile
         self.fileName = fileName
         self.outputVariableType = outputVariableType
+        self.storeInternal = storeInternal
         self.visualization = visualization
 
     def __iter__(self):
@@ -1896,6 +1951,7 @@ class SensorNode:
         yield 'writeToFile', self.writeToFile
         yield 'fileName', self.fileName
         yield 'outputVariableType', self.outputVariableType
+        yield 'storeInternal', self.storeInternal
         yield 'Vshow', dict(self.visualization)["show"]
 
 class VSensorObject:
@@ -1906,12 +1962,13 @@ class VSensorObject:
         yield 'show', self.show
 
 class SensorObject:
-    def __init__(self, name = '', objectNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, visualization = {'show': True}):
+    def __init__(self, name = '', objectNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, storeInternal = False, visualization = {'show': True}):
         self.name = name
         self.objectNumber = objectNumber
         self.writeToFile = writeToFile
         self.fileName = fileName
         self.outputVariableType = outputVariableType
+        self.storeInternal = storeInternal
         self.visualization = visualization
 
     def __iter__(self):
@@ -1921,6 +1978,7 @@ class SensorObject:
         yield 'writeToFile', self.writeToFile
         yield 'fileName', self.fileName
         yield 'outputVariableType', self.outputVariableType
+        yield 'storeInternal', self.storeInternal
         yield 'Vshow', dict(self.visualization)["show"]
 
 class VSensorBody:
@@ -1931,13 +1989,14 @@ class VSensorBody:
         yield 'show', self.show
 
 class SensorBody:
-    def __init__(self, name = '', bodyNumber = -1, localPosition = [0.,0.,0.], writeToFile = True, fileName = '', outputVariableType = 0, visualization = {'show': True}):
+    def __init__(self, name = '', bodyNumber = -1, localPosition = [0.,0.,0.], writeToFile = True, fileName = '', outputVariableType = 0, storeInternal = False, visualization = {'show': True}):
         self.name = name
         self.bodyNumber = bodyNumber
         self.localPosition = localPosition
         self.writeToFile = writeToFile
         self.fileName = fileName
         self.outputVariableType = outputVariableType
+        self.storeInternal = storeInternal
         self.visualization = visualization
 
     def __iter__(self):
@@ -1948,6 +2007,7 @@ class SensorBody:
         yield 'writeToFile', self.writeToFile
         yield 'fileName', self.fileName
         yield 'outputVariableType', self.outputVariableType
+        yield 'storeInternal', self.storeInternal
         yield 'Vshow', dict(self.visualization)["show"]
 
 class VSensorSuperElement:
@@ -1958,13 +2018,14 @@ class VSensorSuperElement:
         yield 'show', self.show
 
 class SensorSuperElement:
-    def __init__(self, name = '', bodyNumber = -1, meshNodeNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, visualization = {'show': True}):
+    def __init__(self, name = '', bodyNumber = -1, meshNodeNumber = -1, writeToFile = True, fileName = '', outputVariableType = 0, storeInternal = False, visualization = {'show': True}):
         self.name = name
         self.bodyNumber = bodyNumber
         self.meshNodeNumber = meshNodeNumber
         self.writeToFile = writeToFile
         self.fileName = fileName
         self.outputVariableType = outputVariableType
+        self.storeInternal = storeInternal
         self.visualization = visualization
 
     def __iter__(self):
@@ -1975,6 +2036,7 @@ class SensorSuperElement:
         yield 'writeToFile', self.writeToFile
         yield 'fileName', self.fileName
         yield 'outputVariableType', self.outputVariableType
+        yield 'storeInternal', self.storeInternal
         yield 'Vshow', dict(self.visualization)["show"]
 
 class VSensorLoad:
@@ -1985,11 +2047,12 @@ class VSensorLoad:
         yield 'show', self.show
 
 class SensorLoad:
-    def __init__(self, name = '', loadNumber = -1, writeToFile = True, fileName = '', visualization = {'show': True}):
+    def __init__(self, name = '', loadNumber = -1, writeToFile = True, fileName = '', storeInternal = False, visualization = {'show': True}):
         self.name = name
         self.loadNumber = loadNumber
         self.writeToFile = writeToFile
         self.fileName = fileName
+        self.storeInternal = storeInternal
         self.visualization = visualization
 
     def __iter__(self):
@@ -1998,5 +2061,6 @@ class SensorLoad:
         yield 'loadNumber', self.loadNumber
         yield 'writeToFile', self.writeToFile
         yield 'fileName', self.fileName
+        yield 'storeInternal', self.storeInternal
         yield 'Vshow', dict(self.visualization)["show"]
 
@@ -63,7 +63,7 @@ def SolveStatic(mbs, simulationSettings = exudyn.SimulationSettings(),
 #**input:
 #   mbs: the MainSystem containing the assembled system; note that mbs may be changed upon several runs of this function
 #   simulationSettings: specific simulation settings
-#   solverType: use exudyn.DynamicSolverType to set specific solver (default=generalized alpha)
+#   solverType: use exudyn.DynamicSolverType to set specific solver (default=generalized alpha); the explicit solvers ExplicitEuler, RK4 and RK45 use the options in simulationSettings.timeIntegration.explicitIntegration
 #   updateInitialValues: if True, the results are written to initial values, such at a consecutive simulation uses the results of this simulation as the initial values of the next simulation
 #   storeSolver: if True, the staticSolver object is stored in the mbs.sys dictionary as mbs.sys['staticSolver'] 
 #**output: returns True, if successful, False if fails; if storeSolver = True, mbs.sys contains staticSolver, which allows to investigate solver problems (check theDoc.pdf section \refSection{sec:solverSubstructures} and the items described in \refSection{sec:MainSolverStatic})
@@ -94,26 +94,42 @@ def SolveDynamic(mbs,
                 updateInitialValues = False,
                 storeSolver = True):
 
+    explicitSolverTypes = [exudyn.DynamicSolverType.ExplicitEuler, 
+                           exudyn.DynamicSolverType.RK4, 
+                           exudyn.DynamicSolverType.RK45]
     if (solverType != exudyn.DynamicSolverType.TrapezoidalIndex2 and 
-        solverType != exudyn.DynamicSolverType.GeneralizedAlpha):
+        solverType != exudyn.DynamicSolverType.GeneralizedAlpha and
+        solverType not in explicitSolverTypes):
         raise ValueError("SolveDynamic: solver type not implemented: ", solverType)
     
-    dynamicSolver = exudyn.MainSolverImplicitSecondOrder()
-    
-    #store old settings:
-    newmarkOld = simulationSettings.timeIntegration.generalizedAlpha.useNewmark
-    index2Old = simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints
-
-    if solverType == exudyn.DynamicSolverType.TrapezoidalIndex2:
-        #manually override settings for integrator
-        simulationSettings.timeIntegration.generalizedAlpha.useNewmark = True
-        simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = True
-    
-    success = dynamicSolver.SolveSystem(mbs, simulationSettings)
+    if solverType in explicitSolverTypes:
+        dynamicSolver = exudyn.MainSolverExplicit()
+
+        #store old settings and override solver type:
+        solverTypeOld = simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType
+        simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType = solverType
 
-    #restore old settings:
-    simulationSettings.timeIntegration.generalizedAlpha.useNewmark = newmarkOld
-    simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = index2Old
+        success = dynamicSolver.SolveSystem(mbs, simulationSettings)
+
+        #restore old settings:
+        simulationSettings.timeIntegration.explicitIntegration.dynamicSolverType = solverTypeOld
+    else:
+        dynamicSolver = exudyn.MainSolverImplicitSecondOrder()
+        
+        #store old settings:
+        newmarkOld = simulationSettings.timeIntegration.generalizedAlpha.useNewmark
+        index2Old = simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints
+
+        if solverType == exudyn.DynamicSolverType.TrapezoidalIndex2:
+            #manually override settings for integrator
+            simulationSettings.timeIntegration.generalizedAlpha.useNewmark = True
+            simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = True
+        
+        success = dynamicSolver.SolveSystem(mbs, simulationSettings)
+
+        #restore old settings:
+        simulationSettings.timeIntegration.generalizedAlpha.useNewmark = newmarkOld
+        simulationSettings.timeIntegration.generalizedAlpha.useIndex2Constraints = index2Old
     
     if updateInitialValues:
         currentState = mbs.systemData.GetSystemState() #get current values
@@ -131,6 +147,7 @@ def SolveDynamic(mbs,
 #   useSparseSolver: if False (only for small systems), all eigenvalues are computed in dense mode (slow for large systems!); if True, only the numberOfEigenvalues are computed (numberOfEigenvalues must be set!); Currently, the matrices are exported only in DENSE MODE from mbs! NOTE that the sparsesolver accuracy is much less than the dense solver
 #   numberOfEigenvalues: number of eigenvalues and eivenvectors to be computed
 #   convert2Frequencies: if True, the eigen values are converted into frequencies (Hz) and the output is [eigenFrequencies, eigenVectors]
+#   useInternalSparseSolver: if True and useSparseSolver=True, the numberOfEigenvalues lowest eigenvalues are computed with the internal sparse shift-invert Lanczos solver instead of scipy; in this case, mass and stiffness matrices are not exported from mbs and linearSolverType=EigenSparse in simulationSettings avoids dense matrices also during assembly
 #**output: [eigenValues, eigenVectors]; eigenValues being a numpy array of eigen values ($\omega_i^2$, being the squared eigen frequencies in ($\omega_i$ in rad/s)!), eigenVectors a numpy array containing the eigenvectors in every column
 #**example:
 #  #take any example from the Examples or TestModels folder, e.g., 'cartesianSpringDamper.py' and run it
@@ -143,7 +160,8 @@ def ComputeODE2Eigenvalues(mbs,
                            useSparseSolver = False, 
                            numberOfEigenvalues = -1,
                            setInitialValues = True,
-                           convert2Frequencies = False):
+                           convert2Frequencies = False,
+                           useInternalSparseSolver = False):
     import numpy as np
     #use static solver, as it does not include factors from time integration (and no velocity derivatives) in the jacobian
     staticSolver = exudyn.MainSolverStatic()
@@ -151,6 +169,20 @@ def ComputeODE2Eigenvalues(mbs,
     #initialize solver with initial values
     staticSolver.InitializeSolver(mbs, simulationSettings)
 
+    if useSparseSolver and useInternalSparseSolver:
+        if numberOfEigenvalues < 1:
+            raise ValueError("ComputeODE2Eigenvalues: numberOfEigenvalues must be > 0")
+
+        #eigenvalues closest to shift=0 computed internally with sparse matrices; results are returned without copying
+        [eigenValues, eigenVectors] = staticSolver.ComputeODE2Eigenvalues(mbs, numberOfEigenvalues)
+        eigenValues = abs(eigenValues) #already sorted; remove round off sign of zero-eigenvalues
+
+        if convert2Frequencies:
+            eigenFrequencies = np.sqrt(eigenValues)/(2*np.pi)
+            return [eigenFrequencies, eigenVectors]
+        else:
+            return [eigenValues, eigenVectors]
+
     staticSolver.ComputeMassMatrix(mbs)
     M = staticSolver.GetSystemMassMatrix()
 
@@ -10,6 +10,7 @@ goal: support functions, which simplify the generation of models
 import numpy as np #LoadSolutionFile
 import time        #AnimateSolution
 import copy as copy #to be able to copy e.g. lists
+import os          #LoadBinarySolutionFile
 
 from exudyn.basicUtilities import *
 from exudyn.rigidBodyUtilities import *
@@ -213,7 +214,35 @@ def LoadSolutionFile(fileName):
     nRows = np.size(data,0)
 
     return dict({'data': data, 'columnsExported': columnsExported,'nColumns': nColumns,'nRows': nRows})
-    
+
+#++++++++++++++++++++++++++++++++++++++++++++
+#**function: map binary coordinates solution file (exported with option exu.SimulationSettings().solutionSettings.binarySolutionFile=True) into dictionary, using numpy.memmap; data is not loaded into memory, but read from file on access
+#**input: fileName: string containing directory and filename of stored binary coordinatesSolutionFile
+#**output: dictionary with same structure as LoadSolutionFile: 'data': read-only numpy.memmap with rows [time, coordinates...], 'columnsExported': [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData], 'nColumns': the number of data columns (excl. time) and 'nRows': the number of data rows; an incomplete last row (e.g. during simulation) is ignored
+def LoadBinarySolutionFile(fileName):
+    headerSize = 128 #8 characters + 15 int64 values
+    header = np.fromfile(fileName, dtype=np.int64, count=16)
+    if len(header) < 16 or header[0:1].tobytes() != b'EXUDYNSF':
+        print('ERROR in LoadBinarySolutionFile: file header corrupted or no binary solution file')
+        return None
+    [version, bytesPerReal] = header[1:3]
+    if version != 1:
+        print('ERROR in LoadBinarySolutionFile: unknown file version', version)
+        return None
+
+    columnsExported = [int(n) for n in header[8:15]] #[nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData]
+    nColumns = sum(columnsExported)
+    dataType = np.float32 if bytesPerReal == 4 else np.float64
+
+    fileSize = os.path.getsize(fileName)
+    nRows = (fileSize - headerSize)//(int(bytesPerReal)*(nColumns+1))
+    if nRows == 0: #memmap cannot map empty data
+        data = np.zeros((0, nColumns+1), dtype=dataType)
+    else:
+        data = np.memmap(fileName, dtype=dataType, mode='r', offset=headerSize, shape=(nRows, nColumns+1))
+
+    return dict({'data': data, 'columnsExported': columnsExported,'nColumns': nColumns,'nRows': nRows})
+
 #++++++++++++++++++++++++++++++++++++++++++++
 #**function: load selected row of solution dictionary (previously loaded with LoadSolutionFile) into specific state
 def SetSolutionState(exu, mbs, solution, row, configuration):
@@ -97,6 +97,8 @@ ext_modules = [
                  'src/Graphics/VisualizationUserFunctions.cpp',
                  'src/Linalg/LinearSolver.cpp',
                  'src/Linalg/Matrix.cpp',
+                 'src/Linalg/SparseEigenSolver.cpp',
+                 'src/Linalg/TriangleMeshBVH.cpp',
                  'src/Linalg/Vector.cpp',
                  'src/Main/CSystem.cpp',
                  'src/Main/MainObjectFactory.cpp',
@@ -138,6 +140,7 @@ ext_modules = [
                  'src/Objects/CObjectContactCircleCable2D.cpp',
                  'src/Objects/CObjectContactCoordinate.cpp',
                  'src/Objects/CObjectContactFrictionCircleCable2D.cpp',
+                 'src/Objects/CObjectContactSpheresTriangleMesh.cpp',
                  'src/Objects/CObjectFFRF.cpp',
                  'src/Objects/CObjectFFRFreducedOrder.cpp',
                  'src/Objects/CObjectGenericODE2.cpp',
@@ -160,10 +163,12 @@ ext_modules = [
                  'src/Pymodules/PyMatrixContainer.cpp',
                  'src/Solver/CSolver.cpp',
                  'src/Solver/CSolverBase.cpp',
+                 'src/Solver/CSolverExplicit.cpp',
                  'src/Solver/CSolverImplicitSecondOrder.cpp',
                  'src/Solver/CSolverStatic.cpp',
                  'src/Solver/MainSolver.cpp',
                  'src/Solver/MainSolverBase.cpp',
+                 'src/Solver/MainSolverBatch.cpp',
                  'src/Solver/StaticSolver.cpp',
                  'src/Solver/TimeIntegrationSolver.cpp',
                  'src/System/CLoad.cpp',
@@ -174,6 +179,8 @@ ext_modules = [
                  'src/System/MainObject.cpp',
                  'src/Tests/UnitTestBase.cpp',
                  'src/Utilities/BasicFunctions.cpp',
+                 'src/Utilities/BinaryFileWriter.cpp',
+                 'src/Utilities/ImageFileWriter.cpp',
 
 		],
         include_dirs=[
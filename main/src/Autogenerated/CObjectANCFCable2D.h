@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-16  11:24:28 (last modfied)
+* @date         2026-10-18  00:30:50 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -113,6 +113,12 @@ public: // AUTO:
         return parameters.useReducedOrderIntegration;
     }
 
+    //! AUTO:  return true, if mass matrix is constant (independent of coordinates and time); used by solvers to compute the system mass matrix only once
+    virtual bool HasConstantMassMatrix() const override
+    {
+        return true;
+    }
+
     //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
     virtual JacobianType::Type GetAvailableJacobians() const override
     {
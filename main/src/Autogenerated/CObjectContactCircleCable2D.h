@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-10  16:56:16 (last modfied)
+* @date         2026-10-18  01:50:31 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -137,6 +137,13 @@ public: // AUTO:
         return true;
     }
 
+    //! AUTO:  contact broad phase: returns true and the radius of the circle including offset; the connector is only evaluated in discontinuous iterations, if the circle is close to the cable segments or if a segment is in contact
+    virtual bool GetContactCircleRadius(Real& radius) const override
+    {
+        radius = parameters.circleRadius + parameters.offset;
+        return true;
+    }
+
     //! AUTO:  Flags to determine, which output variables are available (displacment, velocity, stress, ...)
     virtual OutputVariableType GetOutputVariableTypes() const override;
 
@@ -0,0 +1,206 @@
+/** ***********************************************************************************************
+* @class        CObjectContactSpheresTriangleMeshParameters
+* @brief        Parameter class for CObjectContactSpheresTriangleMesh
+*
+* @author       Gerstmayr Johannes
+* @date         2019-07-01 (generated)
+* @date         2026-10-18  02:38:57 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+                
+************************************************************************************************ */
+
+#ifndef COBJECTCONTACTSPHERESTRIANGLEMESHPARAMETERS__H
+#define COBJECTCONTACTSPHERESTRIANGLEMESHPARAMETERS__H
+
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "System/ItemIndices.h"
+
+#include "Linalg/TriangleMeshBVH.h"
+
+//! AUTO: Parameters for class CObjectContactSpheresTriangleMeshParameters
+class CObjectContactSpheresTriangleMeshParameters // AUTO: 
+{
+public: // AUTO: 
+    ArrayIndex markerNumbers;                     //!< AUTO: list of markers; m0 is the rigid body marker of the body carrying the spheres, m1 is the rigid body marker of the body (usually ground) carrying the triangle mesh
+    Index nodeNumber;                             //!< AUTO: node number of a NodeGenericData with one dataCoordinate per sphere (used for active set strategy ==> hold the gap of the last discontinuous iteration); initialize with positive values (no contact)
+    Matrix spherePositions;                       //!< AUTO:  matrix containing in every row the center of one sphere in marker 0 coordinates [SI:m]
+    Real sphereRadius;                            //!< AUTO: radius [SI:m] of all spheres; use 0 for point contact
+    Matrix meshPoints;                            //!< AUTO:  matrix containing in every row one point of the triangle mesh in marker 1 coordinates [SI:m], e.g. from graphicsDataUtilities or from STL data
+    MatrixI meshTriangles;                        //!< AUTO:  matrix containing in every row the three point indices (referring to meshPoints) of one triangle; points must be ordered counterclockwise when looking at the contact side (triangle normal points outwards)
+    Real maximumPenetration;                      //!< AUTO:  [SI:m] the closest triangle is searched within distance \f$r + p_{max}\f$ from a sphere center; for point contact (\f$r=0\f$), this is the maximum penetration which can be detected; \f$r + p_{max}\f$ must be > 0
+    Real contactStiffness;                        //!< AUTO: contact (penalty) stiffness [SI:N/m] per sphere; contact forces act in contact normal direction only upon penetration
+    Real contactDamping;                          //!< AUTO: contact damping [SI:N/(m s)] per sphere; acts on relative velocity in contact normal direction only upon penetration
+    Real frictionCoefficient;                     //!< AUTO: friction coefficient \f$\mu\f$ [SI: 1]; tangential friction forces act against relative tangential velocity at the contact point and are bounded by \f$\mu |f_n|\f$
+    Real frictionProportionalZone;                //!< AUTO:  limit velocity [SI:m/s] up to which the friction force is regularized (proportional to slip velocity for small velocities), which is needed for convergence of Newton's method
+    bool activeConnector;                         //!< AUTO: flag, which determines, if the connector is active; used to deactivate (temorarily) a connector or constraint
+    //! AUTO: default constructor with parameter initialization
+    CObjectContactSpheresTriangleMeshParameters()
+    {
+        markerNumbers = ArrayIndex({ EXUstd::InvalidIndex, EXUstd::InvalidIndex });
+        nodeNumber = EXUstd::InvalidIndex;
+        spherePositions = Matrix();
+        sphereRadius = 0.;
+        meshPoints = Matrix();
+        meshTriangles = MatrixI();
+        maximumPenetration = 0.;
+        contactStiffness = 0.;
+        contactDamping = 0.;
+        frictionCoefficient = 0.;
+        frictionProportionalZone = 0.;
+        activeConnector = true;
+    };
+};
+
+
+/** ***********************************************************************************************
+* @class        CObjectContactSpheresTriangleMesh
+* @brief        A penalty-based contact/friction condition between a set of spheres (or points) fixed to a rigid body (=marker0, a Rigid-Body Marker) and a static triangle mesh fixed to a second (usually ground) body (=marker1, a Rigid-Body Marker), e.g., for rigid bodies rolling and sliding on complex terrain; sphere positions are given in marker0 coordinates and mesh points in marker1 coordinates; a bounding volume hierarchy of the mesh is built once (upon setting the parameters), such that the closest point on the mesh is found in O(log n) for n triangles; a node NodeGenericData is required with one coordinate per sphere, containing the contact gap of the last discontinuous iteration; the contact force \f$f_n\f$ is zero for \f$gap>0\f$ and otherwise computed from \f$f_n = -gap*contactStiffness - \dot{gap}*contactDamping\f$; during Newton iterations, the contact force is actived only, if \f$dataCoordinate[i] <= 0\f$; dataCoordinate is set equal to gap in nonlinear iterations, but not modified in Newton iterations.
+*
+* @author       Gerstmayr Johannes
+* @date         2019-07-01 (generated)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+                
+************************************************************************************************ */
+
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "System/ItemIndices.h"
+
+//! AUTO: CObjectContactSpheresTriangleMesh
+class CObjectContactSpheresTriangleMesh: public CObjectConnector // AUTO: 
+{
+protected: // AUTO: 
+    TriangleMeshBVH meshBVH; //!< bounding volume hierarchy of mesh; built in ParametersHaveChanged()
+    CObjectContactSpheresTriangleMeshParameters parameters; //! AUTO: contains all parameters for CObjectContactSpheresTriangleMesh
+
+public: // AUTO: 
+
+    // AUTO: access functions
+    //! AUTO: Write (Reference) access to parameters
+    virtual CObjectContactSpheresTriangleMeshParameters& GetParameters() { return parameters; }
+    //! AUTO: Read access to parameters
+    virtual const CObjectContactSpheresTriangleMeshParameters& GetParameters() const { return parameters; }
+
+    //! AUTO:  default function to return Marker numbers
+    virtual const ArrayIndex& GetMarkerNumbers() const override
+    {
+        return parameters.markerNumbers;
+    }
+
+    //! AUTO:  Get global node number (with local node index); needed for every object ==> does local mapping
+    virtual Index GetNodeNumber(Index localIndex) const override
+    {
+        release_assert(localIndex == 0);
+        return parameters.nodeNumber;
+    }
+
+    //! AUTO:  number of nodes; needed for every object
+    virtual Index GetNumberOfNodes() const override
+    {
+        return 1;
+    }
+
+    //! AUTO:  Needs a data variable for every sphere (contact gap of last discontinuous iteration)
+    virtual Index GetDataVariablesSize() const override
+    {
+        return parameters.spherePositions.NumberOfRows();
+    }
+
+    //! AUTO:  Bounding volume hierarchy is rebuilt upon change of parameters; invalid meshes lead to empty hierarchy and are detected in CheckPreAssembleConsistency
+    virtual void ParametersHaveChanged() override
+    {
+        meshBVH.Build(parameters.meshPoints, parameters.meshTriangles);
+    }
+
+    //! AUTO:  access to bounding volume hierarchy of mesh
+    const TriangleMeshBVH& GetMeshBVH() const
+    {
+        return meshBVH;
+    }
+
+    //! AUTO:  compute global sphere center, closest point on mesh, contact normal (from mesh to sphere) and gap (negative for penetration) of sphere; returns false (and gap = search radius \f$r + p_{max}\f$), if no triangle is within search radius
+    bool ComputeSphereGap(const MarkerDataStructure& markerData, Index sphereIndex, Vector3D& sphereCenter, Vector3D& meshPoint, Vector3D& contactNormal, Real& gap) const;
+
+    //! AUTO:  compute sum of contact forces acting on body of marker 0 and according torques w.r.t. marker 0 and marker 1 positions (global coordinates); contact state is taken from data coordinates or, if useCurrentGap=true, from current gap
+    void ComputeContactForces(const MarkerDataStructure& markerData, bool useCurrentGap, Vector3D& force, Vector3D& torque0, Vector3D& torque1) const;
+
+    //! AUTO:  compute derivatives of [f0, torque0, f1, torque1] (forces and torques of ComputeContactForces on both bodies) w.r.t. marker position and rotation increments (forceJacobian) and w.r.t. marker velocities and angular velocities (forceJacobian_t) by automatic differentiation; returns false, if no sphere is in contact
+    bool ComputeContactForcesJacobian(const MarkerDataStructure& markerData, Matrix& forceJacobian, Matrix& forceJacobian_t) const;
+
+    //! AUTO:  Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'
+    virtual void ComputeODE2LHS(Vector& ode2Lhs, const MarkerDataStructure& markerData) const override;
+
+    //! AUTO:  Computational function: compute Jacobian of ODE2 LHS equations w.r.t. ODE coordinates (jacobian) and if JacobianType::ODE2_ODE2_t flag is set in GetAvailableJacobians() compute jacobian w.r.t. ODE_t coordinates
+    virtual void ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const override;
+
+    //! AUTO:  return the available jacobian dependencies and the jacobians which are available as a function; if jacobian dependencies exist but are not available as a function, it is computed numerically; can be combined with 2^i enum flags
+    virtual JacobianType::Type GetAvailableJacobians() const override
+    {
+        return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+    }
+
+    //! AUTO:  compute markerForces = [f0, torque0, f1, torque1] and derivatives w.r.t. marker velocities and angular velocities; used to add derivatives of rigid body marker jacobians to the analytic jacobian
+    virtual bool ComputeMarkerForces(const MarkerDataStructure& markerData, ResizableVector& markerForces, ResizableMatrix& markerForcesJacobian_t) const override;
+
+    //! AUTO:  flag to be set for connectors, which use DiscontinuousIteration
+    virtual bool HasDiscontinuousIteration() const override
+    {
+        return true;
+    }
+
+    //! AUTO:  function called after Newton method; returns a residual error (force)
+    virtual Real PostNewtonStep(const MarkerDataStructure& markerDataCurrent, PostNewtonFlags::Type& flags) override;
+
+    //! AUTO:  function called after discontinuous iterations have been completed for one step (e.g. to finalize history variables and set initial values for next step)
+    virtual void PostDiscontinuousIterationStep() override;
+
+    //! AUTO:  connector uses penalty formulation
+    virtual bool IsPenaltyConnector() const override
+    {
+        return true;
+    }
+
+    //! AUTO:  provide according output variable in 'value'
+    virtual void GetOutputVariableConnector(OutputVariableType variableType, const MarkerDataStructure& markerData, Vector& value) const override;
+
+    //! AUTO:  provide requested markerType for connector
+    virtual Marker::Type GetRequestedMarkerType() const override
+    {
+        return (Marker::Type)((Index)Marker::Position + (Index)Marker::Orientation);
+    }
+
+    //! AUTO:  return object type (for node treatment in computation)
+    virtual CObjectType GetType() const override
+    {
+        return CObjectType::Connector;
+    }
+
+    //! AUTO:  return if connector is active-->speeds up computation
+    virtual bool IsActive() const override;
+
+    virtual OutputVariableType GetOutputVariableTypes() const override
+    {
+        return (OutputVariableType)(
+            (Index)OutputVariableType::Distance +
+            (Index)OutputVariableType::Force +
+            (Index)OutputVariableType::Torque );
+    }
+
+};
+
+
+
+#endif //#ifdef include once...
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:14:41 (last modfied)
+* @date         2026-10-18  00:26:11 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -32,6 +32,7 @@ public: // AUTO:
     bool writeToFile;                             //!< AUTO: true: write sensor output to file
     std::string fileName;                         //!< AUTO: directory and file name for sensor file output; default: empty string generates sensor + sensorNumber + outputVariableType; directory will be created if it does not exist
     OutputVariableType outputVariableType;        //!< AUTO: OutputVariableType for sensor
+    bool storeInternal;                           //!< AUTO: true: sensor values are additionally stored in memory (contiguous buffer with rows [time, sensorValue[0], sensorValue[1], ...]) at the same period as sensor files are written; after or during simulation, access the buffer without copying by mbs.GetSensorStoredData(sensorNumber)
     //! AUTO: default constructor with parameter initialization
     CSensorSuperElementParameters()
     {
@@ -40,6 +41,7 @@ public: // AUTO:
         writeToFile = true;
         fileName = "";
         outputVariableType = OutputVariableType::_None;
+        storeInternal = false;
     };
 };
 
@@ -102,6 +104,12 @@ public: // AUTO:
         return parameters.writeToFile;
     }
 
+    //! AUTO:  get storeInternal flag
+    virtual bool GetStoreInternalFlag() const override
+    {
+        return parameters.storeInternal;
+    }
+
     //! AUTO:  get file name
     virtual STDstring GetFileName() const override
     {
@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -44,6 +44,7 @@ public: // AUTO:
   Real overhead;                                  //!< AUTO: overhead, such as initialization, copying and some matrix-vector multiplication
   Real python;                                    //!< AUTO: time spent for python functions
   Real visualization;                             //!< AUTO: time spent for visualization in computation thread
+  Real visualizationWait;                         //!< AUTO: time which the computation thread waits for the renderer, if the queue of images to be recorded is full (part of visualization; not counted in sum)
 
 
 public: // AUTO: 
@@ -68,6 +69,7 @@ public: // AUTO:
     overhead = 0.;
     python = 0.;
     visualization = 0.;
+    visualizationWait = 0.;
   };
 
   // AUTO: access functions
@@ -106,6 +108,7 @@ public: // AUTO:
     os << "  overhead = " << overhead << "\n";
     os << "  python = " << python << "\n";
     os << "  visualization = " << visualization << "\n";
+    os << "  visualizationWait = " << visualizationWait << "\n";
     os << "\n";
   }
 
@@ -124,7 +127,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -148,6 +151,8 @@ public: // AUTO:
   Index nData;                                    //!< AUTO: number of data coordinates
   Index nSys;                                     //!< AUTO: number of system (unknown) coordinates = nODE2+nODE1+nAE
   Index startAE;                                  //!< AUTO: start of algebraic coordinates, but set to zero if nAE==0
+  bool constantMassMatrix;                        //!< AUTO: true, if system mass matrix is constant and only computed once; set during initialization of solver
+  bool massMatrixComputed;                        //!< AUTO: true, if constant system mass matrix has already been computed and is available in systemMassMatrix
   ResizableVector systemResidual;                 //!< AUTO: system residual vector (vectors will be linked to this vector!)
   ResizableVector newtonSolution;                 //!< AUTO: Newton decrement (computed from residual and jacobian)
   ResizableVector tempODE2;                       //!< AUTO: temporary vector for ODE2 quantities; use in initial accelerations and during Newton
@@ -169,6 +174,7 @@ private: // AUTO:
   GeneralMatrixEigenSparse systemJacobianSparse;  //!< AUTO: sparse system jacobian
   GeneralMatrixEigenSparse systemMassMatrixSparse;//!< AUTO: sparse mass matrix
   GeneralMatrixEigenSparse jacobianAEsparse;      //!< AUTO: sparse AE jacobian
+  GeneralMatrixEigenSparseIterative systemJacobianSparseIterative;//!< AUTO: sparse system jacobian, solved with preconditioned iterative solver (EigenSparseIterative); mass matrix and AE jacobian are sparse
 
 
 public: // AUTO: 
@@ -184,6 +190,9 @@ public: // AUTO:
     systemJacobian = nullptr;
     systemMassMatrix = nullptr;
     jacobianAE = nullptr;
+    constantMassMatrix = false;
+    massMatrixComputed = false;
+    linearSolverType = LinearSolverType::EXUdense;
     SetLinearSolverType(LinearSolverType::EXUdense); //for safety, data is linked initially
   };
 
@@ -210,6 +219,8 @@ public: // AUTO:
     os << "  systemJacobian = " << *systemJacobian << "\n";
     os << "  systemMassMatrix = " << *systemMassMatrix << "\n";
     os << "  jacobianAE = " << *jacobianAE << "\n";
+    os << "  constantMassMatrix = " << constantMassMatrix << "\n";
+    os << "  massMatrixComputed = " << massMatrixComputed << "\n";
     os << "  systemResidual = " << systemResidual << "\n";
     os << "  newtonSolution = " << newtonSolution << "\n";
     os << "  tempODE2 = " << tempODE2 << "\n";
@@ -225,6 +236,7 @@ public: // AUTO:
     os << "  systemJacobianSparse = " << systemJacobianSparse << "\n";
     os << "  systemMassMatrixSparse = " << systemMassMatrixSparse << "\n";
     os << "  jacobianAEsparse = " << jacobianAEsparse << "\n";
+    os << "  systemJacobianSparseIterative = " << systemJacobianSparseIterative << "\n";
     os << "\n";
   }
 
@@ -243,7 +255,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -276,6 +288,11 @@ public: // AUTO:
   Index newtonJacobiCount;                        //!< AUTO: count total Newton jacobian computations
   Index rejectedModifiedNewtonSteps;              //!< AUTO: count the number of rejected modified Newton steps (switch to full Newton)
   Index discontinuousIterationsCount;             //!< AUTO: count total number of discontinuous iterations (min. 1 per step)
+  Index patternAnalysisCount;                     //!< AUTO: count symbolic analyses (ordering, analyzePattern) of the sparse system Jacobian; with linearSolverSettings.reuseAnalyzedPattern, this is the number of pattern cache misses
+  Index patternReuseCount;                        //!< AUTO: count factorizations of the sparse system Jacobian, which reused the previously analyzed sparsity pattern (pattern cache hits)
+  Index linearSolverIterationsCount;              //!< AUTO: count total number of iterations of iterative linear solver (EigenSparseIterative)
+  Index linearSolverNonConvergedCount;            //!< AUTO: count number of solves of iterative linear solver (EigenSparseIterative), which did not reach linearSolverSettings.iterativeTolerance
+  Index preconditionerCount;                      //!< AUTO: count number of preconditioner computations of iterative linear solver (EigenSparseIterative)
 
 
 public: // AUTO: 
@@ -297,6 +314,11 @@ public: // AUTO:
     newtonJacobiCount = 0;
     rejectedModifiedNewtonSteps = 0;
     discontinuousIterationsCount = 0;
+    patternAnalysisCount = 0;
+    patternReuseCount = 0;
+    linearSolverIterationsCount = 0;
+    linearSolverNonConvergedCount = 0;
+    preconditionerCount = 0;
   };
 
   // AUTO: access functions
@@ -321,6 +343,11 @@ public: // AUTO:
     os << "  newtonJacobiCount = " << newtonJacobiCount << "\n";
     os << "  rejectedModifiedNewtonSteps = " << rejectedModifiedNewtonSteps << "\n";
     os << "  discontinuousIterationsCount = " << discontinuousIterationsCount << "\n";
+    os << "  patternAnalysisCount = " << patternAnalysisCount << "\n";
+    os << "  patternReuseCount = " << patternReuseCount << "\n";
+    os << "  linearSolverIterationsCount = " << linearSolverIterationsCount << "\n";
+    os << "  linearSolverNonConvergedCount = " << linearSolverNonConvergedCount << "\n";
+    os << "  preconditionerCount = " << preconditionerCount << "\n";
     os << "\n";
   }
 
@@ -339,7 +366,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -429,7 +456,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -515,7 +542,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -536,9 +563,15 @@ public: // AUTO:
   std::ofstream solutionFile;                     //!< AUTO: solution file with coordinate data
   std::ofstream solverFile;                       //!< AUTO: file with detailed solver information
   std::vector<std::ofstream*> sensorFileList;     //!< AUTO: files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!
+  BinaryFileWriter* binarySolutionFile;           //!< AUTO: binary solution file writer with background thread, if solutionSettings.binarySolutionFile=True; nullptr otherwise; needs to be closed and deleted at end of simulation!
 
 
 public: // AUTO: 
+  //! AUTO: default constructor with parameter initialization
+  SolverFileData()
+  {
+    binarySolutionFile = nullptr;
+  };
 
   // AUTO: access functions
   //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
@@ -2,7 +2,7 @@
 // AUTO:  Helper file for dictionaries get/set for system structures; generated by Johannes Gerstmayr
 // AUTO:  Generated by Johannes Gerstmayr
 // AUTO:  Used for SimulationSettings and VisualizationSettings
-// AUTO:  last modified = 2020-12-02
+// AUTO:  last modified = 2026-10-18
 // AUTO:  ++++++++++++++++++++++
 
   #ifndef DICTIONARIESGETSET__H
@@ -44,7 +44,7 @@
     d["value"] = data.writeFileHeader;
     d["type"] = "bool";
     d["size"] = std::vector<int>{1};
-    d["description"] = "flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration)";
+    d["description"] = "flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration); not used for binarySolutionFile, which always has a header";
     structureDict["writeFileHeader"] = d;
 
     d = py::dict(); //reset local dict
@@ -151,6 +151,30 @@
     d["description"] = "precision for floating point numbers written to solution and sensor files";
     structureDict["outputPrecision"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.binarySolutionFile;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false); if true, the coordinates solution file is written in binary format: a fixed header of 128 bytes (8 characters EXUDYNSF, followed by 15 int64 values: version, bytes per real, isStatic flag, system coordinates [nODE2, nODE1, nAlgebraic, nData], written coordinates [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData] and number of planned steps) followed by frames [time, coordinates...] of raw float64 (or float32) values in native byte order; the file is written from a background thread with double buffering, such that the solver does not wait for the disk; read the file with utilities.LoadBinarySolutionFile(...); outputPrecision and solutionInformation are not used; with appendToFile=True, frames are appended to an existing (non-empty) file without writing the header again, which requires the same number of coordinates and precision";
+    structureDict["binarySolutionFile"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.binarySinglePrecision;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "flag (true/false); if true, values in the binary solution file (binarySolutionFile=True) are stored as float32 (including time), otherwise as float64";
+    structureDict["binarySinglePrecision"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.binaryBufferSize;
+    d["type"] = "UInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "size of each of the two buffers in bytes used for the binary solution file; data is handed over to the writer thread whenever a buffer exceeds this size";
+    structureDict["binaryBufferSize"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.recordImagesInterval;
@@ -179,6 +203,9 @@
     data.solverInformationFileName = py::cast<std::string>(d["solverInformationFileName"]);
     data.solutionInformation = py::cast<std::string>(d["solutionInformation"]);
     data.outputPrecision = py::cast<Index>(d["outputPrecision"]);
+    data.binarySolutionFile = py::cast<bool>(d["binarySolutionFile"]);
+    data.binarySinglePrecision = py::cast<bool>(d["binarySinglePrecision"]);
+    data.binaryBufferSize = py::cast<Index>(d["binaryBufferSize"]);
     data.recordImagesInterval = py::cast<Real>(d["recordImagesInterval"]);
   }
   //! AUTO: read access to structure; converting into dictionary
@@ -217,6 +244,22 @@
     d["description"] = "true: for the size estimation of the differentiation parameter, the reference coordinate q^{Ref}_i is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter";
     structureDict["addReferenceCoordinatesToEpsilon"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useColumnCompression;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: system wide numerical jacobians (doSystemWideDifferentiation=true for ODE2 equations, and numerical AE jacobians) perturb structurally orthogonal columns together (Curtis-Powell-Reid compression), using the sparsity pattern given by the object coordinate lists; this reduces the number of residual evaluations from the number of coordinates to the number of column colors; dependencies not represented in the coordinate lists (e.g. loads with user functions depending on other coordinates) are not captured; false: every column is differentiated separately";
+    structureDict["useColumnCompression"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useAnalyticJacobians;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: local ODE2 jacobians (w.r.t. ODE2 coordinates and velocities) of objects which provide jacobian functions (see GetAvailableJacobians(); e.g. ANCFCable2D, RigidBody with Euler parameters and ConnectorSpringDamper using automatic differentiation, ConnectorCartesianSpringDamper, ConnectorCoordinateSpringDamper and ContactSpheresTriangleMesh) are computed analytically instead of numerical differentiation; connectors are only differentiated analytically, if their markers have jacobians which do not depend on coordinates (e.g. mass points, point nodes, coordinates), otherwise numerical differentiation is used; ContactSpheresTriangleMesh is also differentiated analytically for rigid body markers, for which the derivatives of the marker jacobians are added by numerical differentiation of the marker jacobians; not used with doSystemWideDifferentiation";
+    structureDict["useAnalyticJacobians"] = d;
+
     return structureDict;
   }
   //! AUTO: write access to data structure; converting dictionary d into structure
@@ -225,6 +268,8 @@
     data.minimumCoordinateSize = py::cast<Real>(d["minimumCoordinateSize"]);
     data.doSystemWideDifferentiation = py::cast<bool>(d["doSystemWideDifferentiation"]);
     data.addReferenceCoordinatesToEpsilon = py::cast<bool>(d["addReferenceCoordinatesToEpsilon"]);
+    data.useColumnCompression = py::cast<bool>(d["useColumnCompression"]);
+    data.useAnalyticJacobians = py::cast<bool>(d["useAnalyticJacobians"]);
   }
   //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const NewtonSettings& data) {
@@ -367,6 +412,22 @@
     d["description"] = "absolute tolerance for discontinuous (post Newton) iterations; the errors represent absolute residuals and can be quite high";
     structureDict["discontinuousIterationTolerance"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useContactBroadPhase;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: once per step, bounding boxes of all circles and cable segments of circle-cable contacts (ContactCircleCable2D, ContactFrictionCircleCable2D) are computed (once per marker) and overlapping circle-cable pairs are found by sweep-and-prune; contacts of non-overlapping pairs, which are not in contact, skip the discontinuous (post Newton) iteration, such that gap functions are only evaluated for candidates; the bounding boxes are enlarged by contactBroadPhaseMargin and twice the distance which circle and cable travel with their current velocities within one step";
+    structureDict["useContactBroadPhase"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.contactBroadPhaseMargin;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "additional distance added to circle radius and offset in contact broad phase (useContactBroadPhase); must be larger than unexpected changes of distance between circle and cable within one step (e.g. due to large accelerations)";
+    structureDict["contactBroadPhaseMargin"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.stepInformation;
@@ -397,6 +458,8 @@
     data.maxDiscontinuousIterations = py::cast<Index>(d["maxDiscontinuousIterations"]);
     data.ignoreMaxDiscontinuousIterations = py::cast<bool>(d["ignoreMaxDiscontinuousIterations"]);
     data.discontinuousIterationTolerance = py::cast<Real>(d["discontinuousIterationTolerance"]);
+    data.useContactBroadPhase = py::cast<bool>(d["useContactBroadPhase"]);
+    data.contactBroadPhaseMargin = py::cast<Real>(d["contactBroadPhaseMargin"]);
     data.stepInformation = py::cast<Index>(d["stepInformation"]);
   }
   //! AUTO: read access to structure; converting into dictionary
@@ -463,6 +526,60 @@
     data.computeInitialAccelerations = py::cast<bool>(d["computeInitialAccelerations"]);
   }
   //! AUTO: read access to structure; converting into dictionary
+  py::dict GetDictionaryWithTypeInfo(const ExplicitIntegrationSettings& data) {
+    auto structureDict = py::dict();
+    auto d = py::dict(); //local dict
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.dynamicSolverType;
+    d["type"] = "DynamicSolverType";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "selection of explicit solver: exu.DynamicSolverType.ExplicitEuler (1st order), exu.DynamicSolverType.RK4 (classical Runge-Kutta, constant step size) or exu.DynamicSolverType.RK45 (Dormand-Prince, adaptive step size if adaptiveStep=True)";
+    structureDict["dynamicSolverType"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useConstantMassMatrix;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: mass matrix is only computed and factorized once at the start of the simulation; only used for systems without constraints (nAE=0); the user is responsible that the mass matrix is really constant";
+    structureDict["useConstantMassMatrix"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.useConstraintProjection;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: after every step, position level constraints and velocity level constraints are projected in order to avoid drift of the acceleration level formulation";
+    structureDict["useConstraintProjection"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.absoluteTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "absolute tolerance for error estimate of adaptive RK45 solver";
+    structureDict["absoluteTolerance"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.relativeTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "relative tolerance for error estimate of adaptive RK45 solver; error is normalized by absoluteTolerance + relativeTolerance*|coordinate|";
+    structureDict["relativeTolerance"] = d;
+
+    return structureDict;
+  }
+  //! AUTO: write access to data structure; converting dictionary d into structure
+  void SetDictionary(ExplicitIntegrationSettings& data, const py::dict& d) {
+    data.dynamicSolverType = py::cast<DynamicSolverType>(d["dynamicSolverType"]);
+    data.useConstantMassMatrix = py::cast<bool>(d["useConstantMassMatrix"]);
+    data.useConstraintProjection = py::cast<bool>(d["useConstraintProjection"]);
+    data.absoluteTolerance = py::cast<Real>(d["absoluteTolerance"]);
+    data.relativeTolerance = py::cast<Real>(d["relativeTolerance"]);
+  }
+  //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const TimeIntegrationSettings& data) {
     auto structureDict = py::dict();
     auto d = py::dict(); //local dict
@@ -507,6 +624,14 @@
     d["description"] = "lower limit of time step size, before integrator stops";
     structureDict["minimumStepSize"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.reuseConstantMassMatrix;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: if all bodies have a constant mass matrix (e.g. mass points, 2D rigid bodies, ANCFCable2D or GenericODE2 without massMatrixUserFunction), the system mass matrix is computed only once at the beginning of time integration and reused in all steps and Newton iterations; the mass matrix is recomputed, if object parameters are changed with SetObjectParameter, ModifyObject or parameter handles (e.g. in preStepFunction); changes of mass parameters by other means (e.g. in C++) are not detected";
+    structureDict["reuseConstantMassMatrix"] = d;
+
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.verboseMode;
@@ -524,6 +649,7 @@
     structureDict["verboseModeFile"] = d;
 
     structureDict["generalizedAlpha"] = GetDictionaryWithTypeInfo(data.generalizedAlpha);
+    structureDict["explicitIntegration"] = GetDictionaryWithTypeInfo(data.explicitIntegration);
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.preStepPyExecute;
@@ -542,9 +668,11 @@
     data.numberOfSteps = py::cast<Index>(d["numberOfSteps"]);
     data.adaptiveStep = py::cast<bool>(d["adaptiveStep"]);
     data.minimumStepSize = py::cast<Real>(d["minimumStepSize"]);
+    data.reuseConstantMassMatrix = py::cast<bool>(d["reuseConstantMassMatrix"]);
     data.verboseMode = py::cast<Index>(d["verboseMode"]);
     data.verboseModeFile = py::cast<Index>(d["verboseModeFile"]);
     SetDictionary(data.generalizedAlpha, py::cast<py::dict>(d["generalizedAlpha"]));
+    SetDictionary(data.explicitIntegration, py::cast<py::dict>(d["explicitIntegration"]));
     data.preStepPyExecute = py::cast<std::string>(d["preStepPyExecute"]);
   }
   //! AUTO: read access to structure; converting into dictionary
@@ -667,6 +795,87 @@
     data.preStepPyExecute = py::cast<std::string>(d["preStepPyExecute"]);
   }
   //! AUTO: read access to structure; converting into dictionary
+  py::dict GetDictionaryWithTypeInfo(const LinearSolverSettings& data) {
+    auto structureDict = py::dict();
+    auto d = py::dict(); //local dict
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.reuseAnalyzedPattern;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: in sparse mode (EigenSparse), the symbolic analysis (COLAMD ordering and analyzePattern) of the system Jacobian is only performed, if the sparsity pattern changed since the last factorization; the pattern is compared exactly, therefore this flag is safe for systems with changing pattern (e.g. contact), but it adds a small overhead in these cases; false: symbolic analysis is done in every factorization";
+    structureDict["reuseAnalyzedPattern"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.fixedPatternAssembly;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: in sparse mode (EigenSparse), the sparsity pattern of system Jacobian and mass matrix is kept after the first assembly and later updates (Jacobian, mass matrix) add their values directly into the compressed sparse matrix, using a scatter map of value positions which is recorded from the local-to-global (LTG) coordinate lists; this avoids sorting, summation and reallocation of triplets in every update; entries which are not contained in the pattern (e.g. changed connectivity in contact) are detected and the pattern is extended automatically; false: matrices are rebuilt from triplets in every update";
+    structureDict["fixedPatternAssembly"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.iterativeSolverType;
+    d["type"] = "IterativeSolverType";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "Krylov method for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.IterativeSolverType.GMRES (restarted GMRES, general matrices), exu.IterativeSolverType.BiCGSTAB (general matrices, less memory than GMRES) or exu.IterativeSolverType.CG (conjugate gradient, only for symmetric positive definite matrices, e.g., static problems without constraints)";
+    structureDict["iterativeSolverType"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.preconditionerType;
+    d["type"] = "PreconditionerType";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "preconditioner for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.PreconditionerType.ILU0 (incomplete LU without fill-in), exu.PreconditionerType.BlockJacobi (dense LU of diagonal blocks of size iterativeBlockSize), exu.PreconditionerType.Jacobi (diagonal) or exu.PreconditionerType._None; the preconditioner is only recomputed, if the Newton solver updates the Jacobian; zero pivots (e.g. due to constraints) are regularized";
+    structureDict["preconditionerType"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.iterativeTolerance;
+    d["type"] = "UReal";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "relative tolerance for iterative solver (EigenSparseIterative): iterations stop, if the norm of the linear residual is smaller than iterativeTolerance times the norm of the right-hand-side; must be considerably smaller than the Newton tolerance";
+    structureDict["iterativeTolerance"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.iterativeMaxIterations;
+    d["type"] = "UInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "maximum number of iterations of iterative solver (EigenSparseIterative) per solve; if tolerance is not reached, the last iterate is used and the Newton method decides on convergence; non-converged solves are counted in solver statistics";
+    structureDict["iterativeMaxIterations"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.gmresRestart;
+    d["type"] = "UInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "dimension of Krylov subspace of restarted GMRES; larger values improve convergence, but need more memory (gmresRestart vectors of system size)";
+    structureDict["gmresRestart"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.iterativeBlockSize;
+    d["type"] = "UInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "size of diagonal blocks for exu.PreconditionerType.BlockJacobi, e.g. 6 for rigid bodies with Euler parameters or 3 for 3D finite element nodes";
+    structureDict["iterativeBlockSize"] = d;
+
+    return structureDict;
+  }
+  //! AUTO: write access to data structure; converting dictionary d into structure
+  void SetDictionary(LinearSolverSettings& data, const py::dict& d) {
+    data.reuseAnalyzedPattern = py::cast<bool>(d["reuseAnalyzedPattern"]);
+    data.fixedPatternAssembly = py::cast<bool>(d["fixedPatternAssembly"]);
+    data.iterativeSolverType = py::cast<IterativeSolverType>(d["iterativeSolverType"]);
+    data.preconditionerType = py::cast<PreconditionerType>(d["preconditionerType"]);
+    data.iterativeTolerance = py::cast<Real>(d["iterativeTolerance"]);
+    data.iterativeMaxIterations = py::cast<Index>(d["iterativeMaxIterations"]);
+    data.gmresRestart = py::cast<Index>(d["gmresRestart"]);
+    data.iterativeBlockSize = py::cast<Index>(d["iterativeBlockSize"]);
+  }
+  //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const SimulationSettings& data) {
     auto structureDict = py::dict();
     auto d = py::dict(); //local dict
@@ -678,9 +887,10 @@
     d["value"] = data.linearSolverType;
     d["type"] = "LinearSolverType";
     d["size"] = std::vector<int>{1};
-    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)";
+    d["description"] = "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting, Cholesky factorization for symmetric positive definite matrices), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseIterative (sparse matrix with preconditioned iterative solver, see linearSolverSettings), ... (enumeration type)";
     structureDict["linearSolverType"] = d;
 
+    structureDict["linearSolverSettings"] = GetDictionaryWithTypeInfo(data.linearSolverSettings);
     d = py::dict(); //reset local dict
     d["itemIdentifier"] = std::string(""); //identifier for item
     d["value"] = data.cleanUpMemory;
@@ -737,6 +947,7 @@
     SetDictionary(data.solutionSettings, py::cast<py::dict>(d["solutionSettings"]));
     SetDictionary(data.staticSolver, py::cast<py::dict>(d["staticSolver"]));
     data.linearSolverType = py::cast<LinearSolverType>(d["linearSolverType"]);
+    SetDictionary(data.linearSolverSettings, py::cast<py::dict>(d["linearSolverSettings"]));
     data.cleanUpMemory = py::cast<bool>(d["cleanUpMemory"]);
     data.displayStatistics = py::cast<bool>(d["displayStatistics"]);
     data.displayComputationTime = py::cast<bool>(d["displayComputationTime"]);
@@ -1329,6 +1540,30 @@
     d["description"] = "true: only save single files with given filename, not adding numbering; false: add numbering to files, see saveImageFileName";
     structureDict["saveImageSingleFile"] = d;
 
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.saveImageFormat;
+    d["type"] = "String";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "format of saved frames: 'TGA' = uncompressed .tga files; 'TGA-RLE' = run-length encoded (lossless compressed) .tga files, usually much smaller; 'RAW' = all frames are appended to one raw video stream saveImageFileName+'.bgr' with 3 bytes (blue, green, red) per pixel and rows bottom-up; frame size is the window size, which must not change during recording; convert e.g. with: ffmpeg -f rawvideo -pixel_format bgr24 -video_size 1024x768 -i frame.bgr -vf vflip video.mp4";
+    structureDict["saveImageFormat"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.saveImageAsynchronous;
+    d["type"] = "bool";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "true: pixels are read into a pool of reusable buffers and frames are encoded and written to files by a background thread, such that renderer and solver do not wait for disk output; all files are written after SC.RedrawAndSaveImage() or exu.StopRenderer(); false: frames are written directly by the renderer";
+    structureDict["saveImageAsynchronous"] = d;
+
+    d = py::dict(); //reset local dict
+    d["itemIdentifier"] = std::string(""); //identifier for item
+    d["value"] = data.saveImageQueueSize;
+    d["type"] = "UInt";
+    d["size"] = std::vector<int>{1};
+    d["description"] = "number of frame buffers for saveImageAsynchronous; if all buffers wait for being written, the renderer waits up to saveImageTimeOut for a free buffer (which slows down the solver); otherwise the frame is dropped and the number of dropped frames is reported when the renderer is stopped";
+    structureDict["saveImageQueueSize"] = d;
+
     return structureDict;
   }
   //! AUTO: write access to data structure; converting dictionary d into structure
@@ -1337,6 +1572,9 @@
     data.saveImageFileName = py::cast<std::string>(d["saveImageFileName"]);
     data.saveImageFileCounter = py::cast<Index>(d["saveImageFileCounter"]);
     data.saveImageSingleFile = py::cast<bool>(d["saveImageSingleFile"]);
+    data.saveImageFormat = py::cast<std::string>(d["saveImageFormat"]);
+    data.saveImageAsynchronous = py::cast<bool>(d["saveImageAsynchronous"]);
+    data.saveImageQueueSize = py::cast<Index>(d["saveImageQueueSize"]);
   }
   //! AUTO: read access to structure; converting into dictionary
   py::dict GetDictionaryWithTypeInfo(const VSettingsNodes& data) {
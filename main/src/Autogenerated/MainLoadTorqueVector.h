@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-09  00:35:51 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -158,6 +158,13 @@ public: // AUTO:
         else  {PyError(STDstring("LoadTorqueVector::SetParameter(...): illegal parameter name ")+parameterName+" cannot be modified");} // AUTO: add warning for user
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("loadVector") == 0) { data = cLoadTorqueVector->GetParameters().loadVector.GetDataPointer(); size = 3; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
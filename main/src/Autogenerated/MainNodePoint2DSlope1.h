@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  18:14:39 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -186,6 +186,15 @@ public: // AUTO:
         else  {PyError(STDstring("NodePoint2DSlope1::SetParameter(...): illegal parameter name ")+parameterName+" cannot be modified");} // AUTO: add warning for user
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("referenceCoordinates") == 0) { data = cNodePoint2DSlope1->GetParameters().referenceCoordinates.GetDataPointer(); size = 4; return true; } //! AUTO: direct access
+        else if (parameterName.compare("initialCoordinates") == 0) { data = GetParameters().initialCoordinates.GetDataPointer(); size = 4; return true; } //! AUTO: direct access
+        else if (parameterName.compare("initialVelocities") == 0) { data = GetParameters().initialCoordinates_t.GetDataPointer(); size = 4; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
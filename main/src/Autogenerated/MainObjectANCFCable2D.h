@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-16  11:24:28 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -199,6 +199,20 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("physicsLength") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsLength); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsMassPerLength") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsMassPerLength); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsBendingStiffness") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsBendingStiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsAxialStiffness") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsAxialStiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsBendingDamping") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsBendingDamping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsAxialDamping") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsAxialDamping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsReferenceAxialStrain") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsReferenceAxialStrain); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("physicsReferenceCurvature") == 0) { data = &(cObjectANCFCable2D->GetParameters().physicsReferenceCurvature); size = 1; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-12-01  14:51:06 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -184,6 +184,14 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("offset") == 0) { data = &(cObjectConnectorCoordinate->GetParameters().offset); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("factorValue1") == 0) { data = &(cObjectConnectorCoordinate->GetParameters().factorValue1); size = 1; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-09  16:20:49 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -184,6 +184,17 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("stiffness") == 0) { data = &(cObjectConnectorCoordinateSpringDamper->GetParameters().stiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("damping") == 0) { data = &(cObjectConnectorCoordinateSpringDamper->GetParameters().damping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("offset") == 0) { data = &(cObjectConnectorCoordinateSpringDamper->GetParameters().offset); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("dryFriction") == 0) { data = &(cObjectConnectorCoordinateSpringDamper->GetParameters().dryFriction); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("dryFrictionProportionalZone") == 0) { data = &(cObjectConnectorCoordinateSpringDamper->GetParameters().dryFrictionProportionalZone); size = 1; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
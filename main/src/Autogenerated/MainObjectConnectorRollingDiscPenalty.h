@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-11-29  21:40:48 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -200,6 +200,20 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("dryFrictionAngle") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().dryFrictionAngle); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("contactStiffness") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().contactStiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("contactDamping") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().contactDamping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("dryFriction") == 0) { data = cObjectConnectorRollingDiscPenalty->GetParameters().dryFriction.GetDataPointer(); size = 2; return true; } //! AUTO: direct access
+        else if (parameterName.compare("dryFrictionProportionalZone") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().dryFrictionProportionalZone); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("rollingFrictionViscous") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().rollingFrictionViscous); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("discRadius") == 0) { data = &(cObjectConnectorRollingDiscPenalty->GetParameters().discRadius); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("planeNormal") == 0) { data = cObjectConnectorRollingDiscPenalty->GetParameters().planeNormal.GetDataPointer(); size = 3; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-09  16:20:49 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -180,6 +180,16 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("referenceLength") == 0) { data = &(cObjectConnectorSpringDamper->GetParameters().referenceLength); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("stiffness") == 0) { data = &(cObjectConnectorSpringDamper->GetParameters().stiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("damping") == 0) { data = &(cObjectConnectorSpringDamper->GetParameters().damping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("force") == 0) { data = &(cObjectConnectorSpringDamper->GetParameters().force); size = 1; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
@@ -0,0 +1,227 @@
+/** ***********************************************************************************************
+* @class        MainObjectContactSpheresTriangleMeshParameters
+* @brief        Parameter class for MainObjectContactSpheresTriangleMesh
+*
+* @author       Gerstmayr Johannes
+* @date         2019-07-01 (generated)
+* @date         2026-10-18  01:57:51 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+                
+************************************************************************************************ */
+
+#ifndef MAINOBJECTCONTACTSPHERESTRIANGLEMESHPARAMETERS__H
+#define MAINOBJECTCONTACTSPHERESTRIANGLEMESHPARAMETERS__H
+
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "System/ItemIndices.h"
+
+#include <pybind11/pybind11.h>      //! AUTO: include pybind for dictionary access
+#include <pybind11/stl.h>           //! AUTO: needed for stl-casts; otherwise py::cast with std::vector<Real> crashes!!!
+namespace py = pybind11;            //! AUTO: "py" used throughout in code
+#include "Autogenerated/CObjectContactSpheresTriangleMesh.h"
+
+#include "Autogenerated/VisuObjectContactSpheresTriangleMesh.h"
+
+//! AUTO: Parameters for class MainObjectContactSpheresTriangleMeshParameters
+class MainObjectContactSpheresTriangleMeshParameters // AUTO: 
+{
+public: // AUTO: 
+};
+
+
+/** ***********************************************************************************************
+* @class        MainObjectContactSpheresTriangleMesh
+* @brief        A penalty-based contact/friction condition between a set of spheres (or points) fixed to a rigid body (=marker0, a Rigid-Body Marker) and a static triangle mesh fixed to a second (usually ground) body (=marker1, a Rigid-Body Marker), e.g., for rigid bodies rolling and sliding on complex terrain; sphere positions are given in marker0 coordinates and mesh points in marker1 coordinates; a bounding volume hierarchy of the mesh is built once (upon setting the parameters), such that the closest point on the mesh is found in O(log n) for n triangles; a node NodeGenericData is required with one coordinate per sphere, containing the contact gap of the last discontinuous iteration; the contact force \f$f_n\f$ is zero for \f$gap>0\f$ and otherwise computed from \f$f_n = -gap*contactStiffness - \dot{gap}*contactDamping\f$; during Newton iterations, the contact force is actived only, if \f$dataCoordinate[i] <= 0\f$; dataCoordinate is set equal to gap in nonlinear iterations, but not modified in Newton iterations.
+*
+* @author       Gerstmayr Johannes
+* @date         2019-07-01 (generated)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+                
+************************************************************************************************ */
+
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "System/ItemIndices.h"
+
+//! AUTO: MainObjectContactSpheresTriangleMesh
+class MainObjectContactSpheresTriangleMesh: public MainObjectConnector // AUTO: 
+{
+protected: // AUTO: 
+    CObjectContactSpheresTriangleMesh* cObjectContactSpheresTriangleMesh; //pointer to computational object (initialized in object factory) AUTO:
+    VisualizationObjectContactSpheresTriangleMesh* visualizationObjectContactSpheresTriangleMesh; //pointer to computational object (initialized in object factory) AUTO:
+
+public: // AUTO: 
+    //! AUTO: default constructor with parameter initialization
+    MainObjectContactSpheresTriangleMesh()
+    {
+        name = "";
+    };
+
+    // AUTO: access functions
+    //! AUTO: Get pointer to computational class
+    CObjectContactSpheresTriangleMesh* GetCObjectContactSpheresTriangleMesh() { return cObjectContactSpheresTriangleMesh; }
+    //! AUTO: Get const pointer to computational class
+    const CObjectContactSpheresTriangleMesh* GetCObjectContactSpheresTriangleMesh() const { return cObjectContactSpheresTriangleMesh; }
+    //! AUTO: Set pointer to computational class (do this only in object factory!!!)
+    void SetCObjectContactSpheresTriangleMesh(CObjectContactSpheresTriangleMesh* pCObjectContactSpheresTriangleMesh) { cObjectContactSpheresTriangleMesh = pCObjectContactSpheresTriangleMesh; }
+
+    //! AUTO: Get pointer to visualization class
+    VisualizationObjectContactSpheresTriangleMesh* GetVisualizationObjectContactSpheresTriangleMesh() { return visualizationObjectContactSpheresTriangleMesh; }
+    //! AUTO: Get const pointer to visualization class
+    const VisualizationObjectContactSpheresTriangleMesh* GetVisualizationObjectContactSpheresTriangleMesh() const { return visualizationObjectContactSpheresTriangleMesh; }
+    //! AUTO: Set pointer to visualization class (do this only in object factory!!!)
+    void SetVisualizationObjectContactSpheresTriangleMesh(VisualizationObjectContactSpheresTriangleMesh* pVisualizationObjectContactSpheresTriangleMesh) { visualizationObjectContactSpheresTriangleMesh = pVisualizationObjectContactSpheresTriangleMesh; }
+
+    //! AUTO: Get const pointer to computational base class object
+    virtual CObject* GetCObject() const { return cObjectContactSpheresTriangleMesh; }
+    //! AUTO: Set pointer to computational base class object (do this only in object factory; type is NOT CHECKED!!!)
+    virtual void SetCObject(CObject* pCObject) { cObjectContactSpheresTriangleMesh = (CObjectContactSpheresTriangleMesh*)pCObject; }
+
+    //! AUTO: Get const pointer to visualization base class object
+    virtual VisualizationObject* GetVisualizationObject() const { return visualizationObjectContactSpheresTriangleMesh; }
+    //! AUTO: Set pointer to visualization base class object (do this only in object factory; type is NOT CHECKED!!!)
+    virtual void SetVisualizationObject(VisualizationObject* pVisualizationObject) { visualizationObjectContactSpheresTriangleMesh = (VisualizationObjectContactSpheresTriangleMesh*)pVisualizationObject; }
+
+    //! AUTO:  Check consistency prior to CSystem::Assemble(); needs to find all possible violations such that Assemble() would fail
+    virtual bool CheckPreAssembleConsistency(const MainSystem& mainSystem, STDstring& errorString) const override;
+
+    //! AUTO:  provide requested nodeType for objects; used for automatic checks in CheckSystemIntegrity()
+    virtual Node::Type GetRequestedNodeType() const override
+    {
+        return Node::GenericData;
+    }
+
+    //! AUTO:  Get type name of node (without keyword 'Object'...!); could also be realized via a string -> type conversion?
+    virtual const char* GetTypeName() const override
+    {
+        return "ContactSpheresTriangleMesh";
+    }
+
+
+    //! AUTO:  dictionary write access
+    virtual void SetWithDictionary(const py::dict& d) override
+    {
+        cObjectContactSpheresTriangleMesh->GetParameters().markerNumbers = EPyUtils::GetArrayMarkerIndexSafely(d["markerNumbers"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().nodeNumber = EPyUtils::GetNodeIndexSafely(d["nodeNumber"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        EPyUtils::SetNumpyMatrixSafely(d, "spherePositions", cObjectContactSpheresTriangleMesh->GetParameters().spherePositions); /*! AUTO:  safely cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().sphereRadius = py::cast<Real>(d["sphereRadius"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        EPyUtils::SetNumpyMatrixSafely(d, "meshPoints", cObjectContactSpheresTriangleMesh->GetParameters().meshPoints); /*! AUTO:  safely cast to C++ type*/
+        EPyUtils::SetNumpyMatrixISafely(d, "meshTriangles", cObjectContactSpheresTriangleMesh->GetParameters().meshTriangles); /*! AUTO:  safely cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().maximumPenetration = py::cast<Real>(d["maximumPenetration"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().contactStiffness = py::cast<Real>(d["contactStiffness"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().contactDamping = py::cast<Real>(d["contactDamping"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().frictionCoefficient = py::cast<Real>(d["frictionCoefficient"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        cObjectContactSpheresTriangleMesh->GetParameters().frictionProportionalZone = py::cast<Real>(d["frictionProportionalZone"]); /* AUTO:  read out dictionary and cast to C++ type*/
+        if (EPyUtils::DictItemExists(d, "activeConnector")) { cObjectContactSpheresTriangleMesh->GetParameters().activeConnector = py::cast<bool>(d["activeConnector"]); /* AUTO:  read out dictionary and cast to C++ type*/} 
+        EPyUtils::SetStringSafely(d, "name", name); /*! AUTO:  safely cast to C++ type*/
+        if (EPyUtils::DictItemExists(d, "Vshow")) { visualizationObjectContactSpheresTriangleMesh->GetShow() = py::cast<bool>(d["Vshow"]); /* AUTO:  read out dictionary and cast to C++ type*/} 
+        if (EPyUtils::DictItemExists(d, "VshowMesh")) { visualizationObjectContactSpheresTriangleMesh->GetShowMesh() = py::cast<bool>(d["VshowMesh"]); /* AUTO:  read out dictionary and cast to C++ type*/} 
+        if (EPyUtils::DictItemExists(d, "VdrawSize")) { visualizationObjectContactSpheresTriangleMesh->GetDrawSize() = py::cast<float>(d["VdrawSize"]); /* AUTO:  read out dictionary and cast to C++ type*/} 
+        if (EPyUtils::DictItemExists(d, "Vcolor")) { visualizationObjectContactSpheresTriangleMesh->GetColor() = py::cast<std::vector<float>>(d["Vcolor"]); /* AUTO:  read out dictionary and cast to C++ type*/} 
+        GetCObject()->ParametersHaveChanged();
+    }
+
+    //! AUTO:  dictionary read access
+    virtual py::dict GetDictionary() const override
+    {
+        auto d = py::dict();
+        d["objectType"] = (std::string)GetTypeName();
+        d["markerNumbers"] = EPyUtils::GetArrayMarkerIndex(cObjectContactSpheresTriangleMesh->GetParameters().markerNumbers); //! AUTO: cast variables into python (not needed for standard types) 
+        d["nodeNumber"] = (NodeIndex)cObjectContactSpheresTriangleMesh->GetParameters().nodeNumber; //! AUTO: cast variables into python (not needed for standard types) 
+        d["spherePositions"] = EPyUtils::Matrix2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().spherePositions); //! AUTO: cast variables into python (not needed for standard types) 
+        d["sphereRadius"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().sphereRadius; //! AUTO: cast variables into python (not needed for standard types) 
+        d["meshPoints"] = EPyUtils::Matrix2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().meshPoints); //! AUTO: cast variables into python (not needed for standard types) 
+        d["meshTriangles"] = EPyUtils::MatrixI2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().meshTriangles); //! AUTO: cast variables into python (not needed for standard types) 
+        d["maximumPenetration"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().maximumPenetration; //! AUTO: cast variables into python (not needed for standard types) 
+        d["contactStiffness"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().contactStiffness; //! AUTO: cast variables into python (not needed for standard types) 
+        d["contactDamping"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().contactDamping; //! AUTO: cast variables into python (not needed for standard types) 
+        d["frictionCoefficient"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().frictionCoefficient; //! AUTO: cast variables into python (not needed for standard types) 
+        d["frictionProportionalZone"] = (Real)cObjectContactSpheresTriangleMesh->GetParameters().frictionProportionalZone; //! AUTO: cast variables into python (not needed for standard types) 
+        d["activeConnector"] = (bool)cObjectContactSpheresTriangleMesh->GetParameters().activeConnector; //! AUTO: cast variables into python (not needed for standard types) 
+        d["name"] = (std::string)name; //! AUTO: cast variables into python (not needed for standard types) 
+        d["Vshow"] = (bool)visualizationObjectContactSpheresTriangleMesh->GetShow(); //! AUTO: cast variables into python (not needed for standard types) 
+        d["VshowMesh"] = (bool)visualizationObjectContactSpheresTriangleMesh->GetShowMesh(); //! AUTO: cast variables into python (not needed for standard types) 
+        d["VdrawSize"] = (float)visualizationObjectContactSpheresTriangleMesh->GetDrawSize(); //! AUTO: cast variables into python (not needed for standard types) 
+        d["Vcolor"] = (std::vector<float>)visualizationObjectContactSpheresTriangleMesh->GetColor(); //! AUTO: cast variables into python (not needed for standard types) 
+        return d; 
+    }
+
+    //! AUTO:  parameter read access
+    virtual py::object GetParameter(const STDstring& parameterName) const override 
+    {
+        if (parameterName.compare("name") == 0) { return py::cast((std::string)name);} //! AUTO: get parameter
+        else if (parameterName.compare("markerNumbers") == 0) { return py::cast(EPyUtils::GetArrayMarkerIndex(cObjectContactSpheresTriangleMesh->GetParameters().markerNumbers));} //! AUTO: get parameter
+        else if (parameterName.compare("nodeNumber") == 0) { return py::cast((NodeIndex)cObjectContactSpheresTriangleMesh->GetParameters().nodeNumber);} //! AUTO: get parameter
+        else if (parameterName.compare("spherePositions") == 0) { return EPyUtils::Matrix2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().spherePositions);} //! AUTO: get parameter
+        else if (parameterName.compare("sphereRadius") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().sphereRadius);} //! AUTO: get parameter
+        else if (parameterName.compare("meshPoints") == 0) { return EPyUtils::Matrix2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().meshPoints);} //! AUTO: get parameter
+        else if (parameterName.compare("meshTriangles") == 0) { return EPyUtils::MatrixI2NumPy(cObjectContactSpheresTriangleMesh->GetParameters().meshTriangles);} //! AUTO: get parameter
+        else if (parameterName.compare("maximumPenetration") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().maximumPenetration);} //! AUTO: get parameter
+        else if (parameterName.compare("contactStiffness") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().contactStiffness);} //! AUTO: get parameter
+        else if (parameterName.compare("contactDamping") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().contactDamping);} //! AUTO: get parameter
+        else if (parameterName.compare("frictionCoefficient") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().frictionCoefficient);} //! AUTO: get parameter
+        else if (parameterName.compare("frictionProportionalZone") == 0) { return py::cast((Real)cObjectContactSpheresTriangleMesh->GetParameters().frictionProportionalZone);} //! AUTO: get parameter
+        else if (parameterName.compare("activeConnector") == 0) { return py::cast((bool)cObjectContactSpheresTriangleMesh->GetParameters().activeConnector);} //! AUTO: get parameter
+        else if (parameterName.compare("Vshow") == 0) { return py::cast((bool)visualizationObjectContactSpheresTriangleMesh->GetShow());} //! AUTO: get parameter
+        else if (parameterName.compare("VshowMesh") == 0) { return py::cast((bool)visualizationObjectContactSpheresTriangleMesh->GetShowMesh());} //! AUTO: get parameter
+        else if (parameterName.compare("VdrawSize") == 0) { return py::cast((float)visualizationObjectContactSpheresTriangleMesh->GetDrawSize());} //! AUTO: get parameter
+        else if (parameterName.compare("Vcolor") == 0) { return py::cast((std::vector<float>)visualizationObjectContactSpheresTriangleMesh->GetColor());} //! AUTO: get parameter
+        else  {PyError(STDstring("ObjectContactSpheresTriangleMesh::GetParameter(...): illegal parameter name ")+parameterName+" cannot be read");} // AUTO: add warning for user
+        return py::object();
+    }
+
+
+    //! AUTO:  parameter write access
+    virtual void SetParameter(const STDstring& parameterName, const py::object& value) override 
+    {
+        if (parameterName.compare("name") == 0) { EPyUtils::SetStringSafely(value, name); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("markerNumbers") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().markerNumbers = EPyUtils::GetArrayMarkerIndexSafely(value); /* AUTO:  read out dictionary, check if correct index used and store (converted) Index to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("nodeNumber") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().nodeNumber = EPyUtils::GetNodeIndexSafely(value); /* AUTO:  read out dictionary, check if correct index used and store (converted) Index to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("spherePositions") == 0) { EPyUtils::SetNumpyMatrixSafely(value, cObjectContactSpheresTriangleMesh->GetParameters().spherePositions); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("sphereRadius") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().sphereRadius = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("meshPoints") == 0) { EPyUtils::SetNumpyMatrixSafely(value, cObjectContactSpheresTriangleMesh->GetParameters().meshPoints); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("meshTriangles") == 0) { EPyUtils::SetNumpyMatrixISafely(value, cObjectContactSpheresTriangleMesh->GetParameters().meshTriangles); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("maximumPenetration") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().maximumPenetration = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("contactStiffness") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().contactStiffness = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("contactDamping") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().contactDamping = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("frictionCoefficient") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().frictionCoefficient = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("frictionProportionalZone") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().frictionProportionalZone = py::cast<Real>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("activeConnector") == 0) { cObjectContactSpheresTriangleMesh->GetParameters().activeConnector = py::cast<bool>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("Vshow") == 0) { visualizationObjectContactSpheresTriangleMesh->GetShow() = py::cast<bool>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("VshowMesh") == 0) { visualizationObjectContactSpheresTriangleMesh->GetShowMesh() = py::cast<bool>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("VdrawSize") == 0) { visualizationObjectContactSpheresTriangleMesh->GetDrawSize() = py::cast<float>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("Vcolor") == 0) { visualizationObjectContactSpheresTriangleMesh->GetColor() = py::cast<std::vector<float>>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else  {PyError(STDstring("ObjectContactSpheresTriangleMesh::SetParameter(...): illegal parameter name ")+parameterName+" cannot be modified");} // AUTO: add warning for user
+        GetCObject()->ParametersHaveChanged();
+    }
+
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("sphereRadius") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().sphereRadius); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("maximumPenetration") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().maximumPenetration); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("contactStiffness") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().contactStiffness); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("contactDamping") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().contactDamping); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("frictionCoefficient") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().frictionCoefficient); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("frictionProportionalZone") == 0) { data = &(cObjectContactSpheresTriangleMesh->GetParameters().frictionProportionalZone); size = 1; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
+};
+
+
+
+#endif //#ifdef include once...
@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-09  16:20:49 (last modfied)
+* @date         2026-10-18  01:29:04 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -192,6 +192,15 @@ public: // AUTO:
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("rotationMarker0") == 0) { data = cObjectJointGeneric->GetParameters().rotationMarker0.GetDataPointer(); size = 9; return true; } //! AUTO: direct access
+        else if (parameterName.compare("rotationMarker1") == 0) { data = cObjectJointGeneric->GetParameters().rotationMarker1.GetDataPointer(); size = 9; return true; } //! AUTO: direct access
+        else if (parameterName.compare("offsetUserFunctionParameters") == 0) { data = cObjectJointGeneric->GetParameters().offsetUserFunctionParameters.GetDataPointer(); size = 6; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
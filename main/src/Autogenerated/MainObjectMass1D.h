@@ -4,7 +4,7 @@
 *
 * @author       Gerstmayr Johannes
 * @date         2019-07-01 (generated)
-* @date         2020-09-08  22:06:16 (last modfied)
+* @date         2026-10-18  02:32:39 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -145,6 +145,7 @@ public: // AUTO:
         else if (parameterName.compare("referencePosition") == 0) { return py::cast((std::vector<Real>)cObjectMass1D->GetParameters().referencePosition);} //! AUTO: get parameter
         else if (parameterName.compare("referenceRotation") == 0) { return py::cast(EXUmath::Matrix3DToStdArray33(cObjectMass1D->GetParameters().referenceRotation));} //! AUTO: get parameter
         else if (parameterName.compare("Vshow") == 0) { return py::cast((bool)visualizationObjectMass1D->GetShow());} //! AUTO: get parameter
+        else if (parameterName.compare("VgraphicsData") == 0) { return PyGetBodyGraphicsDataDictionary(visualizationObjectMass1D->GetGraphicsData());} //! AUTO: get parameter
         else  {PyError(STDstring("ObjectMass1D::GetParameter(...): illegal parameter name ")+parameterName+" cannot be read");} // AUTO: add warning for user
         return py::object();
     }
@@ -159,10 +160,20 @@ public: // AUTO:
         else if (parameterName.compare("referencePosition") == 0) { EPyUtils::SetVector3DSafely(value, cObjectMass1D->GetParameters().referencePosition); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
         else if (parameterName.compare("referenceRotation") == 0) { EPyUtils::SetMatrix3DSafely(value, cObjectMass1D->GetParameters().referenceRotation); /*! AUTO:  safely cast to C++ type*/; } //! AUTO: get parameter
         else if (parameterName.compare("Vshow") == 0) { visualizationObjectMass1D->GetShow() = py::cast<bool>(value); /* AUTO:  read out dictionary and cast to C++ type*/; } //! AUTO: get parameter
+        else if (parameterName.compare("VgraphicsData") == 0) { py::dict d; d["VgraphicsData"] = value; PyWriteBodyGraphicsData(d, "VgraphicsData", visualizationObjectMass1D->GetGraphicsData()); /*! AUTO: convert to BodyGraphicsData*/; } //! AUTO: get parameter
         else  {PyError(STDstring("ObjectMass1D::SetParameter(...): illegal parameter name ")+parameterName+" cannot be modified");} // AUTO: add warning for user
         GetCObject()->ParametersHaveChanged();
     }
 
+    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available
+    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override 
+    {
+        if (parameterName.compare("physicsMass") == 0) { data = &(cObjectMass1D->GetParameters().physicsMass); size = 1; return true; } //! AUTO: direct access
+        else if (parameterName.compare("referencePosition") == 0) { data = cObjectMass1D->GetParameters().referencePosition.GetDataPointer(); size = 3; return true; } //! AUTO: direct access
+        else if (parameterName.compare("referenceRotation") == 0) { data = cObjectMass1D->GetParameters().referenceRotation.GetDataPointer(); size = 9; return true; } //! AUTO: direct access
+        else  {return false;}
+    }
+
 };
 
 
@@ -7,7 +7,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -93,7 +93,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -236,5 +236,72 @@ public: // AUTO:
 };
 
 
+/** ***********************************************************************************************
+* @class        MainSolverExplicit
+* @brief        PyBind interface (trampoline) class for explicit time integration solvers (explicit Euler, RK4, RK45). The solver type is selected in timeIntegration.explicitIntegration.dynamicSolverType. Constraints are solved on acceleration level and projected after every step. NOTE that except from SolveSystem(...), these functions are only intended for experienced users and they need to be handled with care, as unexpected crashes may happen if used not appropriately.
+*
+* @author       AUTO: Gerstmayr Johannes
+* @date         AUTO: 2019-07-01 (generated)
+* @date         AUTO: 2026-10-18 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: missing
+                
+************************************************************************************************ **/
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "Main/OutputVariable.h"
+#include "Linalg/BasicLinalg.h"
+
+class MainSolverExplicit: public MainSolverBase // AUTO: 
+{
+public: // AUTO: 
+  CSolverExplicitTimeInt cSolver;                 //!< AUTO: link to C++ CSolver, not accessible from Python
+  bool isInitialized;                             //!< AUTO: variable is used to see, if system is initialized ==> avoid crashes; DO not change these variables: can easily lead to crash! 
+  Index4 initializedSystemSizes;                  //!< AUTO: index-array contains 4 integers: nODE2, nODE1, nAE and nData of initialization: this guaranties, that no function is called with wrong system sizes; DO not change these variables: can easily lead to crash! 
+
+
+public: // AUTO: 
+
+  // AUTO: access functions
+  //! AUTO: Set function (needed in pybind) for: index-array contains 4 integers: nODE2, nODE1, nAE and nData of initialization: this guaranties, that no function is called with wrong system sizes; DO not change these variables: can easily lead to crash! 
+  void PySetInitializedSystemSizes(const std::array<Index,4>& initializedSystemSizesInit) { initializedSystemSizes = initializedSystemSizesInit; }
+  //! AUTO: Read (Copy) access to: index-array contains 4 integers: nODE2, nODE1, nAE and nData of initialization: this guaranties, that no function is called with wrong system sizes; DO not change these variables: can easily lead to crash! 
+  std::array<Index,4> PyGetInitializedSystemSizes() const { return (std::array<Index,4>)(initializedSystemSizes); }
+
+  //! AUTO: constructor, in order to set valid state (settings not initialized at beginning)
+   MainSolverExplicit() {
+    isInitialized = false;
+  }
+
+  //! AUTO: const access to cSolver
+  virtual const CSolverBase& GetCSolver() const override {
+    return cSolver;
+  }
+
+  //! AUTO: reference access to cSolver
+  virtual CSolverBase& GetCSolver() override {
+    return cSolver;
+  }
+
+  //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
+  virtual void Print(std::ostream& os) const
+  {
+    os << "MainSolverExplicit" << ":\n";
+    os << ":"; 
+    MainSolverBase::Print(os);
+    os << "  cSolver = " << cSolver << "\n";
+    os << "  isInitialized = " << isInitialized << "\n";
+    os << "  initializedSystemSizes = " << initializedSystemSizes << "\n";
+    os << "\n";
+  }
+
+};
+
+
 
 #endif //#ifdef include once...
@@ -1,6 +1,6 @@
 // AUTO:  ++++++++++++++++++++++
 // AUTO:  pybind11 module includes; generated by Johannes Gerstmayr
-// AUTO:  last modified = 2020-12-02
+// AUTO:  last modified = 2026-10-18
 // AUTO:  ++++++++++++++++++++++
 
     //++++++++++++++++++++++++++++++++
@@ -22,6 +22,9 @@
         .def_readwrite("solverInformationFileName", &SolutionSettings::solverInformationFileName)
         .def_readwrite("solutionInformation", &SolutionSettings::solutionInformation)
         .def_readwrite("outputPrecision", &SolutionSettings::outputPrecision)
+        .def_readwrite("binarySolutionFile", &SolutionSettings::binarySolutionFile)
+        .def_readwrite("binarySinglePrecision", &SolutionSettings::binarySinglePrecision)
+        .def_readwrite("binaryBufferSize", &SolutionSettings::binaryBufferSize)
         .def_readwrite("recordImagesInterval", &SolutionSettings::recordImagesInterval)
         // AUTO: access functions for SolutionSettings
         .def("__repr__", [](const SolutionSettings &item) { return "<SolutionSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -35,6 +38,8 @@
         .def_readwrite("minimumCoordinateSize", &NumericalDifferentiationSettings::minimumCoordinateSize)
         .def_readwrite("doSystemWideDifferentiation", &NumericalDifferentiationSettings::doSystemWideDifferentiation)
         .def_readwrite("addReferenceCoordinatesToEpsilon", &NumericalDifferentiationSettings::addReferenceCoordinatesToEpsilon)
+        .def_readwrite("useColumnCompression", &NumericalDifferentiationSettings::useColumnCompression)
+        .def_readwrite("useAnalyticJacobians", &NumericalDifferentiationSettings::useAnalyticJacobians)
         // AUTO: access functions for NumericalDifferentiationSettings
         .def("__repr__", [](const NumericalDifferentiationSettings &item) { return "<NumericalDifferentiationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
@@ -61,6 +66,8 @@
         .def_readwrite("maxDiscontinuousIterations", &NewtonSettings::maxDiscontinuousIterations)
         .def_readwrite("ignoreMaxDiscontinuousIterations", &NewtonSettings::ignoreMaxDiscontinuousIterations)
         .def_readwrite("discontinuousIterationTolerance", &NewtonSettings::discontinuousIterationTolerance)
+        .def_readwrite("useContactBroadPhase", &NewtonSettings::useContactBroadPhase)
+        .def_readwrite("contactBroadPhaseMargin", &NewtonSettings::contactBroadPhaseMargin)
         .def_readwrite("stepInformation", &NewtonSettings::stepInformation)
         // AUTO: access functions for NewtonSettings
         .def("__repr__", [](const NewtonSettings &item) { return "<NewtonSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -80,6 +87,19 @@
         .def("__repr__", [](const GeneralizedAlphaSettings &item) { return "<GeneralizedAlphaSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
 
+    //++++++++++++++++++++++++++++++++
+    //++++++++++++++++++++++++++++++++
+    py::class_<ExplicitIntegrationSettings>(m, "ExplicitIntegrationSettings") // AUTO: 
+        .def(py::init<>())
+        .def_readwrite("dynamicSolverType", &ExplicitIntegrationSettings::dynamicSolverType)
+        .def_readwrite("useConstantMassMatrix", &ExplicitIntegrationSettings::useConstantMassMatrix)
+        .def_readwrite("useConstraintProjection", &ExplicitIntegrationSettings::useConstraintProjection)
+        .def_readwrite("absoluteTolerance", &ExplicitIntegrationSettings::absoluteTolerance)
+        .def_readwrite("relativeTolerance", &ExplicitIntegrationSettings::relativeTolerance)
+        // AUTO: access functions for ExplicitIntegrationSettings
+        .def("__repr__", [](const ExplicitIntegrationSettings &item) { return "<ExplicitIntegrationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
+        ; // AUTO: end of class definition!!!
+
     //++++++++++++++++++++++++++++++++
     //++++++++++++++++++++++++++++++++
     py::class_<TimeIntegrationSettings>(m, "TimeIntegrationSettings") // AUTO: 
@@ -90,9 +110,11 @@
         .def_readwrite("numberOfSteps", &TimeIntegrationSettings::numberOfSteps)
         .def_readwrite("adaptiveStep", &TimeIntegrationSettings::adaptiveStep)
         .def_readwrite("minimumStepSize", &TimeIntegrationSettings::minimumStepSize)
+        .def_readwrite("reuseConstantMassMatrix", &TimeIntegrationSettings::reuseConstantMassMatrix)
         .def_readwrite("verboseMode", &TimeIntegrationSettings::verboseMode)
         .def_readwrite("verboseModeFile", &TimeIntegrationSettings::verboseModeFile)
         .def_readwrite("generalizedAlpha", &TimeIntegrationSettings::generalizedAlpha)
+        .def_readwrite("explicitIntegration", &TimeIntegrationSettings::explicitIntegration)
         .def_readwrite("preStepPyExecute", &TimeIntegrationSettings::preStepPyExecute)
         // AUTO: access functions for TimeIntegrationSettings
         .def("__repr__", [](const TimeIntegrationSettings &item) { return "<TimeIntegrationSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -119,6 +141,22 @@
         .def("__repr__", [](const StaticSolverSettings &item) { return "<StaticSolverSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
 
+    //++++++++++++++++++++++++++++++++
+    //++++++++++++++++++++++++++++++++
+    py::class_<LinearSolverSettings>(m, "LinearSolverSettings") // AUTO: 
+        .def(py::init<>())
+        .def_readwrite("reuseAnalyzedPattern", &LinearSolverSettings::reuseAnalyzedPattern)
+        .def_readwrite("fixedPatternAssembly", &LinearSolverSettings::fixedPatternAssembly)
+        .def_readwrite("iterativeSolverType", &LinearSolverSettings::iterativeSolverType)
+        .def_readwrite("preconditionerType", &LinearSolverSettings::preconditionerType)
+        .def_readwrite("iterativeTolerance", &LinearSolverSettings::iterativeTolerance)
+        .def_readwrite("iterativeMaxIterations", &LinearSolverSettings::iterativeMaxIterations)
+        .def_readwrite("gmresRestart", &LinearSolverSettings::gmresRestart)
+        .def_readwrite("iterativeBlockSize", &LinearSolverSettings::iterativeBlockSize)
+        // AUTO: access functions for LinearSolverSettings
+        .def("__repr__", [](const LinearSolverSettings &item) { return "<LinearSolverSettings:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
+        ; // AUTO: end of class definition!!!
+
     //++++++++++++++++++++++++++++++++
     //++++++++++++++++++++++++++++++++
     py::class_<SimulationSettings>(m, "SimulationSettings") // AUTO: 
@@ -127,6 +165,7 @@
         .def_readwrite("solutionSettings", &SimulationSettings::solutionSettings)
         .def_readwrite("staticSolver", &SimulationSettings::staticSolver)
         .def_readwrite("linearSolverType", &SimulationSettings::linearSolverType)
+        .def_readwrite("linearSolverSettings", &SimulationSettings::linearSolverSettings)
         .def_readwrite("cleanUpMemory", &SimulationSettings::cleanUpMemory)
         .def_readwrite("displayStatistics", &SimulationSettings::displayStatistics)
         .def_readwrite("displayComputationTime", &SimulationSettings::displayComputationTime)
@@ -236,6 +275,9 @@
         .def_readwrite("saveImageFileName", &VSettingsExportImages::saveImageFileName)
         .def_readwrite("saveImageFileCounter", &VSettingsExportImages::saveImageFileCounter)
         .def_readwrite("saveImageSingleFile", &VSettingsExportImages::saveImageSingleFile)
+        .def_readwrite("saveImageFormat", &VSettingsExportImages::saveImageFormat)
+        .def_readwrite("saveImageAsynchronous", &VSettingsExportImages::saveImageAsynchronous)
+        .def_readwrite("saveImageQueueSize", &VSettingsExportImages::saveImageQueueSize)
         // AUTO: access functions for VSettingsExportImages
         .def("__repr__", [](const VSettingsExportImages &item) { return "<VSettingsExportImages:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
@@ -383,6 +425,7 @@
         .def_readwrite("overhead", &CSolverTimer::overhead)
         .def_readwrite("python", &CSolverTimer::python)
         .def_readwrite("visualization", &CSolverTimer::visualization)
+        .def_readwrite("visualizationWait", &CSolverTimer::visualizationWait)
         // AUTO: access functions for CSolverTimer
         .def("Reset", &CSolverTimer::Reset, "reset solver timings to initial state by assigning default values; useSolverTimer sets the useTimer flag")
         .def("Sum", &CSolverTimer::Sum, py::return_value_policy::copy, "compute sum of all timers (except for those counted multiple, e.g., jacobians")
@@ -402,6 +445,8 @@
         .def_readwrite("nData", &SolverLocalData::nData)
         .def_readwrite("nSys", &SolverLocalData::nSys)
         .def_readwrite("startAE", &SolverLocalData::startAE)
+        .def_readwrite("constantMassMatrix", &SolverLocalData::constantMassMatrix)
+        .def_readwrite("massMatrixComputed", &SolverLocalData::massMatrixComputed)
         .def_readwrite("systemResidual", &SolverLocalData::systemResidual)
         .def_readwrite("newtonSolution", &SolverLocalData::newtonSolution)
         .def_readwrite("tempODE2", &SolverLocalData::tempODE2)
@@ -436,6 +481,11 @@
         .def_readwrite("newtonJacobiCount", &SolverIterationData::newtonJacobiCount)
         .def_readwrite("rejectedModifiedNewtonSteps", &SolverIterationData::rejectedModifiedNewtonSteps)
         .def_readwrite("discontinuousIterationsCount", &SolverIterationData::discontinuousIterationsCount)
+        .def_readwrite("patternAnalysisCount", &SolverIterationData::patternAnalysisCount)
+        .def_readwrite("patternReuseCount", &SolverIterationData::patternReuseCount)
+        .def_readwrite("linearSolverIterationsCount", &SolverIterationData::linearSolverIterationsCount)
+        .def_readwrite("linearSolverNonConvergedCount", &SolverIterationData::linearSolverNonConvergedCount)
+        .def_readwrite("preconditionerCount", &SolverIterationData::preconditionerCount)
         // AUTO: access functions for SolverIterationData
         .def("ToString", &SolverIterationData::ToString, py::return_value_policy::copy, "convert iteration statistics to string; used for displayStatistics option")
         .def("__repr__", [](const SolverIterationData &item) { return "<SolverIterationData:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
@@ -547,6 +597,7 @@
         .def("ComputeJacobianAE", &MainSolverStatic::ComputeJacobianAE, "add jacobian of algebraic equations (multiplied with factor) to systemJacobian in cSolver; the scalarFactors are scaling the derivatives w.r.t. ODE2 coordinates and w.r.t. ODE2_t (velocity) coordinates; if velocityLevel == true, the constraints are evaluated at velocity level", py::arg("mainSystem"), py::arg("scalarFactor_ODE2") = 1., py::arg("scalarFactor_ODE2_t") = 1., py::arg("velocityLevel") = false)
         .def("ComputeODE2RHS", &MainSolverStatic::ComputeODE2RHS, "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)", py::arg("mainSystem"))
         .def("ComputeAlgebraicEquations", &MainSolverStatic::ComputeAlgebraicEquations, "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)", py::arg("mainSystem"), py::arg("velocityLevel") = false)
+        .def("ComputeODE2Eigenvalues", &MainSolverStatic::ComputeODE2Eigenvalues, py::return_value_policy::copy, "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)", py::arg("mainSystem"), py::arg("numberOfEigenvalues"), py::arg("shift") = 0., py::arg("tolerance") = 1e-12, py::arg("computeEigenVectors") = true)
         .def("__repr__", [](const MainSolverStatic &item) { return "<MainSolverStatic:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
 
@@ -593,6 +644,9 @@
         .def("SolveSystem", &MainSolverImplicitSecondOrder::SolveSystem, py::return_value_policy::copy, "solve System: InitializeSolver, SolveSteps, FinalizeSolver", py::arg("mainSystem"), py::arg("simulationSettings"))
         .def("FinalizeSolver", &MainSolverImplicitSecondOrder::FinalizeSolver, "write concluding information (timer statistics, messages) and close files", py::arg("mainSystem"), py::arg("simulationSettings"))
         .def("SolveSteps", &MainSolverImplicitSecondOrder::SolveSteps, py::return_value_policy::copy, "main solver part: calls multiple InitializeStep(...)/ DiscontinuousIteration(...)/ FinishStep(...); do step reduction if necessary; return true if success, false else", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("Advance", &MainSolverImplicitSecondOrder::Advance, py::return_value_policy::copy, "stepwise time integration, e.g., for control in the loop: perform steps from current time to current time + timeIncrement; the solver is initialized at the first call and solver data, factorizations, files and threads are kept until FinalizeSolver(...) is called; step size follows from simulationSettings (endTime-startTime)/numberOfSteps, reduced such that timeIncrement is an integer multiple; states and parameters may be modified between calls (but do not call Assemble()); return true if success, false else", py::arg("mainSystem"), py::arg("simulationSettings"), py::arg("timeIncrement"))
+        .def("SaveCheckpoint", &MainSolverImplicitSecondOrder::SaveCheckpoint, py::return_value_policy::copy, "write binary checkpoint file with all system states (reference, initial, current, startOfStep, visualization) and solver data needed to continue time integration (aAlgorithmic, step size, time, step and iteration counters), e.g., between calls to Advance(...); also stores values of sensors with storeInternal=True; NOT stored are item parameters (which may contain user functions and graphics data), LTG lists and jacobians: for restart, the model must be rebuilt by the same script and assembled before LoadCheckpoint(...); return true on success", py::arg("mainSystem"), py::arg("fileName"))
+        .def("LoadCheckpoint", &MainSolverImplicitSecondOrder::LoadCheckpoint, py::return_value_policy::copy, "load checkpoint written by SaveCheckpoint(...) into assembled system with identical structure (same items and coordinates); the solver is initialized for Advance(...) if needed and the next call to Advance(...) continues from the loaded states; return true on success", py::arg("mainSystem"), py::arg("simulationSettings"), py::arg("fileName"))
         .def("UpdateCurrentTime", &MainSolverImplicitSecondOrder::UpdateCurrentTime, "update currentTime (and load factor); MUST be overwritten in special solver class", py::arg("mainSystem"), py::arg("simulationSettings"))
         .def("InitializeStep", &MainSolverImplicitSecondOrder::InitializeStep, "initialize static step / time step; python-functions; do some outputs, checks, etc.", py::arg("mainSystem"), py::arg("simulationSettings"))
         .def("FinishStep", &MainSolverImplicitSecondOrder::FinishStep, "finish static step / time step; write output of results to file", py::arg("mainSystem"), py::arg("simulationSettings"))
@@ -622,7 +676,70 @@
         .def("ComputeJacobianAE", &MainSolverImplicitSecondOrder::ComputeJacobianAE, "add jacobian of algebraic equations (multiplied with factor) to systemJacobian in cSolver; the scalarFactors are scaling the derivatives w.r.t. ODE2 coordinates and w.r.t. ODE2_t (velocity) coordinates; if velocityLevel == true, the constraints are evaluated at velocity level", py::arg("mainSystem"), py::arg("scalarFactor_ODE2") = 1., py::arg("scalarFactor_ODE2_t") = 1., py::arg("velocityLevel") = false)
         .def("ComputeODE2RHS", &MainSolverImplicitSecondOrder::ComputeODE2RHS, "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)", py::arg("mainSystem"))
         .def("ComputeAlgebraicEquations", &MainSolverImplicitSecondOrder::ComputeAlgebraicEquations, "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)", py::arg("mainSystem"), py::arg("velocityLevel") = false)
+        .def("ComputeODE2Eigenvalues", &MainSolverImplicitSecondOrder::ComputeODE2Eigenvalues, py::return_value_policy::copy, "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)", py::arg("mainSystem"), py::arg("numberOfEigenvalues"), py::arg("shift") = 0., py::arg("tolerance") = 1e-12, py::arg("computeEigenVectors") = true)
         .def("__repr__", [](const MainSolverImplicitSecondOrder &item) { return "<MainSolverImplicitSecondOrder:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
         ; // AUTO: end of class definition!!!
 
     //++++++++++++++++++++++++++++++++
+    //++++++++++++++++++++++++++++++++
+    py::class_<MainSolverExplicit>(m, "MainSolverExplicit") // AUTO: 
+        .def(py::init<>())
+        .def_property("timer", &MainSolverExplicit::PyGetTimer, &MainSolverExplicit::PySetTimer)
+        .def_property("it", &MainSolverExplicit::PyGetIt, &MainSolverExplicit::PySetIt)
+        .def_property("conv", &MainSolverExplicit::PyGetConv, &MainSolverExplicit::PySetConv)
+        .def_property("output", &MainSolverExplicit::PyGetOutput, &MainSolverExplicit::PySetOutput)
+        .def_property("newton", &MainSolverExplicit::PyGetNewton, &MainSolverExplicit::PySetNewton)
+        // AUTO: access functions for MainSolverExplicit
+        .def("CheckInitialized", &MainSolverExplicit::CheckInitialized, py::return_value_policy::copy, "check if MainSolver and MainSystem are correctly initialized ==> otherwise raise SysError", py::arg("mainSystem"))
+        .def("GetSolverName", &MainSolverExplicit::GetSolverName, py::return_value_policy::copy, "get solver name - needed for output file header and visualization window")
+        .def("IsStaticSolver", &MainSolverExplicit::IsStaticSolver, py::return_value_policy::copy, "return true, if static solver; needs to be overwritten in derived class")
+        .def("GetSimulationEndTime", &MainSolverExplicit::GetSimulationEndTime, py::return_value_policy::copy, "compute simulation end time (depends on static or time integration solver)", py::arg("simulationSettings"))
+        .def("ReduceStepSize", &MainSolverExplicit::ReduceStepSize, py::return_value_policy::copy, "reduce step size (1..normal, 2..severe problems); return true, if reduction was successful", py::arg("mainSystem"), py::arg("simulationSettings"), py::arg("severity"))
+        .def("IncreaseStepSize", &MainSolverExplicit::IncreaseStepSize, "increase step size if convergence is good", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeSolver", &MainSolverExplicit::InitializeSolver, py::return_value_policy::copy, "initialize solverSpecific,data,it,conv; set/compute initial conditions (solver-specific!); initialize output files", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("PreInitializeSolverSpecific", &MainSolverExplicit::PreInitializeSolverSpecific, "pre-initialize for solver specific tasks; called at beginning of InitializeSolver, right after Solver data reset", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeSolverOutput", &MainSolverExplicit::InitializeSolverOutput, "initialize output files; called from InitializeSolver()", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeSolverPreChecks", &MainSolverExplicit::InitializeSolverPreChecks, py::return_value_policy::copy, "check if system is solvable; initialize dense/sparse computation modes", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeSolverData", &MainSolverExplicit::InitializeSolverData, "initialize all data,it,conv; called from InitializeSolver()", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeSolverInitialConditions", &MainSolverExplicit::InitializeSolverInitialConditions, "set/compute initial conditions (solver-specific!); called from InitializeSolver()", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("PostInitializeSolverSpecific", &MainSolverExplicit::PostInitializeSolverSpecific, "post-initialize for solver specific tasks; called at the end of InitializeSolver", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("SolveSystem", &MainSolverExplicit::SolveSystem, py::return_value_policy::copy, "solve System: InitializeSolver, SolveSteps, FinalizeSolver", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("FinalizeSolver", &MainSolverExplicit::FinalizeSolver, "write concluding information (timer statistics, messages) and close files", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("SolveSteps", &MainSolverExplicit::SolveSteps, py::return_value_policy::copy, "main solver part: calls multiple InitializeStep(...)/ DiscontinuousIteration(...)/ FinishStep(...); do step reduction if necessary; return true if success, false else", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("Advance", &MainSolverExplicit::Advance, py::return_value_policy::copy, "stepwise time integration, e.g., for control in the loop: perform steps from current time to current time + timeIncrement; the solver is initialized at the first call and solver data, factorizations, files and threads are kept until FinalizeSolver(...) is called; step size follows from simulationSettings (endTime-startTime)/numberOfSteps, reduced such that timeIncrement is an integer multiple; states and parameters may be modified between calls (but do not call Assemble()); return true if success, false else", py::arg("mainSystem"), py::arg("simulationSettings"), py::arg("timeIncrement"))
+        .def("SaveCheckpoint", &MainSolverExplicit::SaveCheckpoint, py::return_value_policy::copy, "write binary checkpoint file with all system states (reference, initial, current, startOfStep, visualization) and solver data needed to continue time integration (aAlgorithmic, step size, time, step and iteration counters), e.g., between calls to Advance(...); also stores values of sensors with storeInternal=True; NOT stored are item parameters (which may contain user functions and graphics data), LTG lists and jacobians: for restart, the model must be rebuilt by the same script and assembled before LoadCheckpoint(...); return true on success", py::arg("mainSystem"), py::arg("fileName"))
+        .def("LoadCheckpoint", &MainSolverExplicit::LoadCheckpoint, py::return_value_policy::copy, "load checkpoint written by SaveCheckpoint(...) into assembled system with identical structure (same items and coordinates); the solver is initialized for Advance(...) if needed and the next call to Advance(...) continues from the loaded states; return true on success", py::arg("mainSystem"), py::arg("simulationSettings"), py::arg("fileName"))
+        .def("UpdateCurrentTime", &MainSolverExplicit::UpdateCurrentTime, "update currentTime (and load factor); MUST be overwritten in special solver class", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("InitializeStep", &MainSolverExplicit::InitializeStep, "initialize static step / time step; python-functions; do some outputs, checks, etc.", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("FinishStep", &MainSolverExplicit::FinishStep, "finish static step / time step; write output of results to file", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("DiscontinuousIteration", &MainSolverExplicit::DiscontinuousIteration, py::return_value_policy::copy, "perform discontinuousIteration for static step / time step; CALLS ComputeNewtonResidual", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("Newton", &MainSolverExplicit::Newton, py::return_value_policy::copy, "perform Newton method for given solver method", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("ComputeNewtonResidual", &MainSolverExplicit::ComputeNewtonResidual, "compute residual for Newton method (e.g. static or time step); store result in systemResidual", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("ComputeNewtonUpdate", &MainSolverExplicit::ComputeNewtonUpdate, "compute update for currentState from newtonSolution (decrement from residual and jacobian)", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("ComputeNewtonJacobian", &MainSolverExplicit::ComputeNewtonJacobian, "compute jacobian for newton method of given solver method; store result in systemJacobian", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("WriteSolutionFileHeader", &MainSolverExplicit::WriteSolutionFileHeader, "write unique file header, depending on static/ dynamic simulation", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("WriteCoordinatesToFile", &MainSolverExplicit::WriteCoordinatesToFile, "write unique coordinates solution file", py::arg("mainSystem"), py::arg("simulationSettings"))
+        .def("IsVerboseCheck", &MainSolverExplicit::IsVerboseCheck, py::return_value_policy::copy, "return true, if file or console output is at or above the given level", py::arg("level"))
+        .def("VerboseWrite", &MainSolverExplicit::VerboseWrite, "write to console and/or file in case of level", py::arg("level"), py::arg("str"))
+        .def("GetODE2size", &MainSolverExplicit::GetODE2size, py::return_value_policy::reference, "number of ODE2 equations in solver")
+        .def("GetODE1size", &MainSolverExplicit::GetODE1size, py::return_value_policy::reference, "number of ODE1 equations in solver (not yet implemented)")
+        .def("GetAEsize", &MainSolverExplicit::GetAEsize, py::return_value_policy::reference, "number of algebraic equations in solver")
+        .def("GetDataSize", &MainSolverExplicit::GetDataSize, py::return_value_policy::reference, "number of data (history) variables in solver")
+        .def("GetSystemJacobian", &MainSolverExplicit::GetSystemJacobian, py::return_value_policy::copy, "get locally stored / last computed system jacobian of solver")
+        .def("GetSystemMassMatrix", &MainSolverExplicit::GetSystemMassMatrix, py::return_value_policy::copy, "get locally stored / last computed mass matrix of solver")
+        .def("GetSystemResidual", &MainSolverExplicit::GetSystemResidual, py::return_value_policy::copy, "get locally stored / last computed system residual")
+        .def("GetNewtonSolution", &MainSolverExplicit::GetNewtonSolution, py::return_value_policy::copy, "get locally stored / last computed solution (=increment) of Newton")
+        .def("SetSystemJacobian", &MainSolverExplicit::SetSystemJacobian, "set locally stored system jacobian of solver; must have size nODE2+nODE1+nAE", py::arg("systemJacobian"))
+        .def("SetSystemMassMatrix", &MainSolverExplicit::SetSystemMassMatrix, "set locally stored mass matrix of solver; must have size nODE2+nODE1+nAE", py::arg("systemMassMatrix"))
+        .def("SetSystemResidual", &MainSolverExplicit::SetSystemResidual, "set locally stored system residual; must have size nODE2+nODE1+nAE", py::arg("systemResidual"))
+        .def("ComputeMassMatrix", &MainSolverExplicit::ComputeMassMatrix, "compute systemMassMatrix (multiplied with factor) in cSolver and return mass matrix", py::arg("mainSystem"), py::arg("scalarFactor") = 1.)
+        .def("ComputeJacobianODE2RHS", &MainSolverExplicit::ComputeJacobianODE2RHS, "set systemJacobian to zero and add jacobian (multiplied with factor) of ODE2RHS to systemJacobian in cSolver", py::arg("mainSystem"), py::arg("scalarFactor") = 1.)
+        .def("ComputeJacobianODE2RHS_t", &MainSolverExplicit::ComputeJacobianODE2RHS_t, "add jacobian of ODE2RHS_t (multiplied with factor) to systemJacobian in cSolver", py::arg("mainSystem"), py::arg("scalarFactor") = 1.)
+        .def("ComputeJacobianAE", &MainSolverExplicit::ComputeJacobianAE, "add jacobian of algebraic equations (multiplied with factor) to systemJacobian in cSolver; the scalarFactors are scaling the derivatives w.r.t. ODE2 coordinates and w.r.t. ODE2_t (velocity) coordinates; if velocityLevel == true, the constraints are evaluated at velocity level", py::arg("mainSystem"), py::arg("scalarFactor_ODE2") = 1., py::arg("scalarFactor_ODE2_t") = 1., py::arg("velocityLevel") = false)
+        .def("ComputeODE2RHS", &MainSolverExplicit::ComputeODE2RHS, "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)", py::arg("mainSystem"))
+        .def("ComputeAlgebraicEquations", &MainSolverExplicit::ComputeAlgebraicEquations, "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)", py::arg("mainSystem"), py::arg("velocityLevel") = false)
+        .def("ComputeODE2Eigenvalues", &MainSolverExplicit::ComputeODE2Eigenvalues, py::return_value_policy::copy, "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)", py::arg("mainSystem"), py::arg("numberOfEigenvalues"), py::arg("shift") = 0., py::arg("tolerance") = 1e-12, py::arg("computeEigenVectors") = true)
+        .def("__repr__", [](const MainSolverExplicit &item) { return "<MainSolverExplicit:\n" + EXUstd::ToString(item) + " >"; } ) //!< AUTO: add representation for object based on ostream operator
+        ; // AUTO: end of class definition!!!
+
+    //++++++++++++++++++++++++++++++++
@@ -4,7 +4,7 @@
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -28,7 +28,7 @@ class SolutionSettings // AUTO:
 public: // AUTO: 
   bool writeSolutionToFile;                       //!< AUTO: flag (true/false), which determines if (global) solution vector is written to file
   bool appendToFile;                              //!< AUTO: flag (true/false); if true, solution and solverInformation is appended to existing file (otherwise created)
-  bool writeFileHeader;                           //!< AUTO: flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration)
+  bool writeFileHeader;                           //!< AUTO: flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration); not used for binarySolutionFile, which always has a header
   bool writeFileFooter;                           //!< AUTO: flag (true/false); if true, information at end of simulation is written: convergence, total solution time, statistics
   Real solutionWritePeriod;                       //!< AUTO: time span (period), determines how often the solution is written during a simulation
   bool sensorsAppendToFile;                       //!< AUTO: flag (true/false); if true, sensor output is appended to existing file (otherwise created)
@@ -42,6 +42,9 @@ public: // AUTO:
   std::string solverInformationFileName;          //!< AUTO: filename and (relative) path of text file showing detailed information during solving; detail level according to yourSolver.verboseModeFile; if solutionSettings.appendToFile is true, the information is appended in every solution step; directory will be created if it does not exist
   std::string solutionInformation;                //!< AUTO: special information added to header of solution file (e.g. parameters and settings, modes, ...)
   Index outputPrecision;                          //!< AUTO: precision for floating point numbers written to solution and sensor files
+  bool binarySolutionFile;                        //!< AUTO: flag (true/false); if true, the coordinates solution file is written in binary format: a fixed header of 128 bytes (8 characters EXUDYNSF, followed by 15 int64 values: version, bytes per real, isStatic flag, system coordinates [nODE2, nODE1, nAlgebraic, nData], written coordinates [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData] and number of planned steps) followed by frames [time, coordinates...] of raw float64 (or float32) values in native byte order; the file is written from a background thread with double buffering, such that the solver does not wait for the disk; read the file with utilities.LoadBinarySolutionFile(...); outputPrecision and solutionInformation are not used; with appendToFile=True, frames are appended to an existing (non-empty) file without writing the header again, which requires the same number of coordinates and precision
+  bool binarySinglePrecision;                     //!< AUTO: flag (true/false); if true, values in the binary solution file (binarySolutionFile=True) are stored as float32 (including time), otherwise as float64
+  Index binaryBufferSize;                         //!< AUTO: size of each of the two buffers in bytes used for the binary solution file; data is handed over to the writer thread whenever a buffer exceeds this size
   Real recordImagesInterval;                      //!< AUTO: record frames (images) during solving: amount of time to wait until next image (frame) is recorded; set recordImages = -1. if no images shall be recorded; set, e.g., recordImages = 0.01 to record an image every 10 milliseconds (requires that the time steps / load steps are sufficiently small!); for file names, etc., see VisualizationSettings.exportImages
 
 
@@ -64,6 +67,9 @@ public: // AUTO:
     coordinatesSolutionFileName = "coordinatesSolution.txt";
     solverInformationFileName = "solverInformation.txt";
     outputPrecision = 10;
+    binarySolutionFile = false;
+    binarySinglePrecision = false;
+    binaryBufferSize = 4194304;
     recordImagesInterval = -1.;
   };
 
@@ -88,6 +94,9 @@ public: // AUTO:
     os << "  solverInformationFileName = " << solverInformationFileName << "\n";
     os << "  solutionInformation = " << solutionInformation << "\n";
     os << "  outputPrecision = " << outputPrecision << "\n";
+    os << "  binarySolutionFile = " << binarySolutionFile << "\n";
+    os << "  binarySinglePrecision = " << binarySinglePrecision << "\n";
+    os << "  binaryBufferSize = " << binaryBufferSize << "\n";
     os << "  recordImagesInterval = " << recordImagesInterval << "\n";
     os << "\n";
   }
@@ -107,7 +116,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -129,6 +138,8 @@ public: // AUTO:
   Real minimumCoordinateSize;                     //!< AUTO: minimum size of coordinates in relative differentiation parameter
   bool doSystemWideDifferentiation;               //!< AUTO: true: system wide differentiation (e.g. all ODE2 equations w.r.t. all ODE2 coordinates); false: only local (object) differentiation
   bool addReferenceCoordinatesToEpsilon;          //!< AUTO: true: for the size estimation of the differentiation parameter, the reference coordinate \f$q^{Ref}_i\f$ is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter
+  bool useColumnCompression;                      //!< AUTO: true: system wide numerical jacobians (doSystemWideDifferentiation=true for ODE2 equations, and numerical AE jacobians) perturb structurally orthogonal columns together (Curtis-Powell-Reid compression), using the sparsity pattern given by the object coordinate lists; this reduces the number of residual evaluations from the number of coordinates to the number of column colors; dependencies not represented in the coordinate lists (e.g. loads with user functions depending on other coordinates) are not captured; false: every column is differentiated separately
+  bool useAnalyticJacobians;                      //!< AUTO: true: local ODE2 jacobians (w.r.t. ODE2 coordinates and velocities) of objects which provide jacobian functions (see GetAvailableJacobians(); e.g. ANCFCable2D, RigidBody with Euler parameters and ConnectorSpringDamper using automatic differentiation, ConnectorCartesianSpringDamper, ConnectorCoordinateSpringDamper and ContactSpheresTriangleMesh) are computed analytically instead of numerical differentiation; connectors are only differentiated analytically, if their markers have jacobians which do not depend on coordinates (e.g. mass points, point nodes, coordinates), otherwise numerical differentiation is used; ContactSpheresTriangleMesh is also differentiated analytically for rigid body markers, for which the derivatives of the marker jacobians are added by numerical differentiation of the marker jacobians; not used with doSystemWideDifferentiation
 
 
 public: // AUTO: 
@@ -139,6 +150,8 @@ public: // AUTO:
     minimumCoordinateSize = 1e-2;
     doSystemWideDifferentiation = false;
     addReferenceCoordinatesToEpsilon = false;
+    useColumnCompression = false;
+    useAnalyticJacobians = false;
   };
 
   // AUTO: access functions
@@ -150,6 +163,8 @@ public: // AUTO:
     os << "  minimumCoordinateSize = " << minimumCoordinateSize << "\n";
     os << "  doSystemWideDifferentiation = " << doSystemWideDifferentiation << "\n";
     os << "  addReferenceCoordinatesToEpsilon = " << addReferenceCoordinatesToEpsilon << "\n";
+    os << "  useColumnCompression = " << useColumnCompression << "\n";
+    os << "  useAnalyticJacobians = " << useAnalyticJacobians << "\n";
     os << "\n";
   }
 
@@ -168,7 +183,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -204,6 +219,8 @@ public: // AUTO:
   Index maxDiscontinuousIterations;               //!< AUTO: maximum number of discontinuous (post Newton) iterations
   bool ignoreMaxDiscontinuousIterations;          //!< AUTO: continue solver if maximum number of discontinuous (post Newton) iterations is reached (ignore tolerance)
   Real discontinuousIterationTolerance;           //!< AUTO: absolute tolerance for discontinuous (post Newton) iterations; the errors represent absolute residuals and can be quite high
+  bool useContactBroadPhase;                      //!< AUTO: true: once per step, bounding boxes of all circles and cable segments of circle-cable contacts (ContactCircleCable2D, ContactFrictionCircleCable2D) are computed (once per marker) and overlapping circle-cable pairs are found by sweep-and-prune; contacts of non-overlapping pairs, which are not in contact, skip the discontinuous (post Newton) iteration, such that gap functions are only evaluated for candidates; the bounding boxes are enlarged by contactBroadPhaseMargin and twice the distance which circle and cable travel with their current velocities within one step
+  Real contactBroadPhaseMargin;                   //!< AUTO: additional distance added to circle radius and offset in contact broad phase (useContactBroadPhase); must be larger than unexpected changes of distance between circle and cable within one step (e.g. due to large accelerations)
   Index stepInformation;                          //!< AUTO: 0 ... only current step time, 1 ... show time to go, 2 ... show newton iterations (Nit) per step, 3 ... show discontinuous iterations (Dit) and newton jacobians (jac) per step
 
 
@@ -228,6 +245,8 @@ public: // AUTO:
     maxDiscontinuousIterations = 5;
     ignoreMaxDiscontinuousIterations = true;
     discontinuousIterationTolerance = 1;
+    useContactBroadPhase = false;
+    contactBroadPhaseMargin = 0;
     stepInformation = 2;
   };
 
@@ -254,6 +273,8 @@ public: // AUTO:
     os << "  maxDiscontinuousIterations = " << maxDiscontinuousIterations << "\n";
     os << "  ignoreMaxDiscontinuousIterations = " << ignoreMaxDiscontinuousIterations << "\n";
     os << "  discontinuousIterationTolerance = " << discontinuousIterationTolerance << "\n";
+    os << "  useContactBroadPhase = " << useContactBroadPhase << "\n";
+    os << "  contactBroadPhaseMargin = " << contactBroadPhaseMargin << "\n";
     os << "  stepInformation = " << stepInformation << "\n";
     os << "\n";
   }
@@ -273,7 +294,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -334,13 +355,77 @@ public: // AUTO:
 };
 
 
+/** ***********************************************************************************************
+* @class        ExplicitIntegrationSettings
+* @brief        Settings for explicit solvers, like explicit Euler, RK4 or the embedded Runge-Kutta method RK45 (Dormand-Prince); constraints are solved on acceleration level (index 1) with position and velocity projection after every step.
+*
+* @author       AUTO: Gerstmayr Johannes
+* @date         AUTO: 2019-07-01 (generated)
+* @date         AUTO: 2026-10-18 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: missing
+                
+************************************************************************************************ **/
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "Main/OutputVariable.h"
+#include "Linalg/BasicLinalg.h"
+
+class ExplicitIntegrationSettings // AUTO: 
+{
+public: // AUTO: 
+  DynamicSolverType dynamicSolverType;            //!< AUTO: selection of explicit solver: exu.DynamicSolverType.ExplicitEuler (1st order), exu.DynamicSolverType.RK4 (classical Runge-Kutta, constant step size) or exu.DynamicSolverType.RK45 (Dormand-Prince, adaptive step size if adaptiveStep=True)
+  bool useConstantMassMatrix;                     //!< AUTO: true: mass matrix is only computed and factorized once at the start of the simulation; only used for systems without constraints (nAE=0); the user is responsible that the mass matrix is really constant
+  bool useConstraintProjection;                   //!< AUTO: true: after every step, position level constraints and velocity level constraints are projected in order to avoid drift of the acceleration level formulation
+  Real absoluteTolerance;                         //!< AUTO: absolute tolerance for error estimate of adaptive RK45 solver
+  Real relativeTolerance;                         //!< AUTO: relative tolerance for error estimate of adaptive RK45 solver; error is normalized by absoluteTolerance + relativeTolerance*|coordinate|
+
+
+public: // AUTO: 
+  //! AUTO: default constructor with parameter initialization
+  ExplicitIntegrationSettings()
+  {
+    dynamicSolverType = DynamicSolverType::RK45;
+    useConstantMassMatrix = false;
+    useConstraintProjection = true;
+    absoluteTolerance = 1e-8;
+    relativeTolerance = 1e-8;
+  };
+
+  // AUTO: access functions
+  //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
+  virtual void Print(std::ostream& os) const
+  {
+    os << "ExplicitIntegrationSettings" << ":\n";
+    os << "  dynamicSolverType = " << dynamicSolverType << "\n";
+    os << "  useConstantMassMatrix = " << useConstantMassMatrix << "\n";
+    os << "  useConstraintProjection = " << useConstraintProjection << "\n";
+    os << "  absoluteTolerance = " << absoluteTolerance << "\n";
+    os << "  relativeTolerance = " << relativeTolerance << "\n";
+    os << "\n";
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const ExplicitIntegrationSettings& object)
+  {
+    object.Print(os);
+    return os;
+  }
+
+};
+
+
 /** ***********************************************************************************************
 * @class        TimeIntegrationSettings
 * @brief        General parameters used in time integration; specific parameters are provided in the according solver settings, e.g. for generalizedAlpha.
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -364,9 +449,11 @@ public: // AUTO:
   Index numberOfSteps;                            //!< AUTO: number of steps in time integration; stepsize is computed from (endTime-startTime)/numberOfSteps
   bool adaptiveStep;                              //!< AUTO: true: use step reduction if step fails; false: constant step size
   Real minimumStepSize;                           //!< AUTO: lower limit of time step size, before integrator stops
+  bool reuseConstantMassMatrix;                   //!< AUTO: true: if all bodies have a constant mass matrix (e.g. mass points, 2D rigid bodies, ANCFCable2D or GenericODE2 without massMatrixUserFunction), the system mass matrix is computed only once at the beginning of time integration and reused in all steps and Newton iterations; the mass matrix is recomputed, if object parameters are changed with SetObjectParameter, ModifyObject or parameter handles (e.g. in preStepFunction); changes of mass parameters by other means (e.g. in C++) are not detected
   Index verboseMode;                              //!< AUTO: 0 ... no output, 1 ... show short step information every 2 seconds (error), 2 ... show every step information, 3 ... show also solution vector, 4 ... show also mass matrix and jacobian (implicit methods), 5 ... show also Jacobian inverse (implicit methods)
   Index verboseModeFile;                          //!< AUTO: same behaviour as verboseMode, but outputs all solver information to file
   GeneralizedAlphaSettings generalizedAlpha;      //!< AUTO: parameters for generalized-alpha, implicit trapezoidal rule or Newmark (options only apply for these methods)
+  ExplicitIntegrationSettings explicitIntegration;//!< AUTO: parameters for explicit solvers (options only apply for ExplicitEuler, RK4 and RK45)
   std::string preStepPyExecute;                   //!< AUTO: DEPRECATED, use preStepFunction in simulation settings; Python code to be executed prior to every step and after last step, e.g. for postprocessing
 
 
@@ -379,6 +466,7 @@ public: // AUTO:
     numberOfSteps = 100;
     adaptiveStep = true;
     minimumStepSize = 1e-8;
+    reuseConstantMassMatrix = true;
     verboseMode = 0;
     verboseModeFile = 0;
   };
@@ -394,9 +482,11 @@ public: // AUTO:
     os << "  numberOfSteps = " << numberOfSteps << "\n";
     os << "  adaptiveStep = " << adaptiveStep << "\n";
     os << "  minimumStepSize = " << minimumStepSize << "\n";
+    os << "  reuseConstantMassMatrix = " << reuseConstantMassMatrix << "\n";
     os << "  verboseMode = " << verboseMode << "\n";
     os << "  verboseModeFile = " << verboseModeFile << "\n";
     os << "  generalizedAlpha = " << generalizedAlpha << "\n";
+    os << "  explicitIntegration = " << explicitIntegration << "\n";
     os << "  preStepPyExecute = " << preStepPyExecute << "\n";
     os << "\n";
   }
@@ -416,7 +506,7 @@ public: // AUTO:
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -496,13 +586,86 @@ public: // AUTO:
 };
 
 
+/** ***********************************************************************************************
+* @class        LinearSolverSettings
+* @brief        Settings for linear solver, both dense and sparse (Eigen).
+*
+* @author       AUTO: Gerstmayr Johannes
+* @date         AUTO: 2019-07-01 (generated)
+* @date         AUTO: 2026-10-18 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: missing
+                
+************************************************************************************************ **/
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "Main/OutputVariable.h"
+#include "Linalg/BasicLinalg.h"
+
+class LinearSolverSettings // AUTO: 
+{
+public: // AUTO: 
+  bool reuseAnalyzedPattern;                      //!< AUTO: true: in sparse mode (EigenSparse), the symbolic analysis (COLAMD ordering and analyzePattern) of the system Jacobian is only performed, if the sparsity pattern changed since the last factorization; the pattern is compared exactly, therefore this flag is safe for systems with changing pattern (e.g. contact), but it adds a small overhead in these cases; false: symbolic analysis is done in every factorization
+  bool fixedPatternAssembly;                      //!< AUTO: true: in sparse mode (EigenSparse), the sparsity pattern of system Jacobian and mass matrix is kept after the first assembly and later updates (Jacobian, mass matrix) add their values directly into the compressed sparse matrix, using a scatter map of value positions which is recorded from the local-to-global (LTG) coordinate lists; this avoids sorting, summation and reallocation of triplets in every update; entries which are not contained in the pattern (e.g. changed connectivity in contact) are detected and the pattern is extended automatically; false: matrices are rebuilt from triplets in every update
+  IterativeSolverType iterativeSolverType;        //!< AUTO: Krylov method for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.IterativeSolverType.GMRES (restarted GMRES, general matrices), exu.IterativeSolverType.BiCGSTAB (general matrices, less memory than GMRES) or exu.IterativeSolverType.CG (conjugate gradient, only for symmetric positive definite matrices, e.g., static problems without constraints)
+  PreconditionerType preconditionerType;          //!< AUTO: preconditioner for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.PreconditionerType.ILU0 (incomplete LU without fill-in), exu.PreconditionerType.BlockJacobi (dense LU of diagonal blocks of size iterativeBlockSize), exu.PreconditionerType.Jacobi (diagonal) or exu.PreconditionerType._None; the preconditioner is only recomputed, if the Newton solver updates the Jacobian; zero pivots (e.g. due to constraints) are regularized
+  Real iterativeTolerance;                        //!< AUTO: relative tolerance for iterative solver (EigenSparseIterative): iterations stop, if the norm of the linear residual is smaller than iterativeTolerance times the norm of the right-hand-side; must be considerably smaller than the Newton tolerance
+  Index iterativeMaxIterations;                   //!< AUTO: maximum number of iterations of iterative solver (EigenSparseIterative) per solve; if tolerance is not reached, the last iterate is used and the Newton method decides on convergence; non-converged solves are counted in solver statistics
+  Index gmresRestart;                             //!< AUTO: dimension of Krylov subspace of restarted GMRES; larger values improve convergence, but need more memory (gmresRestart vectors of system size)
+  Index iterativeBlockSize;                       //!< AUTO: size of diagonal blocks for exu.PreconditionerType.BlockJacobi, e.g. 6 for rigid bodies with Euler parameters or 3 for 3D finite element nodes
+
+
+public: // AUTO: 
+  //! AUTO: default constructor with parameter initialization
+  LinearSolverSettings()
+  {
+    reuseAnalyzedPattern = false;
+    fixedPatternAssembly = false;
+    iterativeSolverType = IterativeSolverType::GMRES;
+    preconditionerType = PreconditionerType::ILU0;
+    iterativeTolerance = 1e-10;
+    iterativeMaxIterations = 1000;
+    gmresRestart = 50;
+    iterativeBlockSize = 6;
+  };
+
+  // AUTO: access functions
+  //! AUTO: print function used in ostream operator (print is virtual and can thus be overloaded)
+  virtual void Print(std::ostream& os) const
+  {
+    os << "LinearSolverSettings" << ":\n";
+    os << "  reuseAnalyzedPattern = " << reuseAnalyzedPattern << "\n";
+    os << "  fixedPatternAssembly = " << fixedPatternAssembly << "\n";
+    os << "  iterativeSolverType = " << iterativeSolverType << "\n";
+    os << "  preconditionerType = " << preconditionerType << "\n";
+    os << "  iterativeTolerance = " << iterativeTolerance << "\n";
+    os << "  iterativeMaxIterations = " << iterativeMaxIterations << "\n";
+    os << "  gmresRestart = " << gmresRestart << "\n";
+    os << "  iterativeBlockSize = " << iterativeBlockSize << "\n";
+    os << "\n";
+  }
+
+  friend std::ostream& operator<<(std::ostream& os, const LinearSolverSettings& object)
+  {
+    object.Print(os);
+    return os;
+  }
+
+};
+
+
 /** ***********************************************************************************************
 * @class        SimulationSettings
 * @brief        General Settings for simulation; according settings for solution and solvers are given in subitems of this structure
 *
 * @author       AUTO: Gerstmayr Johannes
 * @date         AUTO: 2019-07-01 (generated)
-* @date         AUTO: 2020-12-02 (last modfied)
+* @date         AUTO: 2026-10-18 (last modfied)
 *
 * @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
 * @note         Bug reports, support and further information:
@@ -523,7 +686,8 @@ public: // AUTO:
   TimeIntegrationSettings timeIntegration;        //!< AUTO: time integration parameters
   SolutionSettings solutionSettings;              //!< AUTO: settings for solution files
   StaticSolverSettings staticSolver;              //!< AUTO: static solver parameters
-  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)
+  LinearSolverType linearSolverType;              //!< AUTO: selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting, Cholesky factorization for symmetric positive definite matrices), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseIterative (sparse matrix with preconditioned iterative solver, see linearSolverSettings), ... (enumeration type)
+  LinearSolverSettings linearSolverSettings;      //!< AUTO: linear solver parameters (used for dense and sparse solvers)
   bool cleanUpMemory;                             //!< AUTO: true: solvers will free memory at exit (recommended for large systems); false: keep allocated memory for repeated computations to increase performance
   bool displayStatistics;                         //!< AUTO: display general computation information at end of time step (steps, iterations, function calls, step rejections, ...
   bool displayComputationTime;                    //!< AUTO: display computation time statistics at end of solving
@@ -554,6 +718,7 @@ public: // AUTO:
     os << "  solutionSettings = " << solutionSettings << "\n";
     os << "  staticSolver = " << staticSolver << "\n";
     os << "  linearSolverType = " << linearSolverType << "\n";
+    os << "  linearSolverSettings = " << linearSolverSettings << "\n";
     os << "  cleanUpMemory = " << cleanUpMemory << "\n";
     os << "  displayStatistics = " << displayStatistics << "\n";
     os << "  displayComputationTime = " << displayComputationTime << "\n";
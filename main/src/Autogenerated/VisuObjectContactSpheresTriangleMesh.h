@@ -0,0 +1,77 @@
+/** ***********************************************************************************************
+* @class        VisualizationObjectContactSpheresTriangleMesh
+* @brief        A penalty-based contact/friction condition between a set of spheres (or points) fixed to a rigid body (=marker0, a Rigid-Body Marker) and a static triangle mesh fixed to a second (usually ground) body (=marker1, a Rigid-Body Marker), e.g., for rigid bodies rolling and sliding on complex terrain; sphere positions are given in marker0 coordinates and mesh points in marker1 coordinates; a bounding volume hierarchy of the mesh is built once (upon setting the parameters), such that the closest point on the mesh is found in O(log n) for n triangles; a node NodeGenericData is required with one coordinate per sphere, containing the contact gap of the last discontinuous iteration; the contact force \f$f_n\f$ is zero for \f$gap>0\f$ and otherwise computed from \f$f_n = -gap*contactStiffness - \dot{gap}*contactDamping\f$; during Newton iterations, the contact force is actived only, if \f$dataCoordinate[i] <= 0\f$; dataCoordinate is set equal to gap in nonlinear iterations, but not modified in Newton iterations.
+*
+* @author       Gerstmayr Johannes
+* @date         2019-07-01 (generated)
+* @date         2026-10-18  01:57:51 (last modfied)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: https://github.com/jgerstmayr/EXUDYN
+                
+************************************************************************************************ */
+
+#ifndef VISUALIZATIONOBJECTCONTACTSPHERESTRIANGLEMESH__H
+#define VISUALIZATIONOBJECTCONTACTSPHERESTRIANGLEMESH__H
+
+#include <ostream>
+
+#include "Utilities/ReleaseAssert.h"
+#include "Utilities/BasicDefinitions.h"
+#include "System/ItemIndices.h"
+
+class VisualizationObjectContactSpheresTriangleMesh: public VisualizationObject // AUTO: 
+{
+protected: // AUTO: 
+    bool showMesh;                                //!< AUTO: set true, if edges of the triangle mesh shall be drawn; set false for large meshes, which are drawn by graphicsData of the mesh body
+    float drawSize;                               //!< AUTO: drawing size of contact points (used if sphereRadius = 0); size == -1.f means that default contact points size is used
+    Float4 color;                                 //!< AUTO: RGBA connector color; if R==-1, use default color
+
+public: // AUTO: 
+    //! AUTO: default constructor with parameter initialization
+    VisualizationObjectContactSpheresTriangleMesh()
+    {
+        show = true;
+        showMesh = true;
+        drawSize = -1.f;
+        color = Float4({-1.f,-1.f,-1.f,-1.f});
+    };
+
+    // AUTO: access functions
+    //! AUTO:  Update visualizationSystem -> graphicsData for item; index shows item Number in CData
+    virtual void UpdateGraphics(const VisualizationSettings& visualizationSettings, VisualizationSystem* vSystem, Index itemNumber) override;
+
+    //! AUTO:  this function is needed to distinguish connector objects from body objects
+    virtual bool IsConnector() const override
+    {
+        return true;
+    }
+
+    //! AUTO:  Write (Reference) access to:set true, if edges of the triangle mesh shall be drawn; set false for large meshes, which are drawn by graphicsData of the mesh body
+    void SetShowMesh(const bool& value) { showMesh = value; }
+    //! AUTO:  Read (Reference) access to:set true, if edges of the triangle mesh shall be drawn; set false for large meshes, which are drawn by graphicsData of the mesh body
+    const bool& GetShowMesh() const { return showMesh; }
+    //! AUTO:  Read (Reference) access to:set true, if edges of the triangle mesh shall be drawn; set false for large meshes, which are drawn by graphicsData of the mesh body
+    bool& GetShowMesh() { return showMesh; }
+
+    //! AUTO:  Write (Reference) access to:drawing size of contact points (used if sphereRadius = 0); size == -1.f means that default contact points size is used
+    void SetDrawSize(const float& value) { drawSize = value; }
+    //! AUTO:  Read (Reference) access to:drawing size of contact points (used if sphereRadius = 0); size == -1.f means that default contact points size is used
+    const float& GetDrawSize() const { return drawSize; }
+    //! AUTO:  Read (Reference) access to:drawing size of contact points (used if sphereRadius = 0); size == -1.f means that default contact points size is used
+    float& GetDrawSize() { return drawSize; }
+
+    //! AUTO:  Write (Reference) access to:RGBA connector color; if R==-1, use default color
+    void SetColor(const Float4& value) { color = value; }
+    //! AUTO:  Read (Reference) access to:RGBA connector color; if R==-1, use default color
+    const Float4& GetColor() const { return color; }
+    //! AUTO:  Read (Reference) access to:RGBA connector color; if R==-1, use default color
+    Float4& GetColor() { return color; }
+
+};
+
+
+
+#endif //#ifdef include once...
@@ -49,20 +49,38 @@
   py::enum_<DynamicSolverType>(m, "DynamicSolverType")
 		.value("GeneralizedAlpha", DynamicSolverType::GeneralizedAlpha)    //an implicit solver for index 3 problems; allows to set variables also for Newmark and trapezoidal implicit index 2 solvers
 		.value("TrapezoidalIndex2", DynamicSolverType::TrapezoidalIndex2)    //an implicit solver for index 3 problems with index2 reduction; uses generalized alpha solver with settings for Newmark with index2 reduction
-		.value("ExplicitEuler", DynamicSolverType::ExplicitEuler)    //[NOT IMPLEMENTED YET] an explicit first order solver for systems without constraints
-		.value("RK45", DynamicSolverType::RK45)    //[NOT IMPLEMENTED YET] an explicit Runge Kutta solver of 4th order for systems without constraints; includes adaptive step selection
+		.value("ExplicitEuler", DynamicSolverType::ExplicitEuler)    //an explicit first order solver; constraints are solved on acceleration level and projected after every step
+		.value("RK45", DynamicSolverType::RK45)    //an explicit embedded Runge Kutta solver of 5th order (Dormand-Prince) with 4th order error estimate for adaptive step selection
+		.value("RK4", DynamicSolverType::RK4)    //classical explicit Runge Kutta solver of 4th order with constant step size
 		.export_values();
 
   py::enum_<LinearSolverType>(m, "LinearSolverType")
 		.value("_None", LinearSolverType::_None)    //no value; used, e.g., if no solver is selected
 		.value("EXUdense", LinearSolverType::EXUdense)    //use dense matrices and according solvers for densly populated matrices (usually the CPU time grows cubically with the number of unknowns)
 		.value("EigenSparse", LinearSolverType::EigenSparse)    //use sparse matrices and according solvers; additional overhead for very small systems; specifically, memory allocation is performed during a factorization process
+		.value("EigenSparseIterative", LinearSolverType::EigenSparseIterative)    //use sparse matrices and preconditioned iterative (Krylov) solvers for the system Jacobian; avoids fill-in of direct factorization for large systems; see linearSolverSettings
+		.export_values();
+
+  py::enum_<IterativeSolverType>(m, "IterativeSolverType")
+		.value("GMRES", IterativeSolverType::GMRES)    //restarted GMRES; for general (non-symmetric) matrices
+		.value("BiCGSTAB", IterativeSolverType::BiCGSTAB)    //BiCGSTAB; for general (non-symmetric) matrices, short recurrences
+		.value("CG", IterativeSolverType::CG)    //conjugate gradient; only for symmetric positive definite matrices
+		.export_values();
+
+  py::enum_<PreconditionerType>(m, "PreconditionerType")
+		.value("_None", PreconditionerType::_None)    //no preconditioner
+		.value("Jacobi", PreconditionerType::Jacobi)    //diagonal (Jacobi) preconditioner
+		.value("BlockJacobi", PreconditionerType::BlockJacobi)    //block diagonal preconditioner with dense LU factorization of diagonal blocks
+		.value("ILU0", PreconditionerType::ILU0)    //incomplete LU factorization without fill-in
 		.export_values();
 
 
         m.def("GetVersionString", &PyGetVersionString, "Get EXUDYN module version as string");
         m.def("StartRenderer", &PyStartOpenGLRenderer, "Start OpenGL rendering engine (in separate thread); use verbose=True to output information during OpenGL window creation", py::arg("verbose") = false);
         m.def("StopRenderer", &PyStopOpenGLRenderer, "Stop OpenGL rendering engine");
+        m.def("ComputeSparseEigenvalues", &PyComputeSparseEigenvalues, "Compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the symmetric eigenvalue problem K*phi = lambda*M*phi with a sparse shift-invert Lanczos solver (C++, no scipy); stiffnessMatrix and massMatrix are sparse matrices given as numpy arrays with rows [row, column, value] (sparse format of FEM module, duplicates are summed up); tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenValues sorted ascending and eigenvectors in columns; the numpy arrays own the solver results (no copy)", py::arg("stiffnessMatrix"), py::arg("massMatrix"), py::arg("numberOfEigenvalues"), py::arg("shift") = 0., py::arg("tolerance") = 1e-12, py::arg("computeEigenVectors") = true);
+        m.def("ComputeSparseGyroscopicEigenvalues", &PyComputeSparseGyroscopicEigenvalues, "Compute numberOfEigenvalues complex eigenvalues closest to (real) shift and eigenvectors of the gyroscopic eigenvalue problem (lambda**2*M + lambda*gyroscopicFactor*G + K)*phi = 0, e.g., for Campbell diagrams with gyroscopicFactor being the rotation speed; uses a sparse shift-invert Arnoldi solver for the according first order system; matrices are given as numpy arrays with rows [row, column, value] (sparse format of FEM module); returns [eigenValues, eigenVectors] as complex numpy arrays with eigenValues sorted by distance to shift and eigenvectors (normalized to length 1) in columns", py::arg("stiffnessMatrix"), py::arg("gyroscopicMatrix"), py::arg("massMatrix"), py::arg("gyroscopicFactor"), py::arg("numberOfEigenvalues"), py::arg("shift") = 0., py::arg("tolerance") = 1e-12, py::arg("computeEigenVectors") = false);
+        m.def("SolveBatch", &PySolveBatch, "Solve numberOfVariants=parameterValues.shape[0] variants of the assembled system mbs in parallel threads (C++ threads, no python multiprocessing); every thread works on its own copy of mbs; parameters is a list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] (for vector parameters) with itemType being 'Node', 'Object', 'Marker', 'Load' or 'Sensor'; variant i solves the system with parameter j set to parameterValues[i,j]; solverType selects the dynamic solver as in SolveDynamic, staticSolver=True uses the static solver; numberOfThreads=0 uses all hardware threads; returns a numpy array with one row per variant, containing the concatenated final values of sensors in sensorNumbers or the final ODE2 coordinates if sensorNumbers is empty; rows of failed variants contain NaN; sensors in the copies do not write to files; python user functions are called with the python GIL and therefore are not executed in parallel", py::arg("mbs"), py::arg("simulationSettings"), py::arg("parameters"), py::arg("parameterValues"), py::arg("sensorNumbers") = py::list(), py::arg("solverType") = DynamicSolverType::GeneralizedAlpha, py::arg("staticSolver") = false, py::arg("numberOfThreads") = 0);
         m.def("SetOutputPrecision", &PySetOutputPrecision, "Set the precision (integer) for floating point numbers written to console (reset when simulation is started!)", py::arg("numberOfDigits"));
         m.def("SetLinalgOutputFormatPython", &PySetLinalgOutputFormatPython, "true: use python format for output of vectors and matrices; false: use matlab format", py::arg("flagPythonFormat"));
         m.def("SetWriteToConsole", &PySetWriteToConsole, "set flag to write (true) or not write to console; default = true", py::arg("flag"));
@@ -98,6 +116,7 @@
 
 //        NODES:
         .def("AddNode", &MainSystem::AddMainNodePyClass, "add a node with nodeDefinition from Python node class; returns (global) node index (type NodeIndex) of newly added node; use int(nodeIndex) to convert to int, if needed (but not recommended in order not to mix up index types of nodes, objects, markers, ...)", py::arg("pyObject"))
+        .def("AddNodes", &MainSystem::PyAddNodes, "add nodes with same type and parameters as pyObject (python node class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per node, which sets node-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); node names are generated automatically; all nodes are added in one pass; Real-valued parameters in parameterArrays are written directly into the nodes, while the other parameters of every node are still set from the dictionary of pyObject, such that the creation time per node grows with the number of parameters in pyObject; returns python range of (global) node numbers of newly added nodes", py::arg("pyObject"), py::arg("parameterArrays"))
         .def("GetNodeNumber", &MainSystem::PyGetNodeNumber, "get node's number by name (string)", py::arg("nodeName"))
         .def("GetNode", &MainSystem::PyGetNode, "get node's dictionary by node number (type NodeIndex)", py::arg("nodeNumber"))
         .def("ModifyNode", &MainSystem::PyModifyNode, "modify node's dictionary by node number (type NodeIndex)", py::arg("nodeNumber"), py::arg("nodeDict"))
@@ -109,6 +128,7 @@
 
 //        OBJECTS:
         .def("AddObject", &MainSystem::AddMainObjectPyClass, "add an object with objectDefinition from Python object class; returns (global) object number (type ObjectIndex) of newly added object", py::arg("pyObject"))
+        .def("AddObjects", &MainSystem::PyAddObjects, "add objects with same type and parameters as pyObject (python object class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per object, which sets object-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); object names are generated automatically; all objects are added in one pass; Real-valued parameters in parameterArrays are written directly into the objects, while the other parameters of every object are still set from the dictionary of pyObject, such that the creation time per object grows with the number of parameters in pyObject; returns python range of (global) object numbers of newly added objects", py::arg("pyObject"), py::arg("parameterArrays"))
         .def("GetObjectNumber", &MainSystem::PyGetObjectNumber, "get object's number by name (string)", py::arg("objectName"))
         .def("GetObject", &MainSystem::PyGetObject, "get object's dictionary by object number (type ObjectIndex)", py::arg("objectNumber"))
         .def("ModifyObject", &MainSystem::PyModifyObject, "modify object's dictionary by object number (type ObjectIndex)", py::arg("objectNumber"), py::arg("objectDict"))
@@ -121,6 +141,7 @@
 
 //        MARKER:
         .def("AddMarker", &MainSystem::AddMainMarkerPyClass, "add a marker with markerDefinition from Python marker class; returns (global) marker number (type MarkerIndex) of newly added marker", py::arg("pyObject"))
+        .def("AddMarkers", &MainSystem::PyAddMarkers, "add markers with same type and parameters as pyObject (python marker class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per marker, which sets marker-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); marker names are generated automatically; all markers are added in one pass; Real-valued parameters in parameterArrays are written directly into the markers, while the other parameters of every marker are still set from the dictionary of pyObject, such that the creation time per marker grows with the number of parameters in pyObject; returns python range of (global) marker numbers of newly added markers", py::arg("pyObject"), py::arg("parameterArrays"))
         .def("GetMarkerNumber", &MainSystem::PyGetMarkerNumber, "get marker's number by name (string)", py::arg("markerName"))
         .def("GetMarker", &MainSystem::PyGetMarker, "get marker's dictionary by index", py::arg("markerNumber"))
         .def("ModifyMarker", &MainSystem::PyModifyMarker, "modify marker's dictionary by index", py::arg("markerNumber"), py::arg("markerDict"))
@@ -130,6 +151,7 @@
 
 //        LOADS:
         .def("AddLoad", &MainSystem::AddMainLoadPyClass, "add a load with loadDefinition from Python load class; returns (global) load number (type LoadIndex) of newly added load", py::arg("pyObject"))
+        .def("AddLoads", &MainSystem::PyAddLoads, "add loads with same type and parameters as pyObject (python load class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per load, which sets load-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); load names are generated automatically; all loads are added in one pass; Real-valued parameters in parameterArrays are written directly into the loads, while the other parameters of every load are still set from the dictionary of pyObject, such that the creation time per load grows with the number of parameters in pyObject; returns python range of (global) load numbers of newly added loads", py::arg("pyObject"), py::arg("parameterArrays"))
         .def("GetLoadNumber", &MainSystem::PyGetLoadNumber, "get load's number by name (string)", py::arg("loadName"))
         .def("GetLoad", &MainSystem::PyGetLoad, "get load's dictionary by index", py::arg("loadNumber"))
         .def("ModifyLoad", &MainSystem::PyModifyLoad, "modify load's dictionary by index", py::arg("loadNumber"), py::arg("loadDict"))
@@ -145,8 +167,14 @@
         .def("ModifySensor", &MainSystem::PyModifySensor, "modify sensor's dictionary by index", py::arg("sensorNumber"), py::arg("sensorDict"))
         .def("GetSensorDefaults", &MainSystem::PyGetSensorDefaults, "get sensor's default values for a certain sensorType as (dictionary)", py::arg("typeName"))
         .def("GetSensorValues", &MainSystem::PyGetSensorValues, "get sensors's values for configuration; can be a scalar or vector-valued return value!", py::arg("sensorNumber"), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetSensorStoredData", &MainSystem::PyGetSensorStoredData, "get sensor's internally stored data as read-only numpy array with rows [time, sensorValue[0], sensorValue[1], ...] (requires storeInternal=True in sensor); the array directly accesses the sensor's memory without copying and keeps this memory alive; if the storage is re-initialized (next simulation), enlarged or the system is reset, the sensor continues in new memory and the array keeps the rows available at the time of the call", py::arg("sensorNumber"))
         .def("GetSensorParameter", &MainSystem::PyGetSensorParameter, "get sensors's parameter from sensorNumber and parameterName; parameter names can be found for the specific items in the reference manual", py::arg("sensorNumber"), py::arg("parameterName"))
         .def("SetSensorParameter", &MainSystem::PySetSensorParameter, "set parameter 'parameterName' of sensor with sensorNumber to value; parameter names can be found for the specific items in the reference manual", py::arg("sensorNumber"), py::arg("parameterName"), py::arg("value"))
+
+//        PARAMETER HANDLES:
+        .def("GetParameterHandle", &MainSystem::PyGetParameterHandle, "create a handle (integer) for fast access to the Real-valued parameter 'parameterName' of items with itemType being 'Node', 'Object', 'Marker', 'Load' or 'Sensor'", py::arg("itemType"), py::arg("parameterName"))
+        .def("SetParameters", &MainSystem::PySetParameters, "set parameter of handle for all items in itemNumbers (list or numpy array of int) to values (numpy array with one row per item; 1D array for scalar parameters)", py::arg("handle"), py::arg("itemNumbers"), py::arg("values"))
+        .def("GetParameters", &MainSystem::PyGetParameters, "get parameter of handle for all items in itemNumbers (list or numpy array of int) as numpy array with one row per item (1D array for scalar parameters)", py::arg("handle"), py::arg("itemNumbers"))
         ; // end of MainSystem pybind definitions
 
 
@@ -178,6 +206,12 @@
         .def("SetAECoordinates", &MainSystemData::SetAECoords, "set algebraic equations (AE) system coordinates for given configuration (default: exu.Configuration.Current); invalid vector size may lead to system crash!", py::arg("coordinates"), py::arg("configuration") = ConfigurationType::Current)
         .def("GetDataCoordinates", &MainSystemData::GetDataCoords, "get system data coordinates for given configuration (default: exu.Configuration.Current)", py::arg("configuration") = ConfigurationType::Current)
         .def("SetDataCoordinates", &MainSystemData::SetDataCoords, "set system data coordinates for given configuration (default: exu.Configuration.Current); invalid vector size may lead to system crash!", py::arg("coordinates"), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetODE2CoordinatesView", &MainSystemData::GetODE2CoordsView, "get zero-copy view (SystemStateView) on ODE2 system coordinates (displacements) for given configuration (default: exu.Configuration.Current); numpy arrays obtained from the view (np.asarray(view) or view[...]) link to the system state and allow to read and write coordinates in place; after mbs.Assemble() or mbs.Reset(), the view becomes invalid (check with view.IsValid()) and arrays obtained from it are not linked to the system state anymore (their memory is kept alive by the view); views on the visualization configuration (exu.ConfigurationType.Visualization) are not available, as the renderer swaps the visualization state buffers", py::keep_alive<0, 1>(), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetODE2Coordinates_tView", &MainSystemData::GetODE2Coords_tView, "get zero-copy view (SystemStateView) on ODE2 system coordinates (velocities) for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView", py::keep_alive<0, 1>(), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetODE1CoordinatesView", &MainSystemData::GetODE1CoordsView, "get zero-copy view (SystemStateView) on ODE1 system coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView", py::keep_alive<0, 1>(), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetAECoordinatesView", &MainSystemData::GetAECoordsView, "get zero-copy view (SystemStateView) on algebraic equations (AE) system coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView", py::keep_alive<0, 1>(), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetDataCoordinatesView", &MainSystemData::GetDataCoordsView, "get zero-copy view (SystemStateView) on system data coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView", py::keep_alive<0, 1>(), py::arg("configuration") = ConfigurationType::Current)
+        .def("GetStateVersion", &MainSystemData::GetStateVersion, "get state version of system; the state version changes with mbs.Assemble() or mbs.Reset(), which may reallocate system state vectors and invalidate views on state vectors")
         .def("GetSystemState", &MainSystemData::PyGetSystemState, "get system state for given configuration (default: exu.Configuration.Current); state vectors do not include the non-state derivatives ODE1_t and ODE2_tt and the time; function is copying data - not highly efficient; format of pyList: [ODE2Coords, ODE2Coords_t, ODE1Coords, AEcoords, dataCoords]", py::arg("configuration") = ConfigurationType::Current)
         .def("SetSystemState", &MainSystemData::PySetSystemState, "set system data coordinates for given configuration (default: exu.Configuration.Current); invalid list of vectors / vector size may lead to system crash; write access to state vectors (but not the non-state derivatives ODE1_t and ODE2_tt and the time); function is copying data - not highly efficient; format of pyList: [ODE2Coords, ODE2Coords_t, ODE1Coords, AEcoords, dataCoords]", py::arg("systemStateList"), py::arg("configuration") = ConfigurationType::Current)
 
@@ -188,3 +222,16 @@
         .def("GetObjectLTGData", &MainSystemData::PyGetObjectLocalToGlobalData, "get local-to-global coordinate mapping (list of global coordinate indices) for data coordinates; only available after Assemble()", py::arg("objectNumber"))
         ; // end of SystemData pybind definitions
 
+
+    py::class_<MainVectorizedSystems>(m, "VectorizedSystems")
+        .def(py::init<>())
+        .def("Initialize", &MainVectorizedSystems::Initialize, "create numberOfCopies copies of the assembled system mbs; actions is a list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] as in SolveBatch, defining the parameters which are set by Step(...); observations are the concatenated current values of sensors in sensorNumbers or the ODE2 coordinates if sensorNumbers is empty; solverType selects the dynamic solver as in SolveDynamic; numberOfThreads=0 uses all hardware threads; returns True on success", py::arg("mbs"), py::arg("numberOfCopies"), py::arg("simulationSettings"), py::arg("actions"), py::arg("sensorNumbers") = py::list(), py::arg("solverType") = DynamicSolverType::GeneralizedAlpha, py::arg("numberOfThreads") = 0)
+        .def("Reset", &MainVectorizedSystems::Reset, "finalize solvers and reset all copies to their initial values (actions set in previous steps are kept); returns observations as numpy array with shape (numberOfCopies, numberOfObservations)")
+        .def("Step", &MainVectorizedSystems::Step, "set actions (numpy array with shape (numberOfCopies, numberOfActions)) in all copies and advance all copies by timeIncrement in parallel; returns observations as numpy array with shape (numberOfCopies, numberOfObservations); rows of copies which failed (e.g. no convergence) contain NaN until Reset() is called", py::arg("actions"), py::arg("timeIncrement"))
+        .def("GetObservations", &MainVectorizedSystems::GetObservations, "return current observations as numpy array with shape (numberOfCopies, numberOfObservations)")
+        .def("GetTimes", &MainVectorizedSystems::GetTimes, "return numpy array with current simulation time of every copy")
+        .def("NumberOfCopies", &MainVectorizedSystems::NumberOfCopies, "return number of system copies")
+        .def("NumberOfActions", &MainVectorizedSystems::NumberOfActions, "return number of actions per copy")
+        .def("NumberOfObservations", &MainVectorizedSystems::NumberOfObservations, "return number of observation values per copy")
+        ; // end of VectorizedSystems pybind definitions
+
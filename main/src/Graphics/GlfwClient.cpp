@@ -60,6 +60,7 @@ GLFWwindow* GlfwRenderer::window = nullptr;
 RendererState* GlfwRenderer::state;
 RendererStateMachine GlfwRenderer::stateMachine;
 std::thread GlfwRenderer::rendererThread;
+ImageFileWriter GlfwRenderer::imageFileWriter;
 //uint64_t GlfwRenderer::visualizationCounter = 0;
 
 ResizableArray<GraphicsData*>* GlfwRenderer::graphicsDataList = nullptr;
@@ -548,6 +549,36 @@ void GlfwRenderer::ZoomAll()
 					}
 				}
 			}
+			//retained rigid items: transform points of lines and triangles into current configuration
+			for (const GraphicsData* rigidItem : data->rigidItems)
+			{
+				if (rigidItem && rigidItem->showItem)
+				{
+					for (auto item : rigidItem->glLines)
+					{
+						for (auto point : { rigidItem->TransformPoint(item.point1), rigidItem->TransformPoint(item.point2) })
+						{
+							for (Index i = 0; i < 3; i++)
+							{
+								pmax[i] = EXUstd::Maximum(point[i], pmax[i]);
+								pmin[i] = EXUstd::Minimum(point[i], pmin[i]);
+							}
+						}
+					}
+					for (auto item : rigidItem->glTriangles)
+					{
+						for (auto localPoint : item.points)
+						{
+							Float3 point = rigidItem->TransformPoint(localPoint);
+							for (Index i = 0; i < 3; i++)
+							{
+								pmax[i] = EXUstd::Maximum(point[i], pmax[i]);
+								pmin[i] = EXUstd::Minimum(point[i], pmin[i]);
+							}
+						}
+					}
+				}
+			}
 		}
 
 		Float3 center = 0.5f*(pmin + pmax);
@@ -558,7 +589,7 @@ void GlfwRenderer::ZoomAll()
 		if (graphicsDataList->NumberOfItems() == 0 ||
 			((*graphicsDataList)[0]->glCirclesXY.NumberOfItems() == 0 && (*graphicsDataList)[0]->glLines.NumberOfItems() == 0
 				&& (*graphicsDataList)[0]->glPoints.NumberOfItems() == 0 && (*graphicsDataList)[0]->glTexts.NumberOfItems() == 0
-			&& (*graphicsDataList)[0]->glTriangles.NumberOfItems() == 0))
+			&& (*graphicsDataList)[0]->glTriangles.NumberOfItems() == 0 && (*graphicsDataList)[0]->rigidItems.NumberOfItems() == 0))
 		{
 			maxSceneSize = 1;
 			center = Float3({ 0,0,0 });
@@ -902,6 +933,18 @@ void GlfwRenderer::RunLoop()
 	}
 	basicVisualizationSystemContainer->StopSimulation(); //if user waits for termination of render engine, it tells that window is closed
 
+	//write remaining frames of asynchronous image saving
+	if (imageFileWriter.IsOpen())
+	{
+		imageFileWriter.Close();
+		if (imageFileWriter.GetNumberOfDroppedFrames() || imageFileWriter.GetNumberOfFailedFrames())
+		{
+			PyWarning("GlfwRenderer: " + EXUstd::ToString(imageFileWriter.GetNumberOfWrittenFrames()) + " image files saved, but " +
+				EXUstd::ToString(imageFileWriter.GetNumberOfDroppedFrames()) + " frames dropped (no free buffer within saveImageTimeOut; increase saveImageQueueSize) and " +
+				EXUstd::ToString(imageFileWriter.GetNumberOfFailedFrames()) + " image files could not be written");
+		}
+	}
+
 	glfwDestroyWindow(window);
 	window = nullptr;
 	rendererActive = false; //for new startup of renderer
@@ -1222,56 +1265,80 @@ void GlfwRenderer::SaveImage()
 	//at this time, the scene must have been rendered (called directly from render loop after Render() )
 	if (basicVisualizationSystemContainer->SaveImageRequest())
 	{
+		ImageFileFormat format;
+		if (!ImageFileWriter::GetImageFileFormat(visSettings->exportImages.saveImageFormat, format))
+		{
+			PyWarning("GlfwRenderer::SaveImage: invalid saveImageFormat '" + visSettings->exportImages.saveImageFormat + "'; use 'TGA', 'TGA-RLE' or 'RAW'; saving as 'TGA'");
+			visSettings->exportImages.saveImageFormat = "TGA"; //warn only once
+			format = ImageFileFormat::TGA;
+		}
+
 		STDstring filename = visSettings->exportImages.saveImageFileName;
 
-		if (!visSettings->exportImages.saveImageSingleFile)
+		if (format == ImageFileFormat::RAW)
 		{
-			char num[100];
-			sprintf(num, "%05d", (int)visSettings->exportImages.saveImageFileCounter);
+			filename += ".bgr"; //all frames go into one stream
+			if (!visSettings->exportImages.saveImageSingleFile) { visSettings->exportImages.saveImageFileCounter++; }
+		}
+		else
+		{
+			if (!visSettings->exportImages.saveImageSingleFile)
+			{
+				char num[100];
+				sprintf(num, "%05d", (int)visSettings->exportImages.saveImageFileCounter);
 
-			filename += num;
-			visSettings->exportImages.saveImageFileCounter++; //this changes the settings, because it should always contain the current value for consecutive simulations
+				filename += num;
+				visSettings->exportImages.saveImageFileCounter++; //this changes the settings, because it should always contain the current value for consecutive simulations
+			}
+			filename += ".tga"; //image format ending
 		}
-		filename += ".tga"; //image format ending
 
-		SaveSceneToFile(filename);
+		//the raw video stream is always kept open by the writer thread
+		if (visSettings->exportImages.saveImageAsynchronous || format == ImageFileFormat::RAW)
+		{
+			//pixels are copied into a buffer of the pool; encoding and file output is done by writer thread
+			imageFileWriter.Open(visSettings->exportImages.saveImageQueueSize);
+			ImageFrame* frame = imageFileWriter.AcquireFrame(visSettings->exportImages.saveImageTimeOut);
+			if (frame) //otherwise, frame is dropped and counted
+			{
+				ReadScenePixels(*frame);
+				frame->fileName = filename;
+				frame->format = format;
+				imageFileWriter.SubmitFrame(frame);
+			}
+			if (!visSettings->exportImages.saveImageAsynchronous) { imageFileWriter.Flush(); }
+		}
+		else
+		{
+			imageFileWriter.Flush(); //keep order of frames, if setting is changed during recording
+			SaveSceneToFile(filename);
+		}
 
 		basicVisualizationSystemContainer->SaveImageFinished();
 	}
 }
 
-void GlfwRenderer::SaveSceneToFile(const STDstring& filename)
+void GlfwRenderer::ReadScenePixels(ImageFrame& frame)
 {
-	Index windowWidth = state->currentWindowSize[0];
-	Index windowHeight = state->currentWindowSize[1];
-
-	Index numberOfPixels = windowWidth * windowHeight * 3;
-	ResizableArray<char> pixelBuffer(numberOfPixels);
-	pixelBuffer.SetNumberOfItems(numberOfPixels);
+	frame.SetSize(state->currentWindowSize[0], state->currentWindowSize[1]);
 
 	glPixelStorei(GL_PACK_ALIGNMENT, 1);
 	glReadBuffer(GL_FRONT);
-	glReadPixels(0, 0, (GLsizei)windowWidth, (GLsizei)windowHeight, GL_BGR_EXT, GL_UNSIGNED_BYTE, pixelBuffer.GetDataPointer());
+	glReadPixels(0, 0, (GLsizei)frame.width, (GLsizei)frame.height, GL_BGR_EXT, GL_UNSIGNED_BYTE, frame.pixels.data());
+}
+
+void GlfwRenderer::SaveSceneToFile(const STDstring& filename)
+{
+	ImageFrame frame;
+	ReadScenePixels(frame);
+	frame.fileName = filename;
+	frame.format = ImageFileFormat::TGA;
+	if (visSettings->exportImages.saveImageFormat == "TGA-RLE") { frame.format = ImageFileFormat::TGARLE; }
 
-	std::ofstream imageFile;
-	CheckPathAndCreateDirectories(filename);
-	imageFile.open(filename, std::ofstream::out | std::ofstream::binary);
-	if (!imageFile.is_open()) //failed to open file ...  e.g. invalid file name
+	if (!ImageFileWriter::WriteTGAFile(frame)) //failed to open file ...  e.g. invalid file name
 	{
 		PyWarning(STDstring("GlfwRenderer::SaveSceneToFile: Failed to open image file '") + filename + "'");
 	}
-	else
-	{
-		short header[] = { 0, 2, 0, 0, 0, 0, (short)windowWidth, (short)windowHeight, 24 }; //file header for .tga (targa) images
-		char* charHeader = (char*)(&header);
-
-		imageFile.write(charHeader, sizeof(header));
-		imageFile.write(pixelBuffer.GetDataPointer(), numberOfPixels);
-
-		imageFile.close();
-	}
-
-
 }
 
 
@@ -1281,183 +1348,211 @@ void GlfwRenderer::RenderGraphicsData()
 	{
 		for (auto data : *graphicsDataList)
 		{
-			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-			//DRAW POINTS
-			//GLfloat lineWidth = 0.5f; //has no action so far
-			GLfloat d = visSettings->general.pointSize; //point drawing parameter --> put into settings!
-			glLineWidth(visSettings->openGL.lineWidth);
-			if (visSettings->openGL.lineSmooth) { glEnable(GL_LINE_SMOOTH); }
+			RenderGraphicsDataPrimitives(*data);
 
-			for (const GLPoint& item : data->glPoints)
+			//retained rigid items: primitives are given in body-fixed coordinates and transformed by OpenGL
+			for (const GraphicsData* rigidItem : data->rigidItems)
 			{
-				glBegin(GL_LINES);
-				glColor4f(item.color[0], item.color[1], item.color[2], item.color[3]);
-
-				//plot point as 3D cross
-				glVertex3f(item.point[0] + d, item.point[1], item.point[2]);
-				glVertex3f(item.point[0] - d, item.point[1], item.point[2]);
-				glVertex3f(item.point[0], item.point[1] + d, item.point[2]);
-				glVertex3f(item.point[0], item.point[1] - d, item.point[2]);
-				glVertex3f(item.point[0], item.point[1], item.point[2] + d);
-				glVertex3f(item.point[0], item.point[1], item.point[2] - d);
-
-				glEnd();
+				if (rigidItem && rigidItem->showItem)
+				{
+					glPushMatrix(); //store current matrix -> before rigid body transformation
+					glMultMatrixf(rigidItem->transformation.GetDataPointer());
+					RenderGraphicsDataPrimitives(*rigidItem);
+					glPopMatrix(); //restore matrix
+				}
 			}
 
-			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-			//DRAW CIRCLES
-			//draw a circle in xy-plane
-			for (const GLCircleXY& item : data->glCirclesXY)
+			RenderGraphicsDataTexts(*data, false);
+			for (const GraphicsData* rigidItem : data->rigidItems)
 			{
-				glBegin(GL_LINE_STRIP); //list of single points to define lines
-				glColor4f(item.color[0], item.color[1], item.color[2], item.color[3]);
+				if (rigidItem && rigidItem->showItem) { RenderGraphicsDataTexts(*rigidItem, true); }
+			}
+		}
+	}
+}
 
-				const Float3& p = item.point;
-				GLfloat r = item.radius;
-				float nSeg = (float)item.numberOfSegments;
-				if (nSeg == 0.f) { nSeg = (float)visSettings->general.circleTiling; }
+void GlfwRenderer::RenderGraphicsDataPrimitives(const GraphicsData& data)
+{
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//DRAW POINTS
+	//GLfloat lineWidth = 0.5f; //has no action so far
+	GLfloat d = visSettings->general.pointSize; //point drawing parameter --> put into settings!
+	glLineWidth(visSettings->openGL.lineWidth);
+	if (visSettings->openGL.lineSmooth) { glEnable(GL_LINE_SMOOTH); }
 
-				for (float i = 0; i <= nSeg; i += 2.f*EXUstd::pi_f / nSeg)
-				{
-					glVertex3f(p[0] + r * sin(i), p[1] + r * cos(i), p[2]);
-				}
+	for (const GLPoint& item : data.glPoints)
+	{
+		glBegin(GL_LINES);
+		glColor4f(item.color[0], item.color[1], item.color[2], item.color[3]);
 
-				glEnd(); //GL_LINE_STRIP
-			}
+		//plot point as 3D cross
+		glVertex3f(item.point[0] + d, item.point[1], item.point[2]);
+		glVertex3f(item.point[0] - d, item.point[1], item.point[2]);
+		glVertex3f(item.point[0], item.point[1] + d, item.point[2]);
+		glVertex3f(item.point[0], item.point[1] - d, item.point[2]);
+		glVertex3f(item.point[0], item.point[1], item.point[2] + d);
+		glVertex3f(item.point[0], item.point[1], item.point[2] - d);
+
+		glEnd();
+	}
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//DRAW CIRCLES
+	//draw a circle in xy-plane
+	for (const GLCircleXY& item : data.glCirclesXY)
+	{
+		glBegin(GL_LINE_STRIP); //list of single points to define lines
+		glColor4f(item.color[0], item.color[1], item.color[2], item.color[3]);
 
-			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-			//DRAW LINES
-			for (const GLLine& item : data->glLines)
+		const Float3& p = item.point;
+		GLfloat r = item.radius;
+		float nSeg = (float)item.numberOfSegments;
+		if (nSeg == 0.f) { nSeg = (float)visSettings->general.circleTiling; }
+
+		for (float i = 0; i <= nSeg; i += 2.f*EXUstd::pi_f / nSeg)
+		{
+			glVertex3f(p[0] + r * sin(i), p[1] + r * cos(i), p[2]);
+		}
+
+		glEnd(); //GL_LINE_STRIP
+	}
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//DRAW LINES
+	for (const GLLine& item : data.glLines)
+	{
+		glBegin(GL_LINES);
+		glColor4f(item.color1[0], item.color1[1], item.color1[2], item.color1[3]);
+		glVertex3f(item.point1[0], item.point1[1], item.point1[2]);
+		glColor4f(item.color2[0], item.color2[1], item.color2[2], item.color2[3]);
+		glVertex3f(item.point2[0], item.point2[1], item.point2[2]);
+		glEnd();
+	}
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//DRAW TRIANGLES
+	if (visSettings->openGL.showFaceEdges)
+	{
+		for (const GLTriangle& trig : data.glTriangles)
+		{ //draw lines
+			glColor4f(0.2f, 0.2f, 0.2f, 1.f);
+			for (Index i = 0; i < 3; i++)
 			{
+				Index j = i + 1;
+				if (j >= 3) { j = 0; }
 				glBegin(GL_LINES);
-				glColor4f(item.color1[0], item.color1[1], item.color1[2], item.color1[3]);
-				glVertex3f(item.point1[0], item.point1[1], item.point1[2]);
-				glColor4f(item.color2[0], item.color2[1], item.color2[2], item.color2[3]);
-				glVertex3f(item.point2[0], item.point2[1], item.point2[2]);
+				const Float3& p = trig.points[i];
+				glVertex3f(p[0], p[1], p[2]);
+
+				const Float3& p1 = trig.points[j];
+				glVertex3f(p1[0], p1[1], p1[2]);
 				glEnd();
 			}
+		}
+	}
 
-			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-			//DRAW TRIANGLES
-			if (visSettings->openGL.showFaceEdges)
+	if (visSettings->openGL.showFaces)
+	{
+		glEnable(GL_LIGHTING);
+		for (const GLTriangle& trig : data.glTriangles)
+		{ //draw faces
+			//glColor4f(0.2f, 0.2f, 0.9f, 1.f);
+			glBegin(GL_TRIANGLES);
+			for (Index i = 0; i < 3; i++)
 			{
-				for (const GLTriangle& trig : data->glTriangles)
-				{ //draw lines
-					glColor4f(0.2f, 0.2f, 0.2f, 1.f);
-					for (Index i = 0; i < 3; i++)
-					{
-						Index j = i + 1;
-						if (j >= 3) { j = 0; }
-						glBegin(GL_LINES);
-						const Float3& p = trig.points[i];
-						glVertex3f(p[0], p[1], p[2]);
-
-						const Float3& p1 = trig.points[j];
-						glVertex3f(p1[0], p1[1], p1[2]);
-						glEnd();
-					}
-				}
+				glColor4fv(trig.colors[i].GetDataPointer());
+				glNormal3fv(trig.normals[i].GetDataPointer());
+				glVertex3fv(trig.points[i].GetDataPointer());
 			}
+			glEnd();
+		}
+		glDisable(GL_LIGHTING);
+	}
 
-			if (visSettings->openGL.showFaces)
+	//draw normals
+	if (visSettings->openGL.drawFaceNormals)
+	{
+		float len = visSettings->openGL.drawNormalsLength;
+		for (const GLTriangle& trig : data.glTriangles)
+		{
+			Float3 midPoint = { 0,0,0 };
+			for (Index i = 0; i < 3; i++)
 			{
-				glEnable(GL_LIGHTING);
-				for (const GLTriangle& trig : data->glTriangles)
-				{ //draw faces
-					//glColor4f(0.2f, 0.2f, 0.9f, 1.f);
-					glBegin(GL_TRIANGLES);
-					for (Index i = 0; i < 3; i++)
-					{
-						glColor4fv(trig.colors[i].GetDataPointer());
-						glNormal3fv(trig.normals[i].GetDataPointer());
-						glVertex3fv(trig.points[i].GetDataPointer());
-					}
-					glEnd();
-				}
-				glDisable(GL_LIGHTING);
+				midPoint += trig.points[i];
 			}
+			midPoint *= 1.f / 3.f;
+			glColor4f(0.2f, 0.2f, 0.2f, 1.f);
+			glBegin(GL_LINES);
+			const Float3& p = midPoint;
+			glVertex3f(p[0], p[1], p[2]);
+			Float3 p1 = midPoint + len * trig.normals[0];
+			glVertex3f(p1[0], p1[1], p1[2]);
+			glEnd();
+		}
+	}
 
-			//draw normals
-			if (visSettings->openGL.drawFaceNormals)
+	if (visSettings->openGL.drawVertexNormals)
+	{
+		float len = visSettings->openGL.drawNormalsLength;
+		for (const GLTriangle& trig : data.glTriangles)
+		{
+			for (Index i = 0; i < 3; i++)
 			{
-				float len = visSettings->openGL.drawNormalsLength;
-				for (const GLTriangle& trig : data->glTriangles)
-				{
-					Float3 midPoint = { 0,0,0 };
-					for (Index i = 0; i < 3; i++)
-					{
-						midPoint += trig.points[i];
-					}
-					midPoint *= 1.f / 3.f;
-					glColor4f(0.2f, 0.2f, 0.2f, 1.f);
-					glBegin(GL_LINES);
-					const Float3& p = midPoint;
-					glVertex3f(p[0], p[1], p[2]);
-					Float3 p1 = midPoint + len * trig.normals[0];
-					glVertex3f(p1[0], p1[1], p1[2]);
-					glEnd();
-				}
+				glBegin(GL_LINES);
+				const Float3& p = trig.points[i];
+				glVertex3f(p[0], p[1], p[2]);
+
+				Float3 p1 = trig.points[i] + len * trig.normals[i];
+				glVertex3f(p1[0], p1[1], p1[2]);
+				glEnd();
 			}
+		}
+	}
 
-			if (visSettings->openGL.drawVertexNormals)
-			{
-				float len = visSettings->openGL.drawNormalsLength;
-				for (const GLTriangle& trig : data->glTriangles)
-				{
-					for (Index i = 0; i < 3; i++)
-					{
-						glBegin(GL_LINES);
-						const Float3& p = trig.points[i];
-						glVertex3f(p[0], p[1], p[2]);
+	if (visSettings->openGL.lineSmooth) { glDisable(GL_LINE_SMOOTH); }
+}
 
-						Float3 p1 = trig.points[i] + len * trig.normals[i];
-						glVertex3f(p1[0], p1[1], p1[2]);
-						glEnd();
-					}
-				}
-			}
+void GlfwRenderer::RenderGraphicsDataTexts(const GraphicsData& data, bool transformPoints)
+{
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//DRAW TEXT
+	//float scale = 0.025f; //scaling of text
+	float textheight = visSettings->general.textSize;
+	float scaleFactor = 2.f * state->zoom / ((float)state->currentWindowSize[1]); //factor, which gives approximately 1pt textsize
+	//float scale = 2.f*textheight * state->zoom / ((float)state->currentWindowSize[1]);
 
-			if (visSettings->openGL.lineSmooth) { glDisable(GL_LINE_SMOOTH); }
+	Float16 m = state->modelRotation;
 
-			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
-			//DRAW TEXT
-			//float scale = 0.025f; //scaling of text
-			float textheight = visSettings->general.textSize;
-			float scaleFactor = 2.f * state->zoom / ((float)state->currentWindowSize[1]); //factor, which gives approximately 1pt textsize
-			//float scale = 2.f*textheight * state->zoom / ((float)state->currentWindowSize[1]);
+	Float16 matTp({ m[0],m[4],m[8],m[12], //transpose of modelRotation
+				   m[1],m[5],m[9],m[13],
+				   m[2],m[6],m[10],m[14],
+				   m[3],m[7],m[11],m[15] });
 
-			Float16 m = state->modelRotation;
+	//if not called from modelview, use the following transformations
+	//glMatrixMode(GL_MODELVIEW);
+	//glPushMatrix(); //store current matrix -> before rotation
+	//glLoadIdentity();
+	//glTranslated(-state->centerPoint[0], -state->centerPoint[1], 0.f);
+	//glMultMatrixf(state->modelRotation.GetDataPointer());
 
-			Float16 matTp({ m[0],m[4],m[8],m[12], //transpose of modelRotation
-						   m[1],m[5],m[9],m[13],
-						   m[2],m[6],m[10],m[14],
-						   m[3],m[7],m[11],m[15] });
+	//Float3 p0({ 0.f,0.f,0.f }); //texts are drawn at position 0,0,0 ==> everything else done by tranformations
 
-			//if not called from modelview, use the following transformations
-			//glMatrixMode(GL_MODELVIEW);
-			//glPushMatrix(); //store current matrix -> before rotation
-			//glLoadIdentity();
-			//glTranslated(-state->centerPoint[0], -state->centerPoint[1], 0.f);
-			//glMultMatrixf(state->modelRotation.GetDataPointer());
+	for (const GLText& t : data.glTexts)
+	{
+		float scale = textheight * scaleFactor;
+		if (t.size != 0.f) { scale = t.size * scaleFactor; }
 
-			//Float3 p0({ 0.f,0.f,0.f }); //texts are drawn at position 0,0,0 ==> everything else done by tranformations
+		float offx = t.offsetX * scale;
+		float offy = t.offsetX * scale;
+		Float3 p = t.point;
+		if (transformPoints) { p = data.TransformPoint(t.point); } //rigid item: text is not rotated, only position is transformed
 
-			for (const GLText& t : data->glTexts)
-			{
-				float scale = textheight * scaleFactor;
-				if (t.size != 0.f) { scale = t.size * scaleFactor; }
-
-				float offx = t.offsetX * scale;
-				float offy = t.offsetX * scale;
-				//draw strings without applying the rotation:
-				glPushMatrix(); //store current matrix -> before rotation
-				glTranslated(t.point[0], t.point[1], t.point[2]);
-				glMultMatrixf(matTp.GetDataPointer());
-				DrawString(t.text, scale, Float3({ offx,offy,0.f }), t.color);
-				glPopMatrix(); //restore matrix
-			}
-			//glPopMatrix(); //restore matrix
-		}
+		//draw strings without applying the rotation:
+		glPushMatrix(); //store current matrix -> before rotation
+		glTranslated(p[0], p[1], p[2]);
+		glMultMatrixf(matTp.GetDataPointer());
+		DrawString(t.text, scale, Float3({ offx,offy,0.f }), t.color);
+		glPopMatrix(); //restore matrix
 	}
 }
 
@@ -35,6 +35,7 @@
 
 
 #include "Graphics/GlfwClientText.h" //link to external library; include only if copyright is appropriate
+#include "Utilities/ImageFileWriter.h"
 
 
 enum class RendererMode {
@@ -76,6 +77,7 @@ private:
 	static RendererStateMachine stateMachine; //!< all variables (mouse, keyboard, ...) used for state machine (zoom, zoom-view, move, ...)
 	static std::thread rendererThread;	//!< std::thread variable for rendererThread
 	static Index rendererError;			//!< 0 ... no error, 1 ... glfwInit() failed, 2 ... glfwCreateWindow failed, 3 ... other error
+	static ImageFileWriter imageFileWriter; //!< frame buffer pool and writer thread for asynchronous saving of images
 
 	//done in graphicsData: static uint64_t visualizationCounter; //!< counter showing number for pulling last successful graphics content; must be set to zero when system is reset, otherwise nothing is drawn unless counter is higher than 
 
@@ -146,6 +148,12 @@ public:
 		}
 	}
 
+	//! wait until all asynchronously saved images are written to files
+	static void FlushImageFiles()
+	{
+		imageFileWriter.Flush();
+	}
+
 	static void UpdateGraphicsDataNow()
 	{
 		if (basicVisualizationSystemContainer)
@@ -189,12 +197,21 @@ private: //to be called internally only!
 	//! check if frame shall be grabed and saved to file using visualization options
 	static void SaveImage();
 
-	//! save scene to a file with filename
+	//! read pixels of current scene into frame (resized to window size)
+	static void ReadScenePixels(ImageFrame& frame);
+
+	//! save scene to a .tga file with filename (without asynchronous writer)
 	static void SaveSceneToFile(const STDstring& filename);
 	
 	//! Render particulalry the graphics data of multibody system
 	static void RenderGraphicsData();
 
+	//! Render points, circles, lines and triangles of graphics data (without texts)
+	static void RenderGraphicsDataPrimitives(const GraphicsData& data);
+
+	//! Render texts of graphics data; if transformPoints, text positions are transformed with transformation of (rigid item) data
+	static void RenderGraphicsDataTexts(const GraphicsData& data, bool transformPoints);
+
 	//! Zoom all graphics objects (for current configuration)
 	static void ZoomAll();
 
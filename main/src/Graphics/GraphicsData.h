@@ -104,9 +104,16 @@ public:
 	bool isRigid;				//!< signals that after creation of the object, all points just undergo a rigidbody transformation
 	hMatrix4f transformation;	//!< used for rigidbody transformation, if object is rigid
 
+	//retained mode for rigid items: primitives are stored in body-fixed coordinates and only generated if isDirty;
+	//per visualization update, only the transformation is updated; renderer applies transformation
+	ResizableArray<GraphicsData*> rigidItems;	//!< retained graphics data of rigid items, indexed by object number; nullptr, if item is not retained
+	bool isDirty;				//!< for rigid item: true, if primitives need to be regenerated (after structure change or change of visualization settings)
+	bool showItem;				//!< for rigid item: true, if item is drawn in current visualization update
+
 private:
 	std::atomic_flag lock = ATOMIC_FLAG_INIT;
 	uint64_t visualizationCounter;
+	Index stateVersion;			//! state version of system at last update of rigid items; used to detect structure changes
 	bool updateGraphicsDataNow; //! flag set by Renderer to recompute graphics data (e.g. when settings changed)
 	float contourCurrentMinValue; //! current minimum value for contour plot
 	float contourCurrentMaxValue; //! current maximum value for contour plot
@@ -116,6 +123,12 @@ public:
 	{
 		contourCurrentMinValue = EXUstd::_MAXFLOAT;
 		contourCurrentMaxValue = EXUstd::_MINFLOAT;
+		isStatic = false;
+		isRigid = false;
+		transformation = hMatrix4f({ 1.f,0.f,0.f,0.f, 0.f,1.f,0.f,0.f, 0.f,0.f,1.f,0.f, 0.f,0.f,0.f,1.f });
+		isDirty = true;
+		showItem = false;
+		stateVersion = EXUstd::InvalidIndex;
 	}
 	//! Aquire lock for data, such that computation / visualization thread does not access data at the same time
 	void LockData() 
@@ -130,6 +143,10 @@ public:
 	virtual ~GraphicsData()
 	{
 		FlushData();
+		for (GraphicsData* item : rigidItems)
+		{
+			delete item; //nullptr is allowed
+		}
 	}
 
 	const uint64_t& GetVisualizationCounter() const { return visualizationCounter; };
@@ -138,6 +155,9 @@ public:
 	const bool& GetUpdateGraphicsDataNow() const { return updateGraphicsDataNow; };
 	bool& GetUpdateGraphicsDataNow() { return updateGraphicsDataNow; };
 
+	const Index& GetStateVersion() const { return stateVersion; };
+	Index& GetStateVersion() { return stateVersion; };
+
 	const float& GetContourCurrentMinValue() const { return contourCurrentMinValue; };
 	float& GetContourCurrentMinValue() { return contourCurrentMinValue; };
 
@@ -161,6 +181,57 @@ public:
 		ClearLock();
 	}
 
+	//! retained mode: return graphics data of rigid item with itemNumber; item is created (isDirty=true) if it does not exist
+	GraphicsData& GetRigidItem(Index itemNumber)
+	{
+		while (rigidItems.NumberOfItems() <= itemNumber) { rigidItems.Append(nullptr); }
+		if (rigidItems[itemNumber] == nullptr)
+		{
+			rigidItems[itemNumber] = new GraphicsData();
+			rigidItems[itemNumber]->isRigid = true;
+		}
+		return *rigidItems[itemNumber];
+	}
+
+	//! retained mode: hide all rigid items before a visualization update (shown items set showItem=true);
+	//! if structureChanged, all rigid items are marked dirty and their primitives are regenerated; memory is kept as renderer may still access items
+	void ResetRigidItems(bool structureChanged)
+	{
+		for (GraphicsData* item : rigidItems)
+		{
+			if (item)
+			{
+				item->showItem = false;
+				if (structureChanged) { item->isDirty = true; }
+			}
+		}
+	}
+
+	//! set OpenGL transformation (column-major) of rigid item from position and rotation matrix (row-major access via operator())
+	template<class TMatrix>
+	void SetRigidBodyTransformation(const Float3& position, const TMatrix& rotation)
+	{
+		for (Index j = 0; j < 3; j++)
+		{
+			for (Index i = 0; i < 3; i++)
+			{
+				transformation[4 * j + i] = rotation(i, j);
+			}
+			transformation[4 * j + 3] = 0.f;
+			transformation[12 + j] = position[j];
+		}
+		transformation[15] = 1.f;
+	}
+
+	//! transform point p of rigid item with transformation
+	Float3 TransformPoint(const Float3& p) const
+	{
+		const hMatrix4f& T = transformation;
+		return Float3({ T[0] * p[0] + T[4] * p[1] + T[8] * p[2] + T[12],
+			T[1] * p[0] + T[5] * p[1] + T[9] * p[2] + T[13],
+			T[2] * p[0] + T[6] * p[1] + T[10] * p[2] + T[14] });
+	}
+
 	Index AddLine(const Vector3D& point1, const Vector3D& point2, const Float4& color1, const Float4& color2)
 	{
 		GLLine line;
@@ -245,6 +316,7 @@ public:
 		os << "  number of circles= " << glCirclesXY.NumberOfItems() << "\n";
 		os << "  number of texts  = " << glTexts.NumberOfItems() << "\n";
 		os << "  number of trigs  = " << glTriangles.NumberOfItems() << "\n";
+		os << "  number of rigid items = " << rigidItems.NumberOfItems() << "\n";
 
 		os << "\n";
 	}
@@ -36,6 +36,7 @@ void VisualizationSystem::Reset()
 {
 	graphicsData.GetVisualizationCounter() = 0;
 	graphicsData.FlushData();
+	graphicsData.ResetRigidItems(true);
 	graphicsData.GetUpdateGraphicsDataNow() = false;
 
 	postProcessData->requestUserFunctionDrawingAtomicFlag.test_and_set(std::memory_order_acquire);
@@ -71,28 +72,37 @@ bool visualizationSystemUpdateGraphicsDataTimeoutWarned = false;
 //! OpenGL renderer calls UpdateGraphicsData (different thread) to update graphics data
 void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visualizationSystemContainer)
 {
-	postProcessData->accessState.test_and_set(std::memory_order_acquire); //computation thread must be interrupted before further update
 	postProcessData->visualizationIsRunning = true; //signal, that visualization is running
 
-	if (postProcessData->updateCounter == postProcessData->recordImageCounter) //this is the signal that a frame shall be recorded
-	{
-		visualizationSystemContainer.saveImage = true;
-		visualizationSystemContainer.saveImageOpenGL = true; //send immediately signal to openGL that frame needs to be recorded
-		postProcessData->recordImageCounter--;				 //decrease value such that next update does not lead to image record
-	}
+	bool recordStateQueued = systemData->GetCData().HasQueuedVisualizationRecordStates(); //states requested for image recording are drawn one by one
 
-	if (((postProcessData->postProcessDataReady && postProcessData->updateCounter > graphicsData.GetVisualizationCounter()) 
+	if (((postProcessData->postProcessDataReady && (postProcessData->updateCounter > graphicsData.GetVisualizationCounter() || recordStateQueued))
 		|| visualizationSystemContainer.UpdateGraphicsDataNowInternal()) && systemData->GetCData().IsSystemConsistent())
 	{
 		graphicsData.GetVisualizationCounter() = postProcessData->updateCounter; //next update will only be done if postProcessData->updateCounter increases
 		
 		//flushdata also locks data ...
-		graphicsData.FlushData(); //currently data is always recomputed; FUTURE: differ between structure update and vertex/rigid body update, etc.
+		graphicsData.FlushData(); //data of deformable items, nodes, connectors, etc. is always recomputed; rigid items are retained
 
 		//put this after FlushData():
 		graphicsData.LockData(); //avoid that data is cleared by computation/Python thread
 
+		//rigid items only regenerate their primitives after structure changes (Assemble, Reset) or changed visualization settings;
+		//otherwise, only their transformation is updated
+		bool structureChanged = visualizationSystemContainer.UpdateGraphicsDataNowInternal() || graphicsData.GetStateVersion() != systemData->GetStateVersion();
+		graphicsData.GetStateVersion() = systemData->GetStateVersion();
+		graphicsData.ResetRigidItems(structureChanged);
+
 		Index cnt;
+		if (systemData->GetCData().UpdateVisualizationRecordState()) //take next state queued for image recording
+		{
+			visualizationSystemContainer.saveImage = true;
+			visualizationSystemContainer.saveImageOpenGL = true; //send immediately signal to openGL that frame needs to be recorded
+		}
+		else
+		{
+			systemData->GetCData().UpdateVisualizationState(); //take newest state published by computation thread (triple buffer; computation is not locked)
+		}
 		postProcessData->visualizationTime = systemData->GetCData().GetVisualization().GetTime(); //update time, synchronized with the state shown 
 
 		//++++++++++++++++++++++++++++++++++++++++++++++
@@ -324,7 +334,6 @@ void VisualizationSystem::UpdateGraphicsData(VisualizationSystemContainer& visua
 
 		graphicsData.ClearLock();
 	}
-	postProcessData->accessState.clear(std::memory_order_release); //computation thread must be interrupted before further update
 }
 
 //! any multi-line text message from computation to be shown in renderer (e.g. time, solver, ...)
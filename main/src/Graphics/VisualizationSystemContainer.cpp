@@ -101,6 +101,9 @@ void VisualizationSystemContainer::RedrawAndSaveImage()
 	{
 		PyWarning("PostProcessData::RedrawAndSaveImage: save frame to image file did not finish; increase timeout parameter");
 	}
+#ifdef USE_GLFW_GRAPHICS
+	glfwRenderer.FlushImageFiles(); //files of asynchronous image saving must be complete when returning to python
+#endif
 }
 
 
@@ -307,6 +310,20 @@ void AddBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, GraphicsData&
 
 }
 
+void AddRigidBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, GraphicsData& graphicsData, Index itemNumber, const Float3& position, const Matrix3DF& rotation,
+	bool parametersHaveChanged)
+{
+	GraphicsData& rigidItem = graphicsData.GetRigidItem(itemNumber);
+	if (rigidItem.isDirty || parametersHaveChanged)
+	{
+		rigidItem.FlushData();
+		AddBodyGraphicsData(bodyGraphicsData, rigidItem, Float3({ 0.f,0.f,0.f }), EXUmath::unitMatrix3DF); //primitives in body-fixed coordinates
+		rigidItem.isDirty = false;
+	}
+	rigidItem.SetRigidBodyTransformation(position, rotation);
+	rigidItem.showItem = true;
+}
+
 
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
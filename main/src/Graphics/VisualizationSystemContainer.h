@@ -68,6 +68,11 @@ public:
 //! copy bodyGraphicsData (of body) into global graphicsData (of system); add position offset and transform with rotation matrix
 void AddBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, GraphicsData& graphicsData, const Float3& position, const Matrix3DF& rotation);
 
+//! retained mode: bodyGraphicsData (of rigid body with itemNumber) is copied only once (or if item is dirty or parametersHaveChanged) into rigid item of graphicsData (of system);
+//! in every update, only position and rotation of rigid item are updated
+void AddRigidBodyGraphicsData(const BodyGraphicsData& bodyGraphicsData, GraphicsData& graphicsData, Index itemNumber, const Float3& position, const Matrix3DF& rotation,
+	bool parametersHaveChanged = false);
+
 //! python function to read BodyGraphicsData from dictionary, e.g. for body or ground graphics
 bool PyWriteBodyGraphicsData(const py::dict& d, const char* item, BodyGraphicsData& data);
 
@@ -140,6 +140,52 @@ namespace HGeometry {
 		return sqrt(vLinePoint0Point*vLinePoint0Point - num * num / den);
 	}
 
+	//! compute point on triangle (p0, p1, p2; INCLUDING edges and vertices) with shortest distance to 'point';
+	//! uses the Voronoi regions of vertices, edges and face (see Ericson, Real-Time Collision Detection, 2005); degenerate triangles return a point of the triangle
+	//! should work for Vector3D, ConstVector<3> ...
+	template<class TVector>
+	inline TVector ClosestPointOnTriangle(const TVector& p0, const TVector& p1, const TVector& p2, const TVector& point)
+	{
+		TVector v01 = p1 - p0;
+		TVector v02 = p2 - p0;
+		TVector v0p = point - p0;
+		Real d1 = v01 * v0p;
+		Real d2 = v02 * v0p;
+		if (d1 <= 0. && d2 <= 0.) { return p0; } //vertex region p0
+
+		TVector v1p = point - p1;
+		Real d3 = v01 * v1p;
+		Real d4 = v02 * v1p;
+		if (d3 >= 0. && d4 <= d3) { return p1; } //vertex region p1
+
+		Real vc = d1 * d4 - d3 * d2;
+		if (vc <= 0. && d1 >= 0. && d3 <= 0.) //edge region p0-p1
+		{
+			return p0 + (d1 / (d1 - d3)) * v01;
+		}
+
+		TVector v2p = point - p2;
+		Real d5 = v01 * v2p;
+		Real d6 = v02 * v2p;
+		if (d6 >= 0. && d5 <= d6) { return p2; } //vertex region p2
+
+		Real vb = d5 * d2 - d1 * d6;
+		if (vb <= 0. && d2 >= 0. && d6 <= 0.) //edge region p0-p2
+		{
+			return p0 + (d2 / (d2 - d6)) * v02;
+		}
+
+		Real va = d3 * d6 - d5 * d4;
+		if (va <= 0. && (d4 - d3) >= 0. && (d5 - d6) >= 0.) //edge region p1-p2
+		{
+			return p1 + ((d4 - d3) / ((d4 - d3) + (d5 - d6))) * (p2 - p1);
+		}
+
+		Real den = va + vb + vc; //face region; den > 0 for non-degenerate triangles
+		if (den == 0.) { return p0; }
+		return p0 + (vb / den) * v01 + (vc / den) * v02;
+	}
+
 
 
 	//inline void ComputeOrthogonalBasis(Vector3D vector0, Vector3D& normal1, Vector3D& normal2) { ... }
@@ -14,17 +14,325 @@
 //BasicLinalg provides consistent includes for BasicDefinitions, arrays, vectors and matrices
 #include "Linalg/LinearSolver.h"	
 #include "Utilities/TimerStructure.h" //for local CPU time measurement
+#include <algorithm> //for std::equal, std::lower_bound
+#include <cmath> //for std::isfinite, std::hypot
+#include <limits> //for std::numeric_limits
+#include <thread> //for dense LU factorization without TaskManager
 
+#ifdef USE_NGSOLVE_TASKMANAGER
+#include "ngs-core-master/ngs_core.hpp"
+#endif
+
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//dense factorization: the matrix is overwritten with its triangular factors (no explicit inverse, which would need 3 times more operations)
+
+const Index denseLUblockSize = 64;			//!< number of columns of panel in blocked LU factorization
+const Index denseLUcolumnTileSize = 512;	//!< number of columns processed at once in trailing matrix update (keeps rows of U12 in cache)
+const Index denseLUparallelMinSize = 256;	//!< trailing matrix update is only parallelized for larger matrices
+const Real denseLDLTmaxFactor = 10;		//!< LDLT (without pivoting) is rejected, if entries of L exceed this value (growth of round-off errors); LU with partial pivoting has entries <= 1
 
-	//! factorize matrix (invert, SparseLU, etc.); 0=success
+//! factorize matrix (dense: Cholesky for symmetric positive definite matrices, LDLT for other symmetric matrices, otherwise LU with partial pivoting); 0=success
 Index GeneralMatrixEXUdense::Factorize()
 {
-	Index rv = !matrix.Invert();
-	if (!rv) { SetMatrixIsFactorized(true); }
-	else { SetMatrixIsFactorized(false); }
+	SetMatrixIsFactorized(false);
+	choleskyFactorization = false;
+	ldltFactorization = false;
+	CHECKandTHROW(matrix.NumberOfRows() == matrix.NumberOfColumns(), "GeneralMatrixEXUdense::Factorize(): only valid for quadratic matrices");
+
+	Index n = matrix.NumberOfRows();
+	const Real* a = matrix.GetDataPointer();
+
+	//check for exact symmetry (costs n^2/2 comparisons, while factorization needs n^3/3 operations):
+	bool isSymmetric = true;
+	for (Index i = 1; i < n && isSymmetric; i++)
+	{
+		for (Index j = 0; j < i; j++)
+		{
+			if (a[i*n + j] != a[j*n + i]) { isSymmetric = false; break; }
+		}
+	}
+
+	Index rv = 0;
+	if (isSymmetric && n != 0)
+	{
+		//Cholesky and LDLT factorization only overwrite lower triangle; keep diagonal for restoring matrix, if factorization fails:
+		Vector diagonal(n);
+		for (Index i = 0; i < n; i++) { diagonal[i] = a[i*n + i]; }
+
+		//restore matrix from unmodified upper triangle (rows >= failedRow are untouched)
+		auto RestoreLowerTriangle = [this, n, &diagonal](Index failedRow)
+		{
+			Real* aw = matrix.GetDataPointer();
+			for (Index i = 0; i < failedRow; i++)
+			{
+				for (Index j = 0; j < i; j++) { aw[i*n + j] = aw[j*n + i]; }
+				aw[i*n + i] = diagonal[i];
+			}
+		};
+
+		rv = FactorizeCholesky();
+		if (rv == 0)
+		{
+			choleskyFactorization = true;
+			SetMatrixIsFactorized(true);
+			return 0;
+		}
+		RestoreLowerTriangle(rv);
+
+		//symmetric indefinite, e.g., static problems with constraints: LDLT needs half of the operations of LU
+		rv = FactorizeLDLT();
+		if (rv == 0)
+		{
+			ldltFactorization = true;
+			SetMatrixIsFactorized(true);
+			return 0;
+		}
+		RestoreLowerTriangle(rv);
+	}
+
+	rv = FactorizeLU();
+	if (rv == 0) { SetMatrixIsFactorized(true); }
 	return rv;
 }
 
+//! in-place Cholesky factorization of lower triangle; returns 0 if success, otherwise (row+1) of first non-positive pivot; upper triangle is not modified
+Index GeneralMatrixEXUdense::FactorizeCholesky()
+{
+	Index n = matrix.NumberOfRows();
+	Real* a = matrix.GetDataPointer();
+
+	//row-wise (Cholesky-Banachiewicz) algorithm: only contiguous dot products of rows
+	for (Index i = 0; i < n; i++)
+	{
+		Real* rowI = &a[i*n];
+		for (Index j = 0; j <= i; j++)
+		{
+			const Real* rowJ = &a[j*n];
+			Real sum = rowI[j];
+			for (Index k = 0; k < j; k++) { sum -= rowI[k] * rowJ[k]; }
+
+			if (j < i) { rowI[j] = sum / rowJ[j]; }
+			else
+			{
+				if (sum <= 0.) { return i + 1; } //not positive definite ==> LU
+				rowI[i] = sqrt(sum);
+			}
+		}
+	}
+	return 0;
+}
+
+//! in-place LDLT factorization of lower triangle without pivoting; returns 0 if success, otherwise (row+1) of first zero or unstable pivot;
+//! as no pivoting is done, the factorization is rejected (==> LU) if entries of L grow large; upper triangle is not modified
+Index GeneralMatrixEXUdense::FactorizeLDLT()
+{
+	Index n = matrix.NumberOfRows();
+	Real* a = matrix.GetDataPointer();
+	Vector rowTimesD(n); //L(i,k)*D(k) of current row i
+
+	//row-wise algorithm as in FactorizeCholesky(): L(i,j) = (A(i,j) - sum_k L(i,k)*D(k)*L(j,k)) / D(j), D(i) = A(i,i) - sum_k L(i,k)*D(k)*L(i,k)
+	for (Index i = 0; i < n; i++)
+	{
+		Real* rowI = &a[i*n];
+		for (Index j = 0; j < i; j++)
+		{
+			const Real* rowJ = &a[j*n];
+			Real sum = rowI[j];
+			for (Index k = 0; k < j; k++) { sum -= rowTimesD[k] * rowJ[k]; }
+
+			rowTimesD[j] = sum;
+			rowI[j] = sum / rowJ[j];
+			if (!(fabs(rowI[j]) <= denseLDLTmaxFactor)) { return i + 1; } //also catches NaN
+		}
+		Real sum = rowI[i];
+		for (Index k = 0; k < i; k++) { sum -= rowTimesD[k] * rowI[k]; }
+		if (sum == 0. || !std::isfinite(sum)) { return i + 1; }
+		rowI[i] = sum;
+	}
+	return 0;
+}
+
+//! in-place blocked LU factorization with partial (row) pivoting; returns 0 if success, otherwise (column+1) of first zero pivot
+//! P*A = L*U, with unit lower triangular L (stored below diagonal) and upper triangular U
+Index GeneralMatrixEXUdense::FactorizeLU()
+{
+	Index n = matrix.NumberOfRows();
+	Real* a = matrix.GetDataPointer();
+	pivotIndices.SetNumberOfItems(n);
+
+	for (Index k0 = 0; k0 < n; k0 += denseLUblockSize)
+	{
+		Index k1 = EXUstd::Minimum(k0 + denseLUblockSize, n); //panel = columns k0..k1-1
+
+		//1) unblocked factorization of panel (rows k0..n-1); rows are interchanged in full length
+		for (Index j = k0; j < k1; j++)
+		{
+			Index pivotRow = j;
+			Real pivot = fabs(a[j*n + j]);
+			for (Index i = j + 1; i < n; i++)
+			{
+				if (fabs(a[i*n + j]) > pivot) { pivotRow = i; pivot = fabs(a[i*n + j]); }
+			}
+			if (pivot == 0.) { return j + 1; }
+
+			pivotIndices[j] = pivotRow;
+			if (pivotRow != j) { matrix.SwapRows(pivotRow, j); }
+
+			const Real* rowJ = &a[j*n];
+			Real invPivot = 1. / rowJ[j];
+			for (Index i = j + 1; i < n; i++)
+			{
+				Real* rowI = &a[i*n];
+				Real lij = (rowI[j] *= invPivot);
+				if (lij != 0.)
+				{
+					for (Index c = j + 1; c < k1; c++) { rowI[c] -= lij * rowJ[c]; }
+				}
+			}
+		}
+		if (k1 == n) { break; }
+
+		//2) U12 = L11^{-1}*A12 (rows k0..k1-1, columns k1..n-1), L11 unit lower triangular
+		for (Index r = k0 + 1; r < k1; r++)
+		{
+			Real* rowR = &a[r*n];
+			for (Index p = k0; p < r; p++)
+			{
+				Real lrp = rowR[p];
+				if (lrp != 0.)
+				{
+					const Real* rowP = &a[p*n];
+					for (Index c = k1; c < n; c++) { rowR[c] -= lrp * rowP[c]; }
+				}
+			}
+		}
+
+		//3) trailing matrix update A22 -= L21*U12; rows are independent, columns are tiled for cache efficiency
+		auto UpdateRow = [a, n, k0, k1](Index i)
+		{
+			Real* rowI = &a[i*n];
+			for (Index c0 = k1; c0 < n; c0 += denseLUcolumnTileSize)
+			{
+				Index c1 = EXUstd::Minimum(c0 + denseLUcolumnTileSize, n);
+				for (Index p = k0; p < k1; p++)
+				{
+					Real lip = rowI[p];
+					if (lip != 0.)
+					{
+						const Real* rowP = &a[p*n];
+						for (Index c = c0; c < c1; c++) { rowI[c] -= lip * rowP[c]; }
+					}
+				}
+			}
+		};
+
+#ifdef USE_NGSOLVE_TASKMANAGER
+		if (n - k1 >= denseLUparallelMinSize)
+		{
+			ngstd::ParallelFor((size_t)(n - k1), [&UpdateRow, k1](size_t i) { UpdateRow(k1 + (Index)i); });
+		}
+		else
+#else
+		if (n - k1 >= denseLUparallelMinSize && numberOfThreads > 1)
+		{
+			//without TaskManager: contiguous blocks of rows in std::threads; the calling thread takes the last block
+			Index nThreads = EXUstd::Minimum(numberOfThreads, (n - k1) / (denseLUparallelMinSize / 4));
+			auto UpdateRows = [&UpdateRow, n, k1, nThreads](Index t)
+			{
+				for (Index i = k1 + ((n - k1) * t) / nThreads; i < k1 + ((n - k1) * (t + 1)) / nThreads; i++) { UpdateRow(i); }
+			};
+			std::vector<std::thread> threads;
+			for (Index t = 0; t < nThreads - 1; t++) { threads.push_back(std::thread(UpdateRows, t)); }
+			UpdateRows(nThreads - 1);
+			for (std::thread& thread : threads) { thread.join(); }
+		}
+		else
+#endif
+		{
+			for (Index i = k1; i < n; i++) { UpdateRow(i); }
+		}
+	}
+	return 0;
+}
+
+//!after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
+//!uses forward and backward substitution with the triangular factors
+void GeneralMatrixEXUdense::Solve(const Vector& rhs, Vector& solution)
+{
+	if (!IsMatrixIsFactorized()) { SysError("GeneralMatrixEXUdense::Solve(...): matrix is not factorized!"); }
+	Index n = matrix.NumberOfRows();
+	CHECKandTHROW(rhs.NumberOfItems() == n, "GeneralMatrixEXUdense::Solve(...): size of rhs does not match matrix size");
+
+	const Real* a = matrix.GetDataPointer();
+	solution.CopyFrom(rhs);
+	Real* x = solution.GetDataPointer();
+
+	if (choleskyFactorization)
+	{
+		//forward substitution L*y = rhs
+		for (Index i = 0; i < n; i++)
+		{
+			const Real* rowI = &a[i*n];
+			Real sum = x[i];
+			for (Index k = 0; k < i; k++) { sum -= rowI[k] * x[k]; }
+			x[i] = sum / rowI[i];
+		}
+		//backward substitution L^T*x = y; column-oriented to access rows of L
+		for (SignedIndex i = (SignedIndex)n - 1; i >= 0; i--)
+		{
+			const Real* rowI = &a[i*n];
+			x[i] /= rowI[i];
+			Real xi = x[i];
+			for (SignedIndex k = 0; k < i; k++) { x[k] -= rowI[k] * xi; }
+		}
+	}
+	else if (ldltFactorization)
+	{
+		//forward substitution L*z = rhs, unit diagonal
+		for (Index i = 1; i < n; i++)
+		{
+			const Real* rowI = &a[i*n];
+			Real sum = x[i];
+			for (Index k = 0; k < i; k++) { sum -= rowI[k] * x[k]; }
+			x[i] = sum;
+		}
+		//y = D^{-1}*z
+		for (Index i = 0; i < n; i++) { x[i] /= a[i*n + i]; }
+		//backward substitution L^T*x = y, unit diagonal; column-oriented to access rows of L
+		for (SignedIndex i = (SignedIndex)n - 1; i > 0; i--)
+		{
+			const Real* rowI = &a[i*n];
+			Real xi = x[i];
+			for (SignedIndex k = 0; k < i; k++) { x[k] -= rowI[k] * xi; }
+		}
+	}
+	else
+	{
+		//apply row interchanges
+		for (Index i = 0; i < n; i++)
+		{
+			if (pivotIndices[i] != i) { std::swap(x[i], x[pivotIndices[i]]); }
+		}
+		//forward substitution L*y = P*rhs, unit diagonal
+		for (Index i = 1; i < n; i++)
+		{
+			const Real* rowI = &a[i*n];
+			Real sum = x[i];
+			for (Index k = 0; k < i; k++) { sum -= rowI[k] * x[k]; }
+			x[i] = sum;
+		}
+		//backward substitution U*x = y
+		for (SignedIndex i = (SignedIndex)n - 1; i >= 0; i--)
+		{
+			const Real* rowI = &a[i*n];
+			Real sum = x[i];
+			for (Index k = (Index)i + 1; k < n; k++) { sum -= rowI[k] * x[k]; }
+			x[i] = sum / rowI[i];
+		}
+	}
+}
+
 
 
 #ifdef USE_EIGEN_SPARSE_SOLVER
@@ -39,12 +347,79 @@ void GeneralMatrixEigenSparse::SetAllZero()
 	SetMatrixBuiltFromTriplets(false);
 
 	triplets.resize(0); //this removes all entries!
-	matrix.setZero();	//flush the Eigen sparse matrix
+
+	if (fixedPatternAssembly && matrix.nonZeros() != 0 && matrix.isCompressed() &&
+		(Index)matrix.rows() == NumberOfRows() && (Index)matrix.cols() == NumberOfColumns())
+	{
+		//keep sparsity pattern, values are added in place until next FinalizeMatrix()
+		matrix.coeffs().setZero();
+		patternAssemblyActive = true;
+		scatterMapPosition = 0;
+	}
+	else
+	{
+		matrix.setZero();	//flush the Eigen sparse matrix
+		patternAssemblyActive = false;
+		scatterMap.clear();
+	}
+}
+
+//! switch from fixed-pattern assembly back to triplet mode; values already added to matrix are moved to triplets
+void GeneralMatrixEigenSparse::DeactivatePatternAssembly()
+{
+	if (patternAssemblyActive)
+	{
+		for (Index k = 0; k < (Index)matrix.outerSize(); ++k)
+		{
+			for (EigenSparseMatrix::InnerIterator it(matrix, k); it; ++it)
+			{
+				if (it.value() != 0.)
+				{
+					triplets.push_back(EigenTriplet((StorageIndex)it.row(), (StorageIndex)it.col(), it.value()));
+				}
+			}
+		}
+		matrix.setZero();
+		patternAssemblyActive = false;
+	}
+	scatterMap.clear();
+	scatterMapPosition = 0;
+}
+
+//! return position of entry (row,column) in value array of compressed matrix or -1, if entry is not in pattern
+StorageIndex GeneralMatrixEigenSparse::FindPatternEntry(StorageIndex row, StorageIndex column) const
+{
+	if (column < 0 || column >= matrix.cols()) { return -1; }
+
+	//inner (row) indices are sorted within each column of the compressed matrix
+	const StorageIndex* begin = matrix.innerIndexPtr() + matrix.outerIndexPtr()[column];
+	const StorageIndex* end = matrix.innerIndexPtr() + matrix.outerIndexPtr()[column + 1];
+	const StorageIndex* item = std::lower_bound(begin, end, row);
+	if (item != end && *item == row) { return (StorageIndex)(item - matrix.innerIndexPtr()); }
+
+	return -1;
+}
+
+//! add matrix values of fixed-pattern assembly (without triplets): solution += A*x (transposed=false) or solution += A^T*x (transposed=true)
+void GeneralMatrixEigenSparse::MultPatternValuesVectorAdd(const Vector& x, Vector& solution, bool transposed) const
+{
+	for (Index k = 0; k < (Index)matrix.outerSize(); ++k)
+	{
+		for (EigenSparseMatrix::InnerIterator it(matrix, k); it; ++it)
+		{
+			if (!transposed) { solution[(Index)it.row()] += x[(Index)it.col()] * it.value(); }
+			else { solution[(Index)it.col()] += x[(Index)it.row()] * it.value(); }
+		}
+	}
 }
 
 //! reset matrices and free memory
 void GeneralMatrixEigenSparse::Reset()
 {
+	//pattern must not be kept for the simplistic problem:
+	bool storeFixedPatternAssembly = fixedPatternAssembly;
+	SetFixedPatternAssembly(false);
+
 	//no easy way to do free memory: create simplistic problem to reduce memory
 	SetAllZero();
 	SetNumberOfRowsAndColumns(1, 1);
@@ -55,6 +430,13 @@ void GeneralMatrixEigenSparse::Reset()
 	SetAllZero();
 	triplets.shrink_to_fit(); //this erases the data if it has zero entries
 	matrix.data().squeeze();
+
+	ResetPatternCache();
+	analyzedOuterIndices.shrink_to_fit();
+	analyzedInnerIndices.shrink_to_fit();
+
+	scatterMap.shrink_to_fit();
+	SetFixedPatternAssembly(storeFixedPatternAssembly);
 }
 
 //! multiply either triplets or matrix entries with factor
@@ -67,6 +449,8 @@ void GeneralMatrixEigenSparse::MultiplyWithFactor(Real factor)
 	}
 	else //work on triplets
 	{
+		if (patternAssemblyActive) { matrix.coeffs() *= factor; } //values added in place
+
 		for (auto& item : triplets)
 		{
 			item = EigenTriplet(item.row(), item.col(), factor*item.value());
@@ -83,6 +467,8 @@ void GeneralMatrixEigenSparse::SetMatrix(const Matrix& otherMatrix)
 
 	triplets.resize(0); //this removes all entries!
 	matrix.setZero();	//flush the Eigen sparse matrix
+	patternAssemblyActive = false;
+	scatterMap.clear();
 
 	for (Index i = 0; i < otherMatrix.NumberOfRows(); i++)
 	{
@@ -106,7 +492,18 @@ void GeneralMatrixEigenSparse::AddSubmatrix(const Matrix& submatrix, Real factor
 	//only allowed in triplet mode:
 	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::AddSubmatrix(const Matrix&, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, ...): only possible in triplet mode!");
 
-	if (factor == 1. && rowOffset == 0 && columnOffset == 0)
+	if (patternAssemblyActive)
+	{
+		//zeros are also processed, such that the scatter map does not depend on the values
+		for (Index i = 0; i < submatrix.NumberOfRows(); i++)
+		{
+			for (Index j = 0; j < submatrix.NumberOfColumns(); j++)
+			{
+				AddPatternEntry((StorageIndex)(LTGrows[i] + rowOffset), (StorageIndex)(LTGcolumns[j] + columnOffset), factor*submatrix(i, j));
+			}
+		}
+	}
+	else if (factor == 1. && rowOffset == 0 && columnOffset == 0)
 	{
 		for (Index i = 0; i < submatrix.NumberOfRows(); i++)
 		{
@@ -144,7 +541,17 @@ void GeneralMatrixEigenSparse::AddSubmatrixTransposed(const Matrix& submatrix, R
 	//only allowed in triplet mode:
 	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::AddSubmatrix(const Matrix&, const ArrayIndex& LTGrows, const ArrayIndex& LTGcolumns, ...): only possible in triplet mode!");
 
-	if (factor == 1. && rowOffset == 0 && columnOffset == 0)
+	if (patternAssemblyActive)
+	{
+		for (Index j = 0; j < submatrix.NumberOfRows(); j++)
+		{
+			for (Index i = 0; i < submatrix.NumberOfColumns(); i++)
+			{
+				AddPatternEntry((StorageIndex)(LTGrows[i] + rowOffset), (StorageIndex)(LTGcolumns[j] + columnOffset), factor*submatrix(j, i));
+			}
+		}
+	}
+	else if (factor == 1. && rowOffset == 0 && columnOffset == 0)
 	{
 		for (Index j = 0; j < submatrix.NumberOfRows(); j++)
 		{
@@ -183,11 +590,48 @@ void GeneralMatrixEigenSparse::AddSubmatrix(const GeneralMatrix& submatrix, Inde
 	CHECKandTHROW(!IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::AddSubmatrix(const GeneralMatrix&, ...): matrix must be in triplet mode !");
 
 	const GeneralMatrixEigenSparse& m = (const GeneralMatrixEigenSparse&)submatrix;
-	CHECKandTHROW(!m.IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::AddSubmatrix(const GeneralMatrix&, ...): matrix must be in triplet mode !");
 
 	SetMatrixIsFactorized(false);
 
-	if ((rowOffset != 0) || (columnOffset != 0))
+	if (m.IsMatrixBuiltFromTriplets())
+	{
+		//finalized submatrix (fixed-pattern assembly of mass matrix or temporary jacobian): add values of compressed matrix
+		for (Index k = 0; k < (Index)m.matrix.outerSize(); ++k)
+		{
+			for (EigenSparseMatrix::InnerIterator it(m.matrix, k); it; ++it)
+			{
+				StorageIndex row = (StorageIndex)it.row() + (StorageIndex)rowOffset;
+				StorageIndex column = (StorageIndex)it.col() + (StorageIndex)columnOffset;
+				if (patternAssemblyActive) { AddPatternEntry(row, column, it.value()); }
+				else if (it.value() != 0.) { triplets.push_back(EigenTriplet(row, column, it.value())); }
+			}
+		}
+	}
+	else if (patternAssemblyActive || m.patternAssemblyActive)
+	{
+		//values of submatrix added in place (also explicit zeros of pattern, which keeps the scatter map independent of values)
+		if (m.patternAssemblyActive)
+		{
+			for (Index k = 0; k < (Index)m.matrix.outerSize(); ++k)
+			{
+				for (EigenSparseMatrix::InnerIterator it(m.matrix, k); it; ++it)
+				{
+					StorageIndex row = (StorageIndex)it.row() + (StorageIndex)rowOffset;
+					StorageIndex column = (StorageIndex)it.col() + (StorageIndex)columnOffset;
+					if (patternAssemblyActive) { AddPatternEntry(row, column, it.value()); }
+					else if (it.value() != 0.) { triplets.push_back(EigenTriplet(row, column, it.value())); }
+				}
+			}
+		}
+		for (const EigenTriplet& item : m.GetEigenTriplets())
+		{
+			StorageIndex row = item.row() + (StorageIndex)rowOffset;
+			StorageIndex column = item.col() + (StorageIndex)columnOffset;
+			if (patternAssemblyActive) { AddPatternEntry(row, column, item.value()); }
+			else if (item.value() != 0.) { triplets.push_back(EigenTriplet(row, column, item.value())); }
+		}
+	}
+	else if ((rowOffset != 0) || (columnOffset != 0))
 	{
 		for (const EigenTriplet& item : m.GetEigenTriplets())
 		{
@@ -217,9 +661,10 @@ void GeneralMatrixEigenSparse::AddColumnVector(Index column, const Vector& vec)
 	for (Index i = 0; i < vec.NumberOfItems(); i++) //i = row
 	{
 		Real value = vec[i];
-		if (value != 0.)
+		if (value != 0.) //zeros are filtered also in fixed-pattern assembly, as vec usually has system size
 		{
-			triplets.push_back(EigenTriplet((StorageIndex)i, (StorageIndex)column, value));
+			if (patternAssemblyActive) { AddPatternEntry((StorageIndex)i, (StorageIndex)column, value); }
+			else { triplets.push_back(EigenTriplet((StorageIndex)i, (StorageIndex)column, value)); }
 		}
 	}
 }
@@ -229,9 +674,43 @@ void GeneralMatrixEigenSparse::FinalizeMatrix()
 {
 	SetMatrixIsFactorized(false);
 
-	if (matrix.nonZeros() != 0) { matrix.setZero(); } //this should be already done in matrix.resize - could be omitted ...?
-	matrix.resize(NumberOfRows(), NumberOfColumns());
-	matrix.setFromTriplets(triplets.begin(), triplets.end()); //sums up duplicates by default... (@TODO: what happens in EigenSparseMatrix::setFromTriplets(...) with (+1) + (-1) ? )
+	if (patternAssemblyActive)
+	{
+		//triplets contain entries not found in pattern or added directly via GetEigenTriplets() (e.g. parallel mass matrix):
+		size_t nNotInPattern = 0;
+		for (const EigenTriplet& item : triplets)
+		{
+			StorageIndex pos = FindPatternEntry(item.row(), item.col());
+			if (pos >= 0) { matrix.valuePtr()[pos] += item.value(); }
+			else { triplets[nNotInPattern++] = item; }
+		}
+		triplets.resize(nNotInPattern);
+
+		if (nNotInPattern != 0) 
+		{
+			//pattern needs to be extended (e.g. due to changed connectivity); current pattern is kept, including explicit zeros
+			for (Index k = 0; k < (Index)matrix.outerSize(); ++k)
+			{
+				for (EigenSparseMatrix::InnerIterator it(matrix, k); it; ++it)
+				{
+					triplets.push_back(EigenTriplet((StorageIndex)it.row(), (StorageIndex)it.col(), it.value()));
+				}
+			}
+			matrix.setZero();
+			matrix.setFromTriplets(triplets.begin(), triplets.end());
+			matrix.makeCompressed();
+			scatterMap.clear(); //positions in value array changed
+		}
+		triplets.resize(0);
+		patternAssemblyActive = false;
+	}
+	else
+	{
+		if (matrix.nonZeros() != 0) { matrix.setZero(); } //this should be already done in matrix.resize - could be omitted ...?
+		matrix.resize(NumberOfRows(), NumberOfColumns());
+		matrix.setFromTriplets(triplets.begin(), triplets.end()); //sums up duplicates by default... (@TODO: what happens in EigenSparseMatrix::setFromTriplets(...) with (+1) + (-1) ? )
+		if (fixedPatternAssembly) { matrix.makeCompressed(); } //needed for in place assembly with scatter map
+	}
 
 	SetMatrixBuiltFromTriplets(); //now the sparse matrix is finally set and ready for multiplication and factorization
 }
@@ -246,9 +725,38 @@ Index GeneralMatrixEigenSparse::Factorize()
 {
 	CHECKandTHROW(IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparse::Factorize(): matrix must be built before factorization!");
 
-	//STARTGLOBALTIMER(TSeigenAnalyzePattern);
-	solver.analyzePattern(matrix);
-	//STOPGLOBALTIMER(TSeigenAnalyzePattern);
+	//check, if sparsity pattern is identical to last analyzed pattern; matrix is always compressed after setFromTriplets
+	bool patternChanged = true;
+	if (reuseAnalyzedPattern && patternIsAnalyzed)
+	{
+		Index nOuter = matrix.outerSize() + 1;
+		Index nnz = matrix.nonZeros();
+		if ((Index)analyzedOuterIndices.size() == nOuter && (Index)analyzedInnerIndices.size() == nnz &&
+			std::equal(analyzedOuterIndices.begin(), analyzedOuterIndices.end(), matrix.outerIndexPtr()) &&
+			std::equal(analyzedInnerIndices.begin(), analyzedInnerIndices.end(), matrix.innerIndexPtr()))
+		{
+			patternChanged = false;
+		}
+	}
+
+	if (patternChanged)
+	{
+		//STARTGLOBALTIMER(TSeigenAnalyzePattern);
+		solver.analyzePattern(matrix);
+		//STOPGLOBALTIMER(TSeigenAnalyzePattern);
+		patternAnalysisCount++;
+
+		if (reuseAnalyzedPattern) //store pattern for next factorization
+		{
+			analyzedOuterIndices.assign(matrix.outerIndexPtr(), matrix.outerIndexPtr() + matrix.outerSize() + 1);
+			analyzedInnerIndices.assign(matrix.innerIndexPtr(), matrix.innerIndexPtr() + matrix.nonZeros());
+			patternIsAnalyzed = true;
+		}
+	}
+	else
+	{
+		patternReuseCount++;
+	}
 
 	// Compute the numerical factorization 
 	//STARTGLOBALTIMER(TSeigenFactorize);
@@ -261,6 +769,7 @@ Index GeneralMatrixEigenSparse::Factorize()
 	//> A->ncol: number of bytes allocated when memory allocation failure occurred, plus A->ncol.If lwork = -1, it is the estimated amount of space needed, plus A->ncol.
 	Index rv = solver.info();
 	if (!rv) { SetMatrixIsFactorized(true); }
+	else { patternIsAnalyzed = false; } //for safety: redo symbolic analysis after failed factorization
 
 	return rv;
 }
@@ -297,6 +806,7 @@ void GeneralMatrixEigenSparse::MultMatrixVector(const Vector& x, Vector& solutio
 	else //work on triplets; no memory allocation
 	{
 		solution.SetAll(0.);
+		if (patternAssemblyActive) { MultPatternValuesVectorAdd(x, solution, false); }
 
 		for (const auto& item : triplets)
 		{
@@ -336,6 +846,8 @@ void GeneralMatrixEigenSparse::MultMatrixVectorAdd(const Vector& x, Vector& solu
 	}
 	else //work on triplets; no memory allocation
 	{
+		if (patternAssemblyActive) { MultPatternValuesVectorAdd(x, solution, false); }
+
 		for (const auto& item : triplets)
 		{
 			solution[item.row()] += x[item.col()] * item.value();
@@ -359,6 +871,7 @@ void GeneralMatrixEigenSparse::MultMatrixTransposedVector(const Vector& x, Vecto
 	{
 		solution.SetNumberOfItems(nRows);
 		solution.SetAll(0.);
+		if (patternAssemblyActive) { MultPatternValuesVectorAdd(x, solution, true); }
 
 		for (const auto& item : triplets)
 		{
@@ -419,6 +932,16 @@ ResizableMatrix GeneralMatrixEigenSparse::GetEXUdenseMatrix() const
 	}
 	else //add all triplets to matrix
 	{
+		if (patternAssemblyActive)
+		{
+			for (Index k = 0; k < (Index)matrix.outerSize(); ++k)
+			{
+				for (EigenSparseMatrix::InnerIterator it(matrix, k); it; ++it)
+				{
+					denseMatrix((Index)it.row(), (Index)it.col()) += it.value();
+				}
+			}
+		}
 		for (auto& item : triplets)
 		{
 			denseMatrix(item.row(), item.col()) += item.value();
@@ -427,4 +950,486 @@ ResizableMatrix GeneralMatrixEigenSparse::GetEXUdenseMatrix() const
 	return denseMatrix;
 }
 
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//iterative sparse solver (GeneralMatrixEigenSparseIterative)
+const Index iterativeParallelMinSize = 10000;	//!< matrix-vector products are only parallelized for larger matrices
+const Real iterativeZeroPivotTolerance = 1e-14;	//!< pivots of preconditioner smaller than tolerance*(row scale) are regularized
+
+//! return pivot or a regularized pivot, if it is (numerically) zero; scale is the maximum absolute value of the row (or block)
+inline Real IterativeRegularizedPivot(Real pivot, Real scale)
+{
+	if (fabs(pivot) > iterativeZeroPivotTolerance * scale) { return pivot; }
+	Real value = (scale != 0.) ? scale : 1.;
+	return (pivot < 0.) ? -value : value;
+}
+
+//! reset matrices and free memory
+void GeneralMatrixEigenSparseIterative::Reset()
+{
+	GeneralMatrixEigenSparse::Reset();
+
+	rowStart.clear(); rowStart.shrink_to_fit();
+	columnIndices.clear(); columnIndices.shrink_to_fit();
+	values.clear(); values.shrink_to_fit();
+	diagonalPositions.clear(); diagonalPositions.shrink_to_fit();
+	preconditionerValues.clear(); preconditionerValues.shrink_to_fit();
+	blockPivots.clear(); blockPivots.shrink_to_fit();
+
+	r.resize(0); r0.resize(0); p.resize(0); v.resize(0); s.resize(0); t.resize(0); y.resize(0); z.resize(0);
+	krylovBasis.resize(0, 0);
+	hessenberg.resize(0, 0);
+	givensCos.resize(0); givensSin.resize(0); residualVector.resize(0);
+
+	ResetIterationStatistics();
+}
+
+//! copy matrix into row-compressed storage and compute preconditioner
+Index GeneralMatrixEigenSparseIterative::Factorize()
+{
+	CHECKandTHROW(IsMatrixBuiltFromTriplets(), "GeneralMatrixEigenSparseIterative::Factorize(): matrix must be built before factorization!");
+	CHECKandTHROW(NumberOfRows() == NumberOfColumns(), "GeneralMatrixEigenSparseIterative::Factorize(): matrix must be square!");
+	SetMatrixIsFactorized(false);
+
+	const EigenSparseMatrix& A = GetEigenSparseMatrix(); //column-major
+	Index n = NumberOfRows();
+
+	//count off-diagonal entries per row; the diagonal is always added:
+	rowStart.assign(n + 1, 0);
+	for (Index col = 0; col < n; col++)
+	{
+		rowStart[col + 1]++;
+		for (EigenSparseMatrix::InnerIterator it(A, col); it; ++it)
+		{
+			if ((Index)it.row() != col) { rowStart[(Index)it.row() + 1]++; }
+		}
+	}
+	for (Index i = 0; i < n; i++) { rowStart[i + 1] += rowStart[i]; }
+
+	//fill rows; columns are processed in ascending order, therefore column indices are sorted in every row:
+	Index nnz = rowStart[n];
+	columnIndices.resize(nnz);
+	values.resize(nnz);
+	diagonalPositions.resize(n);
+	std::vector<StorageIndex> rowFill(rowStart.begin(), rowStart.end() - 1);
+	for (Index col = 0; col < n; col++)
+	{
+		StorageIndex diagonalPosition = rowFill[col]++;
+		diagonalPositions[col] = diagonalPosition;
+		columnIndices[diagonalPosition] = (StorageIndex)col;
+		values[diagonalPosition] = 0.;
+
+		for (EigenSparseMatrix::InnerIterator it(A, col); it; ++it)
+		{
+			Index row = (Index)it.row();
+			if (row == col) { values[diagonalPosition] += it.value(); }
+			else
+			{
+				StorageIndex pos = rowFill[row]++;
+				columnIndices[pos] = (StorageIndex)col;
+				values[pos] = it.value();
+			}
+		}
+	}
+
+	for (Index i = 0; i < n; i++)
+	{
+		for (StorageIndex k = rowStart[i]; k < rowStart[i + 1]; k++)
+		{
+			if (!std::isfinite(values[k])) { return i + 1; }
+		}
+	}
+
+	//compute preconditioner:
+	switch (preconditionerType)
+	{
+	case PreconditionerType::_None: preconditionerValues.clear(); break;
+	case PreconditionerType::Jacobi:
+	{
+		preconditionerValues.resize(n);
+		for (Index i = 0; i < n; i++)
+		{
+			Real scale = 0.;
+			for (StorageIndex k = rowStart[i]; k < rowStart[i + 1]; k++) { scale = EXUstd::Maximum(scale, fabs(values[k])); }
+			preconditionerValues[i] = 1. / IterativeRegularizedPivot(values[diagonalPositions[i]], scale);
+		}
+		break;
+	}
+	case PreconditionerType::BlockJacobi: ComputeBlockJacobi(); break;
+	case PreconditionerType::ILU0: ComputeILU0(); break;
+	default: CHECKandTHROWstring("GeneralMatrixEigenSparseIterative::Factorize(): invalid PreconditionerType");
+	}
+	preconditionerCount++;
+
+	SetMatrixIsFactorized(true);
+	return 0;
+}
+
+//! compute incomplete LU factorization without fill-in (IKJ variant); L has unit diagonal, L and U are stored in the pattern of the matrix
+void GeneralMatrixEigenSparseIterative::ComputeILU0()
+{
+	Index n = NumberOfRows();
+	preconditionerValues = values;
+	std::vector<StorageIndex> columnPosition(n, -1); //position of column in current row i, -1 if not in pattern
+
+	for (Index i = 0; i < n; i++)
+	{
+		Real scale = 0.;
+		for (StorageIndex k = rowStart[i]; k < rowStart[i + 1]; k++)
+		{
+			columnPosition[columnIndices[k]] = k;
+			scale = EXUstd::Maximum(scale, fabs(values[k]));
+		}
+
+		for (StorageIndex k = rowStart[i]; k < diagonalPositions[i]; k++) //columns j < i
+		{
+			StorageIndex j = columnIndices[k];
+			Real factor = preconditionerValues[k] / preconditionerValues[diagonalPositions[j]];
+			preconditionerValues[k] = factor;
+			for (StorageIndex m = diagonalPositions[j] + 1; m < rowStart[j + 1]; m++) //U(j, columns > j)
+			{
+				StorageIndex pos = columnPosition[columnIndices[m]];
+				if (pos >= 0) { preconditionerValues[pos] -= factor * preconditionerValues[m]; }
+			}
+		}
+		preconditionerValues[diagonalPositions[i]] = IterativeRegularizedPivot(preconditionerValues[diagonalPositions[i]], scale);
+
+		for (StorageIndex k = rowStart[i]; k < rowStart[i + 1]; k++) { columnPosition[columnIndices[k]] = -1; }
+	}
+}
+
+//! compute LU factorization with partial pivoting of dense diagonal blocks; block starting at row r0 is stored row-major at r0*blockSize
+void GeneralMatrixEigenSparseIterative::ComputeBlockJacobi()
+{
+	Index n = NumberOfRows();
+	preconditionerValues.assign(n * blockSize, 0.);
+	blockPivots.resize(n);
+
+	for (Index r0 = 0; r0 < n; r0 += blockSize)
+	{
+		Index m = EXUstd::Minimum(blockSize, n - r0);
+		Real* block = &preconditionerValues[r0 * blockSize];
+		Real scale = 0.;
+		for (Index i = 0; i < m; i++)
+		{
+			for (StorageIndex k = rowStart[r0 + i]; k < rowStart[r0 + i + 1]; k++)
+			{
+				Index col = (Index)columnIndices[k];
+				if (col >= r0 && col < r0 + m)
+				{
+					block[i * m + col - r0] = values[k];
+					scale = EXUstd::Maximum(scale, fabs(values[k]));
+				}
+			}
+		}
+
+		for (Index k = 0; k < m; k++)
+		{
+			Index pivot = k;
+			for (Index i = k + 1; i < m; i++)
+			{
+				if (fabs(block[i * m + k]) > fabs(block[pivot * m + k])) { pivot = i; }
+			}
+			blockPivots[r0 + k] = pivot;
+			if (pivot != k)
+			{
+				for (Index j = 0; j < m; j++) { std::swap(block[k * m + j], block[pivot * m + j]); }
+			}
+			block[k * m + k] = IterativeRegularizedPivot(block[k * m + k], scale);
+
+			Real inversePivot = 1. / block[k * m + k];
+			for (Index i = k + 1; i < m; i++)
+			{
+				Real factor = block[i * m + k] * inversePivot;
+				block[i * m + k] = factor;
+				if (factor != 0.)
+				{
+					for (Index j = k + 1; j < m; j++) { block[i * m + j] -= factor * block[k * m + j]; }
+				}
+			}
+		}
+	}
+}
+
+//! result = A*x with row-compressed matrix
+void GeneralMatrixEigenSparseIterative::MultRowCompressed(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::Ref<Eigen::VectorXd> result) const
+{
+	Index n = NumberOfRows();
+	auto RowProduct = [this, &x, &result](Index i)
+	{
+		Real value = 0.;
+		for (StorageIndex k = rowStart[i]; k < rowStart[i + 1]; k++) { value += values[k] * x[columnIndices[k]]; }
+		result[i] = value;
+	};
+
+#ifdef USE_NGSOLVE_TASKMANAGER
+	if (n >= iterativeParallelMinSize)
+	{
+		ngstd::ParallelFor((size_t)n, [&RowProduct](size_t i) { RowProduct((Index)i); });
+	}
+	else
+#endif
+	{
+		for (Index i = 0; i < n; i++) { RowProduct(i); }
+	}
+}
+
+//! result = M^{-1}*x with preconditioner M
+void GeneralMatrixEigenSparseIterative::ApplyPreconditioner(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::Ref<Eigen::VectorXd> result) const
+{
+	Index n = NumberOfRows();
+	switch (preconditionerType)
+	{
+	case PreconditionerType::_None: result = x; break;
+	case PreconditionerType::Jacobi:
+	{
+		for (Index i = 0; i < n; i++) { result[i] = preconditionerValues[i] * x[i]; }
+		break;
+	}
+	case PreconditionerType::BlockJacobi:
+	{
+		result = x;
+		for (Index r0 = 0; r0 < n; r0 += blockSize)
+		{
+			Index m = EXUstd::Minimum(blockSize, n - r0);
+			const Real* block = &preconditionerValues[r0 * blockSize];
+			Real* res = &result[r0];
+			for (Index k = 0; k < m; k++) //row interchanges and forward substitution with unit lower triangular matrix
+			{
+				std::swap(res[k], res[blockPivots[r0 + k]]);
+				for (Index j = 0; j < k; j++) { res[k] -= block[k * m + j] * res[j]; }
+			}
+			for (SignedIndex k = (SignedIndex)m - 1; k >= 0; k--) //backward substitution
+			{
+				for (Index j = k + 1; j < m; j++) { res[k] -= block[k * m + j] * res[j]; }
+				res[k] /= block[k * m + k];
+			}
+		}
+		break;
+	}
+	case PreconditionerType::ILU0:
+	{
+		for (Index i = 0; i < n; i++) //forward substitution with unit lower triangular matrix
+		{
+			Real value = x[i];
+			for (StorageIndex k = rowStart[i]; k < diagonalPositions[i]; k++) { value -= preconditionerValues[k] * result[columnIndices[k]]; }
+			result[i] = value;
+		}
+		for (SignedIndex i = (SignedIndex)n - 1; i >= 0; i--) //backward substitution
+		{
+			Real value = result[i];
+			for (StorageIndex k = diagonalPositions[i] + 1; k < rowStart[i + 1]; k++) { value -= preconditionerValues[k] * result[columnIndices[k]]; }
+			result[i] = value / preconditionerValues[diagonalPositions[i]];
+		}
+		break;
+	}
+	default: CHECKandTHROWstring("GeneralMatrixEigenSparseIterative::ApplyPreconditioner(): invalid PreconditionerType");
+	}
+}
+
+//! solve A*x = rhs iteratively with preconditioned Krylov method
+void GeneralMatrixEigenSparseIterative::Solve(const Vector& rhs, Vector& solution)
+{
+	CHECKandTHROW(IsMatrixIsFactorized(), "GeneralMatrixEigenSparseIterative::Solve( ...): matrix is not factorized!");
+	Index n = NumberOfRows();
+	CHECKandTHROW(rhs.NumberOfItems() == n, "GeneralMatrixEigenSparseIterative::Solve( ...): size mismatch of rhs");
+
+	solution.SetNumberOfItems(n);
+	Eigen::Map<const Eigen::VectorXd> b(rhs.GetDataPointer(), n);
+	Eigen::Map<Eigen::VectorXd> x(solution.GetDataPointer(), n);
+	x.setZero();
+
+	r.resize(n); r0.resize(n); p.resize(n); v.resize(n); s.resize(n); t.resize(n); z.resize(n);
+
+	Real residual = 0.;
+	Index iterations = 0;
+	switch (iterativeSolverType)
+	{
+	case IterativeSolverType::GMRES: iterations = SolveGMRES(b, x, residual); break;
+	case IterativeSolverType::BiCGSTAB: iterations = SolveBiCGSTAB(b, x, residual); break;
+	case IterativeSolverType::CG: iterations = SolveCG(b, x, residual); break;
+	default: CHECKandTHROWstring("GeneralMatrixEigenSparseIterative::Solve(): invalid IterativeSolverType");
+	}
+
+	solveCount++;
+	iterationsCount += iterations;
+	lastIterations = iterations;
+	lastRelativeResidual = residual;
+	if (!(residual <= relativeTolerance)) { nonConvergedCount++; } //also counts NaN
+}
+
+//! restarted GMRES with right preconditioning (residual of preconditioned system = true residual) and modified Gram-Schmidt orthogonalization
+Index GeneralMatrixEigenSparseIterative::SolveGMRES(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual)
+{
+	Index n = NumberOfRows();
+	Index m = EXUstd::Minimum(gmresRestart, n);
+	Real bNorm = b.norm();
+	residual = 0.;
+	if (bNorm == 0.) { return 0; }
+	Real tolerance = relativeTolerance * bNorm;
+
+	krylovBasis.resize(n, m + 1);
+	hessenberg.resize(m + 1, m);
+	givensCos.resize(m);
+	givensSin.resize(m);
+	residualVector.resize(m + 1);
+
+	Index iterations = 0;
+	while (true)
+	{
+		MultRowCompressed(x, t);
+		r = b - t;
+		Real beta = r.norm();
+		residual = beta / bNorm;
+		if (beta <= tolerance || iterations >= maxIterations) { return iterations; }
+
+		krylovBasis.col(0) = r / beta;
+		residualVector.setZero();
+		residualVector[0] = beta;
+
+		Index k = 0; //dimension of Krylov subspace
+		while (k < m && iterations < maxIterations)
+		{
+			iterations++;
+			ApplyPreconditioner(krylovBasis.col(k), z);
+			MultRowCompressed(z, v);
+			for (Index j = 0; j <= k; j++)
+			{
+				hessenberg(j, k) = v.dot(krylovBasis.col(j));
+				v -= hessenberg(j, k) * krylovBasis.col(j);
+			}
+			Real hNext = v.norm();
+			if (hNext != 0.) { krylovBasis.col(k + 1) = v / hNext; }
+
+			for (Index j = 0; j < k; j++) //apply previous Givens rotations to new column
+			{
+				Real h0 = hessenberg(j, k);
+				Real h1 = hessenberg(j + 1, k);
+				hessenberg(j, k) = givensCos[j] * h0 + givensSin[j] * h1;
+				hessenberg(j + 1, k) = -givensSin[j] * h0 + givensCos[j] * h1;
+			}
+			Real denominator = std::hypot(hessenberg(k, k), hNext);
+			if (denominator == 0.) { break; } //singular (preconditioned) matrix; use solution of current subspace
+
+			givensCos[k] = hessenberg(k, k) / denominator;
+			givensSin[k] = hNext / denominator;
+			hessenberg(k, k) = denominator;
+			hessenberg(k + 1, k) = 0.;
+			residualVector[k + 1] = -givensSin[k] * residualVector[k];
+			residualVector[k] = givensCos[k] * residualVector[k];
+			k++;
+
+			residual = fabs(residualVector[k]) / bNorm;
+			if (fabs(residualVector[k]) <= tolerance || hNext == 0.) { break; }
+		}
+		if (k == 0) { return iterations; } //no progress possible
+
+		//update solution with x += M^{-1} * V * y, where y solves triangular system H*y = g:
+		y = hessenberg.topLeftCorner(k, k).triangularView<Eigen::Upper>().solve(residualVector.head(k));
+		t = krylovBasis.leftCols(k) * y;
+		ApplyPreconditioner(t, z);
+		x += z;
+	}
+}
+
+//! BiCGSTAB with right preconditioning; restarted, if the residual becomes orthogonal to the initial residual
+Index GeneralMatrixEigenSparseIterative::SolveBiCGSTAB(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual)
+{
+	Real bNorm = b.norm();
+	residual = 0.;
+	if (bNorm == 0.) { return 0; }
+	Real tolerance = relativeTolerance * bNorm;
+	Real epsilon = std::numeric_limits<Real>::epsilon();
+
+	MultRowCompressed(x, t);
+	r = b - t;
+	r0 = r;
+	Real r0SquaredNorm = r0.squaredNorm();
+	Real rho = 1., alpha = 1., omega = 1.;
+	y.resize(NumberOfRows());
+	v.setZero();
+	p.setZero();
+
+	Index iterations = 0;
+	while (r.norm() > tolerance && iterations < maxIterations)
+	{
+		Real rhoOld = rho;
+		rho = r0.dot(r);
+		if (fabs(rho) < epsilon * epsilon * r0SquaredNorm) //breakdown: restart with current residual
+		{
+			MultRowCompressed(x, t);
+			r = b - t;
+			r0 = r;
+			rho = r0SquaredNorm = r.squaredNorm();
+			alpha = omega = 1.;
+			v.setZero();
+			p.setZero();
+			rhoOld = 1.;
+		}
+		Real beta = (rho / rhoOld) * (alpha / omega);
+		p = r + beta * (p - omega * v);
+
+		ApplyPreconditioner(p, y);
+		MultRowCompressed(y, v);
+		Real r0v = r0.dot(v);
+		if (r0v == 0.) { break; }
+		alpha = rho / r0v;
+		s = r - alpha * v;
+		iterations++;
+
+		if (s.norm() <= tolerance) //converged after half step
+		{
+			x += alpha * y;
+			r = s;
+			break;
+		}
+
+		ApplyPreconditioner(s, z);
+		MultRowCompressed(z, t);
+		Real tSquaredNorm = t.squaredNorm();
+		omega = (tSquaredNorm > 0.) ? t.dot(s) / tSquaredNorm : 0.;
+		x += alpha * y + omega * z;
+		r = s - omega * t;
+		if (omega == 0.) { break; } //stagnation
+	}
+	residual = r.norm() / bNorm;
+	return iterations;
+}
+
+//! preconditioned conjugate gradient method; only for symmetric definite matrices; negative definite matrices (e.g. static jacobian -K)
+//! are solved as well, if the preconditioner has the same definiteness (Jacobi, ILU0, BlockJacobi), as this equals CG for -A*x = -b
+Index GeneralMatrixEigenSparseIterative::SolveCG(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual)
+{
+	Real bNorm = b.norm();
+	residual = 0.;
+	if (bNorm == 0.) { return 0; }
+	Real tolerance = relativeTolerance * bNorm;
+
+	MultRowCompressed(x, t);
+	r = b - t;
+	ApplyPreconditioner(r, z);
+	p = z;
+	Real rz = r.dot(z);
+
+	Index iterations = 0;
+	while (r.norm() > tolerance && iterations < maxIterations)
+	{
+		MultRowCompressed(p, t);
+		Real pAp = p.dot(t);
+		if (!(pAp * rz > 0.)) { break; } //matrix (or preconditioner) not definite, or matrix and preconditioner have different definiteness
+
+		Real alpha = rz / pAp;
+		x += alpha * p;
+		r -= alpha * t;
+		iterations++;
+
+		ApplyPreconditioner(r, z);
+		Real rzNew = r.dot(z);
+		p = z + (rzNew / rz) * p;
+		rz = rzNew;
+	}
+	residual = r.norm() / bNorm;
+	return iterations;
+}
+
 #endif //eigen sparse solver
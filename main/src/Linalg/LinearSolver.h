@@ -130,10 +130,24 @@ public:
 class GeneralMatrixEXUdense : public GeneralMatrix
 {
 private:
-	ResizableMatrix matrix; //!< internal dense matrix storage:
+	ResizableMatrix matrix; //!< internal dense matrix storage; after Factorize(), it contains the LU (or Cholesky, LDLT) factors
+	ArrayIndex pivotIndices; //!< row interchanges of LU factorization: in step i, row i has been swapped with row pivotIndices[i]
+	bool choleskyFactorization; //!< true, if symmetric positive definite matrix has been factorized as L*L^T (only lower triangle is used)
+	bool ldltFactorization; //!< true, if symmetric indefinite matrix has been factorized as L*D*L^T (unit lower triangle L, D stored on diagonal)
+	Index numberOfThreads; //!< number of threads used in LU factorization, if the TaskManager is not available
+
+	//! in-place Cholesky factorization of lower triangle; returns 0 if success, otherwise (row+1) of first non-positive pivot; upper triangle is not modified
+	Index FactorizeCholesky();
+	//! in-place LDLT factorization of lower triangle without pivoting; returns 0 if success, otherwise (row+1) of first zero or unstable pivot; upper triangle is not modified
+	Index FactorizeLDLT();
+	//! in-place blocked LU factorization with partial (row) pivoting; returns 0 if success, otherwise (column+1) of first zero pivot
+	Index FactorizeLU();
 
 public:
-	GeneralMatrixEXUdense() { SetMatrixIsFactorized(false); }
+	GeneralMatrixEXUdense() { SetMatrixIsFactorized(false); choleskyFactorization = false; ldltFactorization = false; numberOfThreads = 1; }
+
+	//! set number of threads for factorization; only used if the TaskManager is not available (otherwise, threads of the TaskManager are used)
+	void SetNumberOfThreads(Index numberOfThreadsInit) { numberOfThreads = EXUstd::Maximum((Index)1, numberOfThreadsInit); }
 
 	//! information on storage type
 	virtual LinearSolverType GetSystemMatrixType() const { return LinearSolverType::EXUdense; };
@@ -218,7 +232,7 @@ public:
 		SetMatrixIsFactorized(false);
 	}
 
-	//! factorize matrix (invert, SparseLU, etc.); 0=success
+	//! factorize matrix (dense: Cholesky for symmetric positive definite matrices, LDLT for other symmetric matrices, otherwise LU with partial pivoting; sparse: SparseLU); 0=success
 	virtual Index Factorize();
 
 	//! multiply matrix with vector: solution = A*x
@@ -243,11 +257,8 @@ public:
 	}
 
 	//!after factorization of matrix (=A), solve provides a solution vector (=x) for A*x = rhs ==> soluation = A^{-1}*rhs
-	virtual void Solve(const Vector& rhs, Vector& solution)
-	{
-		if (!IsMatrixIsFactorized()) { SysError("GeneralMatrixEXUdense::Solve(...): matrix is not factorized!"); }
-		EXUmath::MultMatrixVector(matrix, rhs, solution);
-	}
+	//!uses forward and backward substitution with the triangular factors
+	virtual void Solve(const Vector& rhs, Vector& solution);
 
 	//! return a dense matrix from any other matrix: requires a copy - SLOW!
 	virtual ResizableMatrix GetEXUdenseMatrix() const
@@ -280,6 +291,20 @@ private:
 	EigenSparseMatrix matrix;	 //this is the sparse matrix built from triplets
 	EigenTripletVector triplets; //this contains a redundant set of matrix entries
 	Eigen::SparseLU<Eigen::SparseMatrix<Real>, Eigen::COLAMDOrdering<int> >   solver; //this is the solver for the matrix
+
+	//symbolic analysis (pattern) cache:
+	bool reuseAnalyzedPattern;							//!< if true, solver.analyzePattern(...) is only called if the sparsity pattern of matrix changed
+	bool patternIsAnalyzed;								//!< true, if analyzedOuterIndices/analyzedInnerIndices represent the pattern used in the last solver.analyzePattern(...)
+	std::vector<StorageIndex> analyzedOuterIndices;		//!< copy of compressed outer indices (column starts) of last analyzed matrix; used to detect changes of the sparsity pattern
+	std::vector<StorageIndex> analyzedInnerIndices;		//!< copy of compressed inner indices (row indices) of last analyzed matrix
+	Index patternAnalysisCount;							//!< number of symbolic analyses (=pattern cache misses)
+	Index patternReuseCount;							//!< number of factorizations reusing the analyzed pattern (=pattern cache hits)
+
+	//fixed-pattern assembly (values are added in place into compressed matrix):
+	bool fixedPatternAssembly;							//!< if true, SetAllZero() keeps the sparsity pattern of a finalized matrix and the Add...() functions add values directly into the value array of matrix
+	bool patternAssemblyActive;							//!< true, if matrix currently is filled in place (fixed-pattern assembly); in this case, triplets only contain entries which are not contained in the pattern
+	std::vector<StorageIndex> scatterMap;				//!< positions in the value array of matrix for every entry added since SetAllZero(), in the order of Add...() calls (follows the LTG lists); -1 if entry is not in pattern
+	size_t scatterMapPosition;							//!< current position in scatterMap during fixed-pattern assembly
 #endif
 
 public:
@@ -289,6 +314,15 @@ public:
 		SetMatrixBuiltFromTriplets(false);
 		numberOfRows = 0;
 		numberOfColumns = 0;
+
+		reuseAnalyzedPattern = false;
+		patternIsAnalyzed = false;
+		patternAnalysisCount = 0;
+		patternReuseCount = 0;
+
+		fixedPatternAssembly = false;
+		patternAssemblyActive = false;
+		scatterMapPosition = 0;
 	}
 
 	//! information on storage type
@@ -299,21 +333,62 @@ public:
 	virtual bool IsMatrixBuiltFromTriplets() const { return matrixBuiltFromTriplets; }
 
 	//! get (read) matrix as dense exudyn Matrix
+	//! in fixed-pattern assembly, the triplets only contain entries which are not yet contained in the sparsity pattern
 	const EigenTripletVector& GetEigenTriplets() const { return triplets; }
 
 	//! get (write) matrix as dense exudyn Matrix; also in this case, solvability may be lost; sparse matrix is invalid
 	//! however, we never know what else is done with the matrix afterwards ...
+	//! in fixed-pattern assembly, added triplets are summed into the pattern in FinalizeMatrix()
 	EigenTripletVector& GetEigenTriplets() { 
 		SetMatrixIsFactorized(false); 
 		SetMatrixBuiltFromTriplets(false);  
 		return triplets; 
 	}
 
+	//! if flag=true, the symbolic analysis (ordering, analyzePattern) is only redone in Factorize() if the sparsity pattern changed;
+	//! the pattern cache and the hit/miss counters are reset
+	void SetReuseAnalyzedPattern(bool flag) 
+	{ 
+		reuseAnalyzedPattern = flag; 
+		ResetPatternCache();
+	}
+	bool GetReuseAnalyzedPattern() const { return reuseAnalyzedPattern; }
+
+	//! invalidate the analyzed pattern, such that next Factorize() performs symbolic analysis; resets counters
+	void ResetPatternCache()
+	{
+		patternIsAnalyzed = false;
+		analyzedOuterIndices.clear();
+		analyzedInnerIndices.clear();
+		patternAnalysisCount = 0;
+		patternReuseCount = 0;
+	}
+
+	//! number of symbolic analyses (pattern cache misses) since last ResetPatternCache()
+	Index GetPatternAnalysisCount() const { return patternAnalysisCount; }
+	//! number of factorizations reusing the analyzed pattern (pattern cache hits) since last ResetPatternCache()
+	Index GetPatternReuseCount() const { return patternReuseCount; }
+
+	//! if flag=true, the sparsity pattern is kept after FinalizeMatrix(); after SetAllZero(), values are then added directly into the compressed matrix
+	//! using a scatter map (positions in value array), which avoids building and sorting triplets in every update;
+	//! entries that are not in the pattern are collected as triplets and the pattern is extended in FinalizeMatrix()
+	void SetFixedPatternAssembly(bool flag)
+	{
+		if (!flag) { DeactivatePatternAssembly(); }
+		fixedPatternAssembly = flag;
+		scatterMap.clear();
+	}
+	bool GetFixedPatternAssembly() const { return fixedPatternAssembly; }
+
+	//! true, if values are currently added in place into the compressed matrix (fixed-pattern assembly)
+	bool IsPatternAssemblyActive() const { return patternAssemblyActive; }
+
 	//helper functions for matrix:
 	virtual void SetNumberOfRowsAndColumns(Index numberOfRowsInit, Index numberOfColumnsInit)
 	{
 		SetMatrixIsFactorized(false);
 		SetMatrixBuiltFromTriplets(false);
+		if (numberOfRowsInit != numberOfRows || numberOfColumnsInit != numberOfColumns) { DeactivatePatternAssembly(); }
 
 		numberOfRows = numberOfRowsInit;
 		numberOfColumns = numberOfColumnsInit;
@@ -358,6 +433,7 @@ public:
 	virtual void FinalizeMatrix();
 
 	//! factorize matrix (invert, SparseLU, etc.); 0=success
+	//! if reuseAnalyzedPattern=true, symbolic analysis is skipped as long as the sparsity pattern is unchanged
 	virtual Index Factorize();
 
 	//! multiply matrix with vector: solution = A*x
@@ -383,6 +459,168 @@ public:
 	{
 		os << GetEXUdenseMatrix();
 	}
+
+	//! read access to Eigen sparse matrix (built in FinalizeMatrix()); used by derived matrix types with other solvers and by eigenvalue solvers
+	const EigenSparseMatrix& GetEigenSparseMatrix() const { return matrix; }
+
+private:
+	//! switch from fixed-pattern assembly back to triplet mode; values already added to matrix are moved to triplets
+	void DeactivatePatternAssembly();
+
+	//! return position of entry (row,column) in value array of compressed matrix or -1, if entry is not in pattern
+	StorageIndex FindPatternEntry(StorageIndex row, StorageIndex column) const;
+
+	//! add value at (row,column) in fixed-pattern assembly; the position is taken from the scatter map, if it is still valid;
+	//! otherwise it is searched and the scatter map is updated; entries not contained in the pattern are added to triplets
+	void AddPatternEntry(StorageIndex row, StorageIndex column, Real value)
+	{
+		StorageIndex pos = -1;
+		if (scatterMapPosition < scatterMap.size())
+		{
+			pos = scatterMap[scatterMapPosition];
+			if (pos < 0) 
+			{
+				if (value != 0.) { pos = FindPatternEntry(row, column); scatterMap[scatterMapPosition] = pos; }
+			}
+			else if (pos < matrix.outerIndexPtr()[column] || pos >= matrix.outerIndexPtr()[column + 1] || matrix.innerIndexPtr()[pos] != row)
+			{
+				pos = FindPatternEntry(row, column); //sequence of entries changed
+				scatterMap[scatterMapPosition] = pos;
+			}
+		}
+		else
+		{
+			pos = FindPatternEntry(row, column);
+			scatterMap.push_back(pos);
+		}
+		scatterMapPosition++;
+
+		if (pos >= 0) { matrix.valuePtr()[pos] += value; }
+		else if (value != 0.) { triplets.push_back(EigenTriplet(row, column, value)); }
+	}
+
+	//! add matrix values of fixed-pattern assembly (without triplets): solution += A*x (transposed=false) or solution += A^T*x (transposed=true)
+	void MultPatternValuesVectorAdd(const Vector& x, Vector& solution, bool transposed) const;
+};
+
+//! sparse matrix, which is solved with preconditioned iterative (Krylov) solvers (GMRES, BiCGSTAB, CG) instead of SparseLU;
+//! the matrix is assembled exactly as GeneralMatrixEigenSparse (triplets or fixed-pattern assembly), but there is no fill-in as in direct factorization
+//! Factorize() copies the matrix into a row-compressed structure and computes the preconditioner (Jacobi, block-Jacobi, ILU(0));
+//! thus, the preconditioner is only recomputed if the solver updates the Jacobian and Solve() is reused for modified Newton iterations
+class GeneralMatrixEigenSparseIterative : public GeneralMatrixEigenSparse
+{
+private:
+	IterativeSolverType iterativeSolverType;	//!< Krylov method used in Solve()
+	PreconditionerType preconditionerType;		//!< preconditioner computed in Factorize()
+	Real relativeTolerance;						//!< iteration stops, if residual norm < relativeTolerance * norm(rhs)
+	Index maxIterations;						//!< maximum number of iterations (matrix-vector products) in Solve()
+	Index gmresRestart;							//!< dimension of Krylov subspace for restarted GMRES
+	Index blockSize;							//!< size of diagonal blocks for PreconditionerType::BlockJacobi
+
+	//row-compressed (CSR) copy of factorized matrix; the diagonal is always contained in the pattern (needed for ILU(0)):
+	std::vector<StorageIndex> rowStart;			//!< start of row i in columnIndices/values; size = rows+1
+	std::vector<StorageIndex> columnIndices;	//!< column indices, sorted in every row
+	std::vector<Real> values;					//!< matrix values
+	std::vector<StorageIndex> diagonalPositions;//!< position of diagonal entry of row i in values
+
+	//preconditioner:
+	std::vector<Real> preconditionerValues;		//!< Jacobi: inverse diagonal; ILU(0): LU factors in pattern of values; BlockJacobi: LU factors of dense diagonal blocks (row-major)
+	std::vector<Index> blockPivots;				//!< BlockJacobi: pivot rows of LU factorization of blocks (with respect to block)
+
+	//workspace of Krylov solvers (avoids memory allocation in every Solve()):
+	Eigen::VectorXd r, r0, p, v, s, t, y, z;
+	Eigen::MatrixXd krylovBasis;				//!< GMRES: orthonormal basis V (columns), size rows x (restart+1)
+	Eigen::MatrixXd hessenberg;					//!< GMRES: upper Hessenberg matrix, reduced to triangular form by Givens rotations
+	Eigen::VectorXd givensCos, givensSin, residualVector;
+
+	//statistics:
+	Index preconditionerCount;					//!< number of computed preconditioners (=number of Factorize())
+	Index solveCount;							//!< number of calls to Solve()
+	Index iterationsCount;						//!< total number of iterations in Solve()
+	Index nonConvergedCount;					//!< number of Solve(), which did not reach the tolerance within maxIterations
+	Index lastIterations;						//!< iterations of last Solve()
+	Real lastRelativeResidual;					//!< relative residual of last Solve()
+
+public:
+	GeneralMatrixEigenSparseIterative()
+	{
+		iterativeSolverType = IterativeSolverType::GMRES;
+		preconditionerType = PreconditionerType::ILU0;
+		relativeTolerance = 1e-10;
+		maxIterations = 1000;
+		gmresRestart = 50;
+		blockSize = 6;
+		ResetIterationStatistics();
+	}
+
+	//! storage type is identical to GeneralMatrixEigenSparse (matrices can be added and casted); the solver type is defined by SolverLocalData
+	virtual LinearSolverType GetSystemMatrixType() const { return LinearSolverType::EigenSparse; };
+
+	//! set parameters of iterative solver; they are used in next Factorize() and Solve()
+	void SetIterativeSolverParameters(IterativeSolverType solverType, PreconditionerType preconditioner, Real relativeToleranceInit,
+		Index maxIterationsInit, Index gmresRestartInit, Index blockSizeInit)
+	{
+		CHECKandTHROW(relativeToleranceInit > 0, "GeneralMatrixEigenSparseIterative: relative tolerance must be > 0");
+		CHECKandTHROW(maxIterationsInit > 0 && gmresRestartInit > 0 && blockSizeInit > 0, 
+			"GeneralMatrixEigenSparseIterative: maximum iterations, GMRES restart and block size must be > 0");
+		iterativeSolverType = solverType;
+		preconditionerType = preconditioner;
+		relativeTolerance = relativeToleranceInit;
+		maxIterations = maxIterationsInit;
+		gmresRestart = gmresRestartInit;
+		blockSize = blockSizeInit;
+	}
+
+	//! reset counters of preconditioners, solves and iterations
+	void ResetIterationStatistics()
+	{
+		preconditionerCount = 0;
+		solveCount = 0;
+		iterationsCount = 0;
+		nonConvergedCount = 0;
+		lastIterations = 0;
+		lastRelativeResidual = 0;
+	}
+
+	//! number of computed preconditioners since last ResetIterationStatistics()
+	Index GetPreconditionerCount() const { return preconditionerCount; }
+	//! number of solves since last ResetIterationStatistics()
+	Index GetSolveCount() const { return solveCount; }
+	//! total number of iterations since last ResetIterationStatistics()
+	Index GetIterationsCount() const { return iterationsCount; }
+	//! number of solves which did not converge since last ResetIterationStatistics()
+	Index GetNonConvergedCount() const { return nonConvergedCount; }
+	//! iterations of last Solve()
+	Index GetLastIterations() const { return lastIterations; }
+	//! relative residual norm |rhs - A*x|/|rhs| of last Solve()
+	Real GetLastRelativeResidual() const { return lastRelativeResidual; }
+
+	//! reset matrices and free memory
+	virtual void Reset();
+
+	//! copy matrix into row-compressed storage and compute preconditioner; zero pivots are regularized;
+	//! 0=success, otherwise (row index+1) of first row containing non-finite values
+	virtual Index Factorize();
+
+	//! solve A*x = rhs iteratively with preconditioned Krylov method; initial guess is zero; 
+	//! if the tolerance is not reached, the last iterate is returned and the non-converged counter is increased (Newton then decides on convergence)
+	virtual void Solve(const Vector& rhs, Vector& solution);
+
+private:
+	//! result = A*x with row-compressed matrix
+	void MultRowCompressed(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::Ref<Eigen::VectorXd> result) const;
+	//! result = M^{-1}*x with preconditioner M
+	void ApplyPreconditioner(const Eigen::Ref<const Eigen::VectorXd>& x, Eigen::Ref<Eigen::VectorXd> result) const;
+
+	//! compute incomplete LU factorization without fill-in; zero pivots are replaced to keep preconditioner regular
+	void ComputeILU0();
+	//! compute LU factorization with partial pivoting of dense diagonal blocks
+	void ComputeBlockJacobi();
+
+	//! Krylov methods; solution x must be initialized (zero); return number of iterations; residual is relative residual norm
+	Index SolveGMRES(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual);
+	Index SolveBiCGSTAB(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual);
+	Index SolveCG(const Eigen::Ref<const Eigen::VectorXd>& b, Eigen::Ref<Eigen::VectorXd> x, Real& residual);
 };
 
 //std::ostream& operator<<(std::ostream& os, const GeneralMatrix& matrix)
@@ -411,6 +649,10 @@ public:
 
 };
 
+class GeneralMatrixEigenSparseIterative : public GeneralMatrixEigenSparse
+{
+};
+
 #endif
 
 #endif //include once
\ No newline at end of file
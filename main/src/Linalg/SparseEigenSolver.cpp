@@ -0,0 +1,350 @@
+/** ***********************************************************************************************
+* @brief		implementation of sparse eigenvalue solver (shift-invert Krylov-Schur method)
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @date			2026-10-18 (last modified)
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+*
+************************************************************************************************ */
+#ifdef _MSC_VER
+#pragma warning(disable : 4996) //warning deprecated of Eigen2020
+#endif
+
+#include "Linalg/SparseEigenSolver.h"
+#include <algorithm> //for std::stable_sort
+#include <cmath> //for std::isfinite
+#include <random> //for std::mt19937 (deterministic start vectors)
+
+#ifdef USE_EIGEN_SPARSE_SOLVER
+
+const Real sparseEigenShiftPerturbation = 1e-4;		//!< relative perturbation of shift, if shifted matrix is singular (e.g., rigid body modes and shift=0)
+const Real sparseEigenMaxCondition = 1e13;			//!< estimated condition number of shifted matrix, above which it is treated as singular
+const Real sparseEigenBreakdownTolerance = 1e-12;	//!< relative norm of new Krylov vector, below which an invariant subspace is detected
+
+bool SparseEigenSolver::FactorizeShiftedMatrix(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix* gyroscopicMatrix,
+	Real gyroscopicFactor, const EigenSparseMatrix& massMatrix)
+{
+	usedShift = shift;
+	for (Index trial = 0; trial < 2; trial++)
+	{
+		EigenSparseMatrix shiftedMatrix;
+		if (gyroscopicMatrix) { shiftedMatrix = stiffnessMatrix + (usedShift*gyroscopicFactor) * (*gyroscopicMatrix) + (usedShift*usedShift) * massMatrix; }
+		else { shiftedMatrix = stiffnessMatrix - usedShift * massMatrix; }
+		shiftedMatrix.makeCompressed();
+
+		shiftedSolver.analyzePattern(shiftedMatrix);
+		shiftedSolver.factorize(shiftedMatrix);
+		if (shiftedSolver.info() == Eigen::Success)
+		{
+			//numerically singular matrices (e.g., rigid body modes) are not detected by SparseLU: estimate condition number
+			//by one step of inverse iteration with a pseudo random vector, using 1-norms
+			Index n = (Index)shiftedMatrix.rows();
+			DenseVector testVector(n);
+			for (Index i = 0; i < n; i++) { testVector[i] = 1. + 0.5*sin((Real)(i + 1)); }
+			DenseVector testSolution = shiftedSolver.solve(testVector);
+
+			Real matrixNorm = 0.;
+			for (Index j = 0; j < n; j++) { matrixNorm = EXUstd::Maximum(matrixNorm, shiftedMatrix.col(j).cwiseAbs().sum()); }
+			Real conditionEstimate = matrixNorm * testSolution.lpNorm<1>() / testVector.lpNorm<1>();
+			if (conditionEstimate < sparseEigenMaxCondition) { return true; } //also false for NaN
+		}
+
+		//singular shifted matrix: move shift slightly to negative values (eigenvalues of mechanical systems are non-negative or imaginary);
+		//perturbation is relative to typical eigenvalue, which is omega^2 in symmetric and omega in gyroscopic case
+		Real traceK = stiffnessMatrix.diagonal().cwiseAbs().sum();
+		Real traceM = massMatrix.diagonal().cwiseAbs().sum();
+		Real scale = (traceK > 0. && traceM > 0.) ? traceK / traceM : 1.;
+		if (gyroscopicMatrix) { scale = sqrt(scale); }
+		usedShift -= sparseEigenShiftPerturbation * EXUstd::Maximum(fabs(usedShift), scale);
+	}
+	return false;
+}
+
+Index SparseEigenSolver::KrylovSchur(Index n, const std::function<void(const DenseVector&, DenseVector&)>& applyOperator,
+	const EigenSparseMatrix* innerProductMatrix, ComplexVector& ritzValues, ComplexMatrix& ritzCoefficients)
+{
+	bool selfAdjoint = (innerProductMatrix != nullptr);
+	Index nev = numberOfEigenvalues;
+	Index m = maxKrylovDimension;
+	if (m == 0) { m = EXUstd::Maximum(2 * nev + 1, nev + 20); }
+	m = EXUstd::Minimum(EXUstd::Maximum(m, nev + 2), n); //at least 2 additional vectors for restart
+
+	ritzValues.resize(0);
+	ritzCoefficients.resize(0, 0);
+	krylovBasis.setZero(n, m + 1);
+	krylovMatrix.setZero(m + 1, m);
+
+	DenseVector w(n), x(n), h, innerProductTemp;
+
+	//norm in inner product (mass matrix for symmetric problem)
+	auto InnerNorm = [&](const DenseVector& v)
+	{
+		if (selfAdjoint) { return sqrt(EXUstd::Maximum(v.dot((*innerProductMatrix) * v), (Real)0.)); }
+		return v.norm();
+	};
+	//orthogonalize v against first numberOfColumns vectors of basis (classical Gram-Schmidt, applied twice); returns norm of v
+	auto Orthogonalize = [&](DenseVector& v, Index numberOfColumns, DenseVector& coefficients)
+	{
+		coefficients.setZero(numberOfColumns);
+		for (Index pass = 0; pass < 2; pass++)
+		{
+			DenseVector c;
+			if (selfAdjoint)
+			{
+				innerProductTemp = (*innerProductMatrix) * v;
+				c = krylovBasis.leftCols(numberOfColumns).transpose() * innerProductTemp;
+			}
+			else { c = krylovBasis.leftCols(numberOfColumns).transpose() * v; }
+			v.noalias() -= krylovBasis.leftCols(numberOfColumns) * c;
+			coefficients += c;
+		}
+		return InnerNorm(v);
+	};
+	//deterministic pseudo random vector; std::mt19937 gives same sequence on all platforms
+	std::mt19937 randomGenerator(1);
+	auto RandomVector = [&](DenseVector& v)
+	{
+		for (Index i = 0; i < n; i++) { v[i] = (Real)randomGenerator() / (Real)randomGenerator.max() - 0.5; }
+	};
+
+	//start vector is in range of operator, which removes components of infinite eigenvalues (singular mass matrix)
+	RandomVector(x);
+	applyOperator(x, w);
+	numberOfOperatorApplications++;
+	Real startNorm = InnerNorm(w);
+	if (!(startNorm > 0.) || !std::isfinite(startNorm)) { return factorizationFailed; }
+	krylovBasis.col(0) = w / startNorm;
+
+	ComplexVector theta;
+	ComplexMatrix ritzVectorsH; //eigenvectors of projected matrix
+	std::vector<Index> order(m);
+	std::vector<Real> residuals(m);
+	Index p = 0; //number of vectors kept at restart
+	Index convergedCount = 0;
+	while (true)
+	{
+		//extend Krylov decomposition: Op*V(:,0:m-1) = V(:,0:m)*H
+		for (Index j = p; j < m; j++)
+		{
+			applyOperator(krylovBasis.col(j), w);
+			numberOfOperatorApplications++;
+			Real operatorNorm = InnerNorm(w);
+			if (!std::isfinite(operatorNorm)) { return factorizationFailed; }
+
+			Real beta = Orthogonalize(w, j + 1, h);
+			krylovMatrix.col(j).head(j + 1) = h;
+			if (beta > sparseEigenBreakdownTolerance * operatorNorm)
+			{
+				krylovMatrix(j + 1, j) = beta;
+				krylovBasis.col(j + 1) = w / beta;
+			}
+			else //invariant subspace: continue with random vector orthogonal to current basis
+			{
+				krylovMatrix(j + 1, j) = 0.;
+				krylovBasis.col(j + 1).setZero();
+				if (j + 1 < m)
+				{
+					RandomVector(x);
+					Real randomNorm = Orthogonalize(x, j + 1, h);
+					if (randomNorm > 0.) { krylovBasis.col(j + 1) = x / randomNorm; }
+				}
+			}
+		}
+
+		//Ritz values and vectors of projected matrix
+		DenseMatrix projectedMatrix = krylovMatrix.topRows(m);
+		if (selfAdjoint)
+		{
+			projectedMatrix = 0.5 * (projectedMatrix + projectedMatrix.transpose()).eval();
+			Eigen::SelfAdjointEigenSolver<DenseMatrix> eigenSolver(projectedMatrix);
+			if (eigenSolver.info() != Eigen::Success) { return notConverged; }
+			theta = eigenSolver.eigenvalues().cast<std::complex<Real> >();
+			ritzVectorsH = eigenSolver.eigenvectors().cast<std::complex<Real> >();
+		}
+		else
+		{
+			Eigen::EigenSolver<DenseMatrix> eigenSolver(projectedMatrix);
+			if (eigenSolver.info() != Eigen::Success) { return notConverged; }
+			theta = eigenSolver.eigenvalues();
+			ritzVectorsH = eigenSolver.eigenvectors();
+		}
+
+		//wanted Ritz values have largest magnitude; complex conjugate pairs are adjacent (positive imaginary part first)
+		for (Index i = 0; i < m; i++) { order[i] = i; }
+		std::stable_sort(order.begin(), order.end(), [&theta](Index a, Index b)
+		{
+			if (std::abs(theta[a]) != std::abs(theta[b])) { return std::abs(theta[a]) > std::abs(theta[b]); }
+			if (theta[a].real() != theta[b].real()) { return theta[a].real() > theta[b].real(); }
+			return theta[a].imag() > theta[b].imag();
+		});
+
+		convergedCount = 0;
+		for (Index i = 0; i < m; i++)
+		{
+			residuals[i] = std::abs((krylovMatrix.row(m).cast<std::complex<Real> >() * ritzVectorsH.col(i))(0));
+		}
+		for (Index i = 0; i < nev; i++)
+		{
+			if (residuals[order[i]] <= tolerance * std::abs(theta[order[i]])) { convergedCount++; }
+		}
+
+		if (convergedCount == nev || numberOfRestarts >= maxRestarts) { break; }
+
+		//restart: keep invariant subspace of wanted Ritz vectors (Krylov-Schur)
+		numberOfRestarts++;
+		Index keep = nev + (m - nev) / 2;
+		if (!selfAdjoint && theta[order[keep - 1]].imag() > 0.) //keep complex conjugate pairs together
+		{
+			if (keep + 1 < m) { keep++; }
+			else { keep--; }
+		}
+
+		DenseMatrix basisTransformation(m, keep);
+		if (selfAdjoint)
+		{
+			for (Index i = 0; i < keep; i++) { basisTransformation.col(i) = ritzVectorsH.col(order[i]).real(); }
+		}
+		else
+		{
+			//real and imaginary parts of Ritz vectors span same real invariant subspace
+			Index column = 0;
+			for (Index i = 0; i < keep; i++)
+			{
+				const std::complex<Real>& value = theta[order[i]];
+				if (value.imag() < 0.) { continue; } //conjugate vector already added
+				basisTransformation.col(column++) = ritzVectorsH.col(order[i]).real();
+				if (value.imag() > 0.) { basisTransformation.col(column++) = ritzVectorsH.col(order[i]).imag(); }
+			}
+			Eigen::HouseholderQR<DenseMatrix> qr(basisTransformation);
+			basisTransformation = qr.householderQ() * DenseMatrix::Identity(m, keep);
+		}
+
+		DenseMatrix reducedMatrix = basisTransformation.transpose() * projectedMatrix * basisTransformation;
+		DenseVector residualCoupling = (krylovMatrix.row(m) * basisTransformation).transpose();
+
+		krylovBasis.leftCols(keep) = (krylovBasis.leftCols(m) * basisTransformation).eval();
+		krylovBasis.col(keep) = krylovBasis.col(m);
+		krylovMatrix.setZero();
+		krylovMatrix.topLeftCorner(keep, keep) = reducedMatrix;
+		krylovMatrix.row(keep).head(keep) = residualCoupling.transpose();
+		p = keep;
+	}
+
+	numberOfConvergedEigenvalues = convergedCount;
+	ritzValues.resize(nev);
+	ritzCoefficients.resize(m, nev);
+	for (Index i = 0; i < nev; i++)
+	{
+		ritzValues[i] = theta[order[i]];
+		ritzCoefficients.col(i) = ritzVectorsH.col(order[i]);
+	}
+	return (convergedCount == nev) ? success : notConverged;
+}
+
+Index SparseEigenSolver::ComputeSymmetric(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix& massMatrix)
+{
+	Index n = (Index)stiffnessMatrix.rows();
+	CHECKandTHROW((Index)stiffnessMatrix.cols() == n && (Index)massMatrix.rows() == n && (Index)massMatrix.cols() == n,
+		"SparseEigenSolver::ComputeSymmetric: stiffness and mass matrix must be square and of same size");
+	CHECKandTHROW(numberOfEigenvalues >= 1 && numberOfEigenvalues <= n,
+		"SparseEigenSolver::ComputeSymmetric: numberOfEigenvalues must be at least 1 and not larger than size of matrices");
+
+	numberOfConvergedEigenvalues = 0;
+	numberOfOperatorApplications = 0;
+	numberOfRestarts = 0;
+	eigenValues.resize(0);
+	eigenVectors.resize(0, 0);
+
+	//only symmetric part is used (as in dense symmetric eigenvalue solvers); numerical jacobians are not exactly symmetric
+	EigenSparseMatrix K = 0.5 * (stiffnessMatrix + EigenSparseMatrix(stiffnessMatrix.transpose()));
+	EigenSparseMatrix M = 0.5 * (massMatrix + EigenSparseMatrix(massMatrix.transpose()));
+	if (!FactorizeShiftedMatrix(K, nullptr, 0., M)) { return factorizationFailed; }
+
+	//operator (K-sigma*M)^-1*M is self-adjoint in M-inner product
+	DenseVector massTimesVector;
+	auto ApplyOperator = [&](const DenseVector& v, DenseVector& result)
+	{
+		massTimesVector = M * v;
+		result = shiftedSolver.solve(massTimesVector);
+	};
+
+	ComplexVector theta;
+	ComplexMatrix coefficients;
+	Index returnValue = KrylovSchur(n, ApplyOperator, &M, theta, coefficients);
+	if (theta.size() == 0) { return returnValue; }
+
+	//lambda = sigma + 1/theta, sorted ascending
+	Index nev = (Index)theta.size();
+	std::vector<Index> order(nev);
+	DenseVector lambda(nev);
+	for (Index i = 0; i < nev; i++)
+	{
+		order[i] = i;
+		lambda[i] = usedShift + 1. / theta[i].real();
+	}
+	std::stable_sort(order.begin(), order.end(), [&lambda](Index a, Index b) { return lambda[a] < lambda[b]; });
+
+	eigenValues.resize(nev);
+	for (Index i = 0; i < nev; i++) { eigenValues[i] = lambda[order[i]]; }
+
+	if (computeEigenVectors)
+	{
+		//basis is M-orthonormal ==> eigenvectors are mass-normalized
+		DenseMatrix ritzVectors = krylovBasis.leftCols(coefficients.rows()) * coefficients.real();
+		eigenVectors.resize(n, nev);
+		for (Index i = 0; i < nev; i++) { eigenVectors.col(i) = ritzVectors.col(order[i]); }
+	}
+	krylovBasis.resize(0, 0); //free memory
+	return returnValue;
+}
+
+Index SparseEigenSolver::ComputeGyroscopic(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix& gyroscopicMatrix,
+	const EigenSparseMatrix& massMatrix, Real gyroscopicFactor)
+{
+	Index n = (Index)stiffnessMatrix.rows();
+	CHECKandTHROW((Index)stiffnessMatrix.cols() == n && (Index)massMatrix.rows() == n && (Index)massMatrix.cols() == n &&
+		(Index)gyroscopicMatrix.rows() == n && (Index)gyroscopicMatrix.cols() == n,
+		"SparseEigenSolver::ComputeGyroscopic: stiffness, gyroscopic and mass matrix must be square and of same size");
+	CHECKandTHROW(numberOfEigenvalues >= 1 && numberOfEigenvalues <= 2 * n,
+		"SparseEigenSolver::ComputeGyroscopic: numberOfEigenvalues must be at least 1 and not larger than twice the size of matrices");
+
+	numberOfConvergedEigenvalues = 0;
+	numberOfOperatorApplications = 0;
+	numberOfRestarts = 0;
+	complexEigenValues.resize(0);
+	complexEigenVectors.resize(0, 0);
+
+	if (!FactorizeShiftedMatrix(stiffnessMatrix, &gyroscopicMatrix, gyroscopicFactor, massMatrix)) { return factorizationFailed; }
+
+	//first order system for state x=[q, q_t]: x_t = A*x; inverse of (A-sigma*I) applied to v=[v1,v2]:
+	//  (K + sigma*gyroscopicFactor*G + sigma^2*M)*x1 = -M*v2 - (gyroscopicFactor*G + sigma*M)*v1,  x2 = v1 + sigma*x1
+	DenseVector rhs;
+	auto ApplyOperator = [&](const DenseVector& v, DenseVector& result)
+	{
+		rhs = -(massMatrix * v.tail(n)) - gyroscopicFactor * (gyroscopicMatrix * v.head(n)) - usedShift * (massMatrix * v.head(n));
+		result.resize(2 * n);
+		result.head(n) = shiftedSolver.solve(rhs);
+		result.tail(n) = v.head(n) + usedShift * result.head(n);
+	};
+
+	ComplexVector theta;
+	ComplexMatrix coefficients;
+	Index returnValue = KrylovSchur(2 * n, ApplyOperator, nullptr, theta, coefficients);
+	if (theta.size() == 0) { return returnValue; }
+
+	//theta is sorted by magnitude ==> lambda sorted by distance to shift
+	Index nev = (Index)theta.size();
+	complexEigenValues.resize(nev);
+	for (Index i = 0; i < nev; i++) { complexEigenValues[i] = usedShift + 1. / theta[i]; }
+
+	if (computeEigenVectors)
+	{
+		complexEigenVectors = krylovBasis.topLeftCorner(n, coefficients.rows()).cast<std::complex<Real> >() * coefficients;
+		complexEigenVectors.colwise().normalize();
+	}
+	krylovBasis.resize(0, 0); //free memory
+	return returnValue;
+}
+
+#endif //USE_EIGEN_SPARSE_SOLVER
@@ -0,0 +1,119 @@
+/** ***********************************************************************************************
+* @brief		Sparse eigenvalue solver for mechanical systems (mass, stiffness and gyroscopic matrices);
+*				computes a small number of eigenvalues closest to a shift with a shift-invert Krylov-Schur method
+*				(restarted Lanczos for symmetric problems, restarted Arnoldi for gyroscopic problems)
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @date			2026-10-18 (last modified)
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+*
+************************************************************************************************ */
+#ifndef SPARSEEIGENSOLVER__H
+#define SPARSEEIGENSOLVER__H
+
+#include "Linalg/LinearSolver.h"
+#include <complex>
+#include <functional>
+
+#ifdef USE_EIGEN_SPARSE_SOLVER
+//! computes eigenvalues lambda closest to shift sigma (usually the lowest eigenvalues) for
+//!   symmetric problem:  K*phi = lambda*M*phi  (lambda = omega^2)
+//!   gyroscopic problem: (lambda^2*M + lambda*gyroscopicFactor*G + K)*phi = 0  (lambda = i*omega for undamped systems)
+//! the shifted matrix is factorized once by SparseLU; the Krylov subspace is built with the operator (K-sigma*M)^-1*M
+//! (M-orthogonal Lanczos basis) or with the inverse of the shifted first order system (Arnoldi basis) and restarted (Krylov-Schur)
+//! until numberOfEigenvalues Ritz pairs have converged; dense results are stored column-major, such that they can be moved to numpy without copying
+class SparseEigenSolver
+{
+public:
+	typedef Eigen::Matrix<Real, Eigen::Dynamic, 1> DenseVector;						//!< real vector of Krylov method
+	typedef Eigen::Matrix<Real, Eigen::Dynamic, Eigen::Dynamic> DenseMatrix;			//!< column-major real matrix (Krylov basis, eigenvectors)
+	typedef Eigen::Matrix<std::complex<Real>, Eigen::Dynamic, 1> ComplexVector;		//!< complex eigenvalues
+	typedef Eigen::Matrix<std::complex<Real>, Eigen::Dynamic, Eigen::Dynamic> ComplexMatrix;	//!< column-major complex matrix (eigenvectors of gyroscopic problem)
+
+	//! error codes returned by Compute...() functions
+	static const Index success = 0;
+	static const Index factorizationFailed = 1;	//!< shifted matrix could not be factorized, also not with perturbed shift
+	static const Index notConverged = 2;			//!< not all eigenvalues converged within maxRestarts; results contain the current approximations
+
+private:
+	//parameters:
+	Index numberOfEigenvalues;	//!< number of requested eigenvalues
+	Real shift;					//!< eigenvalues closest to shift are computed; shift=0 gives lowest eigenvalues
+	Real tolerance;				//!< relative tolerance for residual of Ritz pairs
+	bool computeEigenVectors;	//!< if false, only eigenvalues are returned
+	Index maxKrylovDimension;	//!< dimension of Krylov subspace; 0: automatic, min(n, max(2*numberOfEigenvalues+1, numberOfEigenvalues+20))
+	Index maxRestarts;			//!< maximum number of restarts of Krylov-Schur method
+
+	//results:
+	DenseVector eigenValues;			//!< eigenvalues of symmetric problem, sorted ascending
+	DenseMatrix eigenVectors;			//!< mass-normalized eigenvectors of symmetric problem (columns)
+	ComplexVector complexEigenValues;	//!< eigenvalues of gyroscopic problem, sorted by distance to shift
+	ComplexMatrix complexEigenVectors;	//!< eigenvectors of gyroscopic problem (displacement part, normalized to length 1)
+	Real usedShift;						//!< shift used for factorization; differs from shift, if shifted matrix was singular
+	Index numberOfConvergedEigenvalues;	//!< number of converged eigenvalues (within requested eigenvalues)
+	Index numberOfOperatorApplications;	//!< number of matrix factor solves = Krylov steps
+	Index numberOfRestarts;				//!< number of restarts of Krylov-Schur method
+
+	//temporary data:
+	Eigen::SparseLU<EigenSparseMatrix, Eigen::COLAMDOrdering<int> > shiftedSolver; //!< factorization of shifted matrix
+	DenseMatrix krylovBasis;			//!< Krylov basis V (n x (m+1))
+	DenseMatrix krylovMatrix;			//!< projected matrix H ((m+1) x m), last row containing the residual coupling
+
+public:
+	SparseEigenSolver()
+	{
+		SetParameters(1, 0., 1e-12, true);
+		usedShift = 0.;
+		numberOfConvergedEigenvalues = 0;
+		numberOfOperatorApplications = 0;
+		numberOfRestarts = 0;
+	}
+
+	//! set parameters for next computation
+	void SetParameters(Index numberOfEigenvaluesInit, Real shiftInit, Real toleranceInit, bool computeEigenVectorsInit,
+		Index maxKrylovDimensionInit = 0, Index maxRestartsInit = 100)
+	{
+		numberOfEigenvalues = numberOfEigenvaluesInit;
+		shift = shiftInit;
+		tolerance = toleranceInit;
+		computeEigenVectors = computeEigenVectorsInit;
+		maxKrylovDimension = maxKrylovDimensionInit;
+		maxRestarts = maxRestartsInit;
+	}
+
+	//! compute eigenvalues of K*phi = lambda*M*phi closest to shift; K and M are symmetrized; returns 0 on success or error code
+	Index ComputeSymmetric(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix& massMatrix);
+
+	//! compute eigenvalues of (lambda^2*M + lambda*gyroscopicFactor*G + K)*phi = 0 closest to (real) shift; returns 0 on success or error code
+	Index ComputeGyroscopic(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix& gyroscopicMatrix,
+		const EigenSparseMatrix& massMatrix, Real gyroscopicFactor);
+
+	//! results; non-const access allows to move results, e.g., to numpy arrays
+	DenseVector& GetEigenValues() { return eigenValues; }
+	DenseMatrix& GetEigenVectors() { return eigenVectors; }
+	ComplexVector& GetComplexEigenValues() { return complexEigenValues; }
+	ComplexMatrix& GetComplexEigenVectors() { return complexEigenVectors; }
+
+	Real GetUsedShift() const { return usedShift; }
+	Index GetNumberOfConvergedEigenvalues() const { return numberOfConvergedEigenvalues; }
+	Index GetNumberOfOperatorApplications() const { return numberOfOperatorApplications; }
+	Index GetNumberOfRestarts() const { return numberOfRestarts; }
+
+private:
+	//! factorize shifted matrix K-sigma*M (symmetric problem) or K+sigma*gyroscopicFactor*G+sigma^2*M (gyroscopic problem) for sigma=usedShift;
+	//! if factorization fails, the shift is perturbed once by a small negative value (relative to trace(K)/trace(M)); returns true on success
+	bool FactorizeShiftedMatrix(const EigenSparseMatrix& stiffnessMatrix, const EigenSparseMatrix* gyroscopicMatrix,
+		Real gyroscopicFactor, const EigenSparseMatrix& massMatrix);
+
+	//! Krylov-Schur iteration for operator of size n; if innerProductMatrix != nullptr, the basis is orthonormal w.r.t. this matrix and
+	//! the operator must be self-adjoint in this inner product (real Ritz values); returns numberOfEigenvalues Ritz values (largest magnitude first)
+	//! and their coefficients w.r.t. krylovBasis (Ritz vectors = krylovBasis.leftCols(ritzCoefficients.rows()) * ritzCoefficients)
+	Index KrylovSchur(Index n, const std::function<void(const DenseVector&, DenseVector&)>& applyOperator,
+		const EigenSparseMatrix* innerProductMatrix, ComplexVector& ritzValues, ComplexMatrix& ritzCoefficients);
+};
+#else
+class SparseEigenSolver {};
+#endif
+
+#endif
@@ -0,0 +1,186 @@
+/** ***********************************************************************************************
+* @file			TriangleMeshBVH.cpp
+* @brief		Implementation of bounding volume hierarchy for closest point queries on static triangle meshes
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include <algorithm> //std::nth_element
+
+#include "Linalg/TriangleMeshBVH.h"
+#include "Linalg/Geometry.h"
+
+//! delete tree and mesh
+void TriangleMeshBVH::Reset()
+{
+	points.Flush();
+	triangles.Flush();
+	nodes.Flush();
+	triangleOrder.Flush();
+	treeDepth = 0;
+}
+
+//! build tree for mesh with points (n x 3 matrix) and triangles (m x 3 matrix of point indices);
+//! returns false (and leaves tree empty), if matrices have wrong size or triangles refer to invalid point indices
+bool TriangleMeshBVH::Build(const Matrix& meshPoints, const MatrixI& meshTriangles, Index maxTrianglesPerLeaf)
+{
+	Reset();
+	if (meshTriangles.NumberOfRows() == 0) { return true; } //empty mesh ==> no contact
+	if (meshPoints.NumberOfColumns() != 3 || meshTriangles.NumberOfColumns() != 3) { return false; }
+
+	Index nPoints = meshPoints.NumberOfRows();
+	for (Index i = 0; i < meshTriangles.NumberOfRows(); i++)
+	{
+		for (Index j = 0; j < 3; j++)
+		{
+			if (meshTriangles(i, j) >= nPoints) { return false; } //Index is unsigned ==> also detects negative indices
+		}
+	}
+
+	points.SetNumberOfItems(nPoints);
+	for (Index i = 0; i < nPoints; i++)
+	{
+		points[i] = Vector3D({ meshPoints(i, 0), meshPoints(i, 1), meshPoints(i, 2) });
+	}
+
+	Index nTriangles = meshTriangles.NumberOfRows();
+	triangles.SetNumberOfItems(nTriangles);
+	triangleOrder.SetNumberOfItems(nTriangles);
+	ResizableArray<Vector3D> centroids(nTriangles);
+	centroids.SetNumberOfItems(nTriangles);
+	for (Index i = 0; i < nTriangles; i++)
+	{
+		triangles[i] = Index3({ meshTriangles(i, 0), meshTriangles(i, 1), meshTriangles(i, 2) });
+		triangleOrder[i] = i;
+		centroids[i] = (1. / 3.)*(points[triangles[i][0]] + points[triangles[i][1]] + points[triangles[i][2]]);
+	}
+
+	//a binary tree with leaves of at least one triangle has less than 2*nTriangles nodes
+	nodes.SetMaxNumberOfItems(2 * nTriangles);
+	BuildNode(0, nTriangles, centroids, EXUstd::Maximum(maxTrianglesPerLeaf, (Index)1), 1);
+
+	if (treeDepth > maxTreeDepth) //cannot happen with median split for any realistic mesh size
+	{
+		Reset();
+		return false;
+	}
+	return true;
+}
+
+//! recursively build tree for triangleOrder[start, ..., end-1]; centroids of all triangles are provided; returns node index
+Index TriangleMeshBVH::BuildNode(Index start, Index end, const ResizableArray<Vector3D>& centroids, Index maxTrianglesPerLeaf, Index depth)
+{
+	treeDepth = EXUstd::Maximum(treeDepth, depth);
+
+	//bounding box of all triangle points and of centroids:
+	TriangleMeshBVHNode node;
+	node.boxMin = points[triangles[triangleOrder[start]][0]];
+	node.boxMax = node.boxMin;
+	Vector3D centroidMin = centroids[triangleOrder[start]];
+	Vector3D centroidMax = centroidMin;
+	for (Index k = start; k < end; k++)
+	{
+		const Index3& triangle = triangles[triangleOrder[k]];
+		for (Index j = 0; j < 3; j++)
+		{
+			const Vector3D& p = points[triangle[j]];
+			for (Index i = 0; i < 3; i++)
+			{
+				node.boxMin[i] = EXUstd::Minimum(node.boxMin[i], p[i]);
+				node.boxMax[i] = EXUstd::Maximum(node.boxMax[i], p[i]);
+			}
+		}
+		const Vector3D& c = centroids[triangleOrder[k]];
+		for (Index i = 0; i < 3; i++)
+		{
+			centroidMin[i] = EXUstd::Minimum(centroidMin[i], c[i]);
+			centroidMax[i] = EXUstd::Maximum(centroidMax[i], c[i]);
+		}
+	}
+
+	Index nodeIndex = nodes.Append(node);
+	if (end - start <= maxTrianglesPerLeaf)
+	{
+		nodes[nodeIndex].index = start;
+		nodes[nodeIndex].numberOfTriangles = end - start;
+		return nodeIndex;
+	}
+
+	//split at median of centroids along longest axis of centroid box:
+	Vector3D size = centroidMax - centroidMin;
+	Index axis = 0;
+	if (size[1] > size[axis]) { axis = 1; }
+	if (size[2] > size[axis]) { axis = 2; }
+
+	Index mid = (start + end) / 2;
+	std::nth_element(triangleOrder.begin() + start, triangleOrder.begin() + mid, triangleOrder.begin() + end,
+		[&centroids, axis](Index a, Index b) { return centroids[a][axis] < centroids[b][axis]; });
+
+	nodes[nodeIndex].numberOfTriangles = 0;
+	BuildNode(start, mid, centroids, maxTrianglesPerLeaf, depth + 1); //left child is nodeIndex+1
+	nodes[nodeIndex].index = BuildNode(mid, end, centroids, maxTrianglesPerLeaf, depth + 1);
+	return nodeIndex;
+}
+
+//! find closest point on mesh to point within distance searchRadius; returns false if there is no triangle within searchRadius;
+//! on success, closestPoint and triangleIndex of the triangle containing the closest point are returned
+bool TriangleMeshBVH::ClosestPoint(const Vector3D& point, Real searchRadius, Vector3D& closestPoint, Index& triangleIndex) const
+{
+	if (IsEmpty()) { return false; }
+
+	Real bestDistance2 = searchRadius * searchRadius;
+	triangleIndex = EXUstd::InvalidIndex;
+
+	Index stack[maxTreeDepth + 1]; //depth first traversal; at most one pending node per level
+	Index stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize)
+	{
+		const TriangleMeshBVHNode& node = nodes[stack[--stackSize]];
+		if (BoxDistanceSquared(node, point) > bestDistance2) { continue; }
+
+		if (node.numberOfTriangles)
+		{
+			for (Index k = node.index; k < node.index + node.numberOfTriangles; k++)
+			{
+				const Index3& triangle = triangles[triangleOrder[k]];
+				Vector3D p = HGeometry::ClosestPointOnTriangle(points[triangle[0]], points[triangle[1]], points[triangle[2]], point);
+				Real distance2 = (p - point).GetL2NormSquared();
+				if (distance2 <= bestDistance2)
+				{
+					bestDistance2 = distance2;
+					closestPoint = p;
+					triangleIndex = triangleOrder[k];
+				}
+			}
+		}
+		else
+		{
+			//visit closer child first (pushed last) to reduce bestDistance2 early
+			Index left = (Index)(&node - nodes.GetDataPointer()) + 1;
+			Index right = node.index;
+			if (BoxDistanceSquared(nodes[left], point) < BoxDistanceSquared(nodes[right], point)) { std::swap(left, right); }
+			stack[stackSize++] = left;
+			stack[stackSize++] = right;
+		}
+	}
+	return triangleIndex != EXUstd::InvalidIndex;
+}
+
+//! return normalized normal of triangle according to counterclockwise orientation of triangle points; zero vector for degenerate triangles
+Vector3D TriangleMeshBVH::GetTriangleNormal(Index triangleIndex) const
+{
+	const Index3& triangle = triangles[triangleIndex];
+	Vector3D normal = (points[triangle[1]] - points[triangle[0]]).CrossProduct(points[triangle[2]] - points[triangle[0]]);
+	Real length = normal.GetL2Norm();
+	if (length != 0.) { normal *= 1. / length; }
+	return normal;
+}
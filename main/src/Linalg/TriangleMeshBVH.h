@@ -0,0 +1,89 @@
+/** ***********************************************************************************************
+* @class		TriangleMeshBVH
+* @brief		Bounding volume hierarchy (axis-aligned bounding boxes) for closest point queries on a static triangle mesh
+* @details		Details:
+* 				- the tree is built once from mesh points and triangles (e.g. terrain given by graphicsDataUtilities or STL data);
+*                 triangles are split at the median of their centroids along the longest axis, leaves contain up to maxTrianglesPerLeaf triangles
+*               - ClosestPoint(...) searches the closest point on the mesh within a search radius; subtrees are skipped if their box
+*                 is farther than the closest point found so far, which gives O(log n) queries for n triangles
+*               - triangle normals follow the counterclockwise orientation of triangle points (right-hand rule)
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef TRIANGLEMESHBVH__H
+#define TRIANGLEMESHBVH__H
+
+#include "Linalg/BasicLinalg.h"
+
+//! node of bounding volume hierarchy; inner nodes have the left child at (nodeIndex+1) and the right child at 'index',
+//! leaves (numberOfTriangles > 0) contain the triangles triangleOrder[index], ..., triangleOrder[index+numberOfTriangles-1]
+class TriangleMeshBVHNode
+{
+public:
+	Vector3D boxMin;			//!< minimum coordinates of bounding box
+	Vector3D boxMax;			//!< maximum coordinates of bounding box
+	Index index;				//!< right child (inner node) or first index in triangleOrder (leaf)
+	Index numberOfTriangles;	//!< 0 for inner nodes
+};
+
+//! bounding volume hierarchy for closest point queries on static triangle mesh
+class TriangleMeshBVH
+{
+private:
+	ResizableArray<Vector3D> points;				//!< mesh points
+	ResizableArray<Index3> triangles;				//!< point indices of triangles
+	ResizableArray<TriangleMeshBVHNode> nodes;		//!< tree nodes; nodes[0] is the root
+	ArrayIndex triangleOrder;						//!< triangle indices sorted such that every leaf references a contiguous range
+	Index treeDepth;								//!< maximum depth of tree (root = 1)
+
+	//! recursively build tree for triangleOrder[start, ..., end-1]; centroids of all triangles are provided; returns node index
+	Index BuildNode(Index start, Index end, const ResizableArray<Vector3D>& centroids, Index maxTrianglesPerLeaf, Index depth);
+
+	//! squared distance of point to box of node; zero if point lies inside box
+	Real BoxDistanceSquared(const TriangleMeshBVHNode& node, const Vector3D& point) const
+	{
+		Real distance2 = 0.;
+		for (Index i = 0; i < 3; i++)
+		{
+			if (point[i] < node.boxMin[i]) { distance2 += EXUstd::Square(node.boxMin[i] - point[i]); }
+			else if (point[i] > node.boxMax[i]) { distance2 += EXUstd::Square(point[i] - node.boxMax[i]); }
+		}
+		return distance2;
+	}
+
+public:
+	static constexpr Index maxTreeDepth = 64; //!< size of traversal stack; median split gives depth of approx. log2(n/maxTrianglesPerLeaf)+1
+
+	TriangleMeshBVH() : treeDepth(0) {}
+
+	//! delete tree and mesh
+	void Reset();
+
+	//! build tree for mesh with points (n x 3 matrix) and triangles (m x 3 matrix of point indices);
+	//! returns false (and leaves tree empty), if matrices have wrong size or triangles refer to invalid point indices
+	bool Build(const Matrix& meshPoints, const MatrixI& meshTriangles, Index maxTrianglesPerLeaf = 4);
+
+	//! return true, if tree contains no triangles
+	bool IsEmpty() const { return nodes.NumberOfItems() == 0; }
+
+	//! find closest point on mesh to point within distance searchRadius; returns false if there is no triangle within searchRadius;
+	//! on success, closestPoint and triangleIndex of the triangle containing the closest point are returned
+	bool ClosestPoint(const Vector3D& point, Real searchRadius, Vector3D& closestPoint, Index& triangleIndex) const;
+
+	//! return normalized normal of triangle according to counterclockwise orientation of triangle points; zero vector for degenerate triangles
+	Vector3D GetTriangleNormal(Index triangleIndex) const;
+
+	const ResizableArray<Vector3D>& GetPoints() const { return points; }
+	const ResizableArray<Index3>& GetTriangles() const { return triangles; }
+	Index GetNumberOfNodes() const { return nodes.NumberOfItems(); }
+	Index GetTreeDepth() const { return treeDepth; }
+};
+
+#endif
@@ -21,6 +21,13 @@
 #include "Utilities/BasicDefinitions.h"
 
 #include "Main/CSystemState.h"
+#include <atomic>
+#include <list>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
 
 class CData // 
 {
@@ -29,13 +36,48 @@ public: //
 	CSystemState initialState;                           //!< initial state coordinates (initial conditions for time integration or Newton method)
 	CSystemState currentState;                           //!< current state coordinates (e.g. during Newton, static solution or time integration)
 	CSystemState startOfStepState;                       //!< state coordinates at beginning of computation step (static or time step); corresponds to current coordinates at beginning of step
-	CSystemState visualizationState;                     //!< visualization state coordinates; usually updated at end of computation step; uses semaphores between rendering and computation threads
 
 private:
+	//visualization state is triple-buffered: computation thread writes into back buffer and publishes it by an atomic swap with the middle buffer;
+	//only the renderer swaps the newest published state into the front buffer, which is returned by GetVisualization(); no thread needs to wait for the other
+	CSystemState visualizationStates[3];				 //!< front, middle and back buffer of visualization state coordinates
+	std::atomic<CSystemState*> visualizationFrontState;	 //!< front buffer returned by GetVisualization(); only changed by renderer (read also by Python thread)
+	Index visualizationFront;							 //!< index of front buffer; only accessed by renderer
+	Index visualizationBack;							 //!< index of back buffer; only accessed by computation thread
+	std::atomic<Index> visualizationMiddle;				 //!< index of middle buffer, including visualizationStateNewFlag if middle buffer contains an unconsumed published state
+	static const Index visualizationStateNewFlag = 4;	 //!< flag added to visualizationMiddle, set by PublishVisualizationState()
+
+	//states for image recording must not be skipped by the triple buffer: they are copied into a bounded queue, which is drained by the renderer
+	std::list<CSystemState> recordStates;				 //!< pool of states for image recording; std::list, as pointers to items must stay valid
+	std::deque<CSystemState*> recordQueue;				 //!< states of recordStates, which shall be drawn and recorded by the renderer (in this order)
+	std::vector<CSystemState*> recordFreeStates;		 //!< states of recordStates, which can be reused
+	CSystemState* recordFrontState;						 //!< state of recordStates currently shown in front buffer, or nullptr; only accessed by renderer
+	std::mutex recordMutex;								 //!< protects recordQueue and recordFreeStates
+	std::condition_variable recordCondition;			 //!< notified by renderer if a state has been taken from recordQueue
+
 	bool systemIsConsistent;							 //!< variable is set after check of system consistency ==> in order to draw or compute system; usually set after Assemble()
 
 public: // 
 
+	CData() : visualizationFrontState(&visualizationStates[0]), visualizationFront(0), visualizationBack(2), visualizationMiddle(1), recordFrontState(nullptr), systemIsConsistent(false) {}
+	CData(const CData& other) : visualizationFrontState(&visualizationStates[0]), visualizationMiddle(1), recordFrontState(nullptr) { *this = other; }
+
+	//! copy assignment; std::atomic and std::mutex are not copyable; states queued for image recording are not copied
+	CData& operator=(const CData& other)
+	{
+		referenceState = other.referenceState;
+		initialState = other.initialState;
+		currentState = other.currentState;
+		startOfStepState = other.startOfStepState;
+		for (Index i = 0; i < 3; i++) { visualizationStates[i] = other.visualizationStates[i]; }
+		visualizationFront = other.visualizationFront;
+		visualizationFrontState = &visualizationStates[visualizationFront];
+		visualizationBack = other.visualizationBack;
+		visualizationMiddle = other.visualizationMiddle.load();
+		systemIsConsistent = other.systemIsConsistent;
+		return *this;
+	}
+
 	virtual ~CData() {} //added for correct deletion of derived classes
 	// access functions
   //! clone object; specifically for copying instances of derived class, for automatic memory management e.g. in ObjectContainer
@@ -61,10 +103,111 @@ public: //
 	//! Read (Reference) access to: state coordinates at beginning of computation step (static or time step); corresponds to current coordinates at beginning of step
 	const CSystemState& GetStartOfStep() const { return startOfStepState; }
 
-	//! Write (Reference) access to: state coordinates for visualization
-	CSystemState& GetVisualization() { return visualizationState; }
-	//! Read (Reference) access to: state coordinates for visualization
-	const CSystemState& GetVisualization() const { return visualizationState; }
+	//! Write (Reference) access to: state coordinates for visualization (front buffer, used by renderer)
+	CSystemState& GetVisualization() { return *visualizationFrontState.load(std::memory_order_acquire); }
+	//! Read (Reference) access to: state coordinates for visualization (front buffer, used by renderer)
+	const CSystemState& GetVisualization() const { return *visualizationFrontState.load(std::memory_order_acquire); }
+
+	//! set all buffers of visualization state to state; only call if renderer does not access visualization state (e.g. in Assemble())
+	void InitializeVisualizationStates(const CSystemState& state)
+	{
+		for (CSystemState& item : visualizationStates) { item = state; }
+		visualizationFront = 0;
+		visualizationFrontState = &visualizationStates[0];
+		visualizationMiddle = 1;
+		visualizationBack = 2;
+
+		std::lock_guard<std::mutex> lock(recordMutex);
+		recordQueue.clear();
+		recordFreeStates.clear();
+		for (CSystemState& item : recordStates) { recordFreeStates.push_back(&item); }
+		recordFrontState = nullptr;
+	}
+
+	//! move all state vectors (including visualization buffers) to the end of retainedStates, which keeps their memory alive;
+	//! vectors are empty afterwards and allocated again at next assignment; only call if renderer does not access visualization state (e.g. in Assemble())
+	void MoveStatesTo(std::list<CSystemState>& retainedStates)
+	{
+		retainedStates.push_back(std::move(referenceState));
+		retainedStates.push_back(std::move(initialState));
+		retainedStates.push_back(std::move(currentState));
+		retainedStates.push_back(std::move(startOfStepState));
+		for (CSystemState& item : visualizationStates) { retainedStates.push_back(std::move(item)); }
+	}
+
+	//! computation thread: copy state into back buffer and publish it as newest visualization state by swapping it with middle buffer; never waits;
+	//! if no renderer is running, there is no consumer of the triple buffer and the state is written directly into the front buffer
+	void PublishVisualizationState(const CSystemState& state, bool rendererIsRunning)
+	{
+		if (rendererIsRunning)
+		{
+			visualizationStates[visualizationBack] = state;
+			visualizationBack = visualizationMiddle.exchange(visualizationBack + visualizationStateNewFlag, std::memory_order_acq_rel) % visualizationStateNewFlag;
+		}
+		else
+		{
+			*visualizationFrontState.load(std::memory_order_acquire) = state;
+			//an unconsumed state in the middle buffer is now outdated and must not be taken by a renderer started later
+			Index middle = visualizationMiddle.load(std::memory_order_acquire);
+			if (middle >= visualizationStateNewFlag) { visualizationMiddle.compare_exchange_strong(middle, middle % visualizationStateNewFlag, std::memory_order_acq_rel); }
+		}
+	}
+
+	//! renderer: swap newest published visualization state into front buffer; returns false if no new state has been published since last call;
+	//! must only be called by the renderer, which is the only consumer of the triple buffer
+	bool UpdateVisualizationState()
+	{
+		if (visualizationMiddle.load(std::memory_order_acquire) < visualizationStateNewFlag) { return false; }
+		visualizationFront = visualizationMiddle.exchange(visualizationFront, std::memory_order_acq_rel) % visualizationStateNewFlag;
+		visualizationFrontState.store(&visualizationStates[visualizationFront], std::memory_order_release);
+		if (recordFrontState) //state recorded in an earlier update is not shown any more
+		{
+			std::lock_guard<std::mutex> lock(recordMutex);
+			recordFreeStates.push_back(recordFrontState);
+			recordFrontState = nullptr;
+		}
+		return true;
+	}
+
+	//! computation thread: queue a copy of state, which shall be drawn and recorded by the renderer; if maximumQueueSize states are already queued,
+	//! waits at most timeOutMilliseconds for the renderer; returns false, if the state could not be queued (frame is dropped)
+	bool QueueVisualizationRecordState(const CSystemState& state, Index maximumQueueSize, Index timeOutMilliseconds)
+	{
+		CSystemState* item;
+		{
+			std::unique_lock<std::mutex> lock(recordMutex);
+			if (!recordCondition.wait_for(lock, std::chrono::milliseconds(timeOutMilliseconds),
+				[this, maximumQueueSize] { return (Index)recordQueue.size() < maximumQueueSize; })) { return false; }
+
+			if (recordFreeStates.size()) { item = recordFreeStates.back(); recordFreeStates.pop_back(); }
+			else { recordStates.emplace_back(); item = &recordStates.back(); }
+		}
+		*item = state; //copy without lock; item is neither queued nor free
+		std::lock_guard<std::mutex> lock(recordMutex);
+		recordQueue.push_back(item);
+		return true;
+	}
+
+	//! return true, if states for image recording are queued
+	bool HasQueuedVisualizationRecordStates()
+	{
+		std::lock_guard<std::mutex> lock(recordMutex);
+		return recordQueue.size() != 0;
+	}
+
+	//! renderer: take next state queued for image recording into front buffer (instead of UpdateVisualizationState());
+	//! returns false, if no state is queued
+	bool UpdateVisualizationRecordState()
+	{
+		std::lock_guard<std::mutex> lock(recordMutex);
+		if (recordQueue.empty()) { return false; }
+		if (recordFrontState) { recordFreeStates.push_back(recordFrontState); }
+		recordFrontState = recordQueue.front();
+		recordQueue.pop_front();
+		visualizationFrontState.store(recordFrontState, std::memory_order_release);
+		recordCondition.notify_all();
+		return true;
+	}
 
 	//! return if systemStates are consistent (if not, e.g., system cannot be drawn using state coordinates)
 	bool IsSystemConsistent() const { return systemIsConsistent; }
@@ -32,8 +32,6 @@
 
 #include "Utilities/TimerStructure.h" //for local CPU time measurement
 
-//#define USE_AUTODIFF
-
 //#define USE_OPENMP
 
 #ifdef USE_OPENMP
@@ -661,6 +659,11 @@ void CSystem::AssembleLTGLists(const MainSystem& mainSystem)
 		listAE.Append(ltgListAE);
 		listData.Append(ltgListData);
 	}
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+	AssembleParallelAssemblyLists();
+#endif
+	columnColoringIsValid = false; //colorings are computed on demand in compressed numerical differentiation
+	AssembleContactBroadPhase();
 	//pout << "local to global ODE2 Indices:\n" << listODE2 << "\n\n";
 	//pout << "local to global ODE1 Indices:\n" << listODE1 << "\n\n";
 	//pout << "local to global AE Indices:\n" << listAE << "\n\n";
@@ -668,6 +671,460 @@ void CSystem::AssembleLTGLists(const MainSystem& mainSystem)
 }
 
 
+//! build lists (offsets, coordinate-wise contributions) for race-free parallel assembly of ODE2 RHS from ltgODE2 lists; must be called after every change of ltg lists
+void CSystem::AssembleParallelAssemblyLists()
+{
+	const ObjectContainer<ArrayIndex>& listODE2 = cSystemData.GetLocalToGlobalODE2();
+	Index nObjects = listODE2.NumberOfItems();
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+
+	ArrayIndex& objectOffsets = parallelAssemblyData.objectOffsets;
+	ArrayIndex& coordinateOffsets = parallelAssemblyData.coordinateOffsets;
+	ArrayIndex& contributions = parallelAssemblyData.contributions;
+
+	//count contributions per system coordinate and compute object offsets:
+	objectOffsets.SetNumberOfItems(nObjects + 1);
+	coordinateOffsets.SetNumberOfItems(nODE2 + 1);
+	coordinateOffsets.SetAll(0);
+
+	Index nTotal = 0;
+	for (Index j = 0; j < nObjects; j++)
+	{
+		objectOffsets[j] = nTotal;
+		for (Index globalIndex : listODE2[j])
+		{
+			CHECKandTHROW(globalIndex < nODE2, "CSystem::AssembleParallelAssemblyLists: invalid ltgODE2 index");
+			coordinateOffsets[globalIndex + 1]++;
+		}
+		nTotal += listODE2[j].NumberOfItems();
+	}
+	objectOffsets[nObjects] = nTotal;
+
+	for (Index i = 0; i < nODE2; i++)
+	{
+		coordinateOffsets[i + 1] += coordinateOffsets[i];
+	}
+
+	//fill contributions in order of objects (and local coordinates), which defines the summation order:
+	ArrayIndex fillPosition;
+	fillPosition.CopyFrom(coordinateOffsets);
+	contributions.SetNumberOfItems(nTotal);
+	for (Index j = 0; j < nObjects; j++)
+	{
+		const ArrayIndex& ltgODE2 = listODE2[j];
+		for (Index k = 0; k < ltgODE2.NumberOfItems(); k++)
+		{
+			contributions[fillPosition[ltgODE2[k]]++] = objectOffsets[j] + k;
+		}
+	}
+
+	parallelAssemblyData.objectValues.SetNumberOfItems(nTotal);
+
+	//greedy coloring of objects: objects with same color do not share ODE2 coordinates
+	//  ==> their coordinates can be perturbed concurrently in numerical differentiation
+	ArrayIndex& colorOffsets = parallelAssemblyData.colorOffsets;
+	ArrayIndex& colorObjects = parallelAssemblyData.colorObjects;
+	ArrayIndex& jacobianOffsets = parallelAssemblyData.jacobianOffsets;
+
+	std::vector<std::vector<Index>> coordinateColors(nODE2); //colors of objects already using a coordinate
+	ArrayIndex objectColor;
+	objectColor.SetNumberOfItems(nObjects);
+	ArrayIndex colorMarker; //colorMarker[c]==j+1, if color c is not possible for object j
+	ArrayIndex colorCount;
+	jacobianOffsets.SetNumberOfItems(nObjects + 1);
+	Index nJacobian = 0;
+
+	for (Index j = 0; j < nObjects; j++)
+	{
+		const ArrayIndex& ltgODE2 = listODE2[j];
+		jacobianOffsets[j] = nJacobian;
+		nJacobian += EXUstd::Square(ltgODE2.NumberOfItems());
+		objectColor[j] = EXUstd::InvalidIndex;
+
+		if (ltgODE2.NumberOfItems())
+		{
+			for (Index globalIndex : ltgODE2)
+			{
+				for (Index color : coordinateColors[globalIndex]) { colorMarker[color] = j + 1; }
+			}
+			Index color = 0;
+			while (color < colorMarker.NumberOfItems() && colorMarker[color] == j + 1) { color++; }
+			if (color == colorMarker.NumberOfItems())
+			{
+				colorMarker.Append(0);
+				colorCount.Append(0);
+			}
+			for (Index globalIndex : ltgODE2) { coordinateColors[globalIndex].push_back(color); }
+			objectColor[j] = color;
+			colorCount[color]++;
+		}
+	}
+	jacobianOffsets[nObjects] = nJacobian;
+
+	Index nColors = colorCount.NumberOfItems();
+	colorOffsets.SetNumberOfItems(nColors + 1);
+	colorOffsets[0] = 0;
+	for (Index c = 0; c < nColors; c++)
+	{
+		colorOffsets[c + 1] = colorOffsets[c] + colorCount[c];
+	}
+
+	fillPosition.CopyFrom(colorOffsets);
+	colorObjects.SetNumberOfItems(colorOffsets[nColors]);
+	for (Index j = 0; j < nObjects; j++)
+	{
+		if (objectColor[j] != EXUstd::InvalidIndex)
+		{
+			colorObjects[fillPosition[objectColor[j]]++] = j;
+		}
+	}
+	parallelAssemblyData.jacobianAvailable.SetNumberOfItems(nObjects);
+}
+
+//! compute column coloring for compressed numerical differentiation from dense blocks (blockRows[b] x blockColumns[b]), which define the sparsity pattern of a jacobian;
+//! greedy coloring: columns which share a row get different colors; columns without rows are not colored (their jacobian column is zero)
+void ComputeColumnColoringFromBlocks(const std::vector<const ArrayIndex*>& blockRows, const std::vector<const ArrayIndex*>& blockColumns,
+	Index nRows, Index nColumns, ColumnColoringData& coloring)
+{
+	//blocks of every column:
+	std::vector<std::vector<Index>> columnBlocks(nColumns);
+	for (Index b = 0; b < (Index)blockColumns.size(); b++)
+	{
+		for (Index column : *blockColumns[b])
+		{
+			CHECKandTHROW(column >= 0 && column < nColumns, "ComputeColumnColoringFromBlocks: invalid column index");
+			if (columnBlocks[column].size() == 0 || columnBlocks[column].back() != b) { columnBlocks[column].push_back(b); }
+		}
+	}
+
+	//rows of every column (union of rows of blocks, sorted, without duplicates):
+	ArrayIndex& columnRowOffsets = coloring.columnRowOffsets;
+	ArrayIndex& columnRows = coloring.columnRows;
+	columnRowOffsets.SetNumberOfItems(nColumns + 1);
+	columnRows.SetNumberOfItems(0);
+
+	ArrayIndex rowMarker; //rowMarker[r]==i, if row r already added to column i
+	rowMarker.SetNumberOfItems(nRows);
+	rowMarker.SetAll(EXUstd::InvalidIndex);
+	ArrayIndex rowOffsets; //compressed storage for transposed pattern (columns of every row)
+	rowOffsets.SetNumberOfItems(nRows + 1);
+	rowOffsets.SetAll(0);
+
+	for (Index i = 0; i < nColumns; i++)
+	{
+		Index start = columnRows.NumberOfItems();
+		columnRowOffsets[i] = start;
+		for (Index b : columnBlocks[i])
+		{
+			for (Index row : *blockRows[b])
+			{
+				CHECKandTHROW(row >= 0 && row < nRows, "ComputeColumnColoringFromBlocks: invalid row index");
+				if (rowMarker[row] != i)
+				{
+					rowMarker[row] = i;
+					columnRows.Append(row);
+					rowOffsets[row + 1]++;
+				}
+			}
+		}
+		std::sort(columnRows.begin() + start, columnRows.end());
+	}
+	columnRowOffsets[nColumns] = columnRows.NumberOfItems();
+
+	//transposed pattern:
+	for (Index r = 0; r < nRows; r++)
+	{
+		rowOffsets[r + 1] += rowOffsets[r];
+	}
+	ArrayIndex fillPosition;
+	fillPosition.CopyFrom(rowOffsets);
+	ArrayIndex rowColumns;
+	rowColumns.SetNumberOfItems(columnRows.NumberOfItems());
+	for (Index i = 0; i < nColumns; i++)
+	{
+		for (Index p = columnRowOffsets[i]; p < columnRowOffsets[i + 1]; p++)
+		{
+			rowColumns[fillPosition[columnRows[p]]++] = i;
+		}
+	}
+
+	//greedy distance-2 coloring: column i must not have same color as any column sharing a row
+	ArrayIndex columnColor;
+	columnColor.SetNumberOfItems(nColumns);
+	columnColor.SetAll(EXUstd::InvalidIndex);
+	ArrayIndex colorMarker; //colorMarker[c]==i+1, if color c is not possible for column i
+	ArrayIndex colorCount;
+
+	for (Index i = 0; i < nColumns; i++)
+	{
+		if (columnRowOffsets[i + 1] != columnRowOffsets[i])
+		{
+			for (Index p = columnRowOffsets[i]; p < columnRowOffsets[i + 1]; p++)
+			{
+				Index row = columnRows[p];
+				for (Index q = rowOffsets[row]; q < rowOffsets[row + 1]; q++)
+				{
+					Index otherColor = columnColor[rowColumns[q]];
+					if (otherColor != EXUstd::InvalidIndex) { colorMarker[otherColor] = i + 1; }
+				}
+			}
+			Index color = 0;
+			while (color < colorMarker.NumberOfItems() && colorMarker[color] == i + 1) { color++; }
+			if (color == colorMarker.NumberOfItems())
+			{
+				colorMarker.Append(0);
+				colorCount.Append(0);
+			}
+			columnColor[i] = color;
+			colorCount[color]++;
+		}
+	}
+
+	ArrayIndex& colorOffsets = coloring.colorOffsets;
+	ArrayIndex& colorColumns = coloring.colorColumns;
+	Index nColors = colorCount.NumberOfItems();
+	colorOffsets.SetNumberOfItems(nColors + 1);
+	colorOffsets[0] = 0;
+	for (Index c = 0; c < nColors; c++)
+	{
+		colorOffsets[c + 1] = colorOffsets[c] + colorCount[c];
+	}
+
+	fillPosition.CopyFrom(colorOffsets);
+	colorColumns.SetNumberOfItems(colorOffsets[nColors]);
+	for (Index i = 0; i < nColumns; i++)
+	{
+		if (columnColor[i] != EXUstd::InvalidIndex)
+		{
+			colorColumns[fillPosition[columnColor[i]]++] = i;
+		}
+	}
+}
+
+//! compute column colorings for compressed system wide numerical differentiation (ODE2 and AE jacobians) from ltg lists; called on demand if columnColoringIsValid=false
+void CSystem::ComputeColumnColorings()
+{
+	const ObjectContainer<ArrayIndex>& listODE2 = cSystemData.GetLocalToGlobalODE2();
+	const ObjectContainer<ArrayIndex>& listAE = cSystemData.GetLocalToGlobalAE();
+	Index nObjects = listODE2.NumberOfItems();
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+	Index nAE = cSystemData.GetNumberOfCoordinatesAE();
+
+	std::vector<const ArrayIndex*> blockRows;
+	std::vector<const ArrayIndex*> blockColumns;
+
+	//ODE2 jacobian: objects couple all of their ODE2 coordinates; constraints do not contribute to ODE2 RHS
+	for (Index j = 0; j < nObjects; j++)
+	{
+		if (listODE2[j].NumberOfItems() && !((Index)cSystemData.GetCObjects()[j]->GetType() & (Index)CObjectType::Constraint))
+		{
+			blockRows.push_back(&listODE2[j]);
+			blockColumns.push_back(&listODE2[j]);
+		}
+	}
+	//loads on body markers only depend on body coordinates (already included); loads on node markers depend on node coordinates:
+	std::vector<ArrayIndex> nodeLoadCoordinates;
+	for (Index j = 0; j < cSystemData.GetCLoads().NumberOfItems(); j++)
+	{
+		CMarker* marker = cSystemData.GetCMarkers()[cSystemData.GetCLoads()[j]->GetMarkerNumber()];
+		if (marker->GetType() & Marker::Node)
+		{
+			CNode* node = cSystemData.GetCNodes()[marker->GetNodeNumber()];
+			if (!node->IsGroundNode() && node->GetNumberOfODE2Coordinates())
+			{
+				ArrayIndex coordinates;
+				coordinates.SetNumberOfItems(node->GetNumberOfODE2Coordinates());
+				for (Index k = 0; k < coordinates.NumberOfItems(); k++)
+				{
+					coordinates[k] = node->GetGlobalODE2CoordinateIndex() + k;
+				}
+				nodeLoadCoordinates.push_back(coordinates);
+			}
+		}
+	}
+	for (const ArrayIndex& coordinates : nodeLoadCoordinates)
+	{
+		blockRows.push_back(&coordinates);
+		blockColumns.push_back(&coordinates);
+	}
+	ComputeColumnColoringFromBlocks(blockRows, blockColumns, nODE2, nODE2, coloringODE2);
+
+	//AE jacobians: algebraic equations of bodies and constraints depend on ODE2 and AE coordinates of the object
+	blockRows.clear();
+	blockColumns.clear();
+	for (Index j = 0; j < nObjects; j++)
+	{
+		if (listAE[j].NumberOfItems())
+		{
+			blockRows.push_back(&listAE[j]);
+			blockColumns.push_back(&listODE2[j]);
+		}
+	}
+	ComputeColumnColoringFromBlocks(blockRows, blockColumns, nAE, nODE2, coloringAE_ODE2);
+
+	blockColumns.clear();
+	for (Index j = 0; j < nObjects; j++)
+	{
+		if (listAE[j].NumberOfItems())
+		{
+			blockColumns.push_back(&listAE[j]);
+		}
+	}
+	ComputeColumnColoringFromBlocks(blockRows, blockColumns, nAE, nAE, coloringAE_AE);
+
+	columnColoringIsValid = true;
+}
+
+//! build list of circle-cable contacts for contact broad phase; called in AssembleLTGLists(...)
+void CSystem::AssembleContactBroadPhase()
+{
+	Index nObjects = cSystemData.GetCObjects().NumberOfItems();
+	Index nMarkers = cSystemData.GetCMarkers().NumberOfItems();
+	contactBroadPhase.contactObjects.SetNumberOfItems(0);
+	contactBroadPhase.nextContactOfCableMarker.SetNumberOfItems(0);
+	contactBroadPhase.firstContactOfCableMarker.SetNumberOfItems(nMarkers);
+	contactBroadPhase.firstContactOfCableMarker.SetAll(EXUstd::InvalidIndex);
+	contactBroadPhase.isCandidate.SetNumberOfItems(nObjects);
+	contactBroadPhase.candidatesValid = false;
+
+	for (Index objectIndex = 0; objectIndex < nObjects; objectIndex++)
+	{
+		contactBroadPhase.isCandidate[objectIndex] = true;
+		CObject* object = cSystemData.GetCObjects()[objectIndex];
+		Real radius;
+		if (((Index)object->GetType() & (Index)CObjectType::Connector) && ((CObjectConnector*)object)->GetContactCircleRadius(radius))
+		{
+			//contacts of a cable marker are stored as linked list
+			Index cableMarker = ((CObjectConnector*)object)->GetMarkerNumbers()[1];
+			contactBroadPhase.nextContactOfCableMarker.Append(contactBroadPhase.firstContactOfCableMarker[cableMarker]);
+			contactBroadPhase.firstContactOfCableMarker[cableMarker] = contactBroadPhase.contactObjects.Append(objectIndex);
+		}
+	}
+}
+
+//! contact broad phase: update candidates of circle-cable contacts for the next step, using bounding boxes enlarged by margin and twice the distance travelled with current velocities within stepSize;
+//! boxes of circle and cable markers are computed once per marker and overlapping circle-cable pairs are found by sweep-and-prune along x;
+//! called once per step at beginning of discontinuous iterations
+void CSystem::UpdateContactCandidates(TemporaryComputationData& temp, Real stepSize, Real margin)
+{
+	Index nMarkers = cSystemData.GetCMarkers().NumberOfItems();
+	contactBroadPhase.markerBoxes.SetNumberOfItems(nMarkers);
+	contactBroadPhase.markerBoxComputed.SetNumberOfItems(nMarkers);
+	contactBroadPhase.sweepBoxes.SetNumberOfItems(0);
+
+	for (Index objectIndex : contactBroadPhase.contactObjects)
+	{
+		const ArrayIndex& markerNumbers = ((CObjectConnector*)cSystemData.GetCObjects()[objectIndex])->GetMarkerNumbers();
+		contactBroadPhase.markerBoxComputed[markerNumbers[0]] = false;
+		contactBroadPhase.markerBoxComputed[markerNumbers[1]] = false;
+		contactBroadPhase.isCandidate[objectIndex] = false;
+	}
+
+	MarkerData& markerData = temp.markerDataStructure.GetMarkerData(1);
+	for (Index objectIndex : contactBroadPhase.contactObjects)
+	{
+		CObjectConnector* connector = (CObjectConnector*)cSystemData.GetCObjects()[objectIndex];
+		const ArrayIndex& markerNumbers = connector->GetMarkerNumbers();
+		Index cableMarker = markerNumbers[1];
+
+		if (!contactBroadPhase.markerBoxComputed[cableMarker])
+		{
+			//bounding box of cable segment points; computed once per marker, without jacobian
+			cSystemData.GetCMarkers()[cableMarker]->ComputeMarkerData(cSystemData, false, markerData);
+
+			const Real& x0 = markerData.vectorValue[0];
+			const Real& y0 = markerData.vectorValue[1];
+			Vector4D box({ x0, x0, y0, y0 });
+			Real maxVelocity2 = 0;
+			for (Index i = 0; i < markerData.vectorValue.NumberOfItems() / 2; i++)
+			{
+				box[0] = EXUstd::Minimum(box[0], markerData.vectorValue[2 * i]);
+				box[1] = EXUstd::Maximum(box[1], markerData.vectorValue[2 * i]);
+				box[2] = EXUstd::Minimum(box[2], markerData.vectorValue[2 * i + 1]);
+				box[3] = EXUstd::Maximum(box[3], markerData.vectorValue[2 * i + 1]);
+				maxVelocity2 = EXUstd::Maximum(maxVelocity2, EXUstd::Square(markerData.vectorValue_t[2 * i]) + EXUstd::Square(markerData.vectorValue_t[2 * i + 1]));
+			}
+			Real motion = 2. * stepSize * sqrt(maxVelocity2);
+			box[0] -= motion;
+			box[1] += motion;
+			box[2] -= motion;
+			box[3] += motion;
+
+			contactBroadPhase.markerBoxes[cableMarker] = box;
+			contactBroadPhase.markerBoxComputed[cableMarker] = true;
+			contactBroadPhase.sweepBoxes.Append({ cableMarker, false });
+		}
+
+		//circle, enlarged by margin and motion within step; box covers the largest radius, if circle marker is used by several contacts
+		Index circleMarkerNumber = markerNumbers[0];
+		const CMarker* circleMarker = cSystemData.GetCMarkers()[circleMarkerNumber];
+		Vector3D center;
+		Vector3D velocity;
+		circleMarker->GetPosition(cSystemData, center);
+		circleMarker->GetVelocity(cSystemData, velocity);
+
+		Real radius;
+		connector->GetContactCircleRadius(radius);
+		Real d = radius + margin + 2. * stepSize * velocity.GetL2Norm();
+
+		Vector4D& circleBox = contactBroadPhase.markerBoxes[circleMarkerNumber];
+		if (!contactBroadPhase.markerBoxComputed[circleMarkerNumber])
+		{
+			circleBox = Vector4D({ center[0] - d, center[0] + d, center[1] - d, center[1] + d });
+			contactBroadPhase.markerBoxComputed[circleMarkerNumber] = true;
+			contactBroadPhase.sweepBoxes.Append({ circleMarkerNumber, true });
+		}
+		else
+		{
+			circleBox[0] = EXUstd::Minimum(circleBox[0], center[0] - d);
+			circleBox[1] = EXUstd::Maximum(circleBox[1], center[0] + d);
+			circleBox[2] = EXUstd::Minimum(circleBox[2], center[1] - d);
+			circleBox[3] = EXUstd::Maximum(circleBox[3], center[1] + d);
+		}
+	}
+
+	//sweep-and-prune along x: boxes become active at xMin and are removed after xMax; only circle-cable pairs are tested in y
+	const ResizableArray<Vector4D>& markerBoxes = contactBroadPhase.markerBoxes;
+	ResizableArray<ContactBroadPhaseBox>& activeBoxes = contactBroadPhase.activeBoxes;
+	if (contactBroadPhase.sweepBoxes.NumberOfItems())
+	{
+		std::sort(contactBroadPhase.sweepBoxes.begin(), contactBroadPhase.sweepBoxes.end(), [&markerBoxes](const ContactBroadPhaseBox& a, const ContactBroadPhaseBox& b)
+			{ return markerBoxes[a.markerNumber][0] < markerBoxes[b.markerNumber][0]; });
+	}
+	activeBoxes.SetNumberOfItems(0);
+	for (const ContactBroadPhaseBox& sweepBox : contactBroadPhase.sweepBoxes)
+	{
+		const Vector4D& box = markerBoxes[sweepBox.markerNumber];
+		Index i = 0;
+		while (i < activeBoxes.NumberOfItems())
+		{
+			const Vector4D& activeBox = markerBoxes[activeBoxes[i].markerNumber];
+			if (activeBox[1] < box[0]) //box has been passed ==> remove by replacing with last box
+			{
+				activeBoxes[i] = activeBoxes.Last();
+				activeBoxes.SetNumberOfItems(activeBoxes.NumberOfItems() - 1);
+				continue;
+			}
+			if (activeBoxes[i].isCircle != sweepBox.isCircle && activeBox[3] >= box[2] && activeBox[2] <= box[3])
+			{
+				Index circleMarkerNumber = sweepBox.isCircle ? sweepBox.markerNumber : activeBoxes[i].markerNumber;
+				Index cableMarker = sweepBox.isCircle ? activeBoxes[i].markerNumber : sweepBox.markerNumber;
+				for (Index k = contactBroadPhase.firstContactOfCableMarker[cableMarker]; k != EXUstd::InvalidIndex; k = contactBroadPhase.nextContactOfCableMarker[k])
+				{
+					Index objectIndex = contactBroadPhase.contactObjects[k];
+					if (((CObjectConnector*)cSystemData.GetCObjects()[objectIndex])->GetMarkerNumbers()[0] == circleMarkerNumber)
+					{
+						contactBroadPhase.isCandidate[objectIndex] = true;
+					}
+				}
+			}
+			i++;
+		}
+		activeBoxes.Append(sweepBox);
+	}
+	contactBroadPhase.candidatesValid = true;
+}
+
 //! build ltg-coordinate lists for object with 'objectIndex' and set indices in ltg lists
 void CSystem::AssembleObjectLTGLists(Index objectIndex, ArrayIndex& ltgListODE2, ArrayIndex& ltgListODE1,
 	ArrayIndex& ltgListAE, ArrayIndex& ltgListData)
@@ -853,6 +1310,7 @@ void CSystem::AssembleObjectLTGLists(Index objectIndex, ArrayIndex& ltgListODE2,
 void CSystem::AssembleInitializeSystemCoordinates(const MainSystem& mainSystem)
 {
 	//pout << "Set initial system coordinates (for ODE2, ODE1 and Data coordinates) ...\n";
+	cSystemData.RetainStateVectorsOfViews(); //numpy arrays linked to views on the old state vectors must not point to deleted memory
 
 	//initial system vectors
 	Vector ODE2u =  Vector(cSystemData.GetNumberOfCoordinatesODE2());
@@ -939,7 +1397,8 @@ void CSystem::AssembleInitializeSystemCoordinates(const MainSystem& mainSystem)
 
 	//initial values are also used for current step ==> from here on, the system can be visualized!
 	cSystemData.GetCData().currentState = cSystemData.GetCData().initialState;
-	cSystemData.GetCData().visualizationState = cSystemData.GetCData().initialState; //from this point on, drawing should be possible
+	cSystemData.GetCData().InitializeVisualizationStates(cSystemData.GetCData().initialState); //from this point on, drawing should be possible
+	cSystemData.IncreaseStateVersion(); //state vectors may have been reallocated and coordinate layout may have changed
 	//done at beginning of solver/time integration: cSystemData.GetCData().startOfStepState = cSystemData.GetCData().initialState;
 }
 
@@ -1132,6 +1591,20 @@ void CSystem::ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& m
 }
 #endif
 
+//! return true, if all bodies with ODE2 coordinates have a constant mass matrix; in this case, the system mass matrix needs to be computed only once
+bool CSystem::HasConstantMassMatrix() const
+{
+	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+	{
+		const CObject& object = *(cSystemData.GetCObjects()[j]);
+		if (((Index)object.GetType() & (Index)CObjectType::Body) && cSystemData.GetLocalToGlobalODE2()[j].NumberOfItems() != 0)
+		{
+			if (!((const CObjectBody&)object).HasConstantMassMatrix()) { return false; }
+		}
+	}
+	return true;
+}
+
 //Index TScomputeODE2LHSobject;
 //TimerStructureRegistrator TSRcomputeODE2LHSobject("computeODE2LHSobject", TScomputeODE2LHSobject, globalTimers);
 //Index TScomputeODE2LHSconnector;
@@ -1178,36 +1651,222 @@ bool CSystem::ComputeObjectODE2LHS(TemporaryComputationData& temp, CObject* obje
 	return false;
 }
 
+//! return true, if the jacobian of the marker does not depend on coordinates (linear access to coordinates, e.g. point nodes, mass points, coordinate markers)
+bool MarkerHasConstantJacobian(const CSystemData& cSystemData, Index markerNumber)
+{
+	const CMarker* marker = cSystemData.GetCMarkers()[markerNumber];
+	Marker::Type type = marker->GetType();
+	if ((type & Marker::Orientation) || (type & Marker::SuperElement)) { return false; }
+	if (!(type & Marker::Position) && !(type & Marker::Coordinate)) { return false; }
+
+	if (type & Marker::Body)
+	{
+		//position of bodies with rotation parameters (rigid bodies, ...) or generic (e.g. ALE) coordinates is not linear in coordinates
+		const CObject* object = cSystemData.GetCObjects()[marker->GetObjectNumber()];
+		for (Index i = 0; i < object->GetNumberOfNodes(); i++)
+		{
+			Index nodeType = (Index)object->GetCNode(i)->GetType();
+			if (nodeType & (Node::Orientation2D + Node::Orientation + Node::RigidBody + Node::GenericODE2)) { return false; }
+		}
+	}
+	return true;
+}
+
+//! write position and rotation jacobians of position and orientation markers into markerJacobian = [positionJacobian0, 0; rotationJacobian0, 0; 0, positionJacobian1; 0, rotationJacobian1]
+//! and velocities and global angular velocities into markerVelocities = [v0, omega0, v1, omega1]
+void GetConnectorMarkerJacobian(const MarkerDataStructure& markerData, ResizableMatrix& markerJacobian, ResizableVector& markerVelocities)
+{
+	Index nColumns0 = markerData.GetMarkerData(0).positionJacobian.NumberOfColumns();
+	Index nColumns1 = markerData.GetMarkerData(1).positionJacobian.NumberOfColumns();
+	markerJacobian.SetNumberOfRowsAndColumns(12, nColumns0 + nColumns1);
+	markerJacobian.SetAll(0.);
+	markerVelocities.SetNumberOfItems(12);
+
+	for (Index i = 0; i < 2; i++)
+	{
+		const MarkerData& markerDataI = markerData.GetMarkerData(i);
+		Index rowOffset = 6 * i;
+		Index columnOffset = (i == 0) ? 0 : nColumns0;
+		Index nColumns = (i == 0) ? nColumns0 : nColumns1;
+		Vector3D omega = markerDataI.orientation * markerDataI.angularVelocityLocal;
+		for (Index k = 0; k < 3; k++)
+		{
+			markerVelocities[rowOffset + k] = markerDataI.velocity[k];
+			markerVelocities[rowOffset + 3 + k] = omega[k];
+			for (Index j = 0; j < nColumns; j++)
+			{
+				markerJacobian(rowOffset + k, columnOffset + j) = markerDataI.positionJacobian(k, j);
+				markerJacobian(rowOffset + 3 + k, columnOffset + j) = markerDataI.rotationJacobian(k, j);
+			}
+		}
+	}
+}
+
+//! compute local jacobian of object ODE2 LHS analytically w.r.t. ODE2 coordinates (velocityLevel=false; stored in temp.localJacobian) or w.r.t. ODE2 velocities (velocityLevel=true; stored in temp.localJacobian_t),
+//! if the object provides the according jacobian function (GetAvailableJacobians()); returns false, if the jacobian needs to be computed numerically;
+//! for connectors with coordinate-dependent marker jacobians, the derivatives of marker jacobians are added, if the connector provides ComputeMarkerForces(...)
+bool CSystem::ComputeObjectJacobianODE2(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff, Index objectNumber, bool velocityLevel)
+{
+	CObject* object = cSystemData.GetCObjects()[objectNumber];
+	const ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[objectNumber];
+	Index nLocalODE2 = ltgODE2.NumberOfItems();
+
+	JacobianType::Type requiredFunction = velocityLevel ? JacobianType::ODE2_ODE2_t_function : JacobianType::ODE2_ODE2_function;
+	if (!(object->GetAvailableJacobians() & requiredFunction)) { return false; }
+
+	temp.localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2);
+	temp.localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2);
+
+	if ((Index)object->GetType() & (Index)CObjectType::Body)
+	{
+		object->ComputeJacobianODE2_ODE2(temp.localJacobian, temp.localJacobian_t);
+	}
+	else if ((Index)object->GetType() & (Index)CObjectType::Connector)
+	{
+		CObjectConnector* connector = (CObjectConnector*)object;
+		bool constantMarkerJacobians = true;
+		for (Index markerNumber : connector->GetMarkerNumbers())
+		{
+			if (!MarkerHasConstantJacobian(cSystemData, markerNumber)) { constantMarkerJacobians = false; }
+		}
+
+		const bool computeJacobian = true;
+		ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
+		bool addMarkerJacobianDerivatives = false;
+		if (!constantMarkerJacobians)
+		{
+			if (!connector->ComputeMarkerForces(temp.markerDataStructure, temp.markerForces, temp.markerForcesJacobian_t)) { return false; } //derivative of marker jacobians not available ==> numerical differentiation
+
+			//LHS = -G^T*markerForces(q, G*q_t): derivatives of G w.r.t. coordinates do not influence the jacobian w.r.t. velocities
+			addMarkerJacobianDerivatives = !velocityLevel;
+		}
+
+		if (addMarkerJacobianDerivatives)
+		{
+			//terms -dG^T/dq_i*markerForces - G^T*markerForcesJacobian_t*d(G*q_t)/dq_i; marker jacobians G are differentiated numerically
+			GetConnectorMarkerJacobian(temp.markerDataStructure, temp.markerJacobian, temp.markerVelocities);
+			CHECKandTHROW(temp.markerJacobian.NumberOfColumns() == nLocalODE2,
+				"CSystem::ComputeObjectJacobianODE2: marker jacobians have inconsistent size");
+
+			temp.markerJacobianDerivatives.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2);
+			ConstSizeVector<12> markerForcesDerivative;
+			Vector& x = cSystemData.GetCData().currentState.ODE2Coords;
+			const Vector& xRef = cSystemData.GetCData().referenceState.ODE2Coords;
+			Real xRefVal = 0;
+			for (Index i = 0; i < nLocalODE2; i++)
+			{
+				Real& xVal = x[ltgODE2[i]];
+				if (numDiff.addReferenceCoordinatesToEpsilon) { xRefVal = xRef[ltgODE2[i]]; }
+				Real eps = numDiff.relativeEpsilon * (EXUstd::Maximum(numDiff.minimumCoordinateSize, fabs(xVal + xRefVal)));
+
+				Real xStore = xVal;
+				xVal += eps;
+				ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
+				xVal = xStore;
+				GetConnectorMarkerJacobian(temp.markerDataStructure, temp.markerJacobianPerturbed, temp.markerVelocitiesPerturbed);
+
+				Real epsInv = 1. / eps;
+				for (Index a = 0; a < 12; a++)
+				{
+					markerForcesDerivative[a] = 0.;
+					for (Index b = 0; b < 12; b++)
+					{
+						markerForcesDerivative[a] += temp.markerForcesJacobian_t(a, b) * epsInv * (temp.markerVelocitiesPerturbed[b] - temp.markerVelocities[b]);
+					}
+				}
+				for (Index k = 0; k < nLocalODE2; k++)
+				{
+					Real value = 0.;
+					for (Index a = 0; a < 12; a++)
+					{
+						value -= epsInv * (temp.markerJacobianPerturbed(a, k) - temp.markerJacobian(a, k)) * temp.markerForces[a] + temp.markerJacobian(a, k) * markerForcesDerivative[a];
+					}
+					temp.markerJacobianDerivatives(k, i) = value;
+				}
+			}
+			ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure); //unperturbed marker data
+		}
+
+		connector->ComputeJacobianODE2_ODE2(temp.localJacobian, temp.localJacobian_t, temp.markerDataStructure);
+
+		if (addMarkerJacobianDerivatives && temp.localJacobian.NumberOfRows() == nLocalODE2 && temp.localJacobian.NumberOfColumns() == nLocalODE2)
+		{
+			for (Index k = 0; k < nLocalODE2; k++)
+			{
+				for (Index i = 0; i < nLocalODE2; i++)
+				{
+					temp.localJacobian(k, i) += temp.markerJacobianDerivatives(k, i);
+				}
+			}
+		}
+	}
+	else { return false; }
+
+	const ResizableMatrix& jacobian = velocityLevel ? temp.localJacobian_t : temp.localJacobian;
+	CHECKandTHROW(jacobian.NumberOfRows() == nLocalODE2 && jacobian.NumberOfColumns() == nLocalODE2,
+		"CSystem::ComputeObjectJacobianODE2: object jacobian has inconsistent size");
+	return true;
+}
+
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+//! compute local ODE2 LHS of object j and write it to the object's range in parallelAssemblyData.objectValues; thread safe, if every thread uses its own temp
+//! objects without contribution (inactive, constraints, ...) write zeros, which does not change the result of the gathered system vector
+inline void ComputeObjectODE2LHSparallel(CSystem& cSystem, TemporaryComputationData& myTemp, ParallelAssemblyData& parallelAssemblyData, Index j)
+{
+	CSystemData& cSystemData = cSystem.GetSystemData();
+	ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+	Index offset = parallelAssemblyData.objectOffsets[j];
+	Index nLocal = 0; //number of local values written
+
+	if (ltgODE2.NumberOfItems() && (cSystemData.GetCObjects()[j])->IsActive() &&
+		cSystem.ComputeObjectODE2LHS(myTemp, cSystemData.GetCObjects()[j], myTemp.localODE2RHS))
+	{
+		nLocal = EXUstd::Minimum(myTemp.localODE2RHS.NumberOfItems(), ltgODE2.NumberOfItems());
+		for (Index k = 0; k < nLocal; k++)
+		{
+			parallelAssemblyData.objectValues[offset + k] = myTemp.localODE2RHS[k];
+		}
+	}
+	for (Index k = nLocal; k < ltgODE2.NumberOfItems(); k++)
+	{
+		parallelAssemblyData.objectValues[offset + k] = 0.;
+	}
+}
+
+//! gather contributions of objects to system coordinate i; summation in order of objects, which gives results identical to serial assembly
+inline Real GatherODE2RHSparallel(const ParallelAssemblyData& parallelAssemblyData, Index i)
+{
+	Real value = 0.;
+	for (Index p = parallelAssemblyData.coordinateOffsets[i]; p < parallelAssemblyData.coordinateOffsets[i + 1]; p++)
+	{
+		value -= parallelAssemblyData.objectValues[parallelAssemblyData.contributions[p]]; //negative sign ==> stiffness/damping on LHS of equations
+	}
+	return value;
+}
+#endif
+
 #ifdef USE_OPENMP
 //! compute system right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
+//! race-free: objects write to separate ranges of parallelAssemblyData.objectValues, which are then gathered per coordinate
 void CSystem::ComputeSystemODE2RHS(TemporaryComputationData& temp, Vector& systemODE2Rhs)
 {
-	systemODE2Rhs.SetAll(0.);
-	//#pragma omp parallel num_threads(maxThreads)
-	//#pragma omp for
-	//#pragma omp parallel for num_threads(maxThreads)
+	CHECKandTHROW(parallelAssemblyData.coordinateOffsets.NumberOfItems() == systemODE2Rhs.NumberOfItems() + 1,
+		"CSystem::ComputeSystemODE2RHS: parallel assembly lists inconsistent; system must be assembled");
 
 	int nItems = (int)(cSystemData.GetCObjects().NumberOfItems());
 #pragma omp parallel num_threads(maxThreads)
 #pragma omp for 
 	for (int j = 0; j < nItems; j++)
 	{
-		TemporaryComputationData& myTemp = tempParallel[omp_get_thread_num()];
-		//std::cout << "compute ODE2 with thread " << omp_get_thread_num() << "\n";
-		if ((cSystemData.GetCObjects()[j])->IsActive())
-		{
-			//work over bodies, connectors, etc.
-			ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+		ComputeObjectODE2LHSparallel(*this, tempParallel[omp_get_thread_num()], parallelAssemblyData, (Index)j);
+	}
 
-			if (ltgODE2.NumberOfItems() && ComputeObjectODE2LHS(myTemp, cSystemData.GetCObjects()[j], myTemp.localODE2RHS))
-			{
-				//now add RHS to system vector
-				for (Index k = 0; k < myTemp.localODE2RHS.NumberOfItems(); k++)
-				{
-					systemODE2Rhs[ltgODE2[k]] -= myTemp.localODE2RHS[k]; //negative sign ==> stiffness/damping on LHS of equations
-				}
-			}
-		}
+	int nODE2 = (int)systemODE2Rhs.NumberOfItems();
+#pragma omp parallel num_threads(maxThreads)
+#pragma omp for 
+	for (int i = 0; i < nODE2; i++)
+	{
+		systemODE2Rhs[i] = GatherODE2RHSparallel(parallelAssemblyData, (Index)i);
 	}
 	//pout << "systemODE2Rhs=" << systemODE2Rhs << "\n";
 
@@ -1216,37 +1875,25 @@ void CSystem::ComputeSystemODE2RHS(TemporaryComputationData& temp, Vector& syste
 #elif defined(USE_NGSOLVE_TASKMANAGER)
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //! compute system right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
+//! race-free: objects write to separate ranges of parallelAssemblyData.objectValues, which are then gathered per coordinate
 void CSystem::ComputeSystemODE2RHS(TemporaryComputationData& temp, Vector& systemODE2Rhs)
 {
-	systemODE2Rhs.SetAll(0.);
+	CHECKandTHROW(parallelAssemblyData.coordinateOffsets.NumberOfItems() == systemODE2Rhs.NumberOfItems() + 1,
+		"CSystem::ComputeSystemODE2RHS: parallel assembly lists inconsistent; system must be assembled");
 
-	//std::mutex mtx;           // mutex for critical section
 	outputBuffer.SetSuspendWriting(true); //may not write to python during parallel computation
 
-	int nItems = cSystemData.GetCObjects().NumberOfItems();
-	ngstd::ParallelFor(nItems, [this, &systemODE2Rhs, &nItems](size_t j) //&temp,&systemODE2Rhs,&cSystemData
-	//for (Index j = 0; j < nItems; j++)
+	Index nItems = cSystemData.GetCObjects().NumberOfItems();
+	ngstd::ParallelFor(nItems, [this](size_t j)
 	{
 		Index threadID = ngstd::task_manager->GetThreadId();
+		ComputeObjectODE2LHSparallel(*this, tempParallel[threadID], parallelAssemblyData, (Index)j);
+	});
 
-		//std::cout << "thread=" << threadID << "\n";
-		//std::cout << "j=" << j << "\n";
-		TemporaryComputationData& myTemp = tempParallel[threadID];
-		//TemporaryComputationData& myTemp = temp;
-		if ((this->cSystemData.GetCObjects()[j])->IsActive())
-		{
-			//work over bodies, connectors, etc.
-			ArrayIndex& ltgODE2 = this->cSystemData.GetLocalToGlobalODE2()[j];
-
-			if (ltgODE2.NumberOfItems() && this->ComputeObjectODE2LHS(myTemp, cSystemData.GetCObjects()[j], myTemp.localODE2RHS))//temp.localODE2RHS))
-			{
-				//now add RHS to system vector
-				for (Index k = 0; k < myTemp.localODE2RHS.NumberOfItems(); k++)
-				{
-					systemODE2Rhs[ltgODE2[k]] -= myTemp.localODE2RHS[k]; //negative sign ==> stiffness/damping on LHS of equations
-				}
-			}
-		}
+	Index nODE2 = systemODE2Rhs.NumberOfItems();
+	ngstd::ParallelFor(nODE2, [this, &systemODE2Rhs](size_t i)
+	{
+		systemODE2Rhs[(Index)i] = GatherODE2RHSparallel(parallelAssemblyData, (Index)i);
 	});
 	//pout << "systemODE2Rhs=" << systemODE2Rhs << "\n";
 
@@ -1528,6 +2175,9 @@ Real CSystem::PostNewtonStep(TemporaryComputationData& temp)
 {
 	Real PNerror = 0;
 	PostNewtonFlags::Type postNewtonFlags;
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+	bool ltgListsChanged = false;
+#endif
 	//algebraic equations only origin from objects (e.g. Euler parameters) and constraints
 
 	for (Index objectIndex = 0; objectIndex < cSystemData.GetCObjects().NumberOfItems(); objectIndex++)
@@ -1541,6 +2191,8 @@ Real CSystem::PostNewtonStep(TemporaryComputationData& temp)
 
 			if (connector->HasDiscontinuousIteration())
 			{
+				//contact broad phase: contacts far from cable and not in contact do not change their state ==> skip gap computation
+				if (contactBroadPhase.candidatesValid && !contactBroadPhase.isCandidate[objectIndex] && !connector->IsActive()) { continue; }
 
 				const bool computeJacobian = true; //why needed for PostNewtonStep?==> check Issue #241
 				ComputeMarkerDataStructure(connector, computeJacobian, temp.markerDataStructure);
@@ -1552,12 +2204,19 @@ Real CSystem::PostNewtonStep(TemporaryComputationData& temp)
 					//now update specific ltg lists, if e.g. due to contact or switching the connectivity has changed
 					AssembleObjectLTGLists(objectIndex, cSystemData.GetLocalToGlobalODE2()[objectIndex], cSystemData.GetLocalToGlobalODE1()[objectIndex],
 						cSystemData.GetLocalToGlobalAE()[objectIndex], cSystemData.GetLocalToGlobalData()[objectIndex]);
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+					ltgListsChanged = true;
+#endif
+					columnColoringIsValid = false;
 
 					//pout << "Connector" << objectIndex << ", new LTGlist=" << cSystemData.GetLocalToGlobalODE2()[objectIndex] << "\n";
 				}
 			}
 		}
 	}
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+	if (ltgListsChanged) { AssembleParallelAssemblyLists(); }
+#endif
 	return PNerror;
 }
 
@@ -1586,6 +2245,94 @@ void CSystem::PostDiscontinuousIterationStep()
 //                          JACOBIANS
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
+//! compressed (Curtis-Powell-Reid) numerical differentiation: all columns of one color are perturbed together, such that the residual is evaluated only once per color;
+//! the differentiation parameter of column i is computed from sizeCoordinates[i] (+addCoordinates[i]) as in uncompressed differentiation;
+//! after evaluation of the perturbed residual by ComputeResidual(), AddColumn(i, 1/eps) is called for every column i of the color
+template<class TResidualFunction, class TAddColumnFunction>
+void CompressedNumericalDifferentiation(const ColumnColoringData& coloring, const NumericalDifferentiationSettings& numDiff,
+	Vector& x, const Vector& sizeCoordinates, const Vector* addCoordinates, TResidualFunction ComputeResidual, TAddColumnFunction AddColumn)
+{
+	Real relEps = numDiff.relativeEpsilon;			//relative differentiation parameter
+	Real minCoord = numDiff.minimumCoordinateSize;	//absolute differentiation parameter is limited to this minimum
+	ResizableVector xStore;	//store values of x; avoid roundoff error effects in numerical differentiation
+	ResizableVector epsInv;	//inverse differentiation parameters of columns of current color
+
+	for (Index c = 0; c < coloring.NumberOfColors(); c++)
+	{
+		Index start = coloring.colorOffsets[c];
+		Index nColumns = coloring.colorOffsets[c + 1] - start;
+		xStore.SetNumberOfItems(nColumns);
+		epsInv.SetNumberOfItems(nColumns);
+
+		for (Index k = 0; k < nColumns; k++)
+		{
+			Index i = coloring.colorColumns[start + k];
+			Real xAddVal = 0;
+			if (addCoordinates) { xAddVal = (*addCoordinates)[i]; }
+			Real eps = relEps * (EXUstd::Maximum(minCoord, fabs(sizeCoordinates[i] + xAddVal)));
+
+			xStore[k] = x[i];
+			x[i] += eps;
+			epsInv[k] = 1. / eps;
+		}
+
+		ComputeResidual();
+
+		for (Index k = 0; k < nColumns; k++)
+		{
+			x[coloring.colorColumns[start + k]] = xStore[k];
+		}
+		for (Index k = 0; k < nColumns; k++)
+		{
+			AddColumn(coloring.colorColumns[start + k], epsInv[k]);
+		}
+	}
+}
+
+//! compute system wide numerical jacobian of ODE2RHS w.r.t. ODE2 coordinates (velocityLevel=false) or ODE2 velocities (velocityLevel=true)
+//! using column compression; only entries of the sparsity pattern are added to jacobianGM; multiply the added entries with scalarFactor
+void CSystem::NumericalJacobianODE2RHScompressed(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+	Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel)
+{
+	if (!columnColoringIsValid) { ComputeColumnColorings(); }
+
+	Index nODE2 = cSystemData.GetNumberOfCoordinatesODE2();
+	CHECKandTHROW(coloringODE2.columnRowOffsets.NumberOfItems() == nODE2 + 1,
+		"CSystem::NumericalJacobianODE2RHScompressed: column coloring inconsistent; system must be assembled");
+
+	Vector& x = velocityLevel ? cSystemData.GetCData().currentState.ODE2Coords_t : cSystemData.GetCData().currentState.ODE2Coords;
+	const Vector* xRef = nullptr; //reference coordinates are only added to epsilon on position level
+	if (!velocityLevel && numDiff.addReferenceCoordinatesToEpsilon) { xRef = &(cSystemData.GetCData().referenceState.ODE2Coords); }
+
+	f0.SetNumberOfItems(nODE2);
+	f1.SetNumberOfItems(nODE2);
+	ComputeSystemODE2RHS(temp, f0); //compute nominal value for jacobian
+
+	ResizableMatrix& columnValues = temp.localJacobian;
+	ArrayIndex& rowIndices = temp.ltg;
+	ArrayIndex columnIndex;
+	columnIndex.SetNumberOfItems(1);
+
+	CompressedNumericalDifferentiation(coloringODE2, numDiff, x, x, xRef,
+		[&]() { ComputeSystemODE2RHS(temp, f1); },
+		[&](Index i, Real epsInv)
+		{
+			epsInv *= scalarFactor;
+			Index rowStart = coloringODE2.columnRowOffsets[i];
+			Index nRows = coloringODE2.columnRowOffsets[i + 1] - rowStart;
+			columnValues.SetNumberOfRowsAndColumns(nRows, 1);
+			rowIndices.SetNumberOfItems(nRows);
+			for (Index k = 0; k < nRows; k++)
+			{
+				Index row = coloringODE2.columnRows[rowStart + k];
+				rowIndices[k] = row;
+				columnValues(k, 0) = (f1[row] - f0[row]) * epsInv;
+			}
+			columnIndex[0] = i;
+			jacobianGM.AddSubmatrix(columnValues, 1., rowIndices, columnIndex);
+		});
+}
+
 //! compute numerical differentiation of ODE2RHS; result is a jacobian;  multiply the added entries with scalarFactor
 //template<class TGeneralMatrix>
 void CSystem::NumericalJacobianODE2RHS(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
@@ -1606,6 +2353,9 @@ void CSystem::NumericalJacobianODE2RHS(TemporaryComputationData& temp, const Num
 
 	if (!numDiff.doSystemWideDifferentiation)
 	{
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+		NumericalJacobianODE2RHSparallel(numDiff, jacobianGM, scalarFactor, false);
+#else
 		//GeneralMatrixEXUdense mat;
 		//if (jacobianGM.GetSystemMatrixType() != LinearSolverType::EXUdense) { CHECKandTHROWstring("CSystem::NumericalJacobianODE2RHS: illegal LinearSolverType!"); }
 		//ResizableMatrix& jacobian = jacobianGM.GetMatrixEXUdense();
@@ -1631,17 +2381,11 @@ void CSystem::NumericalJacobianODE2RHS(TemporaryComputationData& temp, const Num
 
 			if (object->IsActive() && ltgODE2.NumberOfItems())
 			{
-#ifdef USE_AUTODIFF
-				if (object->GetAvailableJacobians() & (JacobianType::ODE2_ODE2_function))
+				if (numDiff.useAnalyticJacobians && ComputeObjectJacobianODE2(temp, numDiff, j, false))
 				{
-					localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					temp.localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					object->ComputeJacobianODE2_ODE2(localJacobian, temp.localJacobian_t);
-					jacobianGM.AddSubmatrix(localJacobian, -1., ltgODE2, ltgODE2); //-1. because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
+					jacobianGM.AddSubmatrix(temp.localJacobian, -scalarFactor, ltgODE2, ltgODE2); //negative sign, because object ODE2LHS is subtracted from global RHS-vector (see numerical differentiation)
 				}
-				else 
-#endif
-				if (ComputeObjectODE2LHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+				else if (ComputeObjectODE2LHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
 				{
 					localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
 					Real xRefVal = 0;
@@ -1669,6 +2413,11 @@ void CSystem::NumericalJacobianODE2RHS(TemporaryComputationData& temp, const Num
 				}
 			}
 		}
+#endif
+	}
+	else if (numDiff.useColumnCompression)
+	{
+		NumericalJacobianODE2RHScompressed(temp, numDiff, f0, f1, jacobianGM, scalarFactor, false);
 	}
 	else
 	{
@@ -1716,6 +2465,9 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 
 	if (!numDiff.doSystemWideDifferentiation)
 	{
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+		NumericalJacobianODE2RHSparallel(numDiff, jacobianGM, scalarFactor, true);
+#else
 		//size already set by solver: jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
 
 		ResizableMatrix& localJacobian_t = temp.localJacobian_t;
@@ -1733,17 +2485,11 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 
 			if (object->IsActive() && ltgODE2.NumberOfItems())
 			{
-#ifdef USE_AUTODIFF
-				if (object->GetAvailableJacobians() & (JacobianType::ODE2_ODE2_t_function))
+				if (numDiff.useAnalyticJacobians && ComputeObjectJacobianODE2(temp, numDiff, j, true))
 				{
-					//temp.localJacobian.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					//localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
-					//object->ComputeJacobianODE2_ODE2(temp.localJacobian, localJacobian_t);
-					//jacobianGM.AddSubmatrix(localJacobian_t, -1., ltgODE2, ltgODE2);//-1. because in numerical mode, f0-f1 leads to negative sign (RHS ==> LHS)
+					jacobianGM.AddSubmatrix(temp.localJacobian_t, -scalarFactor, ltgODE2, ltgODE2); //negative sign, because object ODE2LHS is subtracted from global RHS-vector (see numerical differentiation)
 				}
-				else
-#endif
-				if (ComputeObjectODE2LHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+				else if (ComputeObjectODE2LHS(temp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
 				{
 					localJacobian_t.SetNumberOfRowsAndColumns(nLocalODE2, nLocalODE2); //needs not to be initialized, because the matrix is fully computed and then added to jacobianGM
 					for (Index i = 0; i < nLocalODE2; i++) //differentiate w.r.t. every ltgODE2 coordinate
@@ -1768,7 +2514,11 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 				}
 			}
 		}
-
+#endif
+	}
+	else if (numDiff.useColumnCompression)
+	{
+		NumericalJacobianODE2RHScompressed(temp, numDiff, f0, f1, jacobianGM, scalarFactor, true);
 	}
 	else
 	{
@@ -1802,6 +2552,127 @@ void CSystem::NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const N
 	//pout << "ODE2jac_t=" << jacobian << "\n";
 }
 
+#if defined(USE_NGSOLVE_TASKMANAGER) || defined(USE_OPENMP)
+//! compute local jacobian of object j (numerical differentiation or jacobian function) and store it in parallelAssemblyData.jacobianValues;
+//! objects with same color can be processed concurrently, because they do not share the perturbed coordinates
+inline void ComputeObjectJacobianODE2parallel(CSystem& cSystem, TemporaryComputationData& myTemp, ParallelAssemblyData& parallelAssemblyData,
+	const NumericalDifferentiationSettings& numDiff, Real scalarFactor, bool velocityLevel, Index j)
+{
+	CSystemData& cSystemData = cSystem.GetSystemData();
+	const ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+	Index nLocalODE2 = ltgODE2.NumberOfItems();
+	CObject* object = cSystemData.GetCObjects()[j];
+	parallelAssemblyData.jacobianAvailable[j] = 0;
+
+	if (!object->IsActive()) { return; }
+
+	//local jacobian is directly written to jacobianValues (row-major):
+	LinkedDataMatrix localJacobian(parallelAssemblyData.jacobianValues.GetDataPointer() + parallelAssemblyData.jacobianOffsets[j], nLocalODE2, nLocalODE2);
+
+	Real relEps = numDiff.relativeEpsilon;			//relative differentiation parameter
+	Real minCoord = numDiff.minimumCoordinateSize;	//absolute differentiation parameter is limited to this minimum
+	Real eps, epsInv; //coordinate(column)-wise differentiation parameter; depends on size of coordinate
+	Vector& x = velocityLevel ? cSystemData.GetCData().currentState.ODE2Coords_t : cSystemData.GetCData().currentState.ODE2Coords;
+	const Vector& xRef = cSystemData.GetCData().referenceState.ODE2Coords;	//reference coordinates; only for ODE2 coordinates
+	bool addReferenceCoordinates = numDiff.addReferenceCoordinatesToEpsilon && !velocityLevel;
+	Real xStore; //store value of x; avoid roundoff error effects in numerical differentiation
+
+	Vector& f0 = myTemp.numericalJacobianf0;
+	Vector& f1 = myTemp.numericalJacobianf1;
+	f0.SetNumberOfItems(nLocalODE2);
+	f1.SetNumberOfItems(nLocalODE2);
+
+	if (numDiff.useAnalyticJacobians && cSystem.ComputeObjectJacobianODE2(myTemp, numDiff, j, velocityLevel))
+	{
+		const ResizableMatrix& analyticJacobian = velocityLevel ? myTemp.localJacobian_t : myTemp.localJacobian;
+		for (Index k = 0; k < nLocalODE2; k++)
+		{
+			for (Index i = 0; i < nLocalODE2; i++)
+			{
+				localJacobian(k, i) = -scalarFactor * analyticJacobian(k, i); //negative sign, because object ODE2LHS is subtracted from global RHS-vector (see numerical differentiation)
+			}
+		}
+		parallelAssemblyData.jacobianAvailable[j] = 1;
+	}
+	else if (cSystem.ComputeObjectODE2LHS(myTemp, object, f0)) //check if it is a constraint, etc. which is not differentiated for ODE2 jacobian
+	{
+		Real xRefVal = 0;
+		for (Index i = 0; i < nLocalODE2; i++) //differentiate w.r.t. every ltgODE2 coordinate
+		{
+			Real& xVal = x[ltgODE2[i]];
+			if (addReferenceCoordinates) { xRefVal = xRef[ltgODE2[i]]; }
+
+			eps = relEps * (EXUstd::Maximum(minCoord, fabs(xVal + xRefVal)));
+
+			xStore = xVal;
+			xVal += eps;
+			cSystem.ComputeObjectODE2LHS(myTemp, object, f1);
+			xVal = xStore;
+
+			epsInv = (1. / eps) * scalarFactor;
+
+			for (Index k = 0; k < nLocalODE2; k++)
+			{
+				localJacobian(k, i) = epsInv * (f0[k] - f1[k]); //-(f1-f0) == (f0-f1): negative sign, because object ODE2RHS is subtracted from global RHS-vector
+			}
+		}
+		parallelAssemblyData.jacobianAvailable[j] = 1;
+	}
+}
+
+//! compute numerically the local (object-wise) jacobians of ODE2RHS in parallel (multithreaded computation) and ADD them to jacobianGM in object order;
+//! objects are processed color by color (objects of one color do not share coordinates), local jacobians are stored per object and
+//! afterwards added to jacobianGM in the same order as in serial computation, which gives identical results
+void CSystem::NumericalJacobianODE2RHSparallel(const NumericalDifferentiationSettings& numDiff, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel)
+{
+	Index nObjects = cSystemData.GetCObjects().NumberOfItems();
+	CHECKandTHROW(parallelAssemblyData.jacobianOffsets.NumberOfItems() == nObjects + 1,
+		"CSystem::NumericalJacobianODE2RHSparallel: parallel assembly lists inconsistent; system must be assembled");
+
+	parallelAssemblyData.jacobianValues.SetNumberOfItems(parallelAssemblyData.jacobianOffsets[nObjects]); //memory only allocated in first call
+	parallelAssemblyData.jacobianAvailable.SetAll(0);
+
+#ifdef USE_NGSOLVE_TASKMANAGER
+	outputBuffer.SetSuspendWriting(true); //may not write to python during parallel computation
+#endif
+	for (Index color = 0; color + 1 < parallelAssemblyData.colorOffsets.NumberOfItems(); color++)
+	{
+		Index start = parallelAssemblyData.colorOffsets[color];
+		Index nColorObjects = parallelAssemblyData.colorOffsets[color + 1] - start;
+#ifdef USE_OPENMP
+#pragma omp parallel for num_threads(maxThreads)
+		for (int k = 0; k < (int)nColorObjects; k++)
+		{
+			ComputeObjectJacobianODE2parallel(*this, tempParallel[omp_get_thread_num()], parallelAssemblyData, numDiff, scalarFactor, velocityLevel,
+				parallelAssemblyData.colorObjects[start + (Index)k]);
+		}
+#else
+		ngstd::ParallelFor(nColorObjects, [this, &numDiff, scalarFactor, velocityLevel, start](size_t k)
+		{
+			Index threadID = ngstd::task_manager->GetThreadId();
+			ComputeObjectJacobianODE2parallel(*this, tempParallel[threadID], parallelAssemblyData, numDiff, scalarFactor, velocityLevel,
+				parallelAssemblyData.colorObjects[start + (Index)k]);
+		});
+#endif
+	}
+#ifdef USE_NGSOLVE_TASKMANAGER
+	outputBuffer.SetSuspendWriting(false);
+#endif
+
+	//add local jacobians in object order:
+	for (Index j = 0; j < nObjects; j++)
+	{
+		if (parallelAssemblyData.jacobianAvailable[j])
+		{
+			const ArrayIndex& ltgODE2 = cSystemData.GetLocalToGlobalODE2()[j];
+			Index nLocalODE2 = ltgODE2.NumberOfItems();
+			LinkedDataMatrix localJacobian(parallelAssemblyData.jacobianValues.GetDataPointer() + parallelAssemblyData.jacobianOffsets[j], nLocalODE2, nLocalODE2);
+			jacobianGM.AddSubmatrix(localJacobian, 1., ltgODE2, ltgODE2);
+		}
+	}
+}
+#endif
+
 //! numerical computation of constraint jacobian with respect to ODE2 and ODE1 (fillIntoSystemMatrix=true: also w.r.t. AE) coordinates
 //! factorODE2 is used to scale the ODE2-part of the jacobian (to avoid postmultiplication); 
 //! velocityLevel = velocityLevel constraints are used, if available; 
@@ -1836,6 +2707,83 @@ void CSystem::NumericalJacobianAE(TemporaryComputationData& temp, const Numerica
 
 	ComputeAlgebraicEquations(temp, f0, velocityLevel); //compute nominal value for jacobian
 
+	if (numDiff.useColumnCompression)
+	{
+		//compressed differentiation only computes entries of the sparsity pattern; other entries are zero as in uncompressed differentiation:
+		if (!columnColoringIsValid) { ComputeColumnColorings(); }
+		CHECKandTHROW(coloringAE_ODE2.columnRowOffsets.NumberOfItems() == nODE2 + 1 && coloringAE_AE.columnRowOffsets.NumberOfItems() == nAE + 1,
+			"CSystem::NumericalJacobianAE: column coloring inconsistent; system must be assembled");
+
+		for (Index i = 0; i < nODE2; i++)
+		{
+			for (Index j = 0; j < nAE; j++)
+			{
+				if (fillIntoSystemMatrix)
+				{
+					jacobian(nODE2 + j, i) = 0.;
+					jacobian(i, nODE2 + j) = 0.;
+				}
+				else { jacobian(j, i) = 0.; }
+			}
+		}
+
+		auto ComputeResidual = [&]() { ComputeAlgebraicEquations(temp, f1, velocityLevel); };
+
+		//differentiation w.r.t. ODE2 coordinates
+		CompressedNumericalDifferentiation(coloringAE_ODE2, numDiff, x, x, nullptr, ComputeResidual,
+			[&](Index i, Real epsInv)
+			{
+				for (Index p = coloringAE_ODE2.columnRowOffsets[i]; p < coloringAE_ODE2.columnRowOffsets[i + 1]; p++)
+				{
+					Index j = coloringAE_ODE2.columnRows[p];
+					Real value = epsInv * (f1[j] - f0[j]);
+					if (fillIntoSystemMatrix)
+					{
+						jacobian(nODE2 + j, i) = factorAE_ODE2 * value;
+						jacobian(i, nODE2 + j) = value;
+					}
+					else { jacobian(j, i) = value; }
+				}
+			});
+
+		//differentiation w.r.t. ODE2_t coordinates; differentiation parameter computed from ODE2 coordinates as in uncompressed differentiation
+		CompressedNumericalDifferentiation(coloringAE_ODE2, numDiff, x_t, x, nullptr, ComputeResidual,
+			[&](Index i, Real epsInv)
+			{
+				for (Index p = coloringAE_ODE2.columnRowOffsets[i]; p < coloringAE_ODE2.columnRowOffsets[i + 1]; p++)
+				{
+					Index j = coloringAE_ODE2.columnRows[p];
+					Real value = epsInv * (f1[j] - f0[j]);
+					if (fillIntoSystemMatrix)
+					{
+						jacobian(nODE2 + j, i) += factorAE_ODE2_t * value;
+						jacobian(i, nODE2 + j) += value;
+					}
+					else { jacobian(j, i) += value; }
+				}
+			});
+
+		//differentiation w.r.t. AE coordinates
+		if (fillIntoSystemMatrix)
+		{
+			for (Index i = 0; i < nAE; i++)
+			{
+				for (Index j = 0; j < nAE; j++) { jacobian(nODE2 + j, nODE2 + i) = 0.; }
+			}
+
+			CompressedNumericalDifferentiation(coloringAE_AE, numDiff, z, z, nullptr, ComputeResidual,
+				[&](Index i, Real epsInv)
+				{
+					for (Index p = coloringAE_AE.columnRowOffsets[i]; p < coloringAE_AE.columnRowOffsets[i + 1]; p++)
+					{
+						Index j = coloringAE_AE.columnRows[p];
+						jacobian(nODE2 + j, nODE2 + i) = epsInv * (f1[j] - f0[j]);
+					}
+				});
+		}
+		return;
+	}
+
 	//differentiation w.r.t. ODE2 coordinates
 	for (Index i = 0; i < nODE2; i++)
 	{
@@ -2336,30 +3284,26 @@ void CSystem::ComputeConstraintJacobianTimesVector(TemporaryComputationData& tem
 //! this function is used to copy the current state to the visualization state and to send a signal that the PostProcessData has been updated
 void CSystem::UpdatePostProcessData(bool recordImage)
 {
-	Index timeOut = 1000;		 //max iterations to wait, before frame is redrawn and saved
-	Index timerMilliseconds = 2; //this is a hard-coded value, as visualizationSettings are not available here ...
+	//visualization state is triple-buffered: current state is copied into back buffer and published without locking the renderer
+	CData& cData = GetSystemData().GetCData();
+	cData.PublishVisualizationState(cData.currentState, postProcessData.visualizationIsRunning); //copy current (computation step result) to post process state
 
-	Index i = 0;
-	//wait with new update until last image recording has been finished
-	while (i++ < timeOut && (postProcessData.recordImageCounter == postProcessData.updateCounter))
+	if (recordImage && postProcessData.visualizationIsRunning)
 	{
-		std::this_thread::sleep_for(std::chrono::milliseconds(timerMilliseconds));
-	}
-
-	if (postProcessData.recordImageCounter == postProcessData.updateCounter)
-	{
-		PyWarning("CSystem::UpdatePostProcessData:: timeout for record image; try to decrease scene complexity");
+		//states to be recorded are queued for the renderer; only if queue is full, computation waits (bounded) for the renderer, otherwise frame is dropped
+		const Index recordImageQueueSize = 16;	 //hard-coded values, as visualizationSettings are not available here ...
+		const Index recordImageTimeOut = 2000;	 //milliseconds
+		if (!cData.QueueVisualizationRecordState(cData.currentState, recordImageQueueSize, recordImageTimeOut))
+		{
+			if (postProcessData.numberOfDroppedImages++ == 0)
+			{
+				PyWarning("CSystem::UpdatePostProcessData: renderer did not record images in time, image at time " + EXUstd::ToString(cData.currentState.GetTime()) + 
+					" is dropped (further dropped images are only counted); try to decrease scene complexity or increase recordImagesInterval");
+			}
+		}
 	}
-
-	//use semaphores, because the postProcessData.state is also accessed from the visualization thread
-	postProcessData.accessState.test_and_set(std::memory_order_acquire); //lock PostProcessData
-
-	postProcessData.updateCounter++;
 	postProcessData.postProcessDataReady = true;
-	if (recordImage) { postProcessData.recordImageCounter = postProcessData.updateCounter; } //this is the condition to record an image
-
-	GetSystemData().GetCData().visualizationState = GetSystemData().GetCData().currentState; //copy current (computation step result) to post process state
-	postProcessData.accessState.clear(std::memory_order_release); //clear PostProcessData
+	postProcessData.updateCounter++;
 }
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
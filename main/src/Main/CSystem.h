@@ -56,6 +56,84 @@ public:
 	ArrayIndex ltg;						//!< local to global coordinate mapping; ArrayIndex is also resizable
 
 	MarkerDataStructure markerDataStructure;
+
+	ResizableVector markerForces;				//!< connector forces and torques at markers, used for derivatives of marker jacobians
+	ResizableMatrix markerForcesJacobian_t;		//!< derivative of markerForces w.r.t. marker velocities and angular velocities
+	ResizableMatrix markerJacobian;				//!< position and rotation jacobians of connector markers
+	ResizableMatrix markerJacobianPerturbed;	//!< markerJacobian for perturbed coordinates
+	ResizableVector markerVelocities;			//!< velocities and angular velocities of connector markers
+	ResizableVector markerVelocitiesPerturbed;	//!< markerVelocities for perturbed coordinates
+	ResizableMatrix markerJacobianDerivatives;	//!< jacobian terms due to derivatives of marker jacobians
+};
+
+//! @brief data for race-free and deterministic parallel assembly of the system ODE2 RHS (multithreaded computation)
+//! local object vectors are computed in parallel into objectValues (each object writes to its own range);
+//! afterwards, every system coordinate gathers its contributions in the order of objects, which gives the same summation order as the serial assembly
+//! for parallel numerical differentiation, objects are colored such that objects with same color do not share ODE2 coordinates; local jacobians are added to the system jacobian in object order
+//! lists are built in CSystem::AssembleLTGLists(...) and updated, if LTG lists change (e.g. in PostNewtonStep)
+class ParallelAssemblyData
+{
+public:
+	ArrayIndex objectOffsets;		//!< offset of object j in objectValues; objectOffsets[numberOfObjects] = total number of local coordinates
+	ArrayIndex coordinateOffsets;	//!< compressed storage: contributions to system coordinate i are stored in contributions[coordinateOffsets[i]] ... contributions[coordinateOffsets[i+1]-1]
+	ArrayIndex contributions;		//!< indices into objectValues, sorted by system coordinate and, for every coordinate, by object index
+	ResizableVector objectValues;	//!< local ODE2 LHS vectors of all objects, written during parallel computation
+
+	ArrayIndex colorOffsets;		//!< compressed storage: objects of color c are colorObjects[colorOffsets[c]] ... colorObjects[colorOffsets[c+1]-1]
+	ArrayIndex colorObjects;		//!< objects with ODE2 coordinates, sorted by color and, for every color, by object index
+	ArrayIndex jacobianOffsets;		//!< offset of local (nLocal x nLocal) jacobian of object j in jacobianValues; jacobianOffsets[numberOfObjects] = total size
+	ArrayIndex jacobianAvailable;	//!< 1, if local jacobian of object j has been computed in last parallel jacobian computation, 0 otherwise
+	ResizableVector jacobianValues;	//!< local jacobians of all objects (row-major), computed in parallel; memory is only allocated in jacobian computation
+};
+
+//! @brief column coloring for compressed (Curtis-Powell-Reid) system wide numerical differentiation
+//! columns of same color are structurally orthogonal (they do not share rows); thus they can be perturbed together with one residual evaluation
+//! the sparsity pattern is obtained from the LTG lists; colorings are computed in CSystem::ComputeColumnColorings() after every change of LTG lists
+class ColumnColoringData
+{
+public:
+	ArrayIndex columnRowOffsets;	//!< compressed storage: rows of column i (sorted) are columnRows[columnRowOffsets[i]] ... columnRows[columnRowOffsets[i+1]-1]
+	ArrayIndex columnRows;			//!< row indices of nonzero entries in every column
+	ArrayIndex colorOffsets;		//!< compressed storage: columns of color c are colorColumns[colorOffsets[c]] ... colorColumns[colorOffsets[c+1]-1]
+	ArrayIndex colorColumns;		//!< columns, sorted by color and, for every color, by column index
+
+	//! number of colors = number of residual evaluations needed for one jacobian
+	Index NumberOfColors() const { return EXUstd::Maximum(colorOffsets.NumberOfItems() - 1, (Index)0); }
+};
+
+//! bounding box of circle or cable marker in sweep-and-prune of contact broad phase
+struct ContactBroadPhaseBox
+{
+	Index markerNumber;		//!< marker, whose box is stored in ContactBroadPhaseData::markerBoxes
+	bool isCircle;			//!< true: circle marker, false: cable shape marker
+};
+
+//! @brief data for contact broad phase of circle-cable contacts (NewtonSettings.useContactBroadPhase)
+//! once per step, bounding boxes of all circle markers and cable shape markers are computed (once per marker, even if the marker is used by several contacts)
+//! and overlapping circle-cable box pairs are found by one sweep-and-prune along the x-axis; only contacts of overlapping pairs become candidates;
+//! contacts which are no candidates and which are not in contact are skipped in PostNewtonStep, such that the gap functions (narrow phase) are only evaluated for candidates
+class ContactBroadPhaseData
+{
+public:
+	bool candidatesValid;				//!< true, if isCandidate has been updated by CSystem::UpdateContactCandidates(...) for the current step
+	ArrayIndex contactObjects;			//!< object numbers of connectors with GetContactCircleRadius(...) = true; built in CSystem::AssembleContactBroadPhase()
+	ArrayIndex firstContactOfCableMarker;	//!< per marker: index in contactObjects of first contact using marker as cable marker, or -1; built in CSystem::AssembleContactBroadPhase()
+	ArrayIndex nextContactOfCableMarker;	//!< per index in contactObjects: index of next contact with same cable marker, or -1
+	ResizableArray<bool> isCandidate;	//!< per object: false, if object is a contact whose circle box does not overlap with the box of the cable
+	ResizableArray<Vector4D> markerBoxes;	//!< per marker: bounding box [xMin, xMax, yMin, yMax] of circle or cable segment points, including margin for motion within step
+	ResizableArray<bool> markerBoxComputed;	//!< per marker: true, if bounding box has been computed in current update
+	ResizableArray<ContactBroadPhaseBox> sweepBoxes;	//!< boxes of all markers in contacts, sorted by xMin for sweep-and-prune
+	ResizableArray<ContactBroadPhaseBox> activeBoxes;	//!< boxes overlapping with current sweep position
+
+	ContactBroadPhaseData() : candidatesValid(false) {}
+
+	//! number of contacts, which are candidates for narrow phase in current step
+	Index NumberOfCandidates() const
+	{
+		Index n = 0;
+		for (Index objectIndex : contactObjects) { if (isCandidate[objectIndex]) { n++; } }
+		return n;
+	}
 };
 
 class VisualizationSystem; //for backlink to VisualizationSystem for PythonUserFunctions for drawing
@@ -72,7 +150,7 @@ public:
 	std::atomic_flag accessState;		//!< flag, which is locked / released to access data
 	bool postProcessDataReady;			//!< signals, that data can be plotted (CSystem must be consistent, state is a current state of the CSystem, ...); usually same as CSystem::systemIsConsistent
 	uint64_t updateCounter;				//!< updateCounter is increased upon every update of state; can be used to judge graphics update; for 1 billion steps/second counter goes for 585 years before overflow
-	uint64_t recordImageCounter;				//!< updateCounter is increased upon every update of state; can be used to judge graphics update; for 1 billion steps/second counter goes for 585 years before overflow
+	Index numberOfDroppedImages;		//!< number of images requested by solver, which could not be recorded because the renderer was too slow
 	bool simulationFinished;			//!< shows that computation has been finished ==> visualize last step
 	bool stopSimulation;				//!< renderer or GUI sends signal that simulation shall be interrupted
 	bool simulationPaused;				//!< true: simulation sends renderer or GUI that simulation is paused, waiting for user-input (SPACE)
@@ -87,8 +165,8 @@ public:
 		visualizationTime = 0;
 		simulationFinished = false;
 		stopSimulation = false;
-		updateCounter = 1;				// must be larger than recordImageCounter, in order to avoid hang up in first UpdatePostProcessData(...) in CSystem
-		recordImageCounter = 0;
+		updateCounter = 1;
+		numberOfDroppedImages = 0;
 		postProcessDataReady = false;
 		visualizationIsRunning = false; 
 	}
@@ -172,6 +250,12 @@ protected:
 	PostProcessData postProcessData;	//!< data needed for post-processing
 	SolverData solverData;				//!< data updated by specific solvers 
 	PythonUserFunctions pythonUserFunctions; //!< user functions and MainSystem
+	ParallelAssemblyData parallelAssemblyData; //!< lists for race-free parallel assembly of ODE2 RHS; only used for multithreaded computation
+	ColumnColoringData coloringODE2;		//!< column coloring of ODE2 jacobian (ODE2 rows, ODE2 columns); used for ODE2 and ODE2_t columns
+	ColumnColoringData coloringAE_ODE2;		//!< column coloring of AE jacobian w.r.t. ODE2 (AE rows, ODE2 columns); used for ODE2 and ODE2_t columns
+	ColumnColoringData coloringAE_AE;		//!< column coloring of AE jacobian w.r.t. AE (AE rows, AE columns)
+	bool columnColoringIsValid;				//!< false, if LTG lists changed and colorings need to be recomputed
+	ContactBroadPhaseData contactBroadPhase;	//!< bounding boxes and candidates of circle-cable contacts; only used if NewtonSettings.useContactBroadPhase = true
 
 	bool systemIsConsistent;				//!< variable is set after check of system consistency ==> in order to draw or compute system; usually set after Assemble()
 
@@ -223,6 +307,8 @@ public:
 	void Initialize() 
 	{
 		SetSystemIsConsistent(false);
+		columnColoringIsValid = false;
+		contactBroadPhase.candidatesValid = false;
 		postProcessData.postProcessDataReady = false;
 		postProcessData.simulationFinished = false;
 
@@ -252,6 +338,25 @@ public:
 	//! build ltg-coordinate lists for objects (used to build global ODE2RHS, MassMatrix, etc. vectors and matrices)
 	void AssembleLTGLists(const MainSystem& mainSystem);
 
+	//! build lists (offsets, coordinate-wise contributions) for race-free parallel assembly of ODE2 RHS from ltgODE2 lists; must be called after every change of ltg lists
+	void AssembleParallelAssemblyLists();
+
+	//! compute column colorings for compressed system wide numerical differentiation (ODE2 and AE jacobians) from ltg lists; called on demand if columnColoringIsValid=false
+	void ComputeColumnColorings();
+
+	//! build list of circle-cable contacts for contact broad phase; called in AssembleLTGLists(...)
+	void AssembleContactBroadPhase();
+
+	//! contact broad phase: update candidates of circle-cable contacts for the next step, using bounding boxes enlarged by margin and twice the distance travelled with current velocities within stepSize;
+	//! called once per step at beginning of discontinuous iterations
+	void UpdateContactCandidates(TemporaryComputationData& temp, Real stepSize, Real margin);
+
+	//! deactivate contact broad phase; all contacts are evaluated in PostNewtonStep
+	void ClearContactCandidates() { contactBroadPhase.candidatesValid = false; }
+
+	//! return contact broad phase data (e.g. for statistics)
+	const ContactBroadPhaseData& GetContactBroadPhaseData() const { return contactBroadPhase; }
+
 	////! NEEDED? prepare LinkedDataVectors for objects
 	//void AssembleObjects();
 
@@ -265,8 +370,15 @@ public:
 	virtual void ComputeMassMatrix(TemporaryComputationData& temp, GeneralMatrix& massMatrix);
 	//virtual void ComputeMassMatrixOLD(TemporaryComputationData& temp, Matrix& massMatrix);
 
+	//! return true, if all bodies with ODE2 coordinates have a constant mass matrix; in this case, the system mass matrix needs to be computed only once
+	virtual bool HasConstantMassMatrix() const;
+
 	//! compute left-hand-side (LHS) of second order ordinary differential equations (ODE) for every object (used in numerical differentiation and in RHS computation); return true, if object has localODE2Rhs, false otherwise
 	virtual bool ComputeObjectODE2LHS(TemporaryComputationData& temp, CObject* object, Vector& localODE2Rhs);
+
+	//! compute local jacobian of object ODE2 LHS analytically w.r.t. ODE2 coordinates (velocityLevel=false; stored in temp.localJacobian) or w.r.t. ODE2 velocities (velocityLevel=true; stored in temp.localJacobian_t),
+	//! if the object provides the according jacobian function (GetAvailableJacobians()); returns false, if the jacobian needs to be computed numerically
+	virtual bool ComputeObjectJacobianODE2(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff, Index objectNumber, bool velocityLevel);
 		
 	//! compute system right-hand-side (RHS) of second order ordinary differential equations (ODE) to 'ode2rhs' for ODE2 part
 	virtual void ComputeSystemODE2RHS(TemporaryComputationData& temp, Vector& systemODE2Rhs);
@@ -311,6 +423,15 @@ public:
 	//void NumericalJacobianODE2RHS(TemporaryComputationData& temp, const NumericalDifferentiation& numDiff,
 	//	Vector& f0, Vector& f1, TGeneralMatrix& jacobianGM); // ResizableMatrix& jacobian);
 
+	//! compute numerically the local (object-wise) jacobians of ODE2RHS in parallel (multithreaded computation) and ADD them to jacobianGM in object order;
+	//! velocityLevel=false: jacobian w.r.t. ODE2 coordinates, velocityLevel=true: w.r.t. ODE2 velocity coordinates
+	void NumericalJacobianODE2RHSparallel(const NumericalDifferentiationSettings& numDiff, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel);
+
+	//! compute system wide numerical jacobian of ODE2RHS w.r.t. ODE2 coordinates (velocityLevel=false) or velocities (velocityLevel=true), using column compression (coloringODE2);
+	//! only entries of the sparsity pattern are ADDed to jacobianGM; multiply the added entries with scalarFactor
+	void NumericalJacobianODE2RHScompressed(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
+		Vector& f0, Vector& f1, GeneralMatrix& jacobianGM, Real scalarFactor, bool velocityLevel);
+
 	//! compute numerical differentiation of ODE2RHS with respect to velocity coordinates; result is a jacobian; multiply the added entries with scalarFactor
 	//! the jacobian is ADDed to the given matrix, which needs to have according size; set entries to zero beforehand in order to obtain only the jacobian
 	void NumericalJacobianODE2RHS_t(TemporaryComputationData& temp, const NumericalDifferentiationSettings& numDiff,
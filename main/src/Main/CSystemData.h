@@ -31,6 +31,21 @@
 #include "System/CSensor.h"				//needs sensors
 #include "System/CObjectConnector.h"	//includes OutputVariable.h and CObject.h
 
+#include <memory>
+
+class CSystemData;
+
+//! shared by CSystemData and all views on its state vectors (MainSystemStateView); numpy arrays linked to a view keep the view and thus the anchor alive;
+//! when state vectors are replaced while views exist, the anchor is detached from the system data and keeps the replaced state vectors until the last view is deleted
+class CSystemStateViewAnchor
+{
+public:
+	CSystemData* systemData;					//!< system data owning the state vectors; nullptr after anchor has been detached
+	STDstring detachReason;						//!< reason for detaching anchor, used in error messages of views
+	std::list<CSystemState> retainedStates;		//!< state vectors replaced while views existed; memory may still be linked by numpy arrays
+
+	CSystemStateViewAnchor(CSystemData* systemDataInit) : systemData(systemDataInit) {}
+};
 
 
 
@@ -52,21 +67,34 @@ protected: //
 	Index numberOfCoordinatesODE1;                  //!< global number of ODE1 coordinates (sum of all node ODE1 coordinates); must be synchronous to NumberOfItems in SystemState Vectors
 	Index numberOfCoordinatesAE;                    //!< global number of AE coordinates (sum of all node AE coordinates); must be synchronous to NumberOfItems in SystemState Vectors
 	Index numberOfCoordinatesData;                  //!< global number of Data variables/coordinates (sum of all node Data variables); must be synchronous to NumberOfItems in SystemState Vectors
+	Index stateVersion;                             //!< increased whenever system state vectors may be reallocated or change their layout (Assemble, Reset); used to invalidate views on state vectors
+	Index objectParametersVersion;                  //!< increased whenever object parameters are changed via MainSystem (SetObjectParameter, ModifyObject, parameter handles); used to invalidate constant system mass matrix
+	std::shared_ptr<CSystemStateViewAnchor> stateViewAnchor; //!< shared with views on state vectors; keeps replaced state vectors alive as long as views exist
 
 public: //
 
 	bool isODE2RHSjacobianComputation;
 
+	CSystemData() : numberOfCoordinatesODE2(0), numberOfCoordinatesODE1(0), numberOfCoordinatesAE(0), numberOfCoordinatesData(0),
+		stateVersion(0), objectParametersVersion(0), stateViewAnchor(std::make_shared<CSystemStateViewAnchor>(this)), isODE2RHSjacobianComputation(false) {}
+
 	// access functions
 	//! clone object; specifically for copying instances of derived class, for automatic memory management e.g. in ObjectContainer
 	CSystemData* GetClone() const { return new CSystemData(*this); }
 
 	//! Specific destructor do deallocate data (allocated in MainSystem/ObjectFactory)
-	virtual ~CSystemData() { Reset(); }
+	virtual ~CSystemData() 
+	{ 
+		RetainStateVectorsOfViews("system has been deleted");
+		Reset(); 
+		stateViewAnchor->systemData = nullptr;
+	}
 
 	void Reset()
 	{
+		RetainStateVectorsOfViews();
 		cData = CData();
+		IncreaseStateVersion();
 
 		for (auto item : cLoads) { delete item; }
 		for (auto item : cMarkers) { delete item; }
@@ -191,6 +219,33 @@ public: //
 	//! Read (Reference) access to:global number of Data variable (sum of all node Data variable)
 	const Index& GetNumberOfCoordinatesData() const { return numberOfCoordinatesData; }
 
+	//! state version: changes if state vectors may be reallocated (Assemble, Reset); views on state vectors are only valid for the state version at their creation
+	Index GetStateVersion() const { return stateVersion; }
+	//! signal that state vectors may be reallocated or have changed their layout
+	void IncreaseStateVersion() { stateVersion++; }
+
+	//! object parameters version: changes if object parameters are modified; solvers only reuse a constant mass matrix computed for the same version
+	Index GetObjectParametersVersion() const { return objectParametersVersion; }
+	//! signal that object parameters have been modified, which may change the system mass matrix
+	void IncreaseObjectParametersVersion() { objectParametersVersion++; }
+
+	//! anchor shared with views on state vectors
+	const std::shared_ptr<CSystemStateViewAnchor>& GetStateViewAnchor() const { return stateViewAnchor; }
+
+	//! call before state vectors are reallocated (Assemble, Reset): if views exist, state vectors are moved to the anchor, such that numpy arrays
+	//! linked to views never point to deleted memory; the anchor is detached and replaced by a new one, such that the retained state vectors
+	//! are deleted together with the last view linked to them
+	void RetainStateVectorsOfViews(const STDstring& reason = "system has been assembled or reset")
+	{
+		if (stateViewAnchor.use_count() > 1)
+		{
+			cData.MoveStatesTo(stateViewAnchor->retainedStates);
+			stateViewAnchor->systemData = nullptr;
+			stateViewAnchor->detachReason = reason;
+			stateViewAnchor = std::make_shared<CSystemStateViewAnchor>(this);
+		}
+	}
+
 	//! compute MarkerDataStructure for a given connector (using its markers); used in ComputeSystemODE2RHS, GetOutputVariableConnector, etc.; implemented in CSystem.cpp
 	virtual void ComputeMarkerDataStructure(const CObjectConnector* connector, bool computeJacobian, MarkerDataStructure& markerDataStructure) const;
 
@@ -45,6 +45,7 @@
 #include "Autogenerated/MainObjectContactCoordinate.h"
 #include "Autogenerated/MainObjectContactCircleCable2D.h"
 #include "Autogenerated/MainObjectContactFrictionCircleCable2D.h"
+#include "Autogenerated/MainObjectContactSpheresTriangleMesh.h"
 #include "Autogenerated/MainObjectJointGeneric.h"
 #include "Autogenerated/MainObjectJointSpherical.h"
 #include "Autogenerated/MainObjectJointRollingDisc.h"
@@ -588,6 +589,15 @@ MainObject* MainObjectFactory::CreateMainObject(MainSystem& mainSystem, STDstrin
 		VisualizationObjectContactFrictionCircleCable2D* vObject = new VisualizationObjectContactFrictionCircleCable2D();				//visualization item
 		((MainObjectContactFrictionCircleCable2D*)object)->SetVisualizationObject(vObject);
 	}
+	else if (objectType == "ContactSpheresTriangleMesh")
+	{
+		CObjectContactSpheresTriangleMesh* cObject = new CObjectContactSpheresTriangleMesh();
+		cObject->SetCSystemData(&(mainSystem.GetCSystem()->GetSystemData()));		//add CSystemData* to objects (workaround, will be removed)
+		object = new MainObjectContactSpheresTriangleMesh(); //new main object
+		((MainObjectContactSpheresTriangleMesh*)object)->SetCObjectContactSpheresTriangleMesh(cObject);
+		VisualizationObjectContactSpheresTriangleMesh* vObject = new VisualizationObjectContactSpheresTriangleMesh();				//visualization item
+		((MainObjectContactSpheresTriangleMesh*)object)->SetVisualizationObject(vObject);
+	}
 	else if (objectType == "JointGeneric")
 	{
 	CObjectJointGeneric* cObject = new CObjectJointGeneric();
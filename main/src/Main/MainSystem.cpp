@@ -43,6 +43,7 @@ void MainSystem::Reset()
 	GetCSystem()->Initialize();
 	visualizationSystem.Reset();
 	interactiveMode = false;
+	parameterHandles.clear(); //pointers to item parameters are invalid
 }
 
 //!  if interAciveMode == true: causes Assemble() to be called; this guarantees that the system is always consistent to be drawn
@@ -55,6 +56,165 @@ void MainSystem::InteractiveModeActions()
 	}
 }
 
+//! signal parameter changes of items, which have been written directly in bulk creation
+inline void BulkItemParametersHaveChanged(MainObject& mainItem) { mainItem.GetCObject()->ParametersHaveChanged(); }
+template<class TMainItem>
+inline void BulkItemParametersHaveChanged(TMainItem& mainItem) {}
+
+//! helper for bulk creation of items (AddNodes, AddObjects, ...): holds the item dictionary and the per-item parameter arrays;
+//! the first item is created from the item dictionary; for the following items, parameters with direct Real access (GetRealParameterAccess)
+//! are written directly into the items and only the other parameters (e.g. node or marker numbers) are updated in the item dictionary
+class MainSystemBulkItems
+{
+private:
+	py::dict itemDict;									//!< dictionary of item template, modified per item
+	std::vector<STDstring> names;						//!< parameter names in parameterArrays
+	std::vector<py::array_t<Real, py::array::c_style | py::array::forcecast>> arrays; //!< one row per item
+	std::vector<bool> isInteger;						//!< true: values are converted to int (e.g. for node numbers)
+	std::vector<bool> isDirect;							//!< true: values are written directly into items, not via itemDict
+	Index numberOfItems;								//!< number of items defined by rows of arrays
+
+public:
+	//! convert item template (python item class or dict) and parameterArrays (dict of parameterName: array with one row per item); returns false on error
+	bool Initialize(const STDstring& functionName, const py::object& pyObject, const py::dict& parameterArrays)
+	{
+		py::dict source = py::isinstance<py::dict>(pyObject) ? py::cast<py::dict>(pyObject) : py::dict(pyObject);
+		for (auto item : source) { itemDict[item.first] = item.second; } //copy, as itemDict is modified
+
+		if (itemDict.contains("name") && py::len(itemDict["name"]) != 0)
+		{
+			PyError(functionName + ": item name must be empty; names are generated automatically");
+			return false;
+		}
+		if (parameterArrays.size() == 0)
+		{
+			PyError(functionName + ": parameterArrays must contain at least one parameter");
+			return false;
+		}
+
+		numberOfItems = 0;
+		for (auto item : parameterArrays)
+		{
+			py::array array = py::array::ensure(item.second);
+			if (!array || array.ndim() < 1 || array.ndim() > 2)
+			{
+				PyError(functionName + ": parameterArrays['" + py::cast<STDstring>(item.first) + "'] must be a 1D or 2D array with one row per item");
+				return false;
+			}
+			if (arrays.size() == 0) { numberOfItems = (Index)array.shape(0); }
+			else if ((Index)array.shape(0) != numberOfItems)
+			{
+				PyError(functionName + ": all arrays in parameterArrays must have the same number of rows");
+				return false;
+			}
+			names.push_back(py::cast<STDstring>(item.first));
+			isInteger.push_back(array.dtype().kind() == 'i' || array.dtype().kind() == 'u' || array.dtype().kind() == 'b');
+			isDirect.push_back(false);
+			arrays.push_back(py::array_t<Real, py::array::c_style | py::array::forcecast>::ensure(array));
+		}
+		return true;
+	}
+
+	Index NumberOfItems() const { return numberOfItems; }
+
+	//! number of values per item of array j
+	Index NumberOfColumns(size_t j) const { return (arrays[j].ndim() == 1) ? 1 : (Index)arrays[j].shape(1); }
+
+	//! return item dictionary with parameters set to row i of arrays (except for directly written parameters); name is reset such that it is generated by the object factory
+	py::dict& GetItemDictionary(Index i)
+	{
+		for (size_t j = 0; j < arrays.size(); j++)
+		{
+			if (isDirect[j]) { continue; }
+			const auto& array = arrays[j];
+			const Real* data = array.data();
+			if (array.ndim() == 1)
+			{
+				itemDict[names[j].c_str()] = isInteger[j] ? (py::object)py::int_((Index)data[i]) : (py::object)py::float_(data[i]);
+			}
+			else
+			{
+				Index n = (Index)array.shape(1);
+				py::list row(n);
+				for (Index k = 0; k < n; k++)
+				{
+					Real value = data[i*n + k];
+					row[k] = isInteger[j] ? (py::object)py::int_((Index)value) : (py::object)py::float_(value);
+				}
+				itemDict[names[j].c_str()] = row;
+			}
+		}
+		itemDict["name"] = "";
+		return itemDict;
+	}
+
+	//! called with first added item: parameters with direct Real access and size matching the arrays are written directly into following items
+	template<class TMainItem>
+	void InitializeDirectAccess(TMainItem& mainItem)
+	{
+		for (size_t j = 0; j < arrays.size(); j++)
+		{
+			Real* data;
+			Index size;
+			isDirect[j] = !isInteger[j] && mainItem.GetRealParameterAccess(names[j], data, size) && size == NumberOfColumns(j);
+		}
+	}
+
+	//! write parameters with direct access of row i into mainItem
+	template<class TMainItem>
+	void SetDirectParameters(TMainItem& mainItem, Index i)
+	{
+		bool changed = false;
+		for (size_t j = 0; j < arrays.size(); j++)
+		{
+			if (!isDirect[j]) { continue; }
+			Real* data;
+			Index size;
+			mainItem.GetRealParameterAccess(names[j], data, size);
+			std::copy(arrays[j].data() + i * size, arrays[j].data() + (i + 1) * size, data);
+			changed = true;
+		}
+		if (changed) { BulkItemParametersHaveChanged(mainItem); }
+	}
+
+	//! add all items with AddItem(dict) and return range of added item numbers; reserves memory in item lists first
+	template<class TMainItems, class TCItems, class TVItems, class TAddItem>
+	py::object AddItems(MainSystem& mainSystem, const STDstring& functionName, TMainItems& mainItems, TCItems& cItems, TVItems& vItems, TAddItem AddItem)
+	{
+		Index firstItem = mainItems.NumberOfItems();
+		mainItems.EnlargeMaxNumberOfItemsTo(firstItem + numberOfItems);
+		cItems.EnlargeMaxNumberOfItemsTo(firstItem + numberOfItems);
+		vItems.EnlargeMaxNumberOfItemsTo(firstItem + numberOfItems);
+
+		mainSystem.GetCSystem()->SystemHasChanged();
+		Index cnt = 0;
+		try
+		{
+			for (; cnt < numberOfItems; cnt++)
+			{
+				Index itemNumber = AddItem(GetItemDictionary(cnt));
+				if (itemNumber == EXUstd::InvalidIndex) { break; }
+
+				if (cnt == 0) { InitializeDirectAccess(*mainItems.GetItem(itemNumber)); }
+				else { SetDirectParameters(*mainItems.GetItem(itemNumber), cnt); }
+			}
+		}
+		catch (const EXUexception& ex)
+		{
+			PyError("Error in " + functionName + "(...) for item " + EXUstd::ToString(cnt) + 
+				":\nCheck your python code (negative indices, invalid or undefined parameters, ...)\nException message=\n" + STDstring(ex.what()));
+		}
+		catch (...) //any other exception
+		{
+			PyError("Error in " + functionName + "(...) for item " + EXUstd::ToString(cnt) + 
+				":\nCheck your python code (negative indices, invalid or undefined parameters, ...)\n");
+		}
+		mainSystem.InteractiveModeActions();
+
+		return py::module::import("builtins").attr("range")(firstItem, firstItem + cnt);
+	}
+};
+
 //! set user function to be called by solvers at beginning of step (static or dynamic step)
 void MainSystem::PySetPreStepUserFunction(const py::object& value)
 {
@@ -147,6 +307,16 @@ NodeIndex MainSystem::AddMainNodePyClass(py::object pyObject)
 	//}
 }
 
+py::object MainSystem::PyAddNodes(const py::object& pyObject, const py::dict& parameterArrays)
+{
+	MainSystemBulkItems bulkItems;
+	if (!bulkItems.Initialize("AddNodes", pyObject, parameterArrays)) { return py::list(); }
+
+	return bulkItems.AddItems(*this, "AddNodes", mainSystemData.GetMainNodes(), GetCSystem()->GetSystemData().GetCNodes(),
+		GetVisualizationSystem().GetVisualizationSystemData().GetVisualizationNodes(),
+		[this](py::dict& d) { return GetMainObjectFactory().AddMainNode(*this, d); });
+}
+
 //! get node's dictionary by name; does not throw a error message
 NodeIndex MainSystem::PyGetNodeNumber(STDstring nodeName)
 {
@@ -381,6 +551,16 @@ ObjectIndex MainSystem::AddMainObjectPyClass(py::object pyObject)
 	return itemIndex;
 }
 
+py::object MainSystem::PyAddObjects(const py::object& pyObject, const py::dict& parameterArrays)
+{
+	MainSystemBulkItems bulkItems;
+	if (!bulkItems.Initialize("AddObjects", pyObject, parameterArrays)) { return py::list(); }
+
+	return bulkItems.AddItems(*this, "AddObjects", mainSystemData.GetMainObjects(), GetCSystem()->GetSystemData().GetCObjects(),
+		GetVisualizationSystem().GetVisualizationSystemData().GetVisualizationObjects(),
+		[this](py::dict& d) { return GetMainObjectFactory().AddMainObject(*this, d); });
+}
+
 //! get object's dictionary by name; does not throw a error message
 ObjectIndex MainSystem::PyGetObjectNumber(STDstring itemName)
 {
@@ -431,6 +611,8 @@ void MainSystem::PyModifyObject(const py::object& itemIndex, py::dict d)
 	{
 		GetCSystem()->SystemHasChanged();
 		mainSystemData.GetMainObjects().GetItem(itemNumber)->SetWithDictionary(d);
+		mainSystemData.GetMainObjects().GetItem(itemNumber)->GetVisualizationObject()->ParametersHaveChanged();
+		GetCSystem()->GetSystemData().IncreaseObjectParametersVersion();
 		InteractiveModeActions();
 	}
 	else
@@ -577,6 +759,9 @@ void MainSystem::PySetObjectParameter(const py::object& itemIndex, const STDstri
 	if (itemNumber < mainSystemData.GetMainObjects().NumberOfItems())
 	{
 		mainSystemData.GetMainObjects().GetItem(itemNumber)->SetParameter(parameterName, value);
+		//visualization parameters (graphicsData, color, ...) may have changed: retained graphics data is regenerated at next update
+		mainSystemData.GetMainObjects().GetItem(itemNumber)->GetVisualizationObject()->ParametersHaveChanged();
+		GetCSystem()->GetSystemData().IncreaseObjectParametersVersion(); //mass matrix may have changed
 	}
 	else
 	{
@@ -632,6 +817,16 @@ MarkerIndex MainSystem::AddMainMarkerPyClass(py::object pyObject)
 	return itemIndex;
 }
 
+py::object MainSystem::PyAddMarkers(const py::object& pyObject, const py::dict& parameterArrays)
+{
+	MainSystemBulkItems bulkItems;
+	if (!bulkItems.Initialize("AddMarkers", pyObject, parameterArrays)) { return py::list(); }
+
+	return bulkItems.AddItems(*this, "AddMarkers", mainSystemData.GetMainMarkers(), GetCSystem()->GetSystemData().GetCMarkers(),
+		GetVisualizationSystem().GetVisualizationSystemData().GetVisualizationMarkers(),
+		[this](py::dict& d) { return GetMainObjectFactory().AddMainMarker(*this, d); });
+}
+
 //! get object's dictionary by name; does not throw a error message
 MarkerIndex MainSystem::PyGetMarkerNumber(STDstring itemName)
 {
@@ -794,6 +989,16 @@ LoadIndex MainSystem::AddMainLoadPyClass(py::object pyObject)
 	return itemIndex;
 }
 
+py::object MainSystem::PyAddLoads(const py::object& pyObject, const py::dict& parameterArrays)
+{
+	MainSystemBulkItems bulkItems;
+	if (!bulkItems.Initialize("AddLoads", pyObject, parameterArrays)) { return py::list(); }
+
+	return bulkItems.AddItems(*this, "AddLoads", mainSystemData.GetMainLoads(), GetCSystem()->GetSystemData().GetCLoads(),
+		GetVisualizationSystem().GetVisualizationSystemData().GetVisualizationLoads(),
+		[this](py::dict& d) { return GetMainObjectFactory().AddMainLoad(*this, d); });
+}
+
 //! get object's dictionary by name; does not throw a error message
 LoadIndex MainSystem::PyGetLoadNumber(STDstring itemName)
 {
@@ -924,6 +1129,146 @@ void MainSystem::PySetLoadParameter(const py::object& itemIndex, const STDstring
 }
 
 
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  PARAMETER HANDLES
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+Index MainSystem::PyGetParameterHandle(const STDstring& itemType, const STDstring& parameterName)
+{
+	if (itemType != "Node" && itemType != "Object" && itemType != "Marker" && itemType != "Load" && itemType != "Sensor")
+	{
+		PyError("MainSystem::GetParameterHandle: itemType must be 'Node', 'Object', 'Marker', 'Load' or 'Sensor'");
+		return EXUstd::InvalidIndex;
+	}
+	MainSystemParameterHandle handle;
+	handle.itemType = itemType;
+	handle.parameterName = parameterName;
+	handle.size = EXUstd::InvalidIndex;
+	parameterHandles.push_back(handle);
+	return (Index)parameterHandles.size() - 1;
+}
+
+Real* MainSystem::GetParameterHandleData(MainSystemParameterHandle& handle, Index itemNumber)
+{
+	if (itemNumber < handle.itemData.NumberOfItems() && handle.itemData[itemNumber] != nullptr)
+	{
+		return handle.itemData[itemNumber];
+	}
+
+	//resolve parameter via item (string comparison only done once per item)
+	Real* data = nullptr;
+	Index size = 0;
+	bool found = false;
+	if (handle.itemType == "Node")
+	{
+		if (itemNumber < mainSystemData.GetMainNodes().NumberOfItems()) { found = mainSystemData.GetMainNodes()[itemNumber]->GetRealParameterAccess(handle.parameterName, data, size); }
+	}
+	else if (handle.itemType == "Object")
+	{
+		if (itemNumber < mainSystemData.GetMainObjects().NumberOfItems()) { found = mainSystemData.GetMainObjects()[itemNumber]->GetRealParameterAccess(handle.parameterName, data, size); }
+	}
+	else if (handle.itemType == "Marker")
+	{
+		if (itemNumber < mainSystemData.GetMainMarkers().NumberOfItems()) { found = mainSystemData.GetMainMarkers()[itemNumber]->GetRealParameterAccess(handle.parameterName, data, size); }
+	}
+	else if (handle.itemType == "Load")
+	{
+		if (itemNumber < mainSystemData.GetMainLoads().NumberOfItems()) { found = mainSystemData.GetMainLoads()[itemNumber]->GetRealParameterAccess(handle.parameterName, data, size); }
+	}
+	else
+	{
+		if (itemNumber < mainSystemData.GetMainSensors().NumberOfItems()) { found = mainSystemData.GetMainSensors()[itemNumber]->GetRealParameterAccess(handle.parameterName, data, size); }
+	}
+
+	if (!found)
+	{
+		PyError("MainSystem::SetParameters/GetParameters: " + handle.itemType + " " + EXUstd::ToString(itemNumber) + " does not exist or has no Real-valued parameter '" +
+			handle.parameterName + "' with fixed size");
+		return nullptr;
+	}
+	if (handle.size == EXUstd::InvalidIndex) { handle.size = size; }
+	else if (handle.size != size)
+	{
+		PyError("MainSystem::SetParameters/GetParameters: parameter '" + handle.parameterName + "' of " + handle.itemType + " " + EXUstd::ToString(itemNumber) +
+			" has size " + EXUstd::ToString(size) + ", but other items of handle have size " + EXUstd::ToString(handle.size));
+		return nullptr;
+	}
+
+	while (handle.itemData.NumberOfItems() <= itemNumber) { handle.itemData.Append(nullptr); }
+	handle.itemData[itemNumber] = data;
+	return data;
+}
+
+void MainSystem::PySetParameters(Index handle, const py::array_t<Index>& itemNumbers, const py::array_t<Real, py::array::c_style | py::array::forcecast>& values)
+{
+	if (handle >= (Index)parameterHandles.size())
+	{
+		PyError("MainSystem::SetParameters: invalid handle " + EXUstd::ToString(handle));
+		return;
+	}
+	MainSystemParameterHandle& parameterHandle = parameterHandles[handle];
+	if (itemNumbers.ndim() != 1 || values.ndim() < 1 || values.ndim() > 2 || values.shape(0) != itemNumbers.shape(0))
+	{
+		PyError("MainSystem::SetParameters: itemNumbers must be a 1D array and values must have one row per item");
+		return;
+	}
+
+	auto items = itemNumbers.unchecked<1>();
+	const Real* valuesData = values.data();
+	Index valuesSize = (values.ndim() == 1) ? 1 : (Index)values.shape(1);
+	bool isObject = parameterHandle.itemType == "Object";
+	for (Index i = 0; i < (Index)items.shape(0); i++)
+	{
+		Real* data = GetParameterHandleData(parameterHandle, items(i));
+		if (data == nullptr) { return; }
+		if (parameterHandle.size != valuesSize)
+		{
+			PyError("MainSystem::SetParameters: values must have " + EXUstd::ToString(parameterHandle.size) + " columns for parameter '" + parameterHandle.parameterName + "'");
+			return;
+		}
+		for (Index k = 0; k < valuesSize; k++) { data[k] = valuesData[i*valuesSize + k]; }
+		//same as in SetParameter(...) of objects
+		if (isObject) { mainSystemData.GetMainObjects()[items(i)]->GetCObject()->ParametersHaveChanged(); }
+	}
+	if (isObject) { GetCSystem()->GetSystemData().IncreaseObjectParametersVersion(); } //mass matrix may have changed
+}
+
+py::array_t<Real> MainSystem::PyGetParameters(Index handle, const py::array_t<Index>& itemNumbers)
+{
+	if (handle >= (Index)parameterHandles.size())
+	{
+		PyError("MainSystem::GetParameters: invalid handle " + EXUstd::ToString(handle));
+		return py::array_t<Real>();
+	}
+	MainSystemParameterHandle& parameterHandle = parameterHandles[handle];
+	if (itemNumbers.ndim() != 1)
+	{
+		PyError("MainSystem::GetParameters: itemNumbers must be a 1D array");
+		return py::array_t<Real>();
+	}
+
+	auto items = itemNumbers.unchecked<1>();
+	Index numberOfItems = (Index)items.shape(0);
+	//resolve all items first, in order to know the size
+	for (Index i = 0; i < numberOfItems; i++)
+	{
+		if (GetParameterHandleData(parameterHandle, items(i)) == nullptr) { return py::array_t<Real>(); }
+	}
+	Index size = (numberOfItems == 0) ? 1 : parameterHandle.size;
+
+	py::array_t<Real> values = (size == 1) ? py::array_t<Real>(numberOfItems) : py::array_t<Real>({ numberOfItems, size });
+	Real* valuesData = values.mutable_data();
+	for (Index i = 0; i < numberOfItems; i++)
+	{
+		const Real* data = parameterHandle.itemData[items(i)];
+		for (Index k = 0; k < size; k++) { valuesData[i*size + k] = data[k]; }
+	}
+	return values;
+}
+
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //  SENSOR
@@ -1069,6 +1414,45 @@ py::object MainSystem::PyGetSensorValues(const py::object& itemIndex, Configurat
 	}
 }
 
+//! get sensor's internally stored data (storeInternal=true) as read-only numpy array with rows [time, values...]; 
+//! the array is a view on the sensor's memory (no copy), which is kept alive by the array; storage is never reallocated in place (see CSensor),
+//! such that the array stays valid (showing the rows at time of call) if the storage is re-initialized (next simulation) or enlarged, or the system is reset
+py::object MainSystem::PyGetSensorStoredData(const py::object& itemIndex)
+{
+	Index itemNumber = EPyUtils::GetSensorIndexSafely(itemIndex);
+	if (itemNumber < mainSystemData.GetMainSensors().NumberOfItems())
+	{
+		const CSensor* cSensor = mainSystemData.GetMainSensors().GetItem(itemNumber)->GetCSensor();
+		if (!cSensor->GetStoreInternalFlag())
+		{
+			PyError(STDstring("MainSystem::GetSensorStoredData: sensor number ") + EXUstd::ToString(itemNumber) + " has no stored data; set storeInternal=True");
+			return py::int_(EXUstd::InvalidIndex);
+		}
+
+		Real* storageData = cSensor->GetInternalStorage().GetDataPointer();
+		py::ssize_t nRows = cSensor->GetInternalStorageRows();
+		py::ssize_t nColumns = cSensor->GetInternalStorageColumns();
+		if (nRows == 0 || storageData == nullptr) //nothing stored yet
+		{
+			return py::array_t<Real>(std::vector<py::ssize_t>({ 0, nColumns }));
+		}
+
+		//base object of array shares ownership of sensor storage, avoiding copying of data
+		typedef std::shared_ptr<ResizableArray<Real>> SharedStorage;
+		SharedStorage* storageOwner = new SharedStorage(cSensor->GetInternalStorageShared());
+		py::capsule owner(storageOwner, [](void* p) { delete (SharedStorage*)p; });
+		py::array_t<Real> data(std::vector<py::ssize_t>({ nRows, nColumns }), 
+			std::vector<py::ssize_t>({ nColumns * (py::ssize_t)sizeof(Real), (py::ssize_t)sizeof(Real) }), storageData, owner);
+		py::detail::array_proxy(data.ptr())->flags &= ~py::detail::npy_api::NPY_ARRAY_WRITEABLE_; //sensor data shall not be modified by user
+		return data;
+	}
+	else
+	{
+		PyError(STDstring("MainSystem::GetSensorStoredData: invalid access to sensor number ") + EXUstd::ToString(itemNumber));
+		return py::int_(EXUstd::InvalidIndex);
+	}
+}
+
 
 
 //! Get (read) parameter 'parameterName' of 'sensorNumber' via pybind / pyhton interface instead of obtaining the whole dictionary with GetDictionary
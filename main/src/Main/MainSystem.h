@@ -34,6 +34,16 @@
 //#include "Utilities/BasicFunctions.h"
 
 
+//! handle for fast access to a Real-valued parameter of many items of one type, see MainSystem::PyGetParameterHandle(...)
+class MainSystemParameterHandle
+{
+public:
+	STDstring itemType;				//!< 'Node', 'Object', 'Marker', 'Load' or 'Sensor'
+	STDstring parameterName;		//!< parameter name as in SetObjectParameter(...)
+	Index size;						//!< number of Real values per item; EXUstd::InvalidIndex until first item is resolved
+	ResizableArray<Real*> itemData;	//!< pointer to parameter data per item number, resolved at first access; nullptr if not yet resolved
+};
+
 //!Interface to a CSystem, used in Python
 // This class mirrors all functionality accessible in Python
 // Additionally, the MainSystem includes the object factory
@@ -48,6 +58,7 @@ public: //! objects made public, because Python functions are anyway mostly Auto
 	MainObjectFactory mainObjectFactory;
 	py::dict variables; //!< dictionary which is used to store local variables for models
 	py::dict systemVariables;		//!< dictionary which is used to store system variables (e.g. for solvers, etc.)
+	std::vector<MainSystemParameterHandle> parameterHandles; //!< parameter handles created with PyGetParameterHandle(...); pointers are valid until Reset()
 
 private:
 	bool interactiveMode; //!< if this is true, every AddItem(...), ModifyItem(...), etc. causes Assemble() to be called; this guarantees that the system is always consistent to be drawn
@@ -129,6 +140,9 @@ public:
 	Index AddMainNode(py::dict d);
 	//! Add a MainNode with a python class
 	NodeIndex AddMainNodePyClass(py::object pyObject);
+	//! Add nodes with same type and parameters as pyObject (python class or dict); parameterArrays is a dict of parameterName: array with one row per node,
+	//! defining node-specific parameters; all nodes are added in one pass; returns range of new node numbers
+	py::object PyAddNodes(const py::object& pyObject, const py::dict& parameterArrays);
 	//! get node's dictionary by name; does not throw a error message
 	NodeIndex PyGetNodeNumber(STDstring name);
 	//! hook to read node's dictionary
@@ -160,6 +174,9 @@ public:
 	Index AddMainObject(py::dict d);
 	//! Add a MainObject with a python class
 	ObjectIndex AddMainObjectPyClass(py::object pyObject);
+	//! Add objects with same type and parameters as pyObject (python class or dict); parameterArrays is a dict of parameterName: array with one row per object,
+	//! defining object-specific parameters; all objects are added in one pass; returns range of new object numbers
+	py::object PyAddObjects(const py::object& pyObject, const py::dict& parameterArrays);
 	//! get object's dictionary by name; does not throw a error message
 	ObjectIndex PyGetObjectNumber(STDstring itemName);
 	//! hook to read object's dictionary
@@ -193,6 +210,9 @@ public:
 	Index AddMainMarker(py::dict d);
 	//! Add a MainMarker with a python class
 	MarkerIndex AddMainMarkerPyClass(py::object pyObject);
+	//! Add markers with same type and parameters as pyObject (python class or dict); parameterArrays is a dict of parameterName: array with one row per marker,
+	//! defining marker-specific parameters; all markers are added in one pass; returns range of new marker numbers
+	py::object PyAddMarkers(const py::object& pyObject, const py::dict& parameterArrays);
 	//! get marker's dictionary by name; does not throw a error message
 	MarkerIndex PyGetMarkerNumber(STDstring itemName);
 	//! hook to read marker's dictionary
@@ -215,6 +235,9 @@ public:
 	Index AddMainLoad(py::dict d);
 	//! Add a MainLoad with a python class
 	LoadIndex AddMainLoadPyClass(py::object pyObject);
+	//! Add loads with same type and parameters as pyObject (python class or dict); parameterArrays is a dict of parameterName: array with one row per load,
+	//! defining load-specific parameters; all loads are added in one pass; returns range of new load numbers
+	py::object PyAddLoads(const py::object& pyObject, const py::dict& parameterArrays);
 	//! get load's dictionary by name; does not throw a error message
 	LoadIndex PyGetLoadNumber(STDstring itemName);
 	//! hook to read load's dictionary
@@ -234,6 +257,17 @@ public:
 	//! Set (write) parameter 'parameterName' of 'itemNumber' to 'value' via pybind / pyhton interface instead of writing the whole dictionary with SetWithDictionary(...)
 	virtual void PySetLoadParameter(const py::object& itemIndex, const STDstring& parameterName, const py::object& value);
 
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//   PARAMETER HANDLES
+	//! create handle for Real-valued parameter 'parameterName' of items with itemType ('Node', 'Object', 'Marker', 'Load' or 'Sensor'); returns handle number
+	Index PyGetParameterHandle(const STDstring& itemType, const STDstring& parameterName);
+	//! set parameter of handle for items in itemNumbers to values (one row per item), writing directly into the parameter structures
+	void PySetParameters(Index handle, const py::array_t<Index>& itemNumbers, const py::array_t<Real, py::array::c_style | py::array::forcecast>& values);
+	//! get parameter of handle for items in itemNumbers as array with one row per item
+	py::array_t<Real> PyGetParameters(Index handle, const py::array_t<Index>& itemNumbers);
+	//! return pointer to parameter data of item itemNumber for handle; resolves and stores pointer at first access; returns nullptr (and raises error) if not available
+	Real* GetParameterHandleData(MainSystemParameterHandle& handle, Index itemNumber);
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//   SENSOR
 	//! this is the hook to the object factory, handling all kinds of objects, nodes, ...
@@ -252,6 +286,8 @@ public:
 	py::dict PyGetSensorDefaults(STDstring typeName);
 	//! get sensor's values
 	py::object PyGetSensorValues(const py::object& itemIndex, ConfigurationType configuration = ConfigurationType::Current);
+	//! get sensor's internally stored data (storeInternal=true) as numpy array without copying
+	py::object PyGetSensorStoredData(const py::object& itemIndex);
 
 	//! Get (read) parameter 'parameterName' of 'itemNumber' via pybind / pyhton interface instead of obtaining the whole dictionary with GetDictionary
 	virtual py::object PyGetSensorParameter(const py::object& itemIndex, const STDstring& parameterName) const;
@@ -29,6 +29,46 @@
 
 #include "Main/OutputVariable.h"
 
+class MainSystemData;
+
+//! zero-copy view on one coordinate vector (ODE2, ODE2_t, ODE1, AE or data coordinates) of a system state, accessible with python buffer protocol;
+//! the view links to the memory of the vector and becomes invalid if the state version of the system changes (Assemble, Reset) or the vector is reallocated;
+//! views on the visualization state are not available, as the renderer swaps the visualization state buffers
+class MainSystemStateView
+{
+protected:
+	MainSystemData* mainSystemData;				//!< system data which owns the state vector; only accessed if anchor->systemData is not nullptr
+	std::shared_ptr<CSystemStateViewAnchor> anchor;	//!< shared with CSystemData; keeps the state vector memory alive after Assemble(), Reset() or deletion of the system
+	ConfigurationType configurationType;		//!< configuration of the state (Current, Initial, ...)
+	Vector CSystemState::* stateVector;			//!< member of CSystemState, e.g. &CSystemState::ODE2Coords
+	STDstring vectorName;						//!< name of vector for error messages and representation
+	Index stateVersion;							//!< state version of CSystemData at creation of view
+	Real* data;									//!< data pointer of vector at creation of view
+	Index numberOfItems;						//!< size of vector at creation of view
+
+public:
+	MainSystemStateView(MainSystemData& mainSystemDataInit, ConfigurationType configurationTypeInit, Vector CSystemState::* stateVectorInit, const STDstring& vectorNameInit);
+
+	//! true, if view still links to the state vector (system exists, state version unchanged and vector not reallocated)
+	bool IsValid() const;
+
+	//! reason, why view is not valid anymore (for error messages)
+	STDstring GetInvalidReason() const;
+
+	//! number of coordinates in view
+	Index NumberOfItems() const { return numberOfItems; }
+
+	//! return buffer info for python buffer protocol; raises python error if view is not valid anymore
+	py::buffer_info GetBufferInfo() const;
+
+	//! return numpy array linking to the data of the vector (no copy); base must be the python object of the view, which is kept alive by the array
+	//! and keeps the memory of the vector alive; raises python error if view is not valid anymore
+	py::array_t<Real> GetArray(const py::handle& base) const;
+
+	//! return string representation of view
+	STDstring GetRepresentation() const;
+};
+
 class MainSystemData //
 {
 protected: //
@@ -279,6 +319,42 @@ public: //
 		GetCSystemState(configurationType)->SetDataCoords(v);
 	}
 
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//zero-copy views on state vectors; views become invalid after Assemble() or Reset()
+
+	//! view on ODE2 coordinates (displacements) of given configuration
+	MainSystemStateView GetODE2CoordsView(ConfigurationType configurationType = ConfigurationType::Current)
+	{
+		return MainSystemStateView(*this, configurationType, &CSystemState::ODE2Coords, "ODE2Coordinates");
+	}
+
+	//! view on ODE2 coordinates (velocities) of given configuration
+	MainSystemStateView GetODE2Coords_tView(ConfigurationType configurationType = ConfigurationType::Current)
+	{
+		return MainSystemStateView(*this, configurationType, &CSystemState::ODE2Coords_t, "ODE2Coordinates_t");
+	}
+
+	//! view on ODE1 coordinates of given configuration
+	MainSystemStateView GetODE1CoordsView(ConfigurationType configurationType = ConfigurationType::Current)
+	{
+		return MainSystemStateView(*this, configurationType, &CSystemState::ODE1Coords, "ODE1Coordinates");
+	}
+
+	//! view on algebraic coordinates of given configuration
+	MainSystemStateView GetAECoordsView(ConfigurationType configurationType = ConfigurationType::Current)
+	{
+		return MainSystemStateView(*this, configurationType, &CSystemState::AECoords, "AECoordinates");
+	}
+
+	//! view on data coordinates of given configuration
+	MainSystemStateView GetDataCoordsView(ConfigurationType configurationType = ConfigurationType::Current)
+	{
+		return MainSystemStateView(*this, configurationType, &CSystemState::dataCoords, "DataCoordinates");
+	}
+
+	//! current state version; changes with Assemble() or Reset(), which may reallocate state vectors
+	Index GetStateVersion() const { return cSystemData->GetStateVersion(); }
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//local to global ODE2 transformation lists; returned as python list
@@ -474,4 +550,61 @@ public: //
 
 };
 
+inline MainSystemStateView::MainSystemStateView(MainSystemData& mainSystemDataInit, ConfigurationType configurationTypeInit,
+	Vector CSystemState::* stateVectorInit, const STDstring& vectorNameInit) :
+	mainSystemData(&mainSystemDataInit), anchor(mainSystemDataInit.GetCSystemData().GetStateViewAnchor()), 
+	configurationType(configurationTypeInit), stateVector(stateVectorInit), vectorName(vectorNameInit)
+{
+	CHECKandTHROW(configurationType != ConfigurationType::Visualization, "SystemStateView(" + vectorName + "): views on visualization state are not available, "
+		"as the renderer swaps the visualization state buffers; use a copying function, e.g., GetODE2Coordinates(configuration=exu.ConfigurationType.Visualization)");
+	Vector& v = mainSystemData->GetCSystemState(configurationType)->*stateVector;
+	stateVersion = mainSystemData->GetStateVersion();
+	data = v.GetDataPointer();
+	numberOfItems = v.NumberOfItems();
+}
+
+inline bool MainSystemStateView::IsValid() const
+{
+	if (anchor->systemData == nullptr) { return false; } //state vectors replaced or system deleted
+	if (stateVersion != mainSystemData->GetStateVersion()) { return false; }
+	const Vector& v = mainSystemData->GetCSystemState(configurationType)->*stateVector;
+	return v.GetDataPointer() == data && v.NumberOfItems() == numberOfItems;
+}
+
+inline STDstring MainSystemStateView::GetInvalidReason() const
+{
+	if (anchor->systemData == nullptr) { return anchor->detachReason; }
+	if (stateVersion != mainSystemData->GetStateVersion()) { return "system has been assembled or reset"; }
+	return "state vector has been resized or reallocated";
+}
+
+inline py::buffer_info MainSystemStateView::GetBufferInfo() const
+{
+	static Real emptyData = 0; //python buffer needs valid pointer also for zero size
+	if (!IsValid())
+	{
+		//python errors cannot be raised in buffer protocol ==> empty, read-only buffer
+		PyWarning("SystemStateView(" + vectorName + "): view is not valid anymore, as " + GetInvalidReason() + "; get new view from systemData");
+		return py::buffer_info(&emptyData, (Index)sizeof(Real), py::format_descriptor<Real>::format(), 0, true);
+	}
+	return py::buffer_info(numberOfItems ? data : &emptyData, numberOfItems);
+}
+
+inline py::array_t<Real> MainSystemStateView::GetArray(const py::handle& base) const
+{
+	if (!IsValid())
+	{
+		PyError("SystemStateView(" + vectorName + "): view is not valid anymore, as " + GetInvalidReason() + "; get new view from systemData");
+		return py::array_t<Real>();
+	}
+	return py::array_t<Real>(numberOfItems, data, base);
+}
+
+inline STDstring MainSystemStateView::GetRepresentation() const
+{
+	STDstring str = "SystemStateView(" + vectorName + ", size=" + EXUstd::ToString(numberOfItems);
+	if (!IsValid()) { str += ", INVALID"; }
+	return str + ")";
+}
+
 #endif
@@ -278,13 +278,14 @@ inline const char* GetOutputVariableTypeString(OutputVariableType var)
 //    }
 //};
 
-//currently not used inside C++ code!
+//! solver types for dynamic solvers; explicit types are used in CSolverExplicitTimeInt
 enum class DynamicSolverType {
 	//_None = 0, //marks that no configuration is used
 	GeneralizedAlpha = 1,	//an implicit solver for index 3 problems; allows to set variables also for Newmark and trapezoidal implicit index 2 solvers
 	TrapezoidalIndex2 = 2,	//an implicit solver for index 3 problems with index2 reduction; uses generalized alpha solver with settings for Newmark with index2 reduction
-	ExplicitEuler = 3,		//an explicit first order solver for systems without constraints
-	RK45 = 4				//an explicit Runge Kutta solver of 4th order for systems without constraints; includes adaptive step selection
+	ExplicitEuler = 3,		//an explicit first order solver; constraints are solved on acceleration level and projected after every step
+	RK45 = 4,				//an explicit embedded Runge Kutta solver of 5th order (Dormand-Prince) with 4th order error estimate for adaptive step selection
+	RK4 = 5					//classical explicit Runge Kutta solver of 4th order with constant step size
 };
 
 enum class ConfigurationType {
@@ -401,8 +402,24 @@ inline AccessFunctionType GetAccessFunctionType(LoadType loadType, Marker::Type
 //! enum to determine how to set up the system matrix 
 enum class LinearSolverType {
 	_None = 0,			//marks that no type is used
-	EXUdense = 1,		//use internal dense matrix (e.g. matrix inverse for factorization)
-	EigenSparse = 2		//use Eigen::SparseMatrix
+	EXUdense = 1,		//use internal dense matrix (LU or Cholesky factorization)
+	EigenSparse = 2,	//use Eigen::SparseMatrix
+	EigenSparseIterative = 3	//use Eigen::SparseMatrix and preconditioned iterative (Krylov) solver
+};
+
+//! enum to select iterative (Krylov) solver for LinearSolverType::EigenSparseIterative
+enum class IterativeSolverType {
+	GMRES = 1,			//restarted GMRES; for general (non-symmetric) matrices
+	BiCGSTAB = 2,		//BiCGSTAB; for general (non-symmetric) matrices, short recurrences
+	CG = 3				//conjugate gradient; only for symmetric positive definite matrices
+};
+
+//! enum to select preconditioner for LinearSolverType::EigenSparseIterative
+enum class PreconditionerType {
+	_None = 0,			//no preconditioner
+	Jacobi = 1,			//diagonal (Jacobi) preconditioner
+	BlockJacobi = 2,	//block diagonal preconditioner with dense LU factorization of diagonal blocks
+	ILU0 = 3			//incomplete LU factorization without fill-in
 };
 
 //! ostream operator for printing of enum class
@@ -413,8 +430,48 @@ inline std::ostream& operator<<(std::ostream& os, LinearSolverType value)
 	case LinearSolverType::_None:			return os << "_None"; break;
 	case LinearSolverType::EXUdense:			return os << "EXUdense"; break;
 	case LinearSolverType::EigenSparse:		return os << "EigenSparse"; break;
+	case LinearSolverType::EigenSparseIterative:	return os << "EigenSparseIterative"; break;
 	default: 		return os << "LinearSolverType::invalid";
 	}
 }
 
+//! ostream operator for printing of enum class
+inline std::ostream& operator<<(std::ostream& os, IterativeSolverType value)
+{
+	switch (value)
+	{
+	case IterativeSolverType::GMRES:		return os << "GMRES"; break;
+	case IterativeSolverType::BiCGSTAB:		return os << "BiCGSTAB"; break;
+	case IterativeSolverType::CG:			return os << "CG"; break;
+	default: 		return os << "IterativeSolverType::invalid";
+	}
+}
+
+//! ostream operator for printing of enum class
+inline std::ostream& operator<<(std::ostream& os, PreconditionerType value)
+{
+	switch (value)
+	{
+	case PreconditionerType::_None:			return os << "_None"; break;
+	case PreconditionerType::Jacobi:		return os << "Jacobi"; break;
+	case PreconditionerType::BlockJacobi:	return os << "BlockJacobi"; break;
+	case PreconditionerType::ILU0:			return os << "ILU0"; break;
+	default: 		return os << "PreconditionerType::invalid";
+	}
+}
+
+//! ostream operator for printing of enum class
+inline std::ostream& operator<<(std::ostream& os, DynamicSolverType value)
+{
+	switch (value)
+	{
+	case DynamicSolverType::GeneralizedAlpha:	return os << "GeneralizedAlpha"; break;
+	case DynamicSolverType::TrapezoidalIndex2:	return os << "TrapezoidalIndex2"; break;
+	case DynamicSolverType::ExplicitEuler:		return os << "ExplicitEuler"; break;
+	case DynamicSolverType::RK45:				return os << "RK45"; break;
+	case DynamicSolverType::RK4:				return os << "RK4"; break;
+	default: 		return os << "DynamicSolverType::invalid";
+	}
+}
+
 #endif
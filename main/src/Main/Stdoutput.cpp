@@ -33,7 +33,8 @@
 //does not work globally: #include <pybind11/iostream.h> //used to redirect cout:  py::scoped_ostream_redirect output;
 //#include <pybind11/cast.h> //for arguments
 //#include <pybind11/functional.h> //for functions
-#include <atomic> //for output buffer semaphore
+#include <atomic>
+#include <mutex> //for output buffer
 
 #include "Utilities/TimerStructure.h"
 
@@ -111,6 +112,7 @@ bool CheckPathAndCreateDirectories(const STDstring& pathAndFileName)
 
 //global variable for timers:
 TimerStructure globalTimers; //global timers crash in debug mode! (use Resizable Array instead of std::vector ?)
+thread_local bool globalTimersSuspended = false;
 
 //these two variables become global
 OutputBuffer outputBuffer; //this is my customized output buffer, which can redirect the output stream;
@@ -118,42 +120,62 @@ std::ostream pout(&outputBuffer);  // link ostream pout to buffer; pout behaves
 
 bool globalPyRuntimeErrorFlag = false; //this flag is set true as soon as a PyError or SysError is raised; this causes to shut down secondary processes, such as graphics, etc.
 bool deactivateGlobalPyRuntimeErrorFlag = false; //this flag is set true as soon as functions are called e.g. from command windows, which allow errors without shutting down the renderer
-std::atomic_flag outputBufferAtomicFlag;   //!< flag, which is used to lock access to outputBuffer
+std::mutex outputBufferMutex;				//!< locks writing of lines in outputBuffer, as batch solver threads may write concurrently
+thread_local std::string outputBufferLine;	//!< line of outputBuffer, which is collected per thread until end of line is detected
+std::string outputBufferSuspendedLines;		//!< lines of all threads written during suspended writing; written together with next line
 
 std::atomic_flag queuedPythonExecutableCodeAtomicFlag;  //!< flag for executable python code
 STDstring queuedPythonExecutableCodeStr;					//!< this string contains python code which shall be executed
 
+thread_local bool threadWithoutPythonGIL = false;
+
+//! acquires the python GIL during its lifetime, if the current thread runs without GIL (threadWithoutPythonGIL); no action otherwise
+class WorkerThreadGILGuard
+{
+	std::unique_ptr<py::gil_scoped_acquire> acquireGIL;
+public:
+	WorkerThreadGILGuard() { if (threadWithoutPythonGIL) { acquireGIL.reset(new py::gil_scoped_acquire()); } }
+};
+
 //! used to print to python; string is temporary stored and written as soon as '\n' is detected
 int OutputBuffer::overflow(int c)
 {
-	outputBufferAtomicFlag.test_and_set(std::memory_order_acquire); //lock outputBuffer
-	if ((char)c != '\n') {
-		buf.push_back((char)c);
+	if ((char)c != '\n')
+	{
+		outputBufferLine.push_back((char)c);
+		return c;
+	}
+	if (suspendWriting)
+	{
+		std::lock_guard<std::mutex> lock(outputBufferMutex);
+		outputBufferSuspendedLines += outputBufferLine + '\n';
+		outputBufferLine.clear();
+		return c;
 	}
-	else 
+
 	{
-		if (!suspendWriting)
+		//GIL must be acquired before outputBufferMutex: python main thread holds the GIL while waiting for outputBufferMutex
+		WorkerThreadGILGuard gilGuard;
+		std::lock_guard<std::mutex> lock(outputBufferMutex);
+		if (outputBufferSuspendedLines.size())
 		{
-			if (writeToConsole)
-			{
-				py::print(buf);
-				if (waitMilliSeconds) {
-					std::this_thread::sleep_for(std::chrono::milliseconds(waitMilliSeconds)); //add this to enable Spyder to print messages
-				}
-			}
-			if (writeToFile)
-			{
-				file << buf << "\n"; //add "\n" as compared to py::print, which already adds end line command
+			outputBufferLine = outputBufferSuspendedLines + outputBufferLine;
+			outputBufferSuspendedLines.clear();
+		}
+		if (writeToConsole)
+		{
+			py::print(outputBufferLine);
+			if (waitMilliSeconds) {
+				std::this_thread::sleep_for(std::chrono::milliseconds(waitMilliSeconds)); //add this to enable Spyder to print messages
 			}
-			buf.clear();
 		}
-		else
+		if (writeToFile)
 		{
-			buf.push_back((char)c);
+			file << outputBufferLine << "\n"; //add "\n" as compared to py::print, which already adds end line command
 		}
 	}
+	outputBufferLine.clear();
 	//py::print((char)c); //this would be much slower as each character needs to be processed with py::print
-	outputBufferAtomicFlag.clear(std::memory_order_release); //clear outputBuffer
 	return c;
 }
 
@@ -182,6 +204,12 @@ void OutputBuffer::SetWriteToFile(STDstring filename, bool flagWriteToFile, bool
 
 void PyGetCurrentFileInformation(std::string& fileName, Index& lineNumber) //!< retrieve current parsed file information from python (for error/warning messages...)
 {
+	if (threadWithoutPythonGIL) //worker threads have no python frame
+	{
+		fileName = "<worker thread>";
+		lineNumber = 0;
+		return;
+	}
 	py::module inspect = py::module::import("inspect");
 	py::object currentFrame = inspect.attr("currentframe")();
 	lineNumber = int(py::int_(currentFrame.attr("f_lineno")));
@@ -204,6 +232,7 @@ void PyError(std::string error_msg)
 //! additional output to file
 void PyError(std::string error_msg, std::ofstream& file) 
 {
+	WorkerThreadGILGuard gilGuard;
 	if (!deactivateGlobalPyRuntimeErrorFlag) { globalPyRuntimeErrorFlag = true; } //stop graphics, etc.
 	STDstring fileName;
 	Index lineNumber;
@@ -221,7 +250,7 @@ void PyError(std::string error_msg, std::ofstream& file)
 		file << "Exudyn: parsing of python file terminated due to python (user) error\n\n";
 		file << "********************************************************************\n\n";
 	}
-	PyErr_SetString(PyExc_RuntimeError, "Exudyn: parsing of python file terminated due to python (user) error");
+	if (!threadWithoutPythonGIL) { PyErr_SetString(PyExc_RuntimeError, "Exudyn: parsing of python file terminated due to python (user) error"); } //worker threads report errors to caller
 	//this kills kernel in spyder: CHECKandTHROWstring("Exudyn: parsing of python file terminated due to python (user) error!");
 }
 
@@ -236,6 +265,7 @@ void SysError(std::string error_msg)
 //! additional output to file
 void SysError(std::string error_msg, std::ofstream& file) 
 {
+	WorkerThreadGILGuard gilGuard;
 	if (!deactivateGlobalPyRuntimeErrorFlag) { globalPyRuntimeErrorFlag = true; }//stop graphics, etc.
 	globalPyRuntimeErrorFlag = true; //stop graphics, etc.
 	STDstring fileName;
@@ -254,7 +284,7 @@ void SysError(std::string error_msg, std::ofstream& file)
 		file << "Exudyn: parsing of python file terminated due to system error\n\n";
 		file << "********************************************************************\n\n";
 	}
-	PyErr_SetString(PyExc_RuntimeError, "Exudyn: parsing of python file terminated due to system error");
+	if (!threadWithoutPythonGIL) { PyErr_SetString(PyExc_RuntimeError, "Exudyn: parsing of python file terminated due to system error"); } //worker threads report errors to caller
 }
 
 //!< prints a formated warning message (+log file, etc.); 'warning_msg' shall only contain the warning information, do not write "Python WARNING: ..." or similar
@@ -268,6 +298,7 @@ void PyWarning(std::string warning_msg)
 //! additional output to file
 void PyWarning(std::string warning_msg, std::ofstream& file)
 {
+	WorkerThreadGILGuard gilGuard;
 	STDstring fileName;
 	Index lineNumber;
 	PyGetCurrentFileInformation(fileName, lineNumber);
@@ -292,6 +323,7 @@ void PyQueueExecutableString(STDstring str) //call python function and execute s
 
 void PyProcessExecuteQueue() //call python function and execute string as python code
 {
+	if (threadWithoutPythonGIL) { return; } //only executed in python main thread
 	queuedPythonExecutableCodeAtomicFlag.test_and_set(std::memory_order_acquire); //lock queuedPythonExecutableCodeStr
 	if (queuedPythonExecutableCodeStr.size())
 	{
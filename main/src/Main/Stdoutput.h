@@ -21,13 +21,13 @@
 #include <iostream>     // std::cout, std::ostream
 //#include <iosfwd>		//forward declaration of ofstream; hopefully takes less compile time than fstream ... as this file is included in every .cpp file!!!
 #include <fstream>      // needed for outputbuffer write to file ...
+#include <atomic>
 
 //! buffer which enables output to python and/or to file
 class OutputBuffer : public std::stringbuf //uses solution of so:redirect-stdcout-to-a-custom-writer
 {
 private:
-	std::string buf;     //this buffer is used until end of line is detected
-	bool suspendWriting; //this flag is used to suspend writing via Python, e.g., during parallel computation
+	std::atomic<bool> suspendWriting; //this flag is used to suspend writing via Python, e.g., during parallel computation; lines are then kept until writing is resumed
 	bool writeToFile;    //redirect all output to file
 	bool writeToConsole; //redirect all output to console
 	std::ofstream file;  //this is the filename for redirecting all output
@@ -36,6 +36,7 @@ public:
 	OutputBuffer() 
 	{ 
 		setbuf(0, 0); //this leads to an overflow in any access to stringbuf!
+		suspendWriting = false;
 		writeToFile = false;
 		writeToConsole = true;
 		waitMilliSeconds = 0;
@@ -77,6 +78,10 @@ void PyQueueExecutableString(STDstring str); //call python function and execute
 //! function to be called from main (python) thread, as this thread holds the gil
 void PyProcessExecuteQueue(); //call python function and execute string as python code
 
+//! set true in threads which run without the python GIL (e.g., worker threads of batch solver); 
+//! output to python console and errors then acquire the GIL, python errors are not raised and queued python code is not executed in such threads
+extern thread_local bool threadWithoutPythonGIL;
+
 
 //********************************
 extern std::ostream pout;  //!< provide a output stream (e.g. for Python); remove the following line if linkage to Python is not needed!
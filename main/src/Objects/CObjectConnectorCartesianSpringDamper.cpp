@@ -92,9 +92,34 @@ void CObjectConnectorCartesianSpringDamper::ComputeODE2LHS(Vector& ode2Lhs, cons
 
 }
 
+//! jacobians are only available as functions, if no user function is used
+JacobianType::Type CObjectConnectorCartesianSpringDamper::GetAvailableJacobians() const
+{
+	if (parameters.springForceUserFunction)
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t);
+	}
+	return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+}
+
+//! compute jacobians of ODE2LHS w.r.t. ODE2 coordinates and velocities; force jacobians are diag(stiffness) and diag(damping);
+//! marker jacobians are assumed to be constant (e.g. mass points, ANCF position markers)
 void CObjectConnectorCartesianSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorCartesianSpringDamper::ComputeJacobianODE2_ODE2");
+	Matrix3D forceJacobian(3, 3, 0.);
+	Matrix3D forceJacobian_t(3, 3, 0.);
+
+	if (parameters.activeConnector)
+	{
+		for (Index i = 0; i < 3; i++)
+		{
+			forceJacobian(i, i) = parameters.stiffness[i];
+			forceJacobian_t(i, i) = parameters.damping[i];
+		}
+	}
+
+	ComputeJacobianFromForceJacobian(forceJacobian, markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, jacobian);
+	ComputeJacobianFromForceJacobian(forceJacobian_t, markerData.GetMarkerData(0).positionJacobian, markerData.GetMarkerData(1).positionJacobian, jacobian_ODE2_t);
 }
 
 //! provide according output variable in "value"
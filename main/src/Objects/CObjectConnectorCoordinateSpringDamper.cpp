@@ -100,9 +100,40 @@ void CObjectConnectorCoordinateSpringDamper::ComputeODE2LHS(Vector& ode2Lhs, con
 
 }
 
+//! jacobians are only available as functions, if no user function is used
+JacobianType::Type CObjectConnectorCoordinateSpringDamper::GetAvailableJacobians() const
+{
+	if (parameters.springForceUserFunction)
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t);
+	}
+	return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+}
+
+//! compute jacobians of ODE2LHS w.r.t. ODE2 coordinates and velocities; the scalar force is differentiated w.r.t. relPos and relVel, 
+//! including the proportional zone of dry friction (the Sgn(relVel) part has zero derivative)
 void CObjectConnectorCoordinateSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorCoordinateSpringDamper::ComputeODE2LHSJacobian");
+	ConstSizeMatrix<1> forceJacobian(1, 1, 0.);
+	ConstSizeMatrix<1> forceJacobian_t(1, 1, 0.);
+
+	if (parameters.activeConnector)
+	{
+		forceJacobian(0, 0) = parameters.stiffness;
+		forceJacobian_t(0, 0) = parameters.damping;
+
+		if (parameters.dryFriction != 0.)
+		{
+			Real relVel = (markerData.GetMarkerData(1).vectorValue_t[0] - markerData.GetMarkerData(0).vectorValue_t[0]);
+			if (fabs(relVel) < parameters.dryFrictionProportionalZone)
+			{
+				forceJacobian_t(0, 0) += parameters.dryFriction / parameters.dryFrictionProportionalZone;
+			}
+		}
+	}
+
+	ComputeJacobianFromForceJacobian(forceJacobian, markerData.GetMarkerData(0).jacobian, markerData.GetMarkerData(1).jacobian, jacobian);
+	ComputeJacobianFromForceJacobian(forceJacobian_t, markerData.GetMarkerData(0).jacobian, markerData.GetMarkerData(1).jacobian, jacobian_ODE2_t);
 }
 
 ////! Flags to determine, which output variables are available (displacment, velocity, stress, ...)
@@ -15,6 +15,30 @@
 #include "Main/CSystemData.h"
 #include "Autogenerated/CObjectConnectorSpringDamper.h"
 
+#include<ostream> //for autodiff
+#include "../ngs-core-master/autodiff.hpp"
+
+typedef ngstd::AutoDiff<6, Real> DReal6; //derivatives w.r.t. relPos and relVel
+
+
+//! compute spring-damper force vector from relative position and velocity (without user function); templated for automatic differentiation
+template<class TReal>
+void ComputeSpringDamperForceVector(const CObjectConnectorSpringDamperParameters& parameters, 
+	const SlimVectorBase<TReal, 3>& relPos, const SlimVectorBase<TReal, 3>& relVel, SlimVectorBase<TReal, 3>& fVec)
+{
+	TReal springLength = sqrt(relPos[0] * relPos[0] + relPos[1] * relPos[1] + relPos[2] * relPos[2]);
+	CHECKandTHROW(springLength != 0., "CObjectConnectorSpringDamper::ComputeJacobianODE2_ODE2: springLength = 0");
+	TReal springLengthInv = 1. / springLength;
+
+	TReal force = parameters.stiffness * (springLength - parameters.referenceLength);
+	force += parameters.damping * springLengthInv * (relVel[0] * relPos[0] + relVel[1] * relPos[1] + relVel[2] * relPos[2]) + parameters.force;
+
+	for (Index i = 0; i < 3; i++)
+	{
+		fVec[i] = force * springLengthInv * relPos[i];
+	}
+}
+
 
 //compute the properties which are needed for computation of LHS and needed for OutputVariables
 void ComputeConnectorProperties(const MarkerDataStructure& markerData, const CObjectConnectorSpringDamperParameters& parameters,
@@ -97,9 +121,54 @@ void CObjectConnectorSpringDamper::ComputeODE2LHS(Vector& ode2Lhs, const MarkerD
 	}
 }
 
+//! jacobians are only available as functions, if no user function is used
+JacobianType::Type CObjectConnectorSpringDamper::GetAvailableJacobians() const
+{
+	if (parameters.springForceUserFunction)
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t);
+	}
+	return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function);
+}
+
+//! compute jacobians of ODE2LHS w.r.t. ODE2 coordinates and velocities, using automatic differentiation of the force vector w.r.t. relPos and relVel;
+//! marker jacobians are assumed to be constant (e.g. mass points, ANCF position markers)
 void CObjectConnectorSpringDamper::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
 {
-	CHECKandTHROWstring("ERROR: illegal call to CObjectConnectorSpringDamper::ComputeODE2LHSJacobian");
+	const ResizableMatrix& jacobian0 = markerData.GetMarkerData(0).positionJacobian;
+	const ResizableMatrix& jacobian1 = markerData.GetMarkerData(1).positionJacobian;
+	Matrix3D forceJacobian(3, 3, 0.);
+	Matrix3D forceJacobian_t(3, 3, 0.);
+
+	if (parameters.activeConnector)
+	{
+		Vector3D relPos = (markerData.GetMarkerData(1).position - markerData.GetMarkerData(0).position);
+		Vector3D relVel = (markerData.GetMarkerData(1).velocity - markerData.GetMarkerData(0).velocity);
+
+		SlimVectorBase<DReal6, 3> relPosAD;
+		SlimVectorBase<DReal6, 3> relVelAD;
+		SlimVectorBase<DReal6, 3> fVec;
+		for (Index i = 0; i < 3; i++)
+		{
+			relPosAD[i] = relPos[i];
+			relPosAD[i].DValue(i) = 1;
+			relVelAD[i] = relVel[i];
+			relVelAD[i].DValue(3 + i) = 1;
+		}
+		ComputeSpringDamperForceVector<DReal6>(parameters, relPosAD, relVelAD, fVec);
+
+		for (Index i = 0; i < 3; i++)
+		{
+			for (Index j = 0; j < 3; j++)
+			{
+				forceJacobian(i, j) = fVec[i].DValue(j);
+				forceJacobian_t(i, j) = fVec[i].DValue(3 + j);
+			}
+		}
+	}
+
+	ComputeJacobianFromForceJacobian(forceJacobian, jacobian0, jacobian1, jacobian);
+	ComputeJacobianFromForceJacobian(forceJacobian_t, jacobian0, jacobian1, jacobian_ODE2_t);
 }
 
 ////! Flags to determine, which output variables are available (displacment, velocity, stress, ...)
@@ -0,0 +1,493 @@
+/** ***********************************************************************************************
+* @brief        Implementation of CObjectContactSpheresTriangleMesh
+*
+* @author       agent
+* @date         2026-10-18 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See "LICENSE.txt" for more details.
+* @note         Bug reports, support and further information:
+                - email: johannes.gerstmayr@uibk.ac.at
+                - weblink: missing
+
+************************************************************************************************ */
+
+
+#include "Main/CSystemData.h"
+#include "Autogenerated/CNodeGenericData.h"
+
+//for consistency checks:
+#include "Main/MainSystem.h"
+#include "Pymodules/PybindUtilities.h"
+#include "Autogenerated/MainObjectContactSpheresTriangleMesh.h"
+
+#include<ostream> //for autodiff
+#include "../ngs-core-master/autodiff.hpp"
+
+typedef ngstd::AutoDiff<24, Real> DReal24; //derivatives w.r.t. position/rotation increments and velocities/angular velocities of both markers
+
+
+bool MainObjectContactSpheresTriangleMesh::CheckPreAssembleConsistency(const MainSystem& mainSystem, STDstring& errorString) const
+{
+	CObjectContactSpheresTriangleMesh* cObject = (CObjectContactSpheresTriangleMesh*)GetCObject();
+	const CObjectContactSpheresTriangleMeshParameters& parameters = cObject->GetParameters();
+	Index node = cObject->GetNodeNumber(0);
+
+	if (parameters.spherePositions.NumberOfRows() == 0 || parameters.spherePositions.NumberOfColumns() != 3)
+	{
+		errorString = "ObjectContactSpheresTriangleMesh: spherePositions must be a matrix with 3 columns and at least one row";
+		return false;
+	}
+
+	//check for valid node number already done prior to this function
+	if (std::strcmp(mainSystem.GetMainSystemData().GetMainNode(node).GetTypeName(), "GenericData") != 0)
+	{
+		errorString = "ObjectContactSpheresTriangleMesh: node must be of type 'GenericData'";
+		return false;
+	}
+
+	Index nc = ((const CNodeGenericData&)(cObject->GetCSystemData()->GetCNode(node))).GetNumberOfDataCoordinates();
+	if (nc != parameters.spherePositions.NumberOfRows())
+	{
+		errorString = STDstring("ObjectContactSpheresTriangleMesh: NodeGenericData (Node ") + EXUstd::ToString(node) + ") must have " + EXUstd::ToString(parameters.spherePositions.NumberOfRows())
+			+ " coordinates (found: " + EXUstd::ToString(nc) + ")";
+		return false;
+	}
+
+	if (parameters.sphereRadius + parameters.maximumPenetration <= 0)
+	{
+		errorString = "ObjectContactSpheresTriangleMesh: sphereRadius + maximumPenetration must be > 0";
+		return false;
+	}
+
+	//BVH is empty for empty or invalid meshes; rebuild of a valid mesh is cheap compared to simulation
+	if (parameters.meshTriangles.NumberOfRows() == 0 || !TriangleMeshBVH().Build(parameters.meshPoints, parameters.meshTriangles))
+	{
+		errorString = "ObjectContactSpheresTriangleMesh: meshPoints and meshTriangles must be matrices with 3 columns, at least one triangle and triangles must refer to valid point indices";
+		return false;
+	}
+
+	const ArrayIndex& nMarkers = cObject->GetMarkerNumbers();
+	for (Index i = 0; i < 2; i++)
+	{
+		Marker::Type markerType = mainSystem.GetCSystem()->GetSystemData().GetCMarker(nMarkers[i]).GetType();
+		if (!((markerType & Marker::Position) && (markerType & Marker::Orientation)))
+		{
+			errorString = STDstring("ObjectContactSpheresTriangleMesh: Marker ") + EXUstd::ToString(i) + " must be of type = 'Position' + 'Orientation' (e.g. MarkerBodyRigid)";
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//! compute global sphere center, closest point on mesh, contact normal (from mesh to sphere) and gap (negative for penetration) of sphere;
+//! returns false (and gap = search radius), if no triangle is within search radius
+bool CObjectContactSpheresTriangleMesh::ComputeSphereGap(const MarkerDataStructure& markerData, Index sphereIndex, Vector3D& sphereCenter,
+	Vector3D& meshPoint, Vector3D& contactNormal, Real& gap) const
+{
+	const Vector3D& p0 = markerData.GetMarkerData(0).position;
+	const Matrix3D& A0 = markerData.GetMarkerData(0).orientation;
+	const Vector3D& p1 = markerData.GetMarkerData(1).position;
+	const Matrix3D& A1 = markerData.GetMarkerData(1).orientation;
+
+	const Matrix& spheres = parameters.spherePositions;
+	sphereCenter = p0 + A0 * Vector3D({ spheres(sphereIndex, 0), spheres(sphereIndex, 1), spheres(sphereIndex, 2) });
+
+	//closest point search in mesh coordinates:
+	Real searchRadius = parameters.sphereRadius + parameters.maximumPenetration;
+	Vector3D localCenter = A1.GetTransposed() * (sphereCenter - p1);
+	Vector3D localMeshPoint;
+	Index triangleIndex;
+	if (!meshBVH.ClosestPoint(localCenter, searchRadius, localMeshPoint, triangleIndex))
+	{
+		meshPoint = sphereCenter;
+		contactNormal.SetAll(0.);
+		gap = searchRadius;
+		return false;
+	}
+
+	//normal points from mesh to sphere center, also at edges and vertices; sphere center behind triangle (normal side) gives negative distance
+	Vector3D triangleNormal = meshBVH.GetTriangleNormal(triangleIndex);
+	Vector3D localNormal = localCenter - localMeshPoint;
+	Real distance = localNormal.GetL2Norm();
+	if (distance != 0.)
+	{
+		localNormal *= 1. / distance;
+		if (localNormal * triangleNormal < 0.)
+		{
+			distance = -distance;
+			localNormal *= -1.;
+		}
+	}
+	else { localNormal = triangleNormal; }
+
+	gap = distance - parameters.sphereRadius;
+	meshPoint = p1 + A1 * localMeshPoint;
+	contactNormal = A1 * localNormal;
+	return true;
+}
+
+//! compute sum of contact forces acting on body of marker 0 and according torques w.r.t. marker 0 and marker 1 positions (global coordinates);
+//! contact state is taken from data coordinates or, if useCurrentGap=true, from current gap
+void CObjectContactSpheresTriangleMesh::ComputeContactForces(const MarkerDataStructure& markerData, bool useCurrentGap,
+	Vector3D& force, Vector3D& torque0, Vector3D& torque1) const
+{
+	force.SetAll(0.);
+	torque0.SetAll(0.);
+	torque1.SetAll(0.);
+
+	const Vector3D& p0 = markerData.GetMarkerData(0).position;
+	const Vector3D& v0 = markerData.GetMarkerData(0).velocity;
+	Vector3D omega0 = markerData.GetMarkerData(0).orientation * markerData.GetMarkerData(0).angularVelocityLocal;
+	const Vector3D& p1 = markerData.GetMarkerData(1).position;
+	const Vector3D& v1 = markerData.GetMarkerData(1).velocity;
+	Vector3D omega1 = markerData.GetMarkerData(1).orientation * markerData.GetMarkerData(1).angularVelocityLocal;
+
+	for (Index i = 0; i < parameters.spherePositions.NumberOfRows(); i++)
+	{
+		//data gap is not modified in Newton iterations ==> spheres far from contact are skipped without search in mesh
+		if (!useCurrentGap && GetCNode(0)->GetCurrentCoordinate(i) > 0) { continue; }
+
+		Vector3D sphereCenter, meshPoint, normal;
+		Real gap;
+		if (!ComputeSphereGap(markerData, i, sphereCenter, meshPoint, normal, gap)) { continue; }
+		if (useCurrentGap && gap > 0) { continue; }
+
+		//relative velocity of contact point (on sphere surface) w.r.t. mesh body:
+		Vector3D pC = sphereCenter - parameters.sphereRadius * normal;
+		Vector3D vRel = (v0 + omega0.CrossProduct(pC - p0)) - (v1 + omega1.CrossProduct(pC - p1));
+		Real vNormal = vRel * normal;
+
+		Real forceNormal = -(parameters.contactStiffness * gap + parameters.contactDamping * vNormal);
+		Vector3D f = forceNormal * normal;
+
+		//regularized Coulomb friction, see ConnectorRollingDiscPenalty:
+		Vector3D vTangent = vRel - vNormal * normal;
+		Real slipVelocity = vTangent.GetL2Norm();
+		if (parameters.frictionCoefficient != 0. && slipVelocity != 0.)
+		{
+			Real phi = 1.;
+			if (slipVelocity <= parameters.frictionProportionalZone)
+			{
+				Real fact = slipVelocity / parameters.frictionProportionalZone;
+				phi = (2. - fact)*fact;
+			}
+			f -= (parameters.frictionCoefficient * phi * fabs(forceNormal) / slipVelocity) * vTangent; //acts against slip velocity
+		}
+
+		force += f;
+		torque0 += (pC - p0).CrossProduct(f);
+		torque1 -= (pC - p1).CrossProduct(f);
+	}
+}
+
+bool CObjectContactSpheresTriangleMesh::IsActive() const
+{
+	if (!parameters.activeConnector) { return false; }
+	for (Index i = 0; i < parameters.spherePositions.NumberOfRows(); i++)
+	{
+		if (GetCNode(0)->GetCurrentCoordinate(i) <= 0) { return true; }
+	}
+	return false;
+}
+
+
+//! Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to "ode2Lhs"
+void CObjectContactSpheresTriangleMesh::ComputeODE2LHS(Vector& ode2Lhs, const MarkerDataStructure& markerData) const
+{
+	CHECKandTHROW(markerData.GetMarkerData(1).velocityAvailable && markerData.GetMarkerData(0).velocityAvailable,
+		"CObjectContactSpheresTriangleMesh::ComputeODE2LHS: marker do not provide velocityLevel information");
+
+	Index nColumns0 = markerData.GetMarkerData(0).positionJacobian.NumberOfColumns();
+	Index nColumns1 = markerData.GetMarkerData(1).positionJacobian.NumberOfColumns();
+	ode2Lhs.SetNumberOfItems(nColumns0 + nColumns1);
+	ode2Lhs.SetAll(0.);
+
+	if (parameters.activeConnector)
+	{
+		Vector3D force, torque0, torque1;
+		ComputeContactForces(markerData, false, force, torque0, torque1);
+
+		//now link ode2Lhs Vector to partial result using the two jacobians; LHS has negative sign of forces acting on bodies
+		if (nColumns1) //special case: COGround has (0,0) Jacobian
+		{
+			LinkedDataVector ldv1(ode2Lhs, nColumns0, nColumns1);
+			EXUmath::MultMatrixTransposedVector(markerData.GetMarkerData(1).positionJacobian, force, ldv1); //-(-force)
+			torque1 *= -1.;
+			EXUmath::MultMatrixTransposedVectorAdd(markerData.GetMarkerData(1).rotationJacobian, torque1, ldv1);
+		}
+
+		if (nColumns0) //special case: COGround has (0,0) Jacobian
+		{
+			force *= -1.;
+			torque0 *= -1.;
+			LinkedDataVector ldv0(ode2Lhs, 0, nColumns0);
+			EXUmath::MultMatrixTransposedVector(markerData.GetMarkerData(0).positionJacobian, force, ldv0);
+			EXUmath::MultMatrixTransposedVectorAdd(markerData.GetMarkerData(0).rotationJacobian, torque0, ldv0);
+		}
+	}
+}
+
+//! compute contact force f (acting on body of marker 0) and torques w.r.t. marker 0 and marker 1 positions of one sphere in contact, see ComputeContactForces;
+//! positions of markers are given as increments dp0, dp1 and rotations as (linearized) global rotation increments dPhi0, dPhi1 of the current configuration;
+//! the contact normal and the contact plane rotate with marker 1, which is exact for contact with triangle faces; templated for automatic differentiation
+template<class TReal>
+void ComputeSphereContactForce(const CObjectContactSpheresTriangleMeshParameters& parameters, const Vector3D& p0, const Vector3D& p1, 
+	const Vector3D& sphereCenter, const Vector3D& contactNormal, Real gap,
+	const SlimVectorBase<TReal, 3>& dp0, const SlimVectorBase<TReal, 3>& dPhi0, const SlimVectorBase<TReal, 3>& dp1, const SlimVectorBase<TReal, 3>& dPhi1,
+	const SlimVectorBase<TReal, 3>& v0, const SlimVectorBase<TReal, 3>& omega0, const SlimVectorBase<TReal, 3>& v1, const SlimVectorBase<TReal, 3>& omega1,
+	SlimVectorBase<TReal, 3>& f, SlimVectorBase<TReal, 3>& torque0, SlimVectorBase<TReal, 3>& torque1)
+{
+	SlimVectorBase<TReal, 3> pos0, pos1, sphereOffset, normal0;
+	for (Index i = 0; i < 3; i++)
+	{
+		pos0[i] = p0[i] + dp0[i];
+		pos1[i] = p1[i] + dp1[i];
+		sphereOffset[i] = sphereCenter[i] - p0[i];
+		normal0[i] = contactNormal[i];
+	}
+	SlimVectorBase<TReal, 3> center = pos0 + sphereOffset + dPhi0.CrossProduct(sphereOffset);
+	SlimVectorBase<TReal, 3> normal = normal0 + dPhi1.CrossProduct(normal0);
+
+	//gap = distance of sphere center to contact plane (fixed to marker 1) - sphereRadius:
+	Real planeOffset = gap - contactNormal * (sphereCenter - p1);
+	TReal currentGap = normal * (center - pos1) + planeOffset;
+
+	//relative velocity of contact point (on sphere surface) w.r.t. mesh body:
+	SlimVectorBase<TReal, 3> pC = center - (TReal)parameters.sphereRadius * normal;
+	SlimVectorBase<TReal, 3> vRel = (v0 + omega0.CrossProduct(pC - pos0)) - (v1 + omega1.CrossProduct(pC - pos1));
+	TReal vNormal = vRel * normal;
+
+	TReal forceNormal = -(parameters.contactStiffness * currentGap + parameters.contactDamping * vNormal);
+	f = forceNormal * normal;
+
+	//regularized Coulomb friction:
+	SlimVectorBase<TReal, 3> vTangent = vRel - vNormal * normal;
+	TReal slipVelocity = sqrt(vTangent * vTangent);
+	if (parameters.frictionCoefficient != 0. && slipVelocity != 0.)
+	{
+		TReal phi = 1.;
+		if (slipVelocity < parameters.frictionProportionalZone)
+		{
+			TReal fact = slipVelocity * (1. / parameters.frictionProportionalZone);
+			phi = (2. - fact)*fact;
+		}
+		TReal absForceNormal = forceNormal;
+		if (forceNormal < 0.) { absForceNormal = -forceNormal; }
+		f -= (parameters.frictionCoefficient * phi * absForceNormal / slipVelocity) * vTangent; //acts against slip velocity
+	}
+
+	torque0 = (pC - pos0).CrossProduct(f);
+	torque1 = -((pC - pos1).CrossProduct(f));
+}
+
+//! derivatives of [f0, torque0, f1, torque1] w.r.t. [dp0, dPhi0, dp1, dPhi1] (forceJacobian) and w.r.t. [v0, omega0, v1, omega1] (forceJacobian_t),
+//! computed by automatic differentiation for all spheres in contact; returns false, if no sphere is in contact
+bool CObjectContactSpheresTriangleMesh::ComputeContactForcesJacobian(const MarkerDataStructure& markerData, Matrix& forceJacobian, Matrix& forceJacobian_t) const
+{
+	forceJacobian.SetNumberOfRowsAndColumns(12, 12);
+	forceJacobian.SetAll(0.);
+	forceJacobian_t.SetNumberOfRowsAndColumns(12, 12);
+	forceJacobian_t.SetAll(0.);
+
+	const Vector3D& p0 = markerData.GetMarkerData(0).position;
+	const Vector3D& v0 = markerData.GetMarkerData(0).velocity;
+	Vector3D omega0 = markerData.GetMarkerData(0).orientation * markerData.GetMarkerData(0).angularVelocityLocal;
+	const Vector3D& p1 = markerData.GetMarkerData(1).position;
+	const Vector3D& v1 = markerData.GetMarkerData(1).velocity;
+	Vector3D omega1 = markerData.GetMarkerData(1).orientation * markerData.GetMarkerData(1).angularVelocityLocal;
+
+	bool hasContact = false;
+
+	for (Index i = 0; i < parameters.spherePositions.NumberOfRows(); i++)
+	{
+		//same contact state as in ComputeODE2LHS
+		if (GetCNode(0)->GetCurrentCoordinate(i) > 0) { continue; }
+
+		Vector3D sphereCenter, meshPoint, normal;
+		Real gap;
+		if (!ComputeSphereGap(markerData, i, sphereCenter, meshPoint, normal, gap)) { continue; }
+		hasContact = true;
+
+		SlimVectorBase<DReal24, 3> dp0, dPhi0, dp1, dPhi1, v0AD, omega0AD, v1AD, omega1AD;
+		for (Index k = 0; k < 3; k++)
+		{
+			dp0[k] = DReal24(0., (int)k);
+			dPhi0[k] = DReal24(0., (int)(3 + k));
+			dp1[k] = DReal24(0., (int)(6 + k));
+			dPhi1[k] = DReal24(0., (int)(9 + k));
+			v0AD[k] = DReal24(v0[k], (int)(12 + k));
+			omega0AD[k] = DReal24(omega0[k], (int)(15 + k));
+			v1AD[k] = DReal24(v1[k], (int)(18 + k));
+			omega1AD[k] = DReal24(omega1[k], (int)(21 + k));
+		}
+
+		SlimVectorBase<DReal24, 3> f, torque0, torque1;
+		ComputeSphereContactForce<DReal24>(parameters, p0, p1, sphereCenter, normal, gap, dp0, dPhi0, dp1, dPhi1, v0AD, omega0AD, v1AD, omega1AD, f, torque0, torque1);
+
+		for (Index k = 0; k < 3; k++)
+		{
+			for (Index j = 0; j < 12; j++)
+			{
+				forceJacobian(k, j) += f[k].DValue((int)j);
+				forceJacobian(3 + k, j) += torque0[k].DValue((int)j);
+				forceJacobian(6 + k, j) -= f[k].DValue((int)j); //force on body of marker 1
+				forceJacobian(9 + k, j) += torque1[k].DValue((int)j);
+
+				forceJacobian_t(k, j) += f[k].DValue((int)(12 + j));
+				forceJacobian_t(3 + k, j) += torque0[k].DValue((int)(12 + j));
+				forceJacobian_t(6 + k, j) -= f[k].DValue((int)(12 + j));
+				forceJacobian_t(9 + k, j) += torque1[k].DValue((int)(12 + j));
+			}
+		}
+	}
+	return hasContact;
+}
+
+//! jacobian of LHS = -G^T*[f0, torque0, f1, torque1] with the marker jacobians G = diag([positionJacobian0; rotationJacobian0], [positionJacobian1; rotationJacobian1]);
+//! derivatives of force and torques are computed in ComputeContactForcesJacobian; for rigid body markers, the derivatives of the marker jacobians
+//! (also contained in marker velocities) are not included here, but added by CSystem using ComputeMarkerForces(...)
+void CObjectContactSpheresTriangleMesh::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const
+{
+	Index nColumns0 = markerData.GetMarkerData(0).positionJacobian.NumberOfColumns();
+	Index nColumns1 = markerData.GetMarkerData(1).positionJacobian.NumberOfColumns();
+	Index nColumns = nColumns0 + nColumns1;
+
+	jacobian.SetNumberOfRowsAndColumns(nColumns, nColumns);
+	jacobian.SetAll(0.);
+	jacobian_ODE2_t.SetNumberOfRowsAndColumns(nColumns, nColumns);
+	jacobian_ODE2_t.SetAll(0.);
+
+	if (!parameters.activeConnector) { return; }
+
+	Matrix forceJacobian, forceJacobian_t;
+	if (!ComputeContactForcesJacobian(markerData, forceJacobian, forceJacobian_t)) { return; }
+
+	//marker jacobians map coordinates (velocities) to position and rotation increments (velocities and angular velocities) of markers
+	Matrix G(12, nColumns, 0.);
+	for (Index k = 0; k < 3; k++)
+	{
+		for (Index j = 0; j < nColumns0; j++)
+		{
+			G(k, j) = markerData.GetMarkerData(0).positionJacobian(k, j);
+			G(3 + k, j) = markerData.GetMarkerData(0).rotationJacobian(k, j);
+		}
+		for (Index j = 0; j < nColumns1; j++)
+		{
+			G(6 + k, nColumns0 + j) = markerData.GetMarkerData(1).positionJacobian(k, j);
+			G(9 + k, nColumns0 + j) = markerData.GetMarkerData(1).rotationJacobian(k, j);
+		}
+	}
+
+	//jacobian = -G^T*forceJacobian*G, because LHS has negative sign of forces acting on bodies
+	Matrix forceJacobianG = forceJacobian * G;
+	Matrix forceJacobianG_t = forceJacobian_t * G;
+	for (Index i = 0; i < nColumns; i++)
+	{
+		for (Index j = 0; j < nColumns; j++)
+		{
+			Real value = 0.;
+			Real value_t = 0.;
+			for (Index a = 0; a < 12; a++)
+			{
+				value -= G(a, i) * forceJacobianG(a, j);
+				value_t -= G(a, i) * forceJacobianG_t(a, j);
+			}
+			jacobian(i, j) = value;
+			jacobian_ODE2_t(i, j) = value_t;
+		}
+	}
+}
+
+//! markerForces = [f0, torque0, f1, torque1] (same contact state as in ComputeODE2LHS) and derivative w.r.t. [v0, omega0, v1, omega1]
+bool CObjectContactSpheresTriangleMesh::ComputeMarkerForces(const MarkerDataStructure& markerData, ResizableVector& markerForces, ResizableMatrix& markerForcesJacobian_t) const
+{
+	markerForces.SetNumberOfItems(12);
+	markerForces.SetAll(0.);
+	markerForcesJacobian_t.SetNumberOfRowsAndColumns(12, 12);
+	markerForcesJacobian_t.SetAll(0.);
+
+	if (parameters.activeConnector)
+	{
+		Vector3D force, torque0, torque1;
+		ComputeContactForces(markerData, false, force, torque0, torque1);
+		for (Index k = 0; k < 3; k++)
+		{
+			markerForces[k] = force[k];
+			markerForces[3 + k] = torque0[k];
+			markerForces[6 + k] = -force[k]; //force on body of marker 1
+			markerForces[9 + k] = torque1[k];
+		}
+
+		Matrix forceJacobian;
+		ComputeContactForcesJacobian(markerData, forceJacobian, markerForcesJacobian_t);
+	}
+	return true;
+}
+
+//! provide according output variable in "value"
+void CObjectContactSpheresTriangleMesh::GetOutputVariableConnector(OutputVariableType variableType, const MarkerDataStructure& markerData, Vector& value) const
+{
+	switch (variableType)
+	{
+	case OutputVariableType::Distance:
+	{
+		Real minGap = parameters.sphereRadius + parameters.maximumPenetration;
+		for (Index i = 0; i < parameters.spherePositions.NumberOfRows(); i++)
+		{
+			Vector3D sphereCenter, meshPoint, normal;
+			Real gap;
+			ComputeSphereGap(markerData, i, sphereCenter, meshPoint, normal, gap);
+			minGap = EXUstd::Minimum(minGap, gap);
+		}
+		value.SetVector({ minGap });
+		break;
+	}
+	case OutputVariableType::Force:
+	case OutputVariableType::Torque:
+	{
+		Vector3D force, torque0, torque1;
+		ComputeContactForces(markerData, false, force, torque0, torque1);
+		if (variableType == OutputVariableType::Force) { value.CopyFrom(force); }
+		else { value.CopyFrom(torque0); }
+		break;
+	}
+	default:
+		SysError("CObjectContactSpheresTriangleMesh::GetOutputVariable failed"); //error should not occur, because types are checked!
+	}
+}
+
+
+//! function called after Newton method; returns a residual error (force);
+//! done for two different computation states in order to estimate the correct time of contact
+Real CObjectContactSpheresTriangleMesh::PostNewtonStep(const MarkerDataStructure& markerDataCurrent, PostNewtonFlags::Type& flags)
+{
+	//return force-type error in case of contact: in case that the assumed contact state has been wrong,
+	//  the contact force (also negative) is returned as measure of the error
+	Real discontinuousError = 0;
+	flags = PostNewtonFlags::_None;
+	if (parameters.activeConnector)
+	{
+		LinkedDataVector currentState = ((CNodeData*)GetCNode(0))->GetCoordinateVector(ConfigurationType::Current);	//copy, but might change values ...
+
+		for (Index i = 0; i < parameters.spherePositions.NumberOfRows(); i++)
+		{
+			Vector3D sphereCenter, meshPoint, normal;
+			Real currentGap;
+			ComputeSphereGap(markerDataCurrent, i, sphereCenter, meshPoint, normal, currentGap);
+
+			if ((currentGap > 0 && currentState[i] <= 0) || (currentGap <= 0 && currentState[i] > 0))
+			{//action: state1=currentGapState, error = |currentGap*k|
+				discontinuousError += fabs((currentGap - currentState[i])* parameters.contactStiffness);
+				currentState[i] = currentGap;
+			}
+		}
+	}
+	return discontinuousError;
+}
+
+//! function called after discontinuous iterations have been completed for one step (e.g. to finalize history variables and set initial values for next step)
+void CObjectContactSpheresTriangleMesh::PostDiscontinuousIterationStep()
+{
+
+}
@@ -16,6 +16,11 @@
 #include "Autogenerated/CObjectRigidBody.h"
 #include "Utilities/RigidBodyMath.h"
 
+#include<ostream> //for autodiff
+#include "../ngs-core-master/autodiff.hpp"
+
+typedef ngstd::AutoDiff<8, Real> DReal8; //derivatives w.r.t. Euler parameters and their time derivatives
+
 //! number of ODE2 coordinates; depends on node
 Index CObjectRigidBody::GetODE2Size() const
 {
@@ -85,47 +90,59 @@ void CObjectRigidBody::ComputeMassMatrix(Matrix& massMatrix) const
 	//pout << "mass=" << massMatrix << "\n";
 }
 
-//! Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to "ode2Lhs"
-void CObjectRigidBody::ComputeODE2LHS(Vector& ode2Lhs) const
-{
-	ode2Lhs.SetNumberOfItems(GetODE2Size());
-	ode2Lhs.SetAll(0.);
+//! compute left-hand-side (LHS) of rigid body ODE2 equations (quadratic velocity terms) from local G-matrix Glocal (3 x number of rotation coordinates),
+//! local angular velocity omegaBar, Glocal_tTheta_t = Glocal_t * rot_t (only used if useGlocal_t=true) and rotation matrix A (only used if COM != 0);
+//! templated on the scalar type: Real in ComputeODE2LHS and automatic differentiation in ComputeJacobianODE2_ODE2 (matrices as std::array, as ConstSizeMatrixBase is only available for Real)
+template<class TReal> using RigidBodyGlocal = std::array<std::array<TReal, CNodeRigidBody::maxRotationCoordinates>, CNodeRigidBody::nDim3D>;
+template<class TReal> using RigidBodyRotationMatrix = std::array<std::array<TReal, CNodeRigidBody::nDim3D>, CNodeRigidBody::nDim3D>;
 
-	ConstSizeMatrix<9> localInertia;
-	RigidBodyMath::ComputeInertiaMatrix(parameters.physicsInertia, localInertia);
+template<class TReal, class TVector>
+void ComputeRigidBodyODE2LHS(const CObjectRigidBodyParameters& parameters, const ConstSizeMatrix<9>& localInertia,
+	const RigidBodyGlocal<TReal>& Glocal, Index nRotationCoordinates, const SlimVectorBase<TReal, CNodeRigidBody::nDim3D>& omegaBar,
+	bool useGlocal_t, const SlimVectorBase<TReal, CNodeRigidBody::nDim3D>& Glocal_tTheta_t, const RigidBodyRotationMatrix<TReal>& A, TVector& ode2Lhs)
+{
+	const Index nDisplacementCoordinates = CNodeRigidBody::maxDisplacementCoordinates; //same as CObjectRigidBody::nDisplacementCoordinates, see ComputeMassMatrix
+	const Index nDim3D = CNodeRigidBody::nDim3D;
+	for (Index i = 0; i < ode2Lhs.NumberOfItems(); i++) { ode2Lhs[i] = 0.; }
 
 	//compute forces1 and forces2 on left-hand-side (M*a + forces1 + forces2)
 	//compute: forces1 = Glocal^T * (omegaBar.Cross(localInertia*omegaBar))
-	ConstSizeMatrix<CNodeRigidBody::maxRotationCoordinates * nDim3D> Glocal;
-	((CNodeRigidBody*)GetCNode(0))->GetGlocal(Glocal);
-	Vector3D omegaBar = ((CNodeRigidBody*)GetCNode(0))->GetAngularVelocityLocal();
+	SlimVectorBase<TReal, nDim3D> inertiaOmegaBar;
+	for (Index i = 0; i < nDim3D; i++)
+	{
+		TReal value = 0.;
+		for (Index j = 0; j < nDim3D; j++) { value += localInertia(i, j) * omegaBar[j]; }
+		inertiaOmegaBar[i] = value;
+	}
 
 	//+++++++++++++++++++++++++++++++++++++
 	//Version1 (different to Version2 (gives different forces1; difference acting in the nullspace of rot):
-	Vector3D temp = omegaBar.CrossProduct(localInertia * omegaBar);
-	ConstSizeVector<CNodeRigidBody::maxRotationCoordinates> forces1; //forces acting on rotation coordinates
-	EXUmath::MultMatrixTransposedVector(Glocal, temp, forces1);
-
-	ConstSizeMatrix<CNodeRigidBody::maxRotationCoordinates * nDim3D> Glocal_t; //store this term for case with COM!=0
-	LinkedDataVector rot_t = ((CNodeRigidBody*)GetCNode(0))->GetRotationParameters_t();//store this term for case with COM!=0
-	Vector3D Glocal_tTheta_t(0); //used twice!
+	SlimVectorBase<TReal, nDim3D> temp = omegaBar.CrossProduct(inertiaOmegaBar);
+	SlimVectorBase<TReal, CNodeRigidBody::maxRotationCoordinates> forces1; //forces acting on rotation coordinates
+	for (Index i = 0; i < nRotationCoordinates; i++)
+	{
+		TReal value = 0.;
+		for (Index j = 0; j < nDim3D; j++) { value += Glocal[j][i] * temp[j]; }
+		forces1[i] = value;
+	}
 
-	//additional term, if not Euler Parameters
-	if ((((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationEulerParameters) == 0 && 
-		(((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationRotationVector) == 0) //for Euler parameters or rotation vector, the following terms vanish
+	//additional term, if not Euler Parameters or rotation vector (for which Glocal_t * rot_t vanishes)
+	if (useGlocal_t)
 	{
 		//compute: forces2 = Glocal^T * localInertia * Glocal_t * rot_t
-		ConstSizeVector<CNodeRigidBody::maxRotationCoordinates> forces2;
-		Vector3D temp2;
-
-		((CNodeRigidBody*)GetCNode(0))->GetGlocal_t(Glocal_t);
-		EXUmath::MultMatrixVector(Glocal_t, rot_t, Glocal_tTheta_t); //Glocal_tTheta_t stored for later usage!
-		EXUmath::MultMatrixVector(localInertia, Glocal_tTheta_t, temp2);
-		
-		EXUmath::MultMatrixTransposedVector(Glocal, temp2, forces2);
-		forces1 += forces2;
-		//pout << "forces2=" << forces2 << "\n";
-
+		SlimVectorBase<TReal, nDim3D> temp2;
+		for (Index i = 0; i < nDim3D; i++)
+		{
+			TReal value = 0.;
+			for (Index j = 0; j < nDim3D; j++) { value += localInertia(i, j) * Glocal_tTheta_t[j]; }
+			temp2[i] = value;
+		}
+		for (Index i = 0; i < nRotationCoordinates; i++)
+		{
+			TReal value = 0.;
+			for (Index j = 0; j < nDim3D; j++) { value += Glocal[j][i] * temp2[j]; }
+			forces1[i] += value;
+		}
 	}
 
 	//+++++++++++++++++++++++++++++++++++++
@@ -161,26 +178,141 @@ void CObjectRigidBody::ComputeODE2LHS(Vector& ode2Lhs) const
 	{
 		//add terms with Ubar=m*xBar_COM != 0; addForce is put on left-hand-side
 		//additional term: -A*[omegaBar x (Ubar x omegaBar) + Ubar x (Glocal_t * rot_t) ]
-		Vector3D Ubar = -parameters.physicsMass * parameters.physicsCenterOfMass;	//negative sign of -A[...]
-		Vector3D addForce = omegaBar.CrossProduct(Ubar.CrossProduct(omegaBar));		//omegaBar x (U x omegaBar)
+		SlimVectorBase<TReal, nDim3D> Ubar;												//negative sign of -A[...]
+		for (Index i = 0; i < nDim3D; i++) { Ubar[i] = -parameters.physicsMass * parameters.physicsCenterOfMass[i]; }
+		SlimVectorBase<TReal, nDim3D> addForce = omegaBar.CrossProduct(Ubar.CrossProduct(omegaBar));	//omegaBar x (U x omegaBar)
 
 		addForce += Ubar.CrossProduct(Glocal_tTheta_t);								//U x (Glocal_t * rot_t) (=0 if EulerParameters)
-		addForce = ((CNodeRigidBody*)GetCNode(0))->GetRotationMatrix() * addForce;	//A*[...]
 
 		for (Index i = 0; i < nDim3D; i++)
 		{
-			ode2Lhs[i] += addForce[i]; //positive sign, because object ODEforces are put on LHS
+			TReal value = 0.;
+			for (Index j = 0; j < nDim3D; j++) { value += A[i][j] * addForce[j]; }	//A*[...]
+			ode2Lhs[i] += value; //positive sign, because object ODEforces are put on LHS
 		}
 	}
 
-	for (Index i = 0; i < ((CNodeRigidBody*)GetCNode(0))->GetNumberOfRotationCoordinates(); i++)
+	for (Index i = 0; i < nRotationCoordinates; i++)
 	{
 		ode2Lhs[i + nDisplacementCoordinates] += forces1[i]; //positive sign, because object ODEforces are put on LHS
 	}
+}
+
+//! Computational function: compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to "ode2Lhs"
+void CObjectRigidBody::ComputeODE2LHS(Vector& ode2Lhs) const
+{
+	ode2Lhs.SetNumberOfItems(GetODE2Size());
+
+	ConstSizeMatrix<9> localInertia;
+	RigidBodyMath::ComputeInertiaMatrix(parameters.physicsInertia, localInertia);
+
+	ConstSizeMatrix<CNodeRigidBody::maxRotationCoordinates * nDim3D> GlocalMatrix;
+	((CNodeRigidBody*)GetCNode(0))->GetGlocal(GlocalMatrix);
+	Index nRotationCoordinates = GlocalMatrix.NumberOfColumns();
+	RigidBodyGlocal<Real> Glocal;
+	for (Index i = 0; i < nDim3D; i++)
+	{
+		for (Index j = 0; j < nRotationCoordinates; j++) { Glocal[i][j] = GlocalMatrix(i, j); }
+	}
+	Vector3D omegaBar = ((CNodeRigidBody*)GetCNode(0))->GetAngularVelocityLocal();
+
+	Vector3D Glocal_tTheta_t(0);
+	bool useGlocal_t = (((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationEulerParameters) == 0 &&
+		(((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationRotationVector) == 0; //for Euler parameters or rotation vector, the terms with Glocal_t vanish
+	if (useGlocal_t)
+	{
+		ConstSizeMatrix<CNodeRigidBody::maxRotationCoordinates * nDim3D> Glocal_t;
+		LinkedDataVector rot_t = ((CNodeRigidBody*)GetCNode(0))->GetRotationParameters_t();
+		((CNodeRigidBody*)GetCNode(0))->GetGlocal_t(Glocal_t);
+		EXUmath::MultMatrixVector(Glocal_t, rot_t, Glocal_tTheta_t);
+	}
 
+	RigidBodyRotationMatrix<Real> A;
+	if (!(parameters.physicsCenterOfMass == 0.))
+	{
+		Matrix3D rotationMatrix = ((CNodeRigidBody*)GetCNode(0))->GetRotationMatrix();
+		for (Index i = 0; i < nDim3D; i++)
+		{
+			for (Index j = 0; j < nDim3D; j++) { A[i][j] = rotationMatrix(i, j); }
+		}
+	}
+
+	ComputeRigidBodyODE2LHS<Real>(parameters, localInertia, Glocal, nRotationCoordinates, omegaBar, useGlocal_t, Glocal_tTheta_t, A, ode2Lhs);
 	//pout << "ode2Lhs=" << ode2Lhs << "\n";
 }
 
+//! ODE2 jacobian functions only available for Euler parameters; other rotation parameterizations use numerical differentiation
+JacobianType::Type CObjectRigidBody::GetAvailableJacobians() const
+{
+	if (((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationEulerParameters)
+	{
+		return (JacobianType::Type)(JacobianType::ODE2_ODE2 + JacobianType::ODE2_ODE2_t + JacobianType::ODE2_ODE2_function + JacobianType::ODE2_ODE2_t_function +
+			JacobianType::AE_ODE2 + JacobianType::AE_ODE2_function);
+	}
+	return (JacobianType::Type)(JacobianType::AE_ODE2 + JacobianType::AE_ODE2_function);
+}
+
+//! compute jacobians of ODE2LHS w.r.t. ODE2 coordinates and velocities, using automatic differentiation w.r.t. Euler parameters and their time derivatives;
+//! LHS does not depend on displacement coordinates and velocities
+void CObjectRigidBody::ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t) const
+{
+	CHECKandTHROW(((CNodeRigidBody*)GetCNode(0))->GetType() & Node::Type::RotationEulerParameters,
+		"CObjectRigidBody::ComputeJacobianODE2_ODE2: only available for Euler parameter nodes");
+
+	const Index nODE2 = nDisplacementCoordinates + 4;
+	jacobian.SetNumberOfRowsAndColumns(nODE2, nODE2);
+	jacobian_ODE2_t.SetNumberOfRowsAndColumns(nODE2, nODE2);
+	jacobian.SetAll(0.);
+	jacobian_ODE2_t.SetAll(0.);
+
+	ConstSizeMatrix<9> localInertia;
+	RigidBodyMath::ComputeInertiaMatrix(parameters.physicsInertia, localInertia);
+
+	ConstSizeVector<CNodeRigidBody::maxRotationCoordinates> ep0 = ((CNodeRigidBody*)GetCNode(0))->GetRotationParameters();
+	LinkedDataVector ep0_t = ((CNodeRigidBody*)GetCNode(0))->GetRotationParameters_t();
+
+	SlimVectorBase<DReal8, 4> ep;
+	SlimVectorBase<DReal8, 4> ep_t;
+	for (Index i = 0; i < 4; i++)
+	{
+		ep[i] = ep0[i];
+		ep[i].DValue(i) = 1;
+		ep_t[i] = ep0_t[i];
+		ep_t[i].DValue(4 + i) = 1;
+	}
+
+	//Glocal = 2*[-ep1, ep0, ep3,-ep2; -ep2,-ep3, ep0, ep1; -ep3, ep2,-ep1, ep0], see RigidBodyMath::EP2GlocalTemplate
+	RigidBodyGlocal<DReal8> Glocal = { { { -2.*ep[1], 2.*ep[0], 2.*ep[3],-2.*ep[2] },
+										 { -2.*ep[2],-2.*ep[3], 2.*ep[0], 2.*ep[1] },
+										 { -2.*ep[3], 2.*ep[2],-2.*ep[1], 2.*ep[0] } } };
+	SlimVectorBase<DReal8, nDim3D> omegaBar;
+	for (Index i = 0; i < nDim3D; i++)
+	{
+		omegaBar[i] = 0.;
+		for (Index j = 0; j < 4; j++) { omegaBar[i] += Glocal[i][j] * ep_t[j]; }
+	}
+
+	//rotation matrix A, see RigidBodyMath::EP2RotationMatrixTemplate
+	RigidBodyRotationMatrix<DReal8> A = { { { -2.0*ep[3] * ep[3] - 2.0*ep[2] * ep[2] + 1.0, -2.0*ep[3] * ep[0] + 2.0*ep[2] * ep[1], 2.0*ep[3] * ep[1] + 2.0*ep[2] * ep[0] },
+											{ 2.0*ep[3] * ep[0] + 2.0*ep[2] * ep[1], -2.0*ep[3] * ep[3] - 2.0*ep[1] * ep[1] + 1.0, 2.0*ep[3] * ep[2] - 2.0*ep[1] * ep[0] },
+											{ -2.0*ep[2] * ep[0] + 2.0*ep[3] * ep[1], 2.0*ep[3] * ep[2] + 2.0*ep[1] * ep[0], -2.0*ep[2] * ep[2] - 2.0*ep[1] * ep[1] + 1.0 } } };
+
+	SlimVectorBase<DReal8, nDim3D> Glocal_tTheta_t; //Glocal_t * ep_t = 0 for Euler parameters
+	for (Index i = 0; i < nDim3D; i++) { Glocal_tTheta_t[i] = 0.; }
+
+	SlimVectorBase<DReal8, 7> ode2Lhs;
+	ComputeRigidBodyODE2LHS<DReal8>(parameters, localInertia, Glocal, 4, omegaBar, false, Glocal_tTheta_t, A, ode2Lhs);
+
+	for (Index i = 0; i < nODE2; i++)
+	{
+		for (Index j = 0; j < 4; j++)
+		{
+			jacobian(i, nDisplacementCoordinates + j) = ode2Lhs[i].DValue(j);
+			jacobian_ODE2_t(i, nDisplacementCoordinates + j) = ode2Lhs[i].DValue(4 + j);
+		}
+	}
+}
+
 //! Compute algebraic equations part of rigid body
 void CObjectRigidBody::ComputeAlgebraicEquations(Vector& algebraicEquations, bool useIndex2) const
 {
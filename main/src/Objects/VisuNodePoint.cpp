@@ -61,6 +61,7 @@
 #include "Autogenerated/VisuObjectContactCoordinate.h"
 #include "Autogenerated/VisuObjectContactCircleCable2D.h"
 #include "Autogenerated/VisuObjectContactFrictionCircleCable2D.h"
+#include "Autogenerated/VisuObjectContactSpheresTriangleMesh.h"
 #include "Autogenerated/VisuObjectJointGeneric.h"
 #include "Autogenerated/VisuObjectJointSpherical.h"
 #include "Autogenerated/VisuObjectJointRollingDisc.h"
@@ -123,6 +124,7 @@
 #include "Autogenerated/CObjectContactCoordinate.h"
 #include "Autogenerated/CObjectContactCircleCable2D.h"
 #include "Autogenerated/CObjectContactFrictionCircleCable2D.h"
+#include "Autogenerated/CObjectContactSpheresTriangleMesh.h"
 #include "Autogenerated/CObjectJointGeneric.h"
 #include "Autogenerated/CObjectJointSpherical.h"
 #include "Autogenerated/CObjectJointRollingDisc.h"
@@ -498,8 +500,8 @@ void VisualizationObjectMassPoint::UpdateGraphics(const VisualizationSettings& v
 
 	Float3 refPos3DF; refPos3DF.CopyFrom(refPos3D);
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, EXUmath::unitMatrix3DF);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, EXUmath::unitMatrix3DF, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 
@@ -514,8 +516,8 @@ void VisualizationObjectMassPoint2D::UpdateGraphics(const VisualizationSettings&
 	Vector3D refPos3D = cObject->GetPosition(Vector3D(0.), ConfigurationType::Visualization);
 	Float3 refPos3DF; refPos3DF.CopyFrom(refPos3D);
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, EXUmath::unitMatrix3DF);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, EXUmath::unitMatrix3DF, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 }
@@ -529,8 +531,8 @@ void VisualizationObjectMass1D::UpdateGraphics(const VisualizationSettings& visu
 	Vector3D refPos3D = cObject->GetPosition(Vector3D(0.), ConfigurationType::Visualization);
 	Float3 refPos3DF; refPos3DF.CopyFrom(refPos3D);
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, EXUmath::unitMatrix3DF);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, EXUmath::unitMatrix3DF, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 }
@@ -545,8 +547,8 @@ void VisualizationObjectRotationalMass1D::UpdateGraphics(const VisualizationSett
 	Float3 refPos3DF; refPos3DF.CopyFrom(refPos3D);
 	Matrix3DF A; A.CopyFrom(cObject->GetRotationMatrix(Vector3D(0.), ConfigurationType::Visualization));
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, A);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, A, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 }
@@ -562,8 +564,8 @@ void VisualizationObjectRigidBody::UpdateGraphics(const VisualizationSettings& v
 	Float3 refPos3DF; refPos3DF.CopyFrom(refPos3D);
 	Matrix3DF A; A.CopyFrom(cObject->GetRotationMatrix(Vector3D(0.), ConfigurationType::Visualization));
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, A);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, A, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 
@@ -583,8 +585,8 @@ void VisualizationObjectRigidBody2D::UpdateGraphics(const VisualizationSettings&
 	Matrix3DF A;
 	A.CopyFrom(cObject->GetRotationMatrix(Vector3D(0.), ConfigurationType::Visualization));
 
-	//transform graphics data with rigid body transformation (includes lines, triangles, points, ...)
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, A);
+	//retained graphics data (includes lines, triangles, points, ...) is generated once; only rigid body transformation is updated
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, A, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 
@@ -848,7 +850,7 @@ void VisualizationObjectGround::UpdateGraphics(const VisualizationSettings& visu
 	Float3 refPos3DF;
 	refPos3DF.CopyFrom(refPos3D); // ({ (float)pos3D[0], (float)pos3D[1], (float)pos3D[2] });
 
-	AddBodyGraphicsData(graphicsData, vSystem->graphicsData, refPos3DF, EXUmath::unitMatrix3DF);
+	AddRigidBodyGraphicsData(graphicsData, vSystem->graphicsData, itemNumber, refPos3DF, EXUmath::unitMatrix3DF, ResetParametersHaveChanged());
 
 	if (visualizationSettings.bodies.showNumbers) { EXUvis::DrawItemNumber(refPos3D, vSystem, itemNumber, "", currentColor); }
 }
@@ -1323,6 +1325,61 @@ void VisualizationObjectContactFrictionCircleCable2D::UpdateGraphics(const Visua
 
 }
 
+void VisualizationObjectContactSpheresTriangleMesh::UpdateGraphics(const VisualizationSettings& visualizationSettings, VisualizationSystem* vSystem, Index itemNumber)
+{
+	Float4 currentColor = visualizationSettings.connectors.defaultColor;
+
+	CObjectContactSpheresTriangleMesh* cItem = (CObjectContactSpheresTriangleMesh*)vSystem->systemData->GetCObjects()[itemNumber];
+
+	Vector3D pos[2];
+	vSystem->systemData->GetCMarkers()[cItem->GetMarkerNumbers()[0]]->GetPosition(*vSystem->systemData, pos[0], ConfigurationType::Visualization);
+	vSystem->systemData->GetCMarkers()[cItem->GetMarkerNumbers()[1]]->GetPosition(*vSystem->systemData, pos[1], ConfigurationType::Visualization);
+
+	Matrix3D rot[2];
+	vSystem->systemData->GetCMarkers()[cItem->GetMarkerNumbers()[0]]->GetRotationMatrix(*vSystem->systemData, rot[0], ConfigurationType::Visualization);
+	vSystem->systemData->GetCMarkers()[cItem->GetMarkerNumbers()[1]]->GetRotationMatrix(*vSystem->systemData, rot[1], ConfigurationType::Visualization);
+
+	if (visualizationSettings.connectors.showContact)
+	{
+		if (color[0] != -1.f) { currentColor = color; }
+
+		Real r = cItem->GetParameters().sphereRadius; //radius of spheres
+		if (r == 0.)
+		{
+			r = 0.5*drawSize;
+			if (drawSize == -1.f) { r = 0.5*visualizationSettings.connectors.contactPointsDefaultSize; } //use default size
+		}
+
+		//draw spheres; change color to red, if contact:
+		const Matrix& spheres = cItem->GetParameters().spherePositions;
+		for (Index i = 0; i < spheres.NumberOfRows(); i++)
+		{
+			Vector3D pSphere = pos[0] + rot[0] * Vector3D({ spheres(i, 0), spheres(i, 1), spheres(i, 2) });
+			Float4 contactColor = currentColor;
+			if (cItem->GetCNode(0)->GetVisualizationCoordinateVector()[i] <= 0) //this is the gap at the end of the discontinuous iteration
+			{
+				contactColor = Float4({ 1.,0.,0.,1. });
+			}
+			EXUvis::DrawSphere(pSphere, r, contactColor, vSystem->graphicsData, visualizationSettings.general.sphereTiling);
+		}
+
+		//draw edges of triangle mesh (edges shared by two triangles are drawn twice):
+		if (showMesh)
+		{
+			const ResizableArray<Vector3D>& points = cItem->GetMeshBVH().GetPoints();
+			for (const Index3& triangle : cItem->GetMeshBVH().GetTriangles())
+			{
+				for (Index j = 0; j < 3; j++)
+				{
+					vSystem->graphicsData.AddLine(pos[1] + rot[1] * points[triangle[j]], pos[1] + rot[1] * points[triangle[(j + 1) % 3]], currentColor, currentColor);
+				}
+			}
+		}
+	}
+
+	if (visualizationSettings.connectors.showNumbers) { EXUvis::DrawItemNumber(pos[0], vSystem, itemNumber, "", currentColor); }
+}
+
 void VisualizationObjectJointGeneric::UpdateGraphics(const VisualizationSettings& visualizationSettings, VisualizationSystem* vSystem, Index itemNumber)
 {
 	Float4 currentColor = visualizationSettings.connectors.defaultColor;
@@ -57,6 +57,7 @@ using namespace pybind11::literals; //brings in the '_a' literals; e.g. for shor
 #include "System/versionCpp.h"
 
 #include "Linalg/LinearSolver.h"
+#include "Linalg/SparseEigenSolver.h"
 
 #include "Linalg/Geometry.h"
 
@@ -75,8 +76,10 @@ using namespace pybind11::literals; //brings in the '_a' literals; e.g. for shor
 
 #include "Solver/CSolverImplicitSecondOrder.h"
 #include "Solver/CSolverStatic.h"
+#include "Solver/CSolverExplicit.h"
 #include "Solver/MainSolverBase.h"
 #include "Autogenerated/MainSolver.h" //pybind access to solvers
+#include "Solver/MainSolverBatch.h" //batch solver for many variants in parallel threads
 #include "Autogenerated/SimulationSettings.h" 
 #include "Autogenerated/DictionariesGetSet.h"
 
@@ -216,6 +219,113 @@ void PyStopOpenGLRenderer()
 #endif
 }
 
+//! size of square sparse matrix given as numpy array of triplets [row, column, value] (sparse format of FEM module) = maximum index+1
+Index NumPyTripletsMatrixSize(const py::array_t<Real>& triplets)
+{
+	if (triplets.size() == 0) { return 0; }
+	if (triplets.ndim() != 2 || triplets.shape(1) != 3) 
+	{ 
+		CHECKandTHROWstring("sparse matrix must be numpy array with rows [row, column, value]"); 
+	}
+	auto data = triplets.unchecked<2>();
+	Real maxIndex = 0;
+	for (py::ssize_t i = 0; i < data.shape(0); i++)
+	{
+		if (data(i, 0) < 0 || data(i, 1) < 0) { CHECKandTHROWstring("sparse matrix: row and column indices must not be negative"); }
+		maxIndex = EXUstd::Maximum(maxIndex, EXUstd::Maximum(data(i, 0), data(i, 1)));
+	}
+	return (Index)maxIndex + 1;
+}
+
+//! convert numpy array of triplets [row, column, value] to Eigen sparse matrix of given size; duplicate entries are summed up
+void NumPyTriplets2EigenSparse(const py::array_t<Real>& triplets, Index size, EigenSparseMatrix& matrix)
+{
+	EigenTripletVector eigenTriplets;
+	if (triplets.size() != 0)
+	{
+		auto data = triplets.unchecked<2>();
+		eigenTriplets.reserve(data.shape(0));
+		for (py::ssize_t i = 0; i < data.shape(0); i++)
+		{
+			eigenTriplets.push_back(EigenTriplet((StorageIndex)data(i, 0), (StorageIndex)data(i, 1), data(i, 2)));
+		}
+	}
+	matrix.resize(size, size);
+	matrix.setFromTriplets(eigenTriplets.begin(), eigenTriplets.end());
+}
+
+//! compute eigenvalues closest to shift and eigenvectors of K*phi = lambda*M*phi with sparse shift-invert Lanczos solver;
+//! matrices are numpy arrays of triplets [row, column, value]; returns [eigenValues, eigenVectors], which own the results (no copy)
+py::list PyComputeSparseEigenvalues(const py::array_t<Real>& stiffnessMatrix, const py::array_t<Real>& massMatrix, 
+	Index numberOfEigenvalues, Real shift, Real tolerance, bool computeEigenVectors)
+{
+	Index n = EXUstd::Maximum(NumPyTripletsMatrixSize(stiffnessMatrix), NumPyTripletsMatrixSize(massMatrix));
+	if (numberOfEigenvalues < 1 || numberOfEigenvalues > n)
+	{
+		PyError("ComputeSparseEigenvalues: numberOfEigenvalues must be at least 1 and not larger than size of matrices");
+		return py::list();
+	}
+	EigenSparseMatrix K, M;
+	NumPyTriplets2EigenSparse(stiffnessMatrix, n, K);
+	NumPyTriplets2EigenSparse(massMatrix, n, M);
+
+	SparseEigenSolver eigenSolver;
+	eigenSolver.SetParameters(numberOfEigenvalues, shift, tolerance, computeEigenVectors);
+	Index result = eigenSolver.ComputeSymmetric(K, M);
+	if (result == SparseEigenSolver::factorizationFailed)
+	{
+		PyError("ComputeSparseEigenvalues: factorization of shifted stiffness matrix failed; try different shift");
+		return py::list();
+	}
+	else if (result == SparseEigenSolver::notConverged)
+	{
+		PyWarning("ComputeSparseEigenvalues: only " + EXUstd::ToString(eigenSolver.GetNumberOfConvergedEigenvalues()) +
+			" of " + EXUstd::ToString(numberOfEigenvalues) + " eigenvalues converged; increase tolerance");
+	}
+
+	py::list list;
+	list.append(EPyUtils::DenseVectorMove2NumPy(eigenSolver.GetEigenValues()));
+	list.append(EPyUtils::DenseMatrixMove2NumPy(eigenSolver.GetEigenVectors()));
+	return list;
+}
+
+//! compute complex eigenvalues closest to shift and eigenvectors of gyroscopic system (lambda^2*M + lambda*gyroscopicFactor*G + K)*phi = 0 
+//! with sparse shift-invert Arnoldi solver; matrices are numpy arrays of triplets [row, column, value]; returns [eigenValues, eigenVectors]
+py::list PyComputeSparseGyroscopicEigenvalues(const py::array_t<Real>& stiffnessMatrix, const py::array_t<Real>& gyroscopicMatrix, 
+	const py::array_t<Real>& massMatrix, Real gyroscopicFactor, Index numberOfEigenvalues, Real shift, Real tolerance, bool computeEigenVectors)
+{
+	Index n = EXUstd::Maximum(NumPyTripletsMatrixSize(stiffnessMatrix), NumPyTripletsMatrixSize(massMatrix));
+	n = EXUstd::Maximum(n, NumPyTripletsMatrixSize(gyroscopicMatrix));
+	if (numberOfEigenvalues < 1 || numberOfEigenvalues > 2 * n)
+	{
+		PyError("ComputeSparseGyroscopicEigenvalues: numberOfEigenvalues must be at least 1 and not larger than twice the size of matrices");
+		return py::list();
+	}
+	EigenSparseMatrix K, G, M;
+	NumPyTriplets2EigenSparse(stiffnessMatrix, n, K);
+	NumPyTriplets2EigenSparse(gyroscopicMatrix, n, G);
+	NumPyTriplets2EigenSparse(massMatrix, n, M);
+
+	SparseEigenSolver eigenSolver;
+	eigenSolver.SetParameters(numberOfEigenvalues, shift, tolerance, computeEigenVectors);
+	Index result = eigenSolver.ComputeGyroscopic(K, G, M, gyroscopicFactor);
+	if (result == SparseEigenSolver::factorizationFailed)
+	{
+		PyError("ComputeSparseGyroscopicEigenvalues: factorization of shifted system matrix failed; try different shift");
+		return py::list();
+	}
+	else if (result == SparseEigenSolver::notConverged)
+	{
+		PyWarning("ComputeSparseGyroscopicEigenvalues: only " + EXUstd::ToString(eigenSolver.GetNumberOfConvergedEigenvalues()) +
+			" of " + EXUstd::ToString(numberOfEigenvalues) + " eigenvalues converged; increase tolerance");
+	}
+
+	py::list list;
+	list.append(EPyUtils::DenseVectorMove2NumPy(eigenSolver.GetComplexEigenValues()));
+	list.append(EPyUtils::DenseMatrixMove2NumPy(eigenSolver.GetComplexEigenVectors()));
+	return list;
+}
+
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 //++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
@@ -549,6 +659,23 @@ PYBIND11_MODULE(exudynCPP, m) {
 	//+++++++++++++++++++++++++++++++++++++++++++
 	//+++++++++++++++++++++++++++++++++++++++++++
 	//+++++++++++++++++++++++++++++++++++++++++++
+	//zero-copy view on system state vector, obtained e.g. with mbs.systemData.GetODE2CoordinatesView()
+	py::class_<MainSystemStateView>(m, "SystemStateView", py::buffer_protocol(), "SystemStateView: zero-copy view on a system state vector; use np.asarray(view) or view[...] to read and write coordinates in place; invalid after mbs.Assemble() or mbs.Reset()")
+		.def_buffer([](const MainSystemStateView& view) { return view.GetBufferInfo(); })
+		.def("IsValid", &MainSystemStateView::IsValid, "return True, if view still links to the system state vector; False after mbs.Assemble() or mbs.Reset()")
+		.def("__len__", &MainSystemStateView::NumberOfItems, "return number of coordinates in view")
+		.def("__getitem__", [](const py::object& self, const py::object& key) {
+			return py::object(self.cast<const MainSystemStateView&>().GetArray(self)[key]);
+		}, "read coordinates of state vector with index or slice; slices link to the state vector (no copy)")
+		.def("__setitem__", [](const py::object& self, const py::object& key, const py::object& value) {
+			self.cast<const MainSystemStateView&>().GetArray(self)[key] = value;
+		}, "write coordinates of state vector in place with index or slice")
+		.def("__repr__", &MainSystemStateView::GetRepresentation, "return the string representation of the view")
+		;
+
+	//+++++++++++++++++++++++++++++++++++++++++++
+	//+++++++++++++++++++++++++++++++++++++++++++
+	//+++++++++++++++++++++++++++++++++++++++++++
 	//MAINSYSTEMCONTAINER
 	py::class_<MainSystemContainer>(m, "SystemContainer", "SystemContainer: Contains a set of (multibody) systems")
 		.def(py::init<>())
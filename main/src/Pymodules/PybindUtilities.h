@@ -564,6 +564,27 @@ namespace EPyUtils {
 		return py::array_t<float>(std::vector<std::ptrdiff_t>{(int)matrix.NumberOfRows(), (int)matrix.NumberOfColumns()}, matrix.GetDataPointer());
 	}
 
+	//!move dense vector (e.g. Eigen vector) into numpy array without copying data; the numpy array owns the data, vector is empty afterwards
+	template<class TDenseVector>
+	inline py::array_t<typename TDenseVector::Scalar> DenseVectorMove2NumPy(TDenseVector& vector)
+	{
+		typedef typename TDenseVector::Scalar T;
+		TDenseVector* owner = new TDenseVector(std::move(vector));
+		py::capsule deleteOwner(owner, [](void* data) { delete reinterpret_cast<TDenseVector*>(data); });
+		return py::array_t<T>(std::vector<py::ssize_t>({ (py::ssize_t)owner->size() }), owner->data(), deleteOwner);
+	}
+
+	//!move column-major dense matrix (e.g. Eigen matrix) into numpy array without copying data; the numpy array owns the data, matrix is empty afterwards
+	template<class TDenseMatrix>
+	inline py::array_t<typename TDenseMatrix::Scalar> DenseMatrixMove2NumPy(TDenseMatrix& matrix)
+	{
+		typedef typename TDenseMatrix::Scalar T;
+		TDenseMatrix* owner = new TDenseMatrix(std::move(matrix));
+		py::capsule deleteOwner(owner, [](void* data) { delete reinterpret_cast<TDenseMatrix*>(data); });
+		return py::array_t<T>(std::vector<py::ssize_t>({ (py::ssize_t)owner->rows(), (py::ssize_t)owner->cols() }),
+			std::vector<py::ssize_t>({ (py::ssize_t)sizeof(T), (py::ssize_t)sizeof(T) * (py::ssize_t)owner->rows() }), owner->data(), deleteOwner);
+	}
+
 
 	//!convert numpy matrix to Matrix
 	template<typename T>
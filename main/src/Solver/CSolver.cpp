@@ -72,6 +72,7 @@ STDstring CSolverTimer::ToString() const
 		ostr << "  overhead          = " << overhead / sum << "%\n";
 		ostr << "  python            = " << python / sum << "%\n";
 		ostr << "  visualization/user= " << visualization / sum << "%\n";
+		ostr << "  visualizationWait = " << visualizationWait / sum << "%\n";
 	}
 	else
 	{
@@ -104,6 +105,7 @@ void SolverLocalData::CleanUpMemory()
 	systemJacobianSparse.Reset();
 	systemMassMatrixSparse.Reset();
 	jacobianAEsparse.Reset();
+	systemJacobianSparseIterative.Reset();
 
 	//+++++++++++++++++++++++++++
 	systemResidual.Reset();
@@ -133,7 +135,12 @@ void SolverLocalData::SetLinearSolverType(LinearSolverType linearSolverType)
 		systemJacobian = &systemJacobianSparse;
 		systemMassMatrix = &systemMassMatrixSparse;
 		jacobianAE = &jacobianAEsparse;
+		if (linearSolverType == LinearSolverType::EigenSparseIterative)
+		{
+			systemJacobian = &systemJacobianSparseIterative; //only system jacobian is solved iteratively
+		}
 	}
+	this->linearSolverType = linearSolverType;
 }
 
 
@@ -149,6 +156,20 @@ std::string SolverIterationData::ToString() const
 	{
 		ostr << "rejected modified Newton steps:      " << rejectedModifiedNewtonSteps << "\n";
 	}
+	if (patternAnalysisCount || patternReuseCount)
+	{
+		ostr << "sparse pattern analyses (misses):  " << patternAnalysisCount << "\n";
+		ostr << "sparse pattern reused (hits):      " << patternReuseCount << "\n";
+	}
+	if (preconditionerCount)
+	{
+		ostr << "linear solver preconditioners:     " << preconditionerCount << "\n";
+		ostr << "linear solver iterations:          " << linearSolverIterationsCount << "\n";
+		if (linearSolverNonConvergedCount)
+		{
+			ostr << "linear solves not converged:       " << linearSolverNonConvergedCount << "\n";
+		}
+	}
 
 	return ostr.str();
 }
@@ -26,6 +26,7 @@
 #define CSOLVER__H
 
 #include <omp.h> //for num_threads
+#include "Utilities/BinaryFileWriter.h" //for SolverFileData
 #include "Autogenerated/CSolverStructures.h"
 
 #ifdef __FAST_EXUDYN_LINALG
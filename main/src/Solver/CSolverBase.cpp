@@ -29,6 +29,7 @@
 
 #include "Utilities/TimerStructure.h"
 #include <fstream>
+#include <cstring> //for std::memcmp
 
 namespace py = pybind11;	//for py::object
 
@@ -90,16 +91,33 @@ void CSolverBase::InitializeSolverOutput(CSystem& computationalSystem, const Sim
 	{
 		CheckPathAndCreateDirectories(solutionFileName);
 
-		if (solutionSettings.appendToFile) { file.solutionFile.open(solutionFileName, std::ofstream::app); }
-		else { file.solutionFile.open(solutionFileName, std::ofstream::out); }
-		if (!file.solutionFile.is_open()) //failed to open file ...  e.g. invalid file name
+		if (solutionSettings.binarySolutionFile)
 		{
-			output.writeToSolutionFile = false;
-			SysError(STDstring("failed to open solution file '") + solutionFileName + "'", file.solverFile);
+			//binary file is written by background thread of BinaryFileWriter
+			if (file.binarySolutionFile != nullptr) { delete file.binarySolutionFile; } //in case that previous solver run has been aborted
+			file.binarySolutionFile = new BinaryFileWriter;
+			if (!file.binarySolutionFile->Open(solutionFileName, solutionSettings.appendToFile, 
+				solutionSettings.binarySinglePrecision, solutionSettings.binaryBufferSize))
+			{
+				delete file.binarySolutionFile;
+				file.binarySolutionFile = nullptr;
+				output.writeToSolutionFile = false;
+				SysError(STDstring("failed to open binary solution file '") + solutionFileName + "'", file.solverFile);
+			}
 		}
 		else
 		{
-			file.solutionFile.precision(solutionSettings.outputPrecision);
+			if (solutionSettings.appendToFile) { file.solutionFile.open(solutionFileName, std::ofstream::app); }
+			else { file.solutionFile.open(solutionFileName, std::ofstream::out); }
+			if (!file.solutionFile.is_open()) //failed to open file ...  e.g. invalid file name
+			{
+				output.writeToSolutionFile = false;
+				SysError(STDstring("failed to open solution file '") + solutionFileName + "'", file.solverFile);
+			}
+			else
+			{
+				file.solutionFile.precision(solutionSettings.outputPrecision);
+			}
 		}
 	}
 	else { output.writeToSolutionFile = false; }
@@ -203,7 +221,8 @@ bool CSolverBase::InitializeSolverPreChecks(CSystem& computationalSystem, const
 			PyWarning("The number of total coordinates (unknowns) is larger than 1000. Consider a sparse solver (SimulationSettings().linearSolverType) to reduce memory consumption and computation time.", file.solverFile);
 		}
 	}
-	else if (simulationSettings.linearSolverType == LinearSolverType::EigenSparse)
+	else if (simulationSettings.linearSolverType == LinearSolverType::EigenSparse || 
+		simulationSettings.linearSolverType == LinearSolverType::EigenSparseIterative)
 	{
 		EXUstd::AssignParallelizationParameters(simulationSettings);
 	}
@@ -228,6 +247,7 @@ bool CSolverBase::InitializeSolverPreChecks(CSystem& computationalSystem, const
 	//do this not earlier than here, because checks need to be done prior to writing the header
 	WriteSolutionFileHeader(computationalSystem, simulationSettings);
 	WriteSensorsFileHeader(computationalSystem, simulationSettings);
+	InitializeSensorsInternalStorage(computationalSystem, simulationSettings);
 	return true;
 }
 
@@ -240,10 +260,28 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 	if (simulationSettings.linearSolverType == LinearSolverType::EXUdense)
 	{
 		data.SetLinearSolverType(LinearSolverType::EXUdense);
+		//dense factorization uses threads of TaskManager, if available; otherwise its own threads
+		((GeneralMatrixEXUdense*)data.systemJacobian)->SetNumberOfThreads(simulationSettings.numberOfThreads);
+		((GeneralMatrixEXUdense*)data.systemMassMatrix)->SetNumberOfThreads(simulationSettings.numberOfThreads);
 	}
 	else
 	{
-		data.SetLinearSolverType(LinearSolverType::EigenSparse);
+		data.SetLinearSolverType(simulationSettings.linearSolverType);
+		//only the system jacobian is factorized repeatedly with (usually) same sparsity pattern:
+		((GeneralMatrixEigenSparse*)data.systemJacobian)->SetReuseAnalyzedPattern(simulationSettings.linearSolverSettings.reuseAnalyzedPattern);
+		if (simulationSettings.linearSolverType == LinearSolverType::EigenSparseIterative)
+		{
+			const LinearSolverSettings& lss = simulationSettings.linearSolverSettings;
+			GeneralMatrixEigenSparseIterative& jacobianIterative = *(GeneralMatrixEigenSparseIterative*)data.systemJacobian;
+			jacobianIterative.SetIterativeSolverParameters(lss.iterativeSolverType, lss.preconditionerType, lss.iterativeTolerance,
+				lss.iterativeMaxIterations, lss.gmresRestart, lss.iterativeBlockSize);
+			jacobianIterative.ResetIterationStatistics();
+		}
+		//matrices which are repeatedly assembled with (usually) same sparsity pattern:
+		bool fixedPatternAssembly = simulationSettings.linearSolverSettings.fixedPatternAssembly;
+		((GeneralMatrixEigenSparse*)data.systemJacobian)->SetFixedPatternAssembly(fixedPatternAssembly);
+		((GeneralMatrixEigenSparse*)data.systemMassMatrix)->SetFixedPatternAssembly(fixedPatternAssembly);
+		((GeneralMatrixEigenSparse*)data.jacobianAE)->SetFixedPatternAssembly(fixedPatternAssembly);
 	}
 	
 	data.systemMassMatrix->SetNumberOfRowsAndColumns(data.nODE2, data.nODE2);
@@ -272,6 +310,15 @@ void CSolverBase::InitializeSolverData(CSystem& computationalSystem, const Simul
 	it.newtonJacobiCount = 0;				//count total number of Jacobian computations and factorizations
 	it.rejectedModifiedNewtonSteps = 0;		//count number of rejections of modifiedNewtonMethod
 	it.discontinuousIterationsCount = 0;	//count total number of discontinuous iterations
+	it.patternAnalysisCount = 0;			//count symbolic analyses of sparse jacobian
+	it.patternReuseCount = 0;				//count reuse of analyzed sparse pattern
+	it.linearSolverIterationsCount = 0;		//count iterations of iterative linear solver
+	it.linearSolverNonConvergedCount = 0;	//count non-converged solves of iterative linear solver
+	it.preconditionerCount = 0;				//count preconditioner computations of iterative linear solver
+
+	//mass matrix only computed once, if all bodies have constant mass matrix (static solver does not use mass matrix in steps):
+	data.constantMassMatrix = !IsStaticSolver() && simulationSettings.timeIntegration.reuseConstantMassMatrix && computationalSystem.HasConstantMassMatrix();
+	data.massMatrixComputed = false;
 
 	it.newtonSteps = 0;						//consistently initialize
 	it.discontinuousIteration = 0;			//consistently initialize
@@ -360,9 +407,42 @@ void CSolverBase::InitializeSolverInitialConditions(CSystem& computationalSystem
 
 }
 
+//! true, if constant mass matrix has been computed and object parameters have not been changed since
+bool CSolverBase::ConstantMassMatrixIsValid(const CSystem& computationalSystem) const
+{
+	return data.constantMassMatrix && data.massMatrixComputed && 
+		massMatrixParametersVersion == computationalSystem.GetSystemData().GetObjectParametersVersion();
+}
+
+//! compute system mass matrix into data.systemMassMatrix; if data.constantMassMatrix, the mass matrix is only computed at first call after initialization
+//! and after object parameters have been changed (SetObjectParameter, parameter handles, ...)
+void CSolverBase::ComputeSystemMassMatrix(CSystem& computationalSystem)
+{
+	if (ConstantMassMatrixIsValid(computationalSystem)) { return; }
+	if (data.constantMassMatrix && data.massMatrixComputed) { conv.jacobianUpdateRequested = true; } //factorized jacobian contains previous mass matrix
+	massMatrixParametersVersion = computationalSystem.GetSystemData().GetObjectParametersVersion();
+
+	data.systemMassMatrix->SetAllZero();
+	computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+	if (data.systemMassMatrix->GetSystemMatrixType() == LinearSolverType::EigenSparse &&
+		((GeneralMatrixEigenSparse*)data.systemMassMatrix)->GetFixedPatternAssembly())
+	{
+		data.systemMassMatrix->FinalizeMatrix(); //keep sparsity pattern; next computation refills values in place
+	}
+	data.massMatrixComputed = true;
+}
+
 //! specific call to the start solver
 bool CSolverBase::SolveSystem(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
+	if (advanceMode) //stepwise solution has not been finalized
+	{
+		SolverExceptionHandling([&]
+		{
+			FinalizeSolver(computationalSystem, simulationSettings);
+		}, "CSolverBase::FinalizeSolver");
+	}
+
 #ifdef USE_NGSOLVE_TASKMANAGER
 	//Eigen::initParallel(); //with C++11 and eigen 3.3 optional
 	Index nThreads = simulationSettings.numberOfThreads;
@@ -500,7 +580,7 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 		}
 	}
 
-	if (simulationSettings.solutionSettings.writeFileFooter && output.writeToSolutionFile)
+	if (simulationSettings.solutionSettings.writeFileFooter && output.writeToSolutionFile && file.binarySolutionFile == nullptr) //no footer in binary file
 	{
 		file.solutionFile << "#simulation finished=" << EXUstd::GetDateTimeString() << "\n";
 		file.solutionFile << "#Solver Info:";
@@ -526,6 +606,16 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 
 	//++++++++++++++++++++++++++++++++++
 	//final finalize: close files (NO EARLIER!)
+	if (file.binarySolutionFile != nullptr)
+	{
+		file.binarySolutionFile->Close(); //waits until all buffered frames are written
+		if (file.binarySolutionFile->WriteFailed())
+		{
+			PyWarning(STDstring("writing binary solution file '") + simulationSettings.solutionSettings.coordinatesSolutionFileName + "' failed; file may be incomplete", file.solverFile);
+		}
+		delete file.binarySolutionFile;
+		file.binarySolutionFile = nullptr;
+	}
 	if (file.solutionFile.is_open()) { file.solutionFile.close(); }
 	if (file.solverFile.is_open()) { file.solverFile.close(); }
 
@@ -541,6 +631,14 @@ void CSolverBase::FinalizeSolver(CSystem& computationalSystem, const SimulationS
 	}
 	file.sensorFileList.clear();
 	//pout << "sensor list length=" << file.sensorFileList.size() << "\n";
+
+	if (advanceMode)
+	{
+		advanceMode = false;
+#ifdef USE_NGSOLVE_TASKMANAGER
+		ExitTaskManager(advanceTaskManagerThreads);
+#endif
+	}
 }
 
 //! main solver part: calls multiple InitializeStep(...)/PerformStep(...); do step reduction if necessary; return true if success, false else
@@ -553,15 +651,20 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 	conv.stepReductionFailed = false;
 	conv.jacobianUpdateRequested = true;	//for modified Newton, only request Newton at first step
 
-	Index stepsSinceLastStepSizeReduction = 0;
-
 	if (IsVerbose(2)) { Verbose(2, "\nWrite initial step to solution file and visualize ...\n"); }
 	//perform initialization for initial values (write to file, show solution, ...); 
 	FinishStep(computationalSystem, simulationSettings); //visualization, console output, file output, ...
 
+	it.currentStepIndex++; //first step starts with stepIndex = 1
+
+	return SolveStepsLoop(computationalSystem, simulationSettings);
+}
 
+//! loop of steps, called from SolveSteps(...) and Advance(...): perform steps until it.endTime is reached; return true if success, false else
+bool CSolverBase::SolveStepsLoop(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	Index stepsSinceLastStepSizeReduction = 0;
 	bool simulationEndTimeReached = false; //signals that end time has been reached (tEnd in time integration, loadFactor=1 in static solver)
-	it.currentStepIndex++; //first step starts with stepIndex = 1
 
 	while (!conv.stepReductionFailed && !simulationEndTimeReached &&
 		!computationalSystem.GetPostProcessData()->stopSimulation)
@@ -638,6 +741,438 @@ bool CSolverBase::SolveSteps(CSystem& computationalSystem, const SimulationSetti
 	return !conv.stepReductionFailed; //return success (true) or fail (false)
 }
 
+//! initialize solver for stepwise time integration (first call of Advance(...)): TaskManager, solver data, initial conditions and output
+bool CSolverBase::InitializeAdvanceMode(CSystem& computationalSystem, const SimulationSettings& simulationSettings, bool writeInitialStep)
+{
+#ifdef USE_NGSOLVE_TASKMANAGER
+	CHECKandTHROW(simulationSettings.numberOfThreads <= MAX_NUMBER_OF_THREADS,
+		"Solver::Advance(...): number of threads must be smaller or equal to maximum number of threads");
+	TaskManager::SetNumThreads(simulationSettings.numberOfThreads);
+	advanceTaskManagerThreads = EnterTaskManager(); //threads are kept alive until FinalizeSolver(...)
+#endif
+	advanceMode = true;
+
+	//if initialization fails, leave advance mode and release TaskManager threads, such that next call of Advance(...) re-initializes
+	auto LeaveAdvanceMode = [this]()
+	{
+		advanceMode = false;
+#ifdef USE_NGSOLVE_TASKMANAGER
+		ExitTaskManager(advanceTaskManagerThreads);
+#endif
+	};
+
+	bool success = true; //local success variable
+	try
+	{
+		SolverExceptionHandling([&]
+		{
+			success = InitializeSolver(computationalSystem, simulationSettings);
+		}, "CSolverBase::Advance");
+	}
+	catch (...)
+	{
+		LeaveAdvanceMode();
+		throw;
+	}
+	if (!success) 
+	{ 
+		LeaveAdvanceMode();
+		return false; 
+	}
+
+	globalTimers.Reset();
+	timer.Reset(simulationSettings.displayComputationTime);
+	timer.total = 0;
+
+	//same as in SolveSteps(...), but end time is set in every call of Advance(...)
+	it.currentStepSize = it.maxStepSize; //initial value for step size
+	it.currentStepIndex = 0;
+	conv.stepReductionFailed = false;
+	conv.jacobianUpdateRequested = true;
+
+	if (writeInitialStep)
+	{
+		SolverExceptionHandling([&]
+		{
+			FinishStep(computationalSystem, simulationSettings); //write initial values to files, visualization, ...
+		}, "CSolverBase::Advance");
+	}
+	it.currentStepIndex++;
+
+	return true;
+}
+
+//! stepwise time integration: initialize at first call, then perform steps until current time + timeIncrement
+bool CSolverBase::Advance(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Real timeIncrement)
+{
+	if (IsStaticSolver())
+	{
+		PyError("Advance(...) is only available for time integration solvers"); 
+		return false;
+	}
+	if (timeIncrement <= 0)
+	{
+		PyError("Advance(...): timeIncrement must be positive"); 
+		return false;
+	}
+
+	if (!advanceMode)
+	{
+		if (!InitializeAdvanceMode(computationalSystem, simulationSettings)) { return false; }
+	}
+	else if (conv.stepReductionFailed) 
+	{ 
+		return false; //previous steps failed; solver needs to be finalized and re-initialized
+	}
+
+	//number of steps such that step size is smaller or equal to step size of simulationSettings and timeIncrement is reached exactly
+	if (!it.adaptiveStep)
+	{
+		Real stepSize = timeIncrement / ceil(timeIncrement / it.maxStepSize * (1. - 1e-10));
+		if (stepSize != it.currentStepSize)
+		{
+			it.currentStepSize = stepSize;
+			conv.jacobianUpdateRequested = true; //jacobian of implicit solvers depends on step size
+		}
+		//time of fixed step solvers is computed as currentStepIndex*currentStepSize + startTime; shift startTime such that time is continuous
+		it.startTime = it.currentTime - (Real)(it.currentStepIndex - 1)*it.currentStepSize;
+	}
+	it.endTime = it.currentTime + timeIncrement;
+
+	bool success = true; //local success variable
+	timer.total -= EXUstd::GetTimeInSeconds();
+	SolverExceptionHandling([&]
+	{
+		success = SolveStepsLoop(computationalSystem, simulationSettings);
+	}, "CSolverBase::Advance");
+	timer.total += EXUstd::GetTimeInSeconds();
+
+	return success;
+}
+
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//CHECKPOINT
+//file layout: identifier, version, sizeof(Real), system sizes and item counts, solver name,
+//             5 system states (time + 7 vectors each), solver data (aAlgorithmic, iteration and output data),
+//             internal storage of sensors (columns + data per sensor), end marker;
+//             vectors are stored as int64 size followed by the raw Real data (native byte order);
+//             item parameters, LTG lists and jacobians are not stored: the system is rebuilt by the model script and assembled before loading
+
+const char checkpointFileIdentifier[] = "EXUDYNCHECKPOINT"; //!< first 16 bytes of checkpoint file
+const int64_t checkpointFileVersion = 2;					//!< increase if file layout changes
+
+//! write int64 value to checkpoint file
+void CheckpointWriteInt(std::ofstream& file, int64_t value) { file.write((const char*)&value, sizeof(value)); }
+
+//! read int64 value from checkpoint file
+int64_t CheckpointReadInt(std::ifstream& file) { int64_t value = 0; file.read((char*)&value, sizeof(value)); return value; }
+
+//! write Real value to checkpoint file
+void CheckpointWriteReal(std::ofstream& file, Real value) { file.write((const char*)&value, sizeof(value)); }
+
+//! read Real value from checkpoint file
+Real CheckpointReadReal(std::ifstream& file) { Real value = 0; file.read((char*)&value, sizeof(value)); return value; }
+
+//! write vector (size + data) to checkpoint file
+void CheckpointWriteVector(std::ofstream& file, const Vector& vector)
+{
+	CheckpointWriteInt(file, (int64_t)vector.NumberOfItems());
+	if (vector.NumberOfItems()) { file.write((const char*)vector.GetDataPointer(), vector.NumberOfItems() * sizeof(Real)); }
+}
+
+//! read vector from checkpoint file directly into memory of vector (allocation only if size changes); returns false if size is inconsistent
+bool CheckpointReadVector(std::ifstream& file, Vector& vector)
+{
+	int64_t size = CheckpointReadInt(file);
+	if (!file || size < 0) { return false; }
+	vector.SetNumberOfItems((Index)size);
+	if (size) { file.read((char*)vector.GetDataPointer(), size * sizeof(Real)); }
+	return (bool)file;
+}
+
+//! write array (size + data) to checkpoint file
+void CheckpointWriteArray(std::ofstream& file, const ResizableArray<Real>& array)
+{
+	CheckpointWriteInt(file, (int64_t)array.NumberOfItems());
+	if (array.NumberOfItems()) { file.write((const char*)array.GetDataPointer(), array.NumberOfItems() * sizeof(Real)); }
+}
+
+//! read array from checkpoint file; returns false if size is inconsistent
+bool CheckpointReadArray(std::ifstream& file, ResizableArray<Real>& array)
+{
+	int64_t size = CheckpointReadInt(file);
+	if (!file || size < 0) { return false; }
+	array.SetNumberOfItems((Index)size);
+	if (size) { file.read((char*)array.GetDataPointer(), size * sizeof(Real)); }
+	return (bool)file;
+}
+
+//! write system state to checkpoint file
+void CheckpointWriteState(std::ofstream& file, const CSystemState& state)
+{
+	CheckpointWriteReal(file, state.time);
+	CheckpointWriteVector(file, state.ODE1Coords);
+	CheckpointWriteVector(file, state.ODE1Coords_t);
+	CheckpointWriteVector(file, state.ODE2Coords);
+	CheckpointWriteVector(file, state.ODE2Coords_t);
+	CheckpointWriteVector(file, state.ODE2Coords_tt);
+	CheckpointWriteVector(file, state.AECoords);
+	CheckpointWriteVector(file, state.dataCoords);
+}
+
+//! read system state from checkpoint file; returns false on read error
+bool CheckpointReadState(std::ifstream& file, CSystemState& state)
+{
+	state.time = CheckpointReadReal(file);
+	return CheckpointReadVector(file, state.ODE1Coords) && CheckpointReadVector(file, state.ODE1Coords_t) &&
+		CheckpointReadVector(file, state.ODE2Coords) && CheckpointReadVector(file, state.ODE2Coords_t) &&
+		CheckpointReadVector(file, state.ODE2Coords_tt) && CheckpointReadVector(file, state.AECoords) &&
+		CheckpointReadVector(file, state.dataCoords);
+}
+
+//! sizes and item counts of system, which must agree between saved and loaded system
+void GetCheckpointSystemSizes(const CSystem& computationalSystem, int64_t sizes[9])
+{
+	const CSystemData& systemData = computationalSystem.GetSystemData();
+	sizes[0] = systemData.GetNumberOfCoordinatesODE2();
+	sizes[1] = systemData.GetNumberOfCoordinatesODE1();
+	sizes[2] = systemData.GetNumberOfCoordinatesAE();
+	sizes[3] = systemData.GetNumberOfCoordinatesData();
+	sizes[4] = systemData.GetCNodes().NumberOfItems();
+	sizes[5] = systemData.GetCObjects().NumberOfItems();
+	sizes[6] = systemData.GetCMarkers().NumberOfItems();
+	sizes[7] = systemData.GetCLoads().NumberOfItems();
+	sizes[8] = systemData.GetCSensors().NumberOfItems();
+}
+
+//! write binary checkpoint of system states and solver data
+bool CSolverBase::SaveCheckpoint(const CSystem& computationalSystem, const STDstring& fileName) const
+{
+	if (!computationalSystem.IsSystemConsistent())
+	{
+		PyError("SaveCheckpoint(...): system is not consistent; call Assemble() first");
+		return false;
+	}
+
+	std::ofstream file(fileName, std::ofstream::binary);
+	if (!file.is_open())
+	{
+		PyError("SaveCheckpoint(...): could not open file '" + fileName + "'");
+		return false;
+	}
+
+	file.write(checkpointFileIdentifier, 16);
+	CheckpointWriteInt(file, checkpointFileVersion);
+	CheckpointWriteInt(file, (int64_t)sizeof(Real));
+
+	int64_t sizes[9];
+	GetCheckpointSystemSizes(computationalSystem, sizes);
+	for (int64_t size : sizes) { CheckpointWriteInt(file, size); }
+
+	STDstring solverName = GetSolverName();
+	CheckpointWriteInt(file, (int64_t)solverName.size());
+	file.write(solverName.c_str(), solverName.size());
+
+	const CData& cData = computationalSystem.GetSystemData().GetCData();
+	CheckpointWriteState(file, cData.referenceState);
+	CheckpointWriteState(file, cData.initialState);
+	CheckpointWriteState(file, cData.currentState);
+	CheckpointWriteState(file, cData.startOfStepState);
+	CheckpointWriteState(file, cData.GetVisualization());
+
+	//solver data: only valid, if solver has been initialized for this system
+	bool hasSolverData = (data.nODE2 == (Index)sizes[0] && data.nODE1 == (Index)sizes[1] && data.nAE == (Index)sizes[2] && it.currentStepIndex != 0);
+	CheckpointWriteInt(file, hasSolverData);
+	if (hasSolverData)
+	{
+		CheckpointWriteVector(file, data.aAlgorithmic);
+		CheckpointWriteVector(file, data.startOfStepStateAAlgorithmic);
+
+		CheckpointWriteReal(file, it.maxStepSize);
+		CheckpointWriteReal(file, it.minStepSize);
+		CheckpointWriteReal(file, it.currentStepSize);
+		CheckpointWriteReal(file, it.currentTime);
+		CheckpointWriteReal(file, it.startTime);
+		CheckpointWriteReal(file, it.endTime);
+		CheckpointWriteInt(file, it.numberOfSteps);
+		CheckpointWriteInt(file, it.currentStepIndex);
+		CheckpointWriteInt(file, it.adaptiveStep);
+		CheckpointWriteInt(file, it.newtonStepsCount);
+		CheckpointWriteInt(file, it.newtonJacobiCount);
+		CheckpointWriteInt(file, it.rejectedModifiedNewtonSteps);
+		CheckpointWriteInt(file, it.discontinuousIterationsCount);
+
+		CheckpointWriteReal(file, output.lastSolutionWritten);
+		CheckpointWriteReal(file, output.lastSensorsWritten);
+		CheckpointWriteReal(file, output.lastImageRecorded);
+	}
+
+	//sensor values stored in memory (storeInternal=true) continue after restart
+	for (const CSensor* sensor : computationalSystem.GetSystemData().GetCSensors())
+	{
+		CheckpointWriteInt(file, sensor->GetInternalStorageColumns());
+		CheckpointWriteArray(file, sensor->GetInternalStorage());
+	}
+	CheckpointWriteInt(file, checkpointFileVersion); //end marker
+
+	file.close();
+	if (file.fail())
+	{
+		PyError("SaveCheckpoint(...): writing file '" + fileName + "' failed");
+		return false;
+	}
+	return true;
+}
+
+//! load binary checkpoint into system states and solver data; initializes solver for Advance(...) if needed
+bool CSolverBase::LoadCheckpoint(CSystem& computationalSystem, const SimulationSettings& simulationSettings, const STDstring& fileName)
+{
+	if (IsStaticSolver())
+	{
+		PyError("LoadCheckpoint(...) is only available for time integration solvers");
+		return false;
+	}
+	if (!computationalSystem.IsSystemConsistent())
+	{
+		PyError("LoadCheckpoint(...): system is not consistent; call Assemble() first");
+		return false;
+	}
+
+	std::ifstream file(fileName, std::ifstream::binary);
+	if (!file.is_open())
+	{
+		PyError("LoadCheckpoint(...): could not open file '" + fileName + "'");
+		return false;
+	}
+
+	char identifier[16];
+	file.read(identifier, 16);
+	if (!file || STDstring(identifier, 16) != STDstring(checkpointFileIdentifier, 16) ||
+		CheckpointReadInt(file) != checkpointFileVersion || CheckpointReadInt(file) != (int64_t)sizeof(Real))
+	{
+		PyError("LoadCheckpoint(...): file '" + fileName + "' is no valid checkpoint file or has been written by incompatible version");
+		return false;
+	}
+
+	int64_t sizes[9];
+	GetCheckpointSystemSizes(computationalSystem, sizes);
+	for (int64_t size : sizes)
+	{
+		if (CheckpointReadInt(file) != size)
+		{
+			PyError("LoadCheckpoint(...): system in file '" + fileName + "' has different number of coordinates or items; checkpoints can only be loaded into identical system");
+			return false;
+		}
+	}
+
+	int64_t nameLength = CheckpointReadInt(file);
+	if (!file || nameLength < 0 || nameLength > 1000)
+	{
+		PyError("LoadCheckpoint(...): file '" + fileName + "' is corrupted");
+		return false;
+	}
+	STDstring solverName((size_t)nameLength, ' ');
+	file.read(&solverName[0], nameLength);
+	if (solverName != GetSolverName())
+	{
+		PyWarning("LoadCheckpoint(...): checkpoint has been written by solver '" + solverName + "', but is loaded into solver '" + GetSolverName() + "'; solver data is ignored");
+	}
+
+	//complete file is read into temporary data and only applied after the end marker has been checked; system and solver are unchanged on read errors
+	CSystemState referenceState, initialState, currentState, startOfStepState, visualizationState;
+	bool success = CheckpointReadState(file, referenceState) && CheckpointReadState(file, initialState) &&
+		CheckpointReadState(file, currentState) && CheckpointReadState(file, startOfStepState) &&
+		CheckpointReadState(file, visualizationState);
+
+	bool hasSolverData = success && CheckpointReadInt(file) != 0;
+	ResizableVector aAlgorithmic, startOfStepStateAAlgorithmic;
+	SolverIterationData itLoaded = it;
+	Real lastSolutionWritten = 0, lastSensorsWritten = 0, lastImageRecorded = 0;
+	if (hasSolverData)
+	{
+		success = CheckpointReadVector(file, aAlgorithmic) && CheckpointReadVector(file, startOfStepStateAAlgorithmic);
+
+		itLoaded.maxStepSize = CheckpointReadReal(file);
+		itLoaded.minStepSize = CheckpointReadReal(file);
+		itLoaded.currentStepSize = CheckpointReadReal(file);
+		itLoaded.currentTime = CheckpointReadReal(file);
+		itLoaded.startTime = CheckpointReadReal(file);
+		itLoaded.endTime = CheckpointReadReal(file);
+		itLoaded.numberOfSteps = (Index)CheckpointReadInt(file);
+		itLoaded.currentStepIndex = (Index)CheckpointReadInt(file);
+		itLoaded.adaptiveStep = CheckpointReadInt(file) != 0;
+		itLoaded.newtonStepsCount = (Index)CheckpointReadInt(file);
+		itLoaded.newtonJacobiCount = (Index)CheckpointReadInt(file);
+		itLoaded.rejectedModifiedNewtonSteps = (Index)CheckpointReadInt(file);
+		itLoaded.discontinuousIterationsCount = (Index)CheckpointReadInt(file);
+
+		lastSolutionWritten = CheckpointReadReal(file);
+		lastSensorsWritten = CheckpointReadReal(file);
+		lastImageRecorded = CheckpointReadReal(file);
+	}
+
+	Index nSensors = computationalSystem.GetSystemData().GetCSensors().NumberOfItems();
+	ArrayIndex sensorStorageColumns;
+	std::vector<ResizableArray<Real>> sensorStorages(nSensors);
+	for (Index i = 0; i < nSensors && success; i++)
+	{
+		int64_t columns = CheckpointReadInt(file);
+		success = columns >= 0 && CheckpointReadArray(file, sensorStorages[i]);
+		sensorStorageColumns.Append((Index)columns);
+	}
+
+	if (!success || !file || CheckpointReadInt(file) != checkpointFileVersion)
+	{
+		PyError("LoadCheckpoint(...): reading file '" + fileName + "' failed; system and solver have not been changed");
+		return false;
+	}
+
+	//solver is initialized before states are applied, as initialization computes initial conditions and overwrites current state;
+	//initial step is not written to solution and sensor files, as the loaded state continues a previous simulation
+	if (!advanceMode)
+	{
+		if (!InitializeAdvanceMode(computationalSystem, simulationSettings, false)) { return false; }
+	}
+
+	CData& cData = computationalSystem.GetSystemData().GetCData();
+	cData.referenceState = referenceState;	//assignment does not reallocate state vectors, as sizes have been checked
+	cData.initialState = initialState;
+	cData.currentState = currentState;
+	cData.startOfStepState = startOfStepState;
+	cData.PublishVisualizationState(visualizationState, computationalSystem.GetPostProcessData()->visualizationIsRunning); //renderer takes over visualization state with next update
+
+	bool solverDataApplied = hasSolverData && solverName == GetSolverName();
+	if (solverDataApplied)
+	{
+		if (aAlgorithmic.NumberOfItems() == data.aAlgorithmic.NumberOfItems()) { data.aAlgorithmic.CopyFrom(aAlgorithmic); }
+		if (startOfStepStateAAlgorithmic.NumberOfItems() == data.startOfStepStateAAlgorithmic.NumberOfItems())
+		{
+			data.startOfStepStateAAlgorithmic.CopyFrom(startOfStepStateAAlgorithmic);
+		}
+		it = itLoaded;
+		output.lastSolutionWritten = lastSolutionWritten;
+		output.lastSensorsWritten = lastSensorsWritten;
+		output.lastImageRecorded = lastImageRecorded;
+	}
+	else
+	{
+		//continue from loaded current state; time of fixed step solvers is shifted in Advance(...)
+		it.currentTime = cData.currentState.time;
+	}
+
+	//replaces internal storage initialized by InitializeAdvanceMode(...)
+	for (Index i = 0; i < nSensors; i++)
+	{
+		computationalSystem.GetSystemData().GetCSensors()[i]->SetInternalStorage(sensorStorageColumns[i], sensorStorages[i]);
+	}
+
+	conv.stepReductionFailed = false;
+	conv.jacobianUpdateRequested = true; //jacobian and factorization are not stored
+
+	return true;
+}
+
 
 bool cSolverBaseInitializeStepPreStepFunctionWarned = false;
 
@@ -668,7 +1203,7 @@ void CSolverBase::InitializeStep(CSystem& computationalSystem, const SimulationS
 
 		Verbose(2, str);
 	}
-	if (!IsStaticSolver())
+	if (!IsStaticSolver() && !advanceMode) //in advanceMode, it.endTime is set by Advance(...)
 	{
 		it.endTime = simulationSettings.timeIntegration.endTime; //update time, which may be updated for long integration time
 	}
@@ -810,7 +1345,9 @@ void CSolverBase::FinishStep(CSystem& computationalSystem, const SimulationSetti
 	//update postprocess data only if visualization is running ...
 	if (computationalSystem.GetPostProcessData()->visualizationIsRunning)
 	{
+		if (recordImage) { STARTTIMER(timer.visualizationWait); } //computation thread only waits for renderer, if queue of images to be recorded is full
 		computationalSystem.UpdatePostProcessData(recordImage);
+		if (recordImage) { STOPTIMER(timer.visualizationWait); }
 	}
 
 	if (simulationSettings.pauseAfterEachStep) { computationalSystem.GetPostProcessData()->WaitForUserToContinue(); }
@@ -829,6 +1366,19 @@ bool CSolverBase::DiscontinuousIteration(CSystem& computationalSystem, const Sim
 	bool discIterFinishedSuccessful = false; //local variable
 	it.discontinuousIteration = 0;
 
+	//contact broad phase: candidates are updated once per step, prior to discontinuous iterations
+	if (newton.useContactBroadPhase)
+	{
+		computationalSystem.UpdateContactCandidates(data.tempCompData, it.currentStepSize, newton.contactBroadPhaseMargin);
+		if (IsVerbose(3))
+		{
+			const ContactBroadPhaseData& contactBroadPhase = computationalSystem.GetContactBroadPhaseData();
+			Verbose(3, "  contact broad phase: " + EXUstd::ToString(contactBroadPhase.NumberOfCandidates()) + " of " +
+				EXUstd::ToString(contactBroadPhase.contactObjects.NumberOfItems()) + " contacts are candidates\n");
+		}
+	}
+	else { computationalSystem.ClearContactCandidates(); }
+
 	while (it.discontinuousIteration < newton.maxDiscontinuousIterations && !discIterFinishedSuccessful)
 	{
 		if (IsVerbose(2)) { Verbose(2,STDstring("  START discontinuous iteration ")+EXUstd::ToString(it.discontinuousIteration) + ":\n"); }
@@ -1021,6 +1571,17 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 			//STOPGLOBALTIMER(TSfactorize);
 			STOPTIMER(timer.factorization);
 
+			if (data.GetLinearSolverType() == LinearSolverType::EigenSparse)
+			{
+				const GeneralMatrixEigenSparse& jacobianSparse = *(const GeneralMatrixEigenSparse*)data.systemJacobian;
+				it.patternAnalysisCount = jacobianSparse.GetPatternAnalysisCount();
+				it.patternReuseCount = jacobianSparse.GetPatternReuseCount();
+			}
+			else if (data.GetLinearSolverType() == LinearSolverType::EigenSparseIterative)
+			{
+				it.preconditionerCount = ((const GeneralMatrixEigenSparseIterative*)data.systemJacobian)->GetPreconditionerCount();
+			}
+
 			it.newtonJacobiCount++;
 			conv.jacobianUpdateRequested = false;
 		}
@@ -1029,7 +1590,7 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 		//perform step
 		if (!conv.linearSolverFailed)
 		{
-			if (IsVerbose(4)) {Verbose(4, "    JacInv = " + EXUstd::ToString(*(data.systemJacobian)) + "\n"); }
+			if (IsVerbose(4)) {Verbose(4, "    JacFactorized = " + EXUstd::ToString(*(data.systemJacobian)) + "\n"); }
 
 			//++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 			//now compute descent of acceleration vector with jacobian
@@ -1038,6 +1599,18 @@ bool CSolverBase::Newton(CSystem& computationalSystem, const SimulationSettings&
 			data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
 			STOPTIMER(timer.newtonIncrement);
 
+			if (data.GetLinearSolverType() == LinearSolverType::EigenSparseIterative)
+			{
+				const GeneralMatrixEigenSparseIterative& jacobianIterative = *(const GeneralMatrixEigenSparseIterative*)data.systemJacobian;
+				it.linearSolverIterationsCount = jacobianIterative.GetIterationsCount();
+				it.linearSolverNonConvergedCount = jacobianIterative.GetNonConvergedCount();
+				if (IsVerbose(3)) 
+				{
+					Verbose(3, "    iterative linear solver: iterations = " + EXUstd::ToString(jacobianIterative.GetLastIterations()) + 
+						", relative residual = " + EXUstd::ToString(jacobianIterative.GetLastRelativeResidual()) + "\n");
+				}
+			}
+
 			ComputeNewtonUpdate(computationalSystem, simulationSettings);
 
 
@@ -1258,6 +1831,47 @@ void CSolverBase::WriteSolutionFileHeader(CSystem& computationalSystem, const Si
 	if (solutionSettings.exportAlgebraicCoordinates) { nAEexported = nAE; }
 	if (solutionSettings.exportDataCoordinates) { nDataExported = nData; }
 
+	if (file.binarySolutionFile != nullptr)
+	{
+		//fixed size binary header (128 bytes), such that frames can be mapped directly (e.g. numpy.memmap);
+		//the header is always written (independent of writeFileHeader), as frames cannot be interpreted without it
+		BinaryFileWriter& binFile = *file.binarySolutionFile;
+		const Index headerSize = 15;
+		int64_t header[headerSize] = { 1, //version of binary format
+			(int64_t)binFile.GetRealSize(), isStatic,
+			(int64_t)nODE2, (int64_t)nODE1, (int64_t)nAE, (int64_t)nData, //number of system coordinates [nODE2, nODE1, nAlgebraic, nData]
+			(int64_t)nODE2, (int64_t)nVel2, (int64_t)nAcc2, (int64_t)nODE1, (int64_t)nVel1, (int64_t)nAEexported, (int64_t)nDataExported, //number of written coordinates [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData]
+			(int64_t)(!isStatic ? timeint.numberOfSteps : staticSolver.numberOfLoadSteps) };
+
+		if (binFile.GetInitialFileSize() == 0)
+		{
+			binFile.WriteBytes("EXUDYNSF", 8);
+			for (Index i = 0; i < headerSize; i++) { binFile.WriteInt64(header[i]); }
+		}
+		else
+		{
+			//appending to existing file: frames are added to existing header, which must have the same frame layout
+			char existingID[8] = { 0 };
+			int64_t existingHeader[headerSize] = { 0 };
+			std::ifstream existingFile(simulationSettings.solutionSettings.coordinatesSolutionFileName, std::ifstream::binary);
+			existingFile.read(existingID, 8);
+			existingFile.read((char*)existingHeader, headerSize * sizeof(int64_t));
+
+			bool headerMatches = existingFile.good() && std::memcmp(existingID, "EXUDYNSF", 8) == 0;
+			for (Index i = 0; i < headerSize - 1; i++) //number of steps may differ
+			{
+				if (existingHeader[i] != header[i]) { headerMatches = false; }
+			}
+			if (!headerMatches)
+			{
+				PyError(STDstring("binary solution file '") + simulationSettings.solutionSettings.coordinatesSolutionFileName +
+					"': appendToFile=True, but existing file has no binary solution header or a different number of coordinates / precision; frames are not written", file.solverFile);
+				output.writeToSolutionFile = false;
+			}
+		}
+		return;
+	}
+
 	std::ofstream& solFile = file.solutionFile;
 
 	if (solutionSettings.writeFileHeader)
@@ -1316,6 +1930,20 @@ void CSolverBase::WriteCoordinatesToFile(const CSystem& computationalSystem, con
 
 		output.lastSolutionWritten += solutionSettings.solutionWritePeriod;
 		output.lastSolutionWritten = EXUstd::Maximum(output.lastSolutionWritten, t); //never accept smaller values ==> for adaptive solver
+
+		if (file.binarySolutionFile != nullptr)
+		{
+			//only copied to buffer; file is written in background thread
+			BinaryFileWriter& binFile = *file.binarySolutionFile;
+			binFile.WriteReal(t);
+			binFile.WriteReals(solutionU.GetDataPointer(), solutionU.NumberOfItems());
+			if (solutionSettings.exportVelocities && !isStatic) { binFile.WriteReals(solutionV.GetDataPointer(), solutionV.NumberOfItems()); }
+			if (solutionSettings.exportAccelerations && !isStatic) { binFile.WriteReals(solutionA.GetDataPointer(), solutionA.NumberOfItems()); }
+			if (solutionSettings.exportAlgebraicCoordinates) { binFile.WriteReals(solutionLambda.GetDataPointer(), solutionLambda.NumberOfItems()); }
+			if (solutionSettings.exportDataCoordinates) { binFile.WriteReals(solutionData.GetDataPointer(), solutionData.NumberOfItems()); }
+			return;
+		}
+
 		solFile << t;
 
 		for (Index k = 0; k < solutionU.NumberOfItems(); k++) {
@@ -1379,6 +2007,41 @@ void CSolverBase::WriteSensorsFileHeader(CSystem& computationalSystem, const Sim
 	}
 }
 
+//! prepare internal storage of sensors with storeInternal=true; memory is reserved for the planned number of sensor outputs
+void CSolverBase::InitializeSensorsInternalStorage(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	const SolutionSettings& solutionSettings = simulationSettings.solutionSettings;
+
+	Real timeSpan;
+	Index numberOfSteps;
+	if (IsStaticSolver())
+	{
+		timeSpan = simulationSettings.staticSolver.loadStepDuration;
+		numberOfSteps = simulationSettings.staticSolver.numberOfLoadSteps;
+	}
+	else
+	{
+		timeSpan = simulationSettings.timeIntegration.endTime - simulationSettings.timeIntegration.startTime;
+		numberOfSteps = simulationSettings.timeIntegration.numberOfSteps;
+	}
+
+	Index reservedRows = numberOfSteps;
+	if (solutionSettings.sensorsWritePeriod > 0)
+	{
+		reservedRows = (Index)EXUstd::Minimum((Real)numberOfSteps, timeSpan / solutionSettings.sensorsWritePeriod);
+	}
+	reservedRows += 2; //initial values and additional last step; more rows are allocated automatically, e.g. for adaptive steps
+
+	for (auto item : computationalSystem.GetSystemData().GetCSensors())
+	{
+		if (item->GetStoreInternalFlag())
+		{
+			item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Initial);
+			item->InitializeInternalStorage(output.sensorValuesTemp.NumberOfItems(), reservedRows, solutionSettings.sensorsAppendToFile);
+		}
+	}
+}
+
 //! write unique sensor solution file
 void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
@@ -1397,20 +2060,28 @@ void CSolverBase::WriteSensorsToFile(const CSystem& computationalSystem, const S
 		Index cnt = 0;
 		for (auto item : computationalSystem.GetSystemData().GetCSensors())
 		{
-			if (file.sensorFileList.size() >= cnt && file.sensorFileList[cnt] != nullptr)
+			bool writeToFile = ((Index)file.sensorFileList.size() > cnt && file.sensorFileList[cnt] != nullptr);
+			bool storeInternal = item->GetStoreInternalFlag();
+			if (writeToFile || storeInternal)
+			{
+				item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current);
+			}
+
+			if (writeToFile)
 			{
 				std::ofstream* sFile = file.sensorFileList[cnt];
 
 				(*sFile) << t;
-				
-				item->GetSensorValues(computationalSystem.GetSystemData(), output.sensorValuesTemp, ConfigurationType::Current);
-
 				for (auto value : output.sensorValuesTemp)
 				{
 					(*sFile) << "," << value;
 				}
 				(*sFile) << "\n";
 			}
+			if (storeInternal)
+			{
+				item->StoreValuesInternal(t, output.sensorValuesTemp);
+			}
 			cnt++;
 		}
 	}
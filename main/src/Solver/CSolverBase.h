@@ -45,12 +45,22 @@ public: //made public for simpler access via pybind; nevertheless, C++ functions
 	SolverOutputData output;
 	SolverFileData file;
 	NewtonSettings newton; //copy of timeInt or staticSolver (depending on solver)
+protected:
+	bool advanceMode;					//!< true from first call to Advance(...) until FinalizeSolver(...); it.endTime is then set by Advance(...) and not by simulationSettings
+	Index advanceTaskManagerThreads;	//!< threads returned by EnterTaskManager() in Advance(...); TaskManager is exited in FinalizeSolver(...)
+	Index massMatrixParametersVersion;	//!< object parameters version of system data, for which the constant mass matrix has been computed
 public:
 	CSolverBase()
 	{
+		advanceMode = false;
+		advanceTaskManagerThreads = 0;
+		massMatrixParametersVersion = 0;
 		InitCSolverBase();
 	}
-	virtual ~CSolverBase() {} //added for correct deletion of derived classes
+	virtual ~CSolverBase() //added for correct deletion of derived classes
+	{
+		if (file.binarySolutionFile != nullptr) { delete file.binarySolutionFile; } //only in case that solver has not been finalized
+	}
 
 	void InitCSolverBase()
 	{
@@ -128,6 +138,30 @@ public:
 	//! main solver part: calls multiple InitializeStep(...)/DiscontinuousIteration(...)/FinishStep(...); do step reduction if necessary; return true if success, false else
 	virtual bool SolveSteps(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
 
+	//! stepwise time integration, e.g., for control in the loop: perform steps from current time to current time + timeIncrement;
+	//! the solver is initialized at the first call and solver data, factorizations, files and threads are kept until FinalizeSolver(...) is called;
+	//! the step size is the one of simulationSettings (endTime-startTime)/numberOfSteps, reduced such that timeIncrement is an integer multiple;
+	//! current state (and parameters) may be modified between calls; return true if success, false else
+	virtual bool Advance(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Real timeIncrement);
+
+	//! return true, if solver has been initialized by Advance(...) and not yet finalized
+	bool IsAdvanceMode() const { return advanceMode; }
+
+	//! initialize solver for stepwise time integration; called at first call of Advance(...) or LoadCheckpoint(...);
+	//! writeInitialStep=false: initial state is not written to solution/sensor files (used for restart from checkpoint)
+	virtual bool InitializeAdvanceMode(CSystem& computationalSystem, const SimulationSettings& simulationSettings, bool writeInitialStep = true);
+
+	//! write binary checkpoint file with all system states (reference, initial, current, startOfStep, visualization) and
+	//! solver data needed to continue time integration (aAlgorithmic, step size, time, step and iteration counters); return true on success
+	virtual bool SaveCheckpoint(const CSystem& computationalSystem, const STDstring& fileName) const;
+
+	//! load checkpoint written by SaveCheckpoint(...) into system with identical structure (same items and coordinates, assembled);
+	//! solver is initialized for Advance(...) if needed, and the next call to Advance(...) continues from the loaded states; return true on success
+	virtual bool LoadCheckpoint(CSystem& computationalSystem, const SimulationSettings& simulationSettings, const STDstring& fileName);
+
+	//! loop of steps, called from SolveSteps(...) and Advance(...): perform steps until it.endTime is reached; return true if success, false else
+	virtual bool SolveStepsLoop(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
 	//! update currentTime (and load factor); MUST be overwritten in special solver class
 	virtual void UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings) { CHECKandTHROWstring("CSolverBase::illegal call"); }
 
@@ -157,6 +191,13 @@ public:
 	//! +++++ TO BE IMPLEMENTED IN DERIVED CLASS +++++
 	virtual void ComputeNewtonJacobian(CSystem& computationalSystem, const SimulationSettings& simulationSettings) { CHECKandTHROWstring("CSolverBase::illegal call"); }
 
+	//! compute system mass matrix into data.systemMassMatrix; if data.constantMassMatrix, the mass matrix is only computed at first call after initialization
+	//! and after object parameters have been changed; for a recomputed constant mass matrix, a jacobian update is requested (factorization of modified Newton)
+	virtual void ComputeSystemMassMatrix(CSystem& computationalSystem);
+
+	//! true, if constant mass matrix has been computed and object parameters have not been changed since
+	virtual bool ConstantMassMatrixIsValid(const CSystem& computationalSystem) const;
+
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//! output helper functions:
 	//! write unique file header, depending on static/dynamic simulation
@@ -168,7 +209,10 @@ public:
 	//! write unique sensor file header, depending on static/dynamic simulation
 	virtual void WriteSensorsFileHeader(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
 
-	//! write unique sensor solution file
+	//! prepare internal storage of sensors (storeInternal=true) for current simulation
+	virtual void InitializeSensorsInternalStorage(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
+	//! write unique sensor solution file; also stores sensor values internally (storeInternal=true)
 	virtual void WriteSensorsToFile(const CSystem& computationalSystem, const SimulationSettings& simulationSettings);
 	
 	//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
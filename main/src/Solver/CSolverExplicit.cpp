@@ -0,0 +1,507 @@
+/** ***********************************************************************************************
+* @brief		Implementation for CSolverExplicitTimeInt
+*
+* @author		agent
+* @date			2026-10-18 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include <pybind11/pybind11.h> //for integrated python connectivity (==>put functionality into separate file ...!!!)
+#include <pybind11/eval.h>
+#include <fstream>
+
+#include "Linalg/BasicLinalg.h" //for Resizable Vector
+#include "Main/CSystem.h"
+#include "Solver/CSolverExplicit.h"
+
+
+namespace py = pybind11;	//for py::object
+
+
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++++++++++++++++   EXPLICIT SOLVER   +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+//! reduce step size (1..normal, 2..severe problems); return true, if reduction was successful
+bool CSolverExplicitTimeInt::ReduceStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Index severity)
+{
+	//it.currentTime is the only important value to be updated in order to reset the step time:
+	it.currentTime = computationalSystem.GetSystemData().GetCData().currentState.time;
+
+	if (it.currentStepSize > it.minStepSize)
+	{
+		if (stepSizeProposal > 0.) //step has been rejected by error control
+		{
+			it.currentStepSize = stepSizeProposal;
+			stepSizeProposal = 0.;
+		}
+		else
+		{
+			it.currentStepSize *= 0.5;
+		}
+
+		it.currentStepSize = EXUstd::Maximum(it.minStepSize, it.currentStepSize);
+		return true;
+	}
+
+	return false;
+}
+
+//! initialize things at the very beginning of initialize
+void CSolverExplicitTimeInt::PreInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	const ExplicitIntegrationSettings& explicitIntegration = simulationSettings.timeIntegration.explicitIntegration;
+
+	dynamicSolverType = explicitIntegration.dynamicSolverType;
+	massMatrixFactorized = false;
+	stepSizeProposal = 0.;
+	nextStepSize = 0.;
+
+	rkWeightsBhat.SetNumberOfItems(0); //only RK45 has error estimate
+
+	switch (dynamicSolverType)
+	{
+	case DynamicSolverType::ExplicitEuler:
+		numberOfStages = 1;
+		rkMatrixA = Matrix(1, 1, { 0. });
+		rkWeightsB = Vector({ 1. });
+		rkNodesC = Vector({ 0. });
+		break;
+	case DynamicSolverType::RK4:
+		numberOfStages = 4;
+		rkMatrixA = Matrix(4, 4, {	0.,  0.,  0., 0.,
+									0.5, 0.,  0., 0.,
+									0.,  0.5, 0., 0.,
+									0.,  0.,  1., 0. });
+		rkWeightsB = Vector({ 1. / 6., 1. / 3., 1. / 3., 1. / 6. });
+		rkNodesC = Vector({ 0., 0.5, 0.5, 1. });
+		break;
+	case DynamicSolverType::RK45:
+		//Dormand-Prince coefficients; 5th order solution, 4th order error estimate
+		numberOfStages = 7;
+		rkMatrixA = Matrix(7, 7, {	0., 0., 0., 0., 0., 0., 0.,
+									1. / 5., 0., 0., 0., 0., 0., 0.,
+									3. / 40., 9. / 40., 0., 0., 0., 0., 0.,
+									44. / 45., -56. / 15., 32. / 9., 0., 0., 0., 0.,
+									19372. / 6561., -25360. / 2187., 64448. / 6561., -212. / 729., 0., 0., 0.,
+									9017. / 3168., -355. / 33., 46732. / 5247., 49. / 176., -5103. / 18656., 0., 0.,
+									35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784., 11. / 84., 0. });
+		rkWeightsB = Vector({ 35. / 384., 0., 500. / 1113., 125. / 192., -2187. / 6784., 11. / 84., 0. });
+		rkWeightsBhat = Vector({ 5179. / 57600., 0., 7571. / 16695., 393. / 640., -92097. / 339200., 187. / 2100., 1. / 40. });
+		rkNodesC = Vector({ 0., 1. / 5., 3. / 10., 4. / 5., 8. / 9., 1., 1. });
+		break;
+	default:
+		PyError(STDstring("CSolverExplicitTimeInt: dynamicSolverType '") + EXUstd::ToString(dynamicSolverType) +
+			"' is not an explicit solver; use ExplicitEuler, RK4 or RK45", file.solverFile);
+		//use explicit Euler in order to keep solver data consistent
+		numberOfStages = 1;
+		rkMatrixA = Matrix(1, 1, { 0. });
+		rkWeightsB = Vector({ 1. });
+		rkNodesC = Vector({ 0. });
+	}
+}
+
+//! post-initialize for solver specific tasks; called at the end of InitializeSolver
+void CSolverExplicitTimeInt::PostInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	if (IsVerbose(2))
+	{
+		Verbose(2, STDstring("  Explicit solver: ") + EXUstd::ToString(dynamicSolverType) + ", stages=" + EXUstd::ToString(numberOfStages) + "\n");
+	}
+}
+
+//! set/compute initial conditions (solver-specific!); called from InitializeSolver()
+void CSolverExplicitTimeInt::InitializeSolverInitialConditions(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	//call base class for general tasks
+	CSolverBase::InitializeSolverInitialConditions(computationalSystem, simulationSettings); //set currentState = initialState
+
+	stageVelocities.Flush();
+	stageAccelerations.Flush();
+	for (Index i = 0; i < numberOfStages; i++)
+	{
+		stageVelocities.Append(Vector(data.nODE2, 0.));
+		stageAccelerations.Append(Vector(data.nODE2, 0.));
+	}
+	tempAE0.SetNumberOfItems(data.nAE);
+	tempAE1.SetNumberOfItems(data.nAE);
+	if (data.nAE)
+	{
+		GetStageSystemMatrix().SetNumberOfRowsAndColumns(data.nSys, data.nSys);
+		refinementResidual.SetNumberOfItems(data.nSys);
+		refinementCorrection.SetNumberOfItems(data.nSys);
+	}
+
+	//constraints at velocity level are not considered in position projection
+	velocityLevelAEindices.SetNumberOfItems(0);
+	const CSystemData& cSystemData = computationalSystem.GetSystemData();
+	for (Index j = 0; j < cSystemData.GetCObjects().NumberOfItems(); j++)
+	{
+		const CObject& object = *(cSystemData.GetCObjects()[j]);
+		if (((Index)object.GetType() & (Index)CObjectType::Constraint) && ((const CObjectConstraint&)object).UsesVelocityLevel())
+		{
+			for (Index i : cSystemData.GetLocalToGlobalAE()[j]) { velocityLevelAEindices.Append(i); }
+		}
+	}
+
+	//initial accelerations and Lagrange multipliers are consistently computed from system in acceleration form
+	Vector& solutionODE2_tt = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords_tt;
+	if (!ComputeAccelerations(computationalSystem, simulationSettings, solutionODE2_tt))
+	{
+		PyWarning("CSolverExplicitTimeInt::InitializeSolverInitialConditions: system matrix not invertible!\nWARNING: using zero initial accelerations\n", file.solverFile);
+		solutionODE2_tt.SetAll(0.);
+		computationalSystem.GetSystemData().GetCData().currentState.AECoords.SetAll(0.);
+	}
+
+	if (IsVerbose(3)) { Verbose(3, STDstring("initial accelerations = ") + EXUstd::ToString(solutionODE2_tt) + "\n"); }
+}
+
+//! update currentTime (and load factor)
+void CSolverExplicitTimeInt::UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	if (nextStepSize > 0.) //step size from error control of last accepted step
+	{
+		it.currentStepSize = nextStepSize;
+		nextStepSize = 0.;
+	}
+
+	if (!it.adaptiveStep)
+	{
+		it.currentTime = it.currentStepIndex * it.currentStepSize + it.startTime; //use this to avoid round-off errors in time
+	}
+	else
+	{
+		if (it.currentTime + it.currentStepSize > it.endTime)
+		{
+			it.currentStepSize = it.endTime - it.currentTime;
+		}
+		it.currentTime += it.currentStepSize;
+	}
+}
+
+//! compute system matrix [M C_q^T; C_q C_lambda] at current state into systemMatrix (not factorized)
+void CSolverExplicitTimeInt::AssembleSystemMatrix(CSystem& computationalSystem, GeneralMatrix& systemMatrix)
+{
+	systemMatrix.SetAllZero(); //entries are not set to zero inside jacobian computation!
+
+	if (data.nAE)
+	{
+		//velocity level constraints add C_{q_t} into the ODE2 part: d/dt(C(q_t)) = C_{q_t}*q_tt + ...
+		STARTTIMER(timer.jacobianAE);
+		Real factorAE_ODE2 = 1.;
+		Real factorAE_ODE2_t = 1.;
+		bool velocityLevel = false;
+		bool fillIntoSystemMatrix = true;
+		computationalSystem.JacobianAE(data.tempCompData, newton, systemMatrix, factorAE_ODE2, factorAE_ODE2_t, velocityLevel, fillIntoSystemMatrix);
+		STOPTIMER(timer.jacobianAE);
+	}
+
+	STARTTIMER(timer.massMatrix);
+	ComputeSystemMassMatrix(computationalSystem); //not recomputed for constant mass matrix; in case of constraints, only factorization is repeated
+	systemMatrix.AddSubmatrix(*(data.systemMassMatrix));
+	STOPTIMER(timer.massMatrix);
+
+	systemMatrix.FinalizeMatrix();
+}
+
+//! compute system matrix [M C_q^T; C_q C_lambda] at current state and factorize; returns false, if factorization failed
+bool CSolverExplicitTimeInt::ComputeSystemMatrix(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	//constrained systems: system matrix is only computed once per step (reset in Newton(...) and ProjectConstraints(...))
+	bool constantMassMatrix = (simulationSettings.timeIntegration.explicitIntegration.useConstantMassMatrix || data.constantMassMatrix) && data.nAE == 0;
+	if (data.constantMassMatrix && !ConstantMassMatrixIsValid(computationalSystem)) { massMatrixFactorized = false; } //object parameters changed
+	if ((constantMassMatrix || data.nAE != 0) && massMatrixFactorized) { return true; }
+
+	AssembleSystemMatrix(computationalSystem, *(data.systemJacobian));
+
+	if (IsVerbose(4)) { Verbose(4, "    system matrix = " + EXUstd::ToString(*(data.systemJacobian)) + "\n"); }
+
+	STARTTIMER(timer.factorization);
+	Index factorizeOutput = data.systemJacobian->Factorize();
+	STOPTIMER(timer.factorization);
+	it.newtonJacobiCount++;
+
+	if (factorizeOutput != 0)
+	{
+		conv.linearSolverFailed = true;
+		conv.massMatrixNotInvertible = true;
+		massMatrixFactorized = false;
+		if (IsVerbose(1)) { Verbose(1, STDstring("CSolverExplicitTimeInt: system matrix not invertible (row/column ") + EXUstd::ToString(factorizeOutput) + ")\n"); }
+		return false;
+	}
+	massMatrixFactorized = true;
+
+	return true;
+}
+
+//! iterative refinement of data.newtonSolution for the system matrix A at the current stage state, using the factorization of the
+//! system matrix A0 at the start of step: x += A0^{-1}*(r - A*x); as C_q changes only by O(h) within the step, few iterations are needed
+bool CSolverExplicitTimeInt::RefineStageSolution(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	const Index maxIterations = 10;
+	const Real relativeTolerance = 1e-13;
+
+	GeneralMatrix& stageMatrix = GetStageSystemMatrix();
+	AssembleSystemMatrix(computationalSystem, stageMatrix);
+
+	for (Index k = 0; k < maxIterations; k++)
+	{
+		STARTTIMER(timer.newtonIncrement);
+		stageMatrix.MultMatrixVector(data.newtonSolution, refinementResidual);
+		refinementResidual *= -1.;
+		refinementResidual += data.systemResidual;
+		data.systemJacobian->Solve(refinementResidual, refinementCorrection);
+		data.newtonSolution += refinementCorrection;
+		STOPTIMER(timer.newtonIncrement);
+
+		if (refinementCorrection.GetL2Norm() <= relativeTolerance * data.newtonSolution.GetL2Norm()) { return true; }
+	}
+
+	//no convergence, e.g., for large step sizes: system matrix is factorized at stage state and used for the remaining stages
+	if (IsVerbose(3)) { Verbose(3, "    refinement of stage accelerations did not converge; factorize system matrix at stage\n"); }
+	massMatrixFactorized = false;
+	if (!ComputeSystemMatrix(computationalSystem, simulationSettings)) { return false; }
+
+	STARTTIMER(timer.newtonIncrement);
+	data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
+	STOPTIMER(timer.newtonIncrement);
+
+	return true;
+}
+
+//! compute accelerations and Lagrange multipliers at current state (incl. current time)
+bool CSolverExplicitTimeInt::ComputeAccelerations(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Vector& accelerations)
+{
+	bool refineStageSolution = data.nAE != 0 && massMatrixFactorized; //factorization of start of step is reused in later stages
+	if (!ComputeSystemMatrix(computationalSystem, simulationSettings)) { return false; }
+
+	LinkedDataVector ode2RHS(data.systemResidual, 0, data.nODE2);
+	LinkedDataVector aeRHS(data.systemResidual, data.startAE, data.nAE);
+
+	STARTTIMER(timer.ODE2RHS);
+	computationalSystem.ComputeSystemODE2RHS(data.tempCompData, ode2RHS);
+	STOPTIMER(timer.ODE2RHS);
+
+	if (data.nAE)
+	{
+		//constraints in acceleration form: d/dt(C_v) = C_q*q_tt + (C_v)_q*q_t + (C_v)_t = 0, with velocity level constraints C_v = C_q*q_t + C_t;
+		//(C_v)_q*q_t + (C_v)_t (contains (C_q*q_t)_q*q_t, 2*(C_q)_t*q_t and C_tt) is computed by a directional difference of C_v in direction (q_t, t)
+		STARTTIMER(timer.AERHS);
+		CSystemState& current = computationalSystem.GetSystemData().GetCData().currentState;
+		Vector& solutionODE2 = current.ODE2Coords;
+		const Vector& solutionODE2_t = current.ODE2Coords_t;
+
+		Real maxQ = 0.;
+		Real maxV = 0.;
+		for (Index i = 0; i < data.nODE2; i++)
+		{
+			maxQ = EXUstd::Maximum(maxQ, fabs(solutionODE2[i]));
+			maxV = EXUstd::Maximum(maxV, fabs(solutionODE2_t[i]));
+		}
+
+		const NumericalDifferentiationSettings& numDiff = newton.numericalDifferentiation;
+		Real eps = numDiff.relativeEpsilon * EXUstd::Maximum(numDiff.minimumCoordinateSize, maxQ) / EXUstd::Maximum(numDiff.minimumCoordinateSize, maxV);
+		Real time0 = current.time;
+
+		data.tempODE2.CopyFrom(solutionODE2);
+		computationalSystem.ComputeAlgebraicEquations(data.tempCompData, tempAE0, true);
+		solutionODE2.MultAdd(eps, solutionODE2_t);
+		current.time += eps;
+		computationalSystem.ComputeAlgebraicEquations(data.tempCompData, tempAE1, true);
+		solutionODE2.CopyFrom(data.tempODE2);
+		current.time = time0;
+
+		for (Index i = 0; i < data.nAE; i++)
+		{
+			aeRHS[i] = -(tempAE1[i] - tempAE0[i]) / eps;
+		}
+		STOPTIMER(timer.AERHS);
+	}
+
+	STARTTIMER(timer.newtonIncrement);
+	data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
+	STOPTIMER(timer.newtonIncrement);
+
+	if (refineStageSolution && !RefineStageSolution(computationalSystem, simulationSettings)) { return false; }
+
+	LinkedDataVector solutionODE2_tt(data.newtonSolution, 0, data.nODE2);
+	accelerations.CopyFrom(solutionODE2_tt);
+	if (data.nAE)
+	{
+		LinkedDataVector solutionLambda(data.newtonSolution, data.startAE, data.nAE);
+		computationalSystem.GetSystemData().GetCData().currentState.AECoords.CopyFrom(solutionLambda);
+	}
+
+	return true;
+}
+
+//! project positions and velocities of current state onto position and velocity level constraints
+//! position projection: [M C_q^T; C_q 0] * [Delta q; mu] = [0; -C(q)]
+//! velocity projection: [M C_q^T; C_q 0] * [Delta q_t; mu] = [0; -C_q*q_t - C_t]
+//! the system matrix is computed once at the end of step and used for both projections
+bool CSolverExplicitTimeInt::ProjectConstraints(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	massMatrixFactorized = false; //system matrix at end of step
+	if (!ComputeSystemMatrix(computationalSystem, simulationSettings)) { return false; }
+
+	Vector& solutionODE2 = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords;
+	Vector& solutionODE2_t = computationalSystem.GetSystemData().GetCData().currentState.ODE2Coords_t;
+
+	LinkedDataVector ode2RHS(data.systemResidual, 0, data.nODE2);
+	LinkedDataVector aeRHS(data.systemResidual, data.startAE, data.nAE);
+	LinkedDataVector solutionCorrection(data.newtonSolution, 0, data.nODE2);
+
+	//position level:
+	STARTTIMER(timer.AERHS);
+	ode2RHS.SetAll(0.);
+	computationalSystem.ComputeAlgebraicEquations(data.tempCompData, tempAE0, false);
+	for (Index i = 0; i < data.nAE; i++) { aeRHS[i] = -tempAE0[i]; }
+	for (Index i : velocityLevelAEindices) { aeRHS[i] = 0.; }
+	STOPTIMER(timer.AERHS);
+	if (IsVerbose(3)) { Verbose(3, STDstring("    projection: position constraint error = ") + EXUstd::ToString(aeRHS.GetL2Norm()) + "\n"); }
+
+	STARTTIMER(timer.newtonIncrement);
+	data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
+	STOPTIMER(timer.newtonIncrement);
+	solutionODE2 += solutionCorrection;
+
+	//velocity level:
+	STARTTIMER(timer.AERHS);
+	ode2RHS.SetAll(0.);
+	computationalSystem.ComputeAlgebraicEquations(data.tempCompData, tempAE0, true);
+	for (Index i = 0; i < data.nAE; i++) { aeRHS[i] = -tempAE0[i]; }
+	STOPTIMER(timer.AERHS);
+	if (IsVerbose(3)) { Verbose(3, STDstring("    projection: velocity constraint error = ") + EXUstd::ToString(aeRHS.GetL2Norm()) + "\n"); }
+
+	STARTTIMER(timer.newtonIncrement);
+	data.systemJacobian->Solve(data.systemResidual, data.newtonSolution);
+	STOPTIMER(timer.newtonIncrement);
+	solutionODE2_t += solutionCorrection;
+
+	return true;
+}
+
+//! perform one explicit step (replaces Newton's method):
+//!   q_i = q0 + h*sum_j a_ij*V_j, q_t,i = q_t0 + h*sum_j a_ij*A_j, V_i = q_t,i, A_i = q_tt(t0 + c_i*h, q_i, q_t,i)
+//!   q1 = q0 + h*sum_i b_i*V_i, q_t1 = q_t0 + h*sum_i b_i*A_i
+bool CSolverExplicitTimeInt::Newton(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
+{
+	const ExplicitIntegrationSettings& explicitIntegration = simulationSettings.timeIntegration.explicitIntegration;
+
+	conv.linearSolverFailed = false;
+	conv.newtonConverged = false;
+	conv.newtonSolutionDiverged = false;
+	it.newtonSteps = 0; //no Newton iterations in explicit solver
+	nextStepSize = 0.;
+
+	CSystemState& startOfStep = computationalSystem.GetSystemData().GetCData().startOfStepState;
+	CSystemState& current = computationalSystem.GetSystemData().GetCData().currentState;
+	Vector& solutionODE2 = current.ODE2Coords;
+	Vector& solutionODE2_t = current.ODE2Coords_t;
+	Vector& solutionODE2_tt = current.ODE2Coords_tt;
+
+	Real h = it.currentStepSize;
+	Real t0 = startOfStep.time;
+
+	//constrained systems: system matrix [M C_q^T; C_q 0] is computed and factorized once per step at the start of step and used in all stages;
+	//stage solutions are iteratively refined with the system matrix at the stage state (C_q depends on stage coordinates)
+	if (data.nAE) { massMatrixFactorized = false; }
+
+	for (Index i = 0; i < numberOfStages; i++)
+	{
+		STARTTIMER(timer.integrationFormula);
+		solutionODE2.CopyFrom(startOfStep.ODE2Coords);
+		solutionODE2_t.CopyFrom(startOfStep.ODE2Coords_t);
+		for (Index j = 0; j < i; j++)
+		{
+			if (rkMatrixA(i, j) != 0.)
+			{
+				solutionODE2.MultAdd(h*rkMatrixA(i, j), stageVelocities[j]);
+				solutionODE2_t.MultAdd(h*rkMatrixA(i, j), stageAccelerations[j]);
+			}
+		}
+		current.time = t0 + rkNodesC[i] * h;
+		stageVelocities[i].CopyFrom(solutionODE2_t);
+		STOPTIMER(timer.integrationFormula);
+
+		if (!ComputeAccelerations(computationalSystem, simulationSettings, stageAccelerations[i]))
+		{
+			current.time = it.currentTime;
+			return false;
+		}
+	}
+
+	STARTTIMER(timer.integrationFormula);
+	current.time = it.currentTime;
+	solutionODE2.CopyFrom(startOfStep.ODE2Coords);
+	solutionODE2_t.CopyFrom(startOfStep.ODE2Coords_t);
+	for (Index i = 0; i < numberOfStages; i++)
+	{
+		if (rkWeightsB[i] != 0.)
+		{
+			solutionODE2.MultAdd(h*rkWeightsB[i], stageVelocities[i]);
+			solutionODE2_t.MultAdd(h*rkWeightsB[i], stageAccelerations[i]);
+		}
+	}
+	//accelerations are the mean accelerations of step (consistent with velocity update)
+	solutionODE2_tt.SetAll(0.);
+	for (Index i = 0; i < numberOfStages; i++)
+	{
+		if (rkWeightsB[i] != 0.) { solutionODE2_tt.MultAdd(rkWeightsB[i], stageAccelerations[i]); }
+	}
+	STOPTIMER(timer.integrationFormula);
+
+	if (HasErrorEstimate() && it.adaptiveStep)
+	{
+		//scaled RMS error of difference between 5th and 4th order solution (Hairer, Norsett, Wanner)
+		Real atol = explicitIntegration.absoluteTolerance;
+		Real rtol = explicitIntegration.relativeTolerance;
+		Real errorSquared = 0.;
+		for (Index k = 0; k < data.nODE2; k++)
+		{
+			Real errorQ = 0.;
+			Real errorV = 0.;
+			for (Index i = 0; i < numberOfStages; i++)
+			{
+				Real db = rkWeightsB[i] - rkWeightsBhat[i];
+				errorQ += db * stageVelocities[i][k];
+				errorV += db * stageAccelerations[i][k];
+			}
+			Real scaleQ = atol + rtol * EXUstd::Maximum(fabs(startOfStep.ODE2Coords[k]), fabs(solutionODE2[k]));
+			Real scaleV = atol + rtol * EXUstd::Maximum(fabs(startOfStep.ODE2Coords_t[k]), fabs(solutionODE2_t[k]));
+			errorSquared += EXUstd::Square(h*errorQ / scaleQ) + EXUstd::Square(h*errorV / scaleV);
+		}
+		Real error = data.nODE2 ? sqrt(errorSquared / (Real)(2 * data.nODE2)) : 0.;
+
+		const Real safetyFactor = 0.9;
+		const Real minFactor = 0.2;
+		const Real maxFactor = 5.;
+		Real factor = maxFactor;
+		if (error != 0.) { factor = EXUstd::Minimum(maxFactor, EXUstd::Maximum(minFactor, safetyFactor * pow(error, -0.2))); }
+
+		if (IsVerbose(2)) { Verbose(2, STDstring("  RK45: error estimate = ") + EXUstd::ToString(error) + ", step size factor = " + EXUstd::ToString(factor) + "\n"); }
+
+		if (error > 1. && h > it.minStepSize)
+		{
+			stepSizeProposal = h * factor; //step rejected; ReduceStepSize(...) uses this step size
+			return false;
+		}
+		//next step size is applied in UpdateCurrentTime(...), as this step may be repeated in discontinuous iterations
+		nextStepSize = EXUstd::Maximum(it.minStepSize, EXUstd::Minimum(it.maxStepSize, h * factor));
+	}
+
+	if (data.nAE && explicitIntegration.useConstraintProjection)
+	{
+		if (!ProjectConstraints(computationalSystem, simulationSettings)) { return false; }
+	}
+
+	conv.newtonConverged = true;
+	return true;
+}
+
@@ -0,0 +1,118 @@
+/** ***********************************************************************************************
+* @class		CSolverExplicitTimeInt
+* @brief		Explicit time integration solvers: explicit Euler, classical Runge-Kutta (RK4) and the embedded
+*               Runge-Kutta method of Dormand-Prince (RK45) with error control
+* @details		Details:
+* 				- solves a dynamic system with constraints
+*               - accelerations and Lagrange multipliers are computed in every stage from the system in acceleration form
+*                 (index 1): [M C_q^T; C_q 0] * [q_tt; lambda] = [ODE2RHS; -(C_v)_q*q_t - (C_v)_t], C_v = C_q*q_t + C_t
+*               - for constrained systems, the system matrix is computed and factorized only once per step (start of step)
+*               - constraint drift is removed by projection of positions and velocities at the end of every step
+*               - for systems without constraints, the mass matrix can be factorized only once (useConstantMassMatrix)
+*				- the Newton method of CSolverBase is replaced by one explicit step; discontinuous iterations are still available
+*
+* @author		agent
+* @date			2026-10-18 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef CSOLVEREXPLICITTIMEINT__H
+#define CSOLVEREXPLICITTIMEINT__H
+
+#include "Solver/CSolverBase.h"
+
+//! explicit time integration solver with Butcher tableau; includes explicit Euler, RK4 and RK45 (Dormand-Prince)
+class CSolverExplicitTimeInt : public CSolverBase
+{
+public: //made public for access via pybind
+	//copy of parameters from integration scheme (cannot be changed during integration!)
+	DynamicSolverType dynamicSolverType;	//!< explicit method, copied from timeIntegration.explicitIntegration
+	Index numberOfStages;					//!< number of stages of Runge-Kutta method
+	Matrix rkMatrixA;						//!< Butcher tableau: coefficients a_ij (strictly lower triangular)
+	Vector rkWeightsB;						//!< Butcher tableau: weights b_i of solution
+	Vector rkWeightsBhat;					//!< Butcher tableau: weights of embedded method for error estimate (empty, if no error estimate available)
+	Vector rkNodesC;						//!< Butcher tableau: nodes c_i (stage times)
+
+	bool massMatrixFactorized;				//!< true, if (constant) mass matrix or system matrix of current step has been factorized already
+	Real stepSizeProposal;					//!< step size proposed by error control for rejected step; 0 if no proposal available
+	Real nextStepSize;						//!< step size proposed by error control for next step after accepted step; 0 if no proposal available
+
+	ObjectContainer<Vector> stageVelocities;	//!< velocities of all stages (derivatives of ODE2 coordinates)
+	ObjectContainer<Vector> stageAccelerations;	//!< accelerations of all stages (derivatives of ODE2_t coordinates)
+	ResizableVector tempAE0;				//!< temporary vector for AE quantities
+	ResizableVector tempAE1;				//!< temporary vector for AE quantities
+	ArrayIndex velocityLevelAEindices;		//!< global AE indices of constraints formulated at velocity level; they are excluded from position projection
+	GeneralMatrixEXUdense stageSystemMatrixDense;		//!< system matrix at state of current stage (constrained systems, dense solver); only used for iterative refinement
+	GeneralMatrixEigenSparse stageSystemMatrixSparse;	//!< system matrix at state of current stage (constrained systems, sparse solver); only used for iterative refinement
+	ResizableVector refinementResidual;		//!< temporary vector for residual of iterative refinement
+	ResizableVector refinementCorrection;	//!< temporary vector for correction of iterative refinement
+
+public:
+
+	//! return true, if static solver; needs to be overwritten in derived class
+	virtual bool IsStaticSolver() const override { return false; }
+
+	//! get solver name - needed for output file header and visualization window
+	virtual const STDstring GetSolverName() const override { return "explicit time integration"; }
+
+	//! reduce step size (1..normal, 2..severe problems); return true, if reduction was successful
+	virtual bool ReduceStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Index severity) override;
+
+	//! increase step size if convergence is good; for methods with error control, the step size follows from the error estimate
+	virtual void IncreaseStepSize(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override
+	{
+		if (!HasErrorEstimate())
+		{
+			it.currentStepSize = EXUstd::Minimum(it.maxStepSize, 2.*it.currentStepSize);
+		}
+	}
+
+	//! pre-initialize for solver specific tasks; called at beginning of InitializeSolver, right after Solver data reset
+	virtual void PreInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! post-initialize for solver specific tasks; called at the end of InitializeSolver
+	virtual void PostInitializeSolverSpecific(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! set/compute initial conditions (solver-specific!); called from InitializeSolver()
+	virtual void InitializeSolverInitialConditions(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! update currentTime (and load factor); MUST be overwritten in special solver class
+	virtual void UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! perform one explicit step (replaces Newton's method); returns false, if the step failed or has been rejected by error control
+	virtual bool Newton(CSystem& computationalSystem, const SimulationSettings& simulationSettings) override;
+
+	//! return true, if the method has an embedded error estimate (RK45)
+	bool HasErrorEstimate() const { return rkWeightsBhat.NumberOfItems() != 0; }
+
+	//! compute system matrix [M C_q^T; C_q C_lambda] at current state into systemMatrix (not factorized)
+	void AssembleSystemMatrix(CSystem& computationalSystem, GeneralMatrix& systemMatrix);
+
+	//! compute system matrix [M C_q^T; C_q C_lambda] at current state and factorize; returns false, if factorization failed
+	bool ComputeSystemMatrix(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
+	//! system matrix at state of current stage, which is used for iterative refinement in constrained systems
+	GeneralMatrix& GetStageSystemMatrix()
+	{
+		if (data.GetLinearSolverType() == LinearSolverType::EXUdense) { return stageSystemMatrixDense; }
+		return stageSystemMatrixSparse;
+	}
+
+	//! iterative refinement of data.newtonSolution for the system matrix at the current stage state, using the factorization
+	//! at the start of step; if refinement does not converge, the system matrix is factorized at the stage state; returns false, if factorization failed
+	bool RefineStageSolution(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+
+	//! compute accelerations and Lagrange multipliers at current state (incl. current time); accelerations are stored in 'accelerations',
+	//! Lagrange multipliers in currentState.AECoords; returns false, if the system matrix is not invertible
+	bool ComputeAccelerations(CSystem& computationalSystem, const SimulationSettings& simulationSettings, Vector& accelerations);
+
+	//! project positions and velocities of current state onto position and velocity level constraints; returns false, if the system matrix is not invertible
+	bool ProjectConstraints(CSystem& computationalSystem, const SimulationSettings& simulationSettings);
+};
+
+#endif
@@ -62,7 +62,24 @@ void CSolverImplicitSecondOrderTimeInt::InitializeSolverInitialConditions(CSyste
 	//compute initial values for accelerations:
 	//to be fully consistent the initial accelerations must be computed with Lagrange multipliers
 
-	if (computeInitialAccelerations)
+	if (computeInitialAccelerations && data.constantMassMatrix && data.nSys == data.nODE2)
+	{
+		//no constraints: M*q_tt = ODE2RHS; factorization of constant mass matrix is reused, if solver is run again on unchanged system
+		ComputeSystemMassMatrix(computationalSystem); //computed only here and reused in all steps
+		computationalSystem.ComputeSystemODE2RHS(data.tempCompData, data.tempODE2);
+
+		GeneralMatrix* massMatrix = FactorizeInitialMassMatrix(computationalSystem);
+		if (massMatrix == nullptr)
+		{
+			PyWarning("CSolverImplicitSecondOrder::InitializeSolverInitialConditions: System Jacobian not invertible!\nWARNING: using zero initial accelerations\n");
+			solutionODE2_tt.SetAll(0.);
+		}
+		else
+		{
+			massMatrix->Solve(data.tempODE2, solutionODE2_tt);
+		}
+	}
+	else if (computeInitialAccelerations)
 	{
 		//initial accelerations can be computed, if the system is written in acceleration form
 		//[ M    C_q^T][q_tt  ]   [             -ODE2RHS                 ]   [0]
@@ -90,8 +107,7 @@ void CSolverImplicitSecondOrderTimeInt::InitializeSolverInitialConditions(CSyste
 		computationalSystem.JacobianAE(data.tempCompData, newton, *(data.systemJacobian), factorAE_ODE2, factorAE_ODE2_t, velocityLevel, fillIntoSystemMatrix);
 
 		//Mass matrix - may also be directly filled into data.systemJacobian?
-		data.systemMassMatrix->SetAllZero();
-		computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+		ComputeSystemMassMatrix(computationalSystem); //if mass matrix is constant, it is computed only here and reused in all steps
 		data.systemJacobian->AddSubmatrix(*(data.systemMassMatrix));
 
 		//compute RHS
@@ -167,6 +183,38 @@ void CSolverImplicitSecondOrderTimeInt::InitializeSolverInitialConditions(CSyste
 
 }
 
+//! factorize constant mass matrix (computed with ComputeSystemMassMatrix) for initial accelerations, if not done already for the unchanged system; return nullptr, if factorization failed
+GeneralMatrix* CSolverImplicitSecondOrderTimeInt::FactorizeInitialMassMatrix(CSystem& computationalSystem)
+{
+	const CSystemData& systemData = computationalSystem.GetSystemData();
+	GeneralMatrix* massMatrix = &initialMassMatrixSparse;
+	if (data.systemMassMatrix->GetSystemMatrixType() == LinearSolverType::EXUdense) { massMatrix = &initialMassMatrixDense; }
+
+	//state version changes with Assemble() and Reset(), object parameters version with changes of parameters, which may change the mass matrix
+	if (massMatrix->IsMatrixIsFactorized() && massMatrix->NumberOfRows() == data.nODE2 && 
+		initialMassMatrixSystem.lock() == systemData.GetStateViewAnchor() &&
+		initialMassMatrixStateVersion == systemData.GetStateVersion() &&
+		initialMassMatrixParametersVersion == systemData.GetObjectParametersVersion())
+	{
+		return massMatrix;
+	}
+
+	initialMassMatrixSystem = systemData.GetStateViewAnchor();
+	initialMassMatrixStateVersion = systemData.GetStateVersion();
+	initialMassMatrixParametersVersion = systemData.GetObjectParametersVersion();
+
+	massMatrix->SetNumberOfRowsAndColumns(data.nODE2, data.nODE2);
+	massMatrix->SetAllZero();
+	massMatrix->AddSubmatrix(*(data.systemMassMatrix));
+	massMatrix->FinalizeMatrix();
+
+	STARTTIMER(timer.factorization);
+	Index factorizeOutput = massMatrix->Factorize();
+	STOPTIMER(timer.factorization);
+	if (factorizeOutput != 0) { return nullptr; }
+	return massMatrix;
+}
+
 //! initialize static step / time step: do some outputs, checks, etc.
 void CSolverImplicitSecondOrderTimeInt::UpdateCurrentTime(CSystem& computationalSystem, const SimulationSettings& simulationSettings)
 {
@@ -283,8 +331,7 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonResidual(CSystem& computati
 
 	//now compute the new residual with updated system vectors:
 	STARTTIMER(timer.massMatrix);
-	data.systemMassMatrix->SetAllZero();
-	computationalSystem.ComputeMassMatrix(data.tempCompData, *(data.systemMassMatrix));
+	ComputeSystemMassMatrix(computationalSystem); //not recomputed for constant mass matrix
 	STOPTIMER(timer.massMatrix);
 
 	STARTTIMER(timer.ODE2RHS);
@@ -369,6 +416,7 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonJacobian(CSystem& computati
 	computationalSystem.NumericalJacobianODE2RHS(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.jacobianAE)); //fills in part of jacobian
 
 	data.jacobianAE->MultiplyWithFactor(-EXUstd::Square(it.currentStepSize) * newmarkBeta * factJacAlgorithmic); //only ODE2 part; displacements (including those in contraints?) related to unknown accelerations by h^2*beta
+	if (simulationSettings.linearSolverSettings.fixedPatternAssembly) { data.jacobianAE->FinalizeMatrix(); } //temporary matrix keeps its pattern for in-place refill
 
 	data.systemJacobian->AddSubmatrix(*(data.jacobianAE), 0, 0);
 	STOPTIMER(timer.jacobianODE2);
@@ -380,6 +428,7 @@ void CSolverImplicitSecondOrderTimeInt::ComputeNewtonJacobian(CSystem& computati
 	computationalSystem.NumericalJacobianODE2RHS_t(data.tempCompData, newton.numericalDifferentiation, data.tempODE2F0, data.tempODE2F1, *(data.jacobianAE)); //d(ODE2)/dq_t for damping terms
 	data.jacobianAE->MultiplyWithFactor(-it.currentStepSize * newmarkGamma * factJacAlgorithmic);
 	//jacobianAE *= -stepSize * newmarkGamma * factJacAlgorithmic;
+	if (simulationSettings.linearSolverSettings.fixedPatternAssembly) { data.jacobianAE->FinalizeMatrix(); } //temporary matrix keeps its pattern for in-place refill
 	data.systemJacobian->AddSubmatrix(*(data.jacobianAE), 0, 0);
 	STOPTIMER(timer.jacobianODE2_t);
 
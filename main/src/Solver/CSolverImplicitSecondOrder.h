@@ -21,6 +21,9 @@
 #define CSOLVERIMPLICITSECONDORDERTIMEINT__H
 
 #include "Solver/CSolverBase.h" 
+#include <memory> //for std::weak_ptr
+
+class CSystemStateViewAnchor;
 
 //! this is the new general implicit second order time integration solver
 //! includes trapezoidal rule, Newmark and generalized alpha
@@ -36,7 +39,19 @@ public: //made public for access via pybind
 	Real factJacAlgorithmic;
 
 	//bool useIndex2Constraints; ==> directly linked to simulationSettings
+protected:
+	//factorized constant mass matrix for initial accelerations of systems without constraints; reused by later runs of the solver on the unchanged system
+	GeneralMatrixEXUdense initialMassMatrixDense;		//!< factorized mass matrix in case of EXUdense
+	GeneralMatrixEigenSparse initialMassMatrixSparse;	//!< factorized mass matrix in case of sparse solvers
+	std::weak_ptr<CSystemStateViewAnchor> initialMassMatrixSystem; //!< identifies system data, for which mass matrix has been factorized (anchor is unique per system data)
+	Index initialMassMatrixStateVersion;				//!< state version of system at factorization of mass matrix
+	Index initialMassMatrixParametersVersion;			//!< object parameters version of system at factorization of mass matrix
+
+	//! factorize constant mass matrix (computed with ComputeSystemMassMatrix) for initial accelerations, if not done already for the unchanged system; return nullptr, if factorization failed
+	GeneralMatrix* FactorizeInitialMassMatrix(CSystem& computationalSystem);
+
 public:
+	CSolverImplicitSecondOrderTimeInt() : initialMassMatrixStateVersion(EXUstd::InvalidIndex), initialMassMatrixParametersVersion(EXUstd::InvalidIndex) {}
 
 	//! return true, if static solver; needs to be overwritten in derived class
 	virtual bool IsStaticSolver() const override { return false; }
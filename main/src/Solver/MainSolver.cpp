@@ -37,6 +37,7 @@
 
 #include "Solver/CSolverImplicitSecondOrder.h"
 #include "Solver/CSolverStatic.h"
+#include "Solver/CSolverExplicit.h"
 
 #include "Solver/MainSolverBase.h" //pybind access to solvers
 #include "Autogenerated/MainSolver.h" //pybind access to solvers
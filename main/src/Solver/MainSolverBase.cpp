@@ -20,6 +20,7 @@
 //
 #include "Linalg/BasicLinalg.h"
 #include "Linalg/LinearSolver.h"
+#include "Linalg/SparseEigenSolver.h"
 
 #include "Linalg/Geometry.h"
 
@@ -176,6 +177,7 @@ void MainSolverBase::SetSystemMassMatrix(const py::array_t<Real>& systemMassMatr
 	if (m.NumberOfColumns() != nSys || m.NumberOfRows() != nSys) { SysError("MainSolverBase::SetSystemMassMatrix(...): matrix has wrong size or MainSolverBase is not correctly initialized; call InitializeSolver() first"); }
 
 	GetCSolver().data.systemMassMatrix->SetMatrix(m);
+	GetCSolver().data.massMatrixComputed = false; //constant mass matrix needs to be recomputed by solver
 }
 
 //! set locally stored system residual
@@ -199,6 +201,7 @@ void MainSolverBase::ComputeMassMatrix(MainSystem& mainSystem/*, const Simulatio
 	GetCSolver().data.systemMassMatrix->SetAllZero();
 	mainSystem.cSystem->ComputeMassMatrix(GetCSolver().data.tempCompData, *(GetCSolver().data.systemMassMatrix));
 	if (scalarFactor != 1.) { GetCSolver().data.systemMassMatrix->MultiplyWithFactor(scalarFactor); }
+	GetCSolver().data.massMatrixComputed = false; //scaled matrix must not be reused as constant mass matrix by solver
 }
 
 //! set systemJacobian to zero and add jacobian (multiplied with factor) of ODE2RHS to systemJacobian in cSolver
@@ -258,8 +261,66 @@ void MainSolverBase::ComputeAlgebraicEquations(MainSystem& mainSystem/*, const S
 	}
 }
 
+//! get upper left block of size x size of system matrix as Eigen sparse matrix; dense matrices are converted (slow for large systems)
+void GeneralMatrix2EigenSparse(GeneralMatrix& matrix, Index size, EigenSparseMatrix& sparseMatrix)
+{
+	if (matrix.GetSystemMatrixType() == LinearSolverType::EigenSparse)
+	{
+		GeneralMatrixEigenSparse& matrixEigenSparse = (GeneralMatrixEigenSparse&)matrix;
+		if (!matrixEigenSparse.IsMatrixBuiltFromTriplets()) { matrixEigenSparse.FinalizeMatrix(); }
+		sparseMatrix = matrixEigenSparse.GetEigenSparseMatrix().topLeftCorner(size, size);
+	}
+	else
+	{
+		ResizableMatrix denseMatrix = matrix.GetEXUdenseMatrix();
+		EigenTripletVector triplets;
+		for (Index j = 0; j < size; j++)
+		{
+			for (Index i = 0; i < size; i++)
+			{
+				if (denseMatrix(i, j) != 0.) { triplets.push_back(EigenTriplet((StorageIndex)i, (StorageIndex)j, denseMatrix(i, j))); }
+			}
+		}
+		sparseMatrix.resize(size, size);
+		sparseMatrix.setFromTriplets(triplets.begin(), triplets.end());
+	}
+}
 
+//! compute numberOfEigenvalues eigenvalues (closest to shift) and eigenvectors of ODE2 part (mass and stiffness matrix, without constraints) with sparse shift-invert Lanczos solver;
+//! matrices are not exported to python; results are moved to numpy arrays without copying
+py::list MainSolverBase::ComputeODE2Eigenvalues(MainSystem& mainSystem, Index numberOfEigenvalues, Real shift, Real tolerance, bool computeEigenVectors)
+{
+	CheckInitialized(mainSystem);
+	Index nODE2 = GetCSolver().data.nODE2;
+	if (numberOfEigenvalues < 1 || numberOfEigenvalues > nODE2) 
+	{ 
+		SysError("MainSolverBase::ComputeODE2Eigenvalues(...): numberOfEigenvalues must be at least 1 and not larger than number of ODE2 coordinates"); 
+		return py::list();
+	}
 
+	ComputeMassMatrix(mainSystem);
+	ComputeJacobianODE2RHS(mainSystem, -1.); //stiffness matrix = -d(ODE2RHS)/dq (static solver: no factors of time integration)
 
+	EigenSparseMatrix massMatrix, stiffnessMatrix;
+	GeneralMatrix2EigenSparse(*(GetCSolver().data.systemMassMatrix), nODE2, massMatrix);
+	GeneralMatrix2EigenSparse(*(GetCSolver().data.systemJacobian), nODE2, stiffnessMatrix);
 
+	SparseEigenSolver eigenSolver;
+	eigenSolver.SetParameters(numberOfEigenvalues, shift, tolerance, computeEigenVectors);
+	Index result = eigenSolver.ComputeSymmetric(stiffnessMatrix, massMatrix);
+	if (result == SparseEigenSolver::factorizationFailed)
+	{
+		SysError("MainSolverBase::ComputeODE2Eigenvalues(...): factorization of shifted stiffness matrix failed; try different shift");
+		return py::list();
+	}
+	else if (result == SparseEigenSolver::notConverged)
+	{
+		PyWarning("MainSolverBase::ComputeODE2Eigenvalues(...): only " + EXUstd::ToString(eigenSolver.GetNumberOfConvergedEigenvalues()) +
+			" of " + EXUstd::ToString(numberOfEigenvalues) + " eigenvalues converged; increase tolerance");
+	}
 
+	py::list list;
+	list.append(EPyUtils::DenseVectorMove2NumPy(eigenSolver.GetEigenValues()));
+	list.append(EPyUtils::DenseMatrixMove2NumPy(eigenSolver.GetEigenVectors()));
+	return list;
+}
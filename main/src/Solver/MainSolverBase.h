@@ -42,6 +42,7 @@
 
 #include "Solver/CSolverImplicitSecondOrder.h"
 #include "Solver/CSolverStatic.h"
+#include "Solver/CSolverExplicit.h"
 
 
 class MainSolverBase // 
@@ -197,6 +198,31 @@ public: //
 		return GetCSolver().SolveSystem(*(mainSystem.cSystem), simulationSettings);
 	}
 
+	//! stepwise time integration: perform steps from current time to current time + timeIncrement; solver is initialized at first call
+	//! and data, factorizations and files are kept until FinalizeSolver(...) is called; return true if success, false else
+	virtual bool Advance(MainSystem& mainSystem, const SimulationSettings& simulationSettings, Real timeIncrement)
+	{
+		if (!GetCSolver().IsAdvanceMode()) { InitializeCheckInitialized(mainSystem); }
+		else if (!CheckInitialized(mainSystem)) { return false; }
+		return GetCSolver().Advance(*(mainSystem.cSystem), simulationSettings, timeIncrement);
+	}
+
+	//! write binary checkpoint file with system states, solver data and internally stored sensor values (e.g. between calls to Advance(...));
+	//! item parameters are not stored, the model is rebuilt for restart; return true on success
+	virtual bool SaveCheckpoint(const MainSystem& mainSystem, const STDstring& fileName) const
+	{
+		return GetCSolver().SaveCheckpoint(*(mainSystem.cSystem), fileName);
+	}
+
+	//! load checkpoint file into assembled system with identical structure; solver is initialized for Advance(...) if needed;
+	//! return true on success
+	virtual bool LoadCheckpoint(MainSystem& mainSystem, const SimulationSettings& simulationSettings, const STDstring& fileName)
+	{
+		if (!GetCSolver().IsAdvanceMode()) { InitializeCheckInitialized(mainSystem); }
+		else if (!CheckInitialized(mainSystem)) { return false; }
+		return GetCSolver().LoadCheckpoint(*(mainSystem.cSystem), simulationSettings, fileName);
+	}
+
 	//! write concluding information (timer statistics, messages) and close files
 	virtual void FinalizeSolver(MainSystem& mainSystem, const SimulationSettings& simulationSettings) 
 	{
@@ -331,6 +357,8 @@ public: //
 	virtual void ComputeODE2RHS(MainSystem& mainSystem/*, const SimulationSettings& simulationSettings*/);
 	//! compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)
 	virtual void ComputeAlgebraicEquations(MainSystem& mainSystem/*, const SimulationSettings& simulationSettings*/, bool velocityLevel = false);
+	//! compute numberOfEigenvalues eigenvalues (closest to shift) and eigenvectors of ODE2 part (mass and stiffness matrix, without constraints) with sparse shift-invert Lanczos solver; returns [eigenValues, eigenVectors]
+	virtual py::list ComputeODE2Eigenvalues(MainSystem& mainSystem, Index numberOfEigenvalues, Real shift = 0., Real tolerance = 1e-12, bool computeEigenVectors = true);
 	//! print function used in ostream operator (print is virtual and can thus be overloaded)
 	virtual void Print(std::ostream& os) const
 	{
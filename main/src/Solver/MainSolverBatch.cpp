@@ -0,0 +1,560 @@
+/** ***********************************************************************************************
+* @brief		Implementation of batch solver: many variants of one MainSystem solved in parallel threads
+* @details		Details:
+* 				- see MainSolverBatch.h
+*
+* @author		agent
+* @date			2026-10-18 (created)
+*
+* @copyright    This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include <pybind11/numpy.h>       //interface to numpy
+#include <pybind11/functional.h> //for preStepFunction
+
+#include <thread>
+#include <atomic>
+#include <vector>
+#include <functional>
+
+#include "Linalg/BasicLinalg.h"
+#include "Main/MainSystem.h"
+#include "Pymodules/PybindUtilities.h"
+#include "Utilities/TimerStructure.h" //for globalTimersSuspended
+
+#include "Solver/CSolverImplicitSecondOrder.h"
+#include "Solver/CSolverStatic.h"
+#include "Solver/CSolverExplicit.h"
+#include "Solver/MainSolverBatch.h"
+#include "Autogenerated/MainSolver.h"
+
+//! get parameter value of item in mainSystem; needs python GIL
+py::object GetBatchSolverParameter(MainSystem& mainSystem, const BatchSolverParameter& parameter)
+{
+	if (parameter.itemType == "Node") { return mainSystem.PyGetNodeParameter(parameter.itemIndex, parameter.parameterName); }
+	else if (parameter.itemType == "Object") { return mainSystem.PyGetObjectParameter(parameter.itemIndex, parameter.parameterName); }
+	else if (parameter.itemType == "Marker") { return mainSystem.PyGetMarkerParameter(parameter.itemIndex, parameter.parameterName); }
+	else if (parameter.itemType == "Load") { return mainSystem.PyGetLoadParameter(parameter.itemIndex, parameter.parameterName); }
+	return mainSystem.PyGetSensorParameter(parameter.itemIndex, parameter.parameterName);
+}
+
+//! set parameter (or component of vector parameter) of item in mainSystem to value; needs python GIL
+void SetBatchSolverParameter(MainSystem& mainSystem, const BatchSolverParameter& parameter, Real value)
+{
+	py::object pyValue = py::float_(value);
+	if (parameter.component != EXUstd::InvalidIndex)
+	{
+		py::list vector(GetBatchSolverParameter(mainSystem, parameter));
+		vector[parameter.component] = pyValue;
+		pyValue = vector;
+	}
+
+	if (parameter.itemType == "Node") { mainSystem.PySetNodeParameter(parameter.itemIndex, parameter.parameterName, pyValue); }
+	else if (parameter.itemType == "Object") { mainSystem.PySetObjectParameter(parameter.itemIndex, parameter.parameterName, pyValue); }
+	else if (parameter.itemType == "Marker") { mainSystem.PySetMarkerParameter(parameter.itemIndex, parameter.parameterName, pyValue); }
+	else if (parameter.itemType == "Load") { mainSystem.PySetLoadParameter(parameter.itemIndex, parameter.parameterName, pyValue); }
+	else { mainSystem.PySetSensorParameter(parameter.itemIndex, parameter.parameterName, pyValue); }
+}
+
+//! return pointer to Real value of parameter (or component) of item in mainSystem for writing without python interface;
+//! returns nullptr if parameter has no direct access (parameters which are not Real-valued with fixed size); does not need python GIL
+Real* GetBatchSolverParameterData(MainSystem& mainSystem, const BatchSolverParameter& parameter)
+{
+	MainSystemData& data = mainSystem.GetMainSystemData();
+	Real* value = nullptr;
+	Index size = 0;
+	bool found = false;
+	if (parameter.itemType == "Node") { found = data.GetMainNodes()[parameter.itemNumber]->GetRealParameterAccess(parameter.parameterName, value, size); }
+	else if (parameter.itemType == "Object") { found = data.GetMainObjects()[parameter.itemNumber]->GetRealParameterAccess(parameter.parameterName, value, size); }
+	else if (parameter.itemType == "Marker") { found = data.GetMainMarkers()[parameter.itemNumber]->GetRealParameterAccess(parameter.parameterName, value, size); }
+	else if (parameter.itemType == "Load") { found = data.GetMainLoads()[parameter.itemNumber]->GetRealParameterAccess(parameter.parameterName, value, size); }
+	else { found = data.GetMainSensors()[parameter.itemNumber]->GetRealParameterAccess(parameter.parameterName, value, size); }
+
+	if (!found) { return nullptr; }
+	if (parameter.component == EXUstd::InvalidIndex) { return (size == 1) ? value : nullptr; }
+	return (parameter.component < size) ? value + parameter.component : nullptr;
+}
+
+//! resolve pointers for direct access to parameters in mainSystem, see GetBatchSolverParameterData(...); pointers stay valid until items are deleted
+std::vector<Real*> GetBatchSolverParametersData(MainSystem& mainSystem, const std::vector<BatchSolverParameter>& parameters)
+{
+	std::vector<Real*> parametersData;
+	for (const BatchSolverParameter& parameter : parameters)
+	{
+		parametersData.push_back(GetBatchSolverParameterData(mainSystem, parameter));
+	}
+	return parametersData;
+}
+
+//! set parameters of mainSystem to values; parameters with direct access (parametersData[j] != nullptr) are set without python GIL,
+//! only other parameters are set via python interface with GIL; throws exception in case of errors
+void SetBatchSolverParameters(MainSystem& mainSystem, const std::vector<BatchSolverParameter>& parameters, const std::vector<Real*>& parametersData, const Real* values)
+{
+	bool usePythonInterface = false;
+	for (Index j = 0; j < (Index)parameters.size(); j++)
+	{
+		if (parametersData[j])
+		{
+			*parametersData[j] = values[j];
+			//same as in SetObjectParameter(...)
+			if (parameters[j].itemType == "Object")
+			{
+				mainSystem.GetMainSystemData().GetMainObjects()[parameters[j].itemNumber]->GetCObject()->ParametersHaveChanged();
+				mainSystem.GetCSystem()->GetSystemData().IncreaseObjectParametersVersion();
+			}
+		}
+		else { usePythonInterface = true; }
+	}
+
+	if (usePythonInterface)
+	{
+		bool success = true;
+		{
+			py::gil_scoped_acquire acquire;
+			try
+			{
+				for (Index j = 0; j < (Index)parameters.size(); j++)
+				{
+					if (!parametersData[j]) { SetBatchSolverParameter(mainSystem, parameters[j], values[j]); }
+				}
+			}
+			catch (...) { success = false; } //python exceptions must be destroyed with GIL
+		}
+		CHECKandTHROW(success, "SetBatchSolverParameters: setting parameter via python interface failed");
+	}
+}
+
+//! prepare item dictionary for adding to system copy: automatically generated names (e.g. 'node3') are not accepted by AddMain...(),
+//! but are regenerated identically in the copy; graphics data cannot be read back from items and is not needed, as copies are not rendered
+py::dict ItemDictionaryForCopy(py::dict d, const STDstring& baseItem, Index itemNumber)
+{
+	if (d.contains("name") && py::cast<std::string>(d["name"]) == baseItem + EXUstd::Num2String(itemNumber))
+	{
+		d["name"] = "";
+	}
+	if (d.contains("VgraphicsData")) { d.attr("pop")("VgraphicsData"); }
+	return d;
+}
+
+MainSystem* NewMainSystemCopy(MainSystem& source)
+{
+	//same as MainSystemContainer::AddMainSystem(), but not added to MainSystemContainer and VisualizationSystemContainer
+	CSystem* cSystem = new CSystem();
+	MainSystem* mainSystem = new MainSystem();
+	mainSystem->mainSystemData.SetCSystemData(&(cSystem->GetSystemData()));
+	mainSystem->cSystem = cSystem;
+	mainSystem->LinkToRenderEngine(); //only links visualizationSystem to the data of the copy; copy is not added to renderer
+	mainSystem->SetInteractiveMode(false);
+
+	//items are copied via their dictionaries, in the same order as in source ==> item numbers are identical
+	const MainSystemData& data = source.GetMainSystemData();
+	for (Index i = 0; i < data.GetMainNodes().NumberOfItems(); i++)
+	{
+		mainSystem->AddMainNode(ItemDictionaryForCopy(source.PyGetNode(py::int_(i)), "node", i));
+	}
+	for (Index i = 0; i < data.GetMainObjects().NumberOfItems(); i++)
+	{
+		mainSystem->AddMainObject(ItemDictionaryForCopy(source.PyGetObject(py::int_(i)), "object", i));
+	}
+	for (Index i = 0; i < data.GetMainMarkers().NumberOfItems(); i++)
+	{
+		mainSystem->AddMainMarker(ItemDictionaryForCopy(source.PyGetMarker(py::int_(i)), "marker", i));
+	}
+	for (Index i = 0; i < data.GetMainLoads().NumberOfItems(); i++)
+	{
+		mainSystem->AddMainLoad(ItemDictionaryForCopy(source.PyGetLoad(py::int_(i)), "load", i));
+	}
+	for (Index i = 0; i < data.GetMainSensors().NumberOfItems(); i++)
+	{
+		py::dict d = ItemDictionaryForCopy(source.PyGetSensor(py::int_(i)), "sensor", i);
+		d["writeToFile"] = false; //all copies would write to the same file
+		d["storeInternal"] = false;
+		mainSystem->AddMainSensor(d);
+	}
+
+	cSystem->GetPythonUserFunctions().preStepFunction = source.GetCSystem()->GetPythonUserFunctions().preStepFunction;
+	cSystem->GetPythonUserFunctions().mainSystem = mainSystem;
+
+	return mainSystem;
+}
+
+//! true, if solverType is handled by MainSolverExplicit
+bool IsBatchSolverExplicit(DynamicSolverType solverType)
+{
+	return solverType == DynamicSolverType::ExplicitEuler || solverType == DynamicSolverType::RK4 || solverType == DynamicSolverType::RK45;
+}
+
+void DeleteMainSystemCopy(MainSystem* mainSystem)
+{
+	//same as MainSystemContainer::Reset() for one system
+	mainSystem->Reset();
+	delete mainSystem->cSystem;
+	delete mainSystem;
+}
+
+//! parse list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] into batchParameters; returns false on error
+bool ParseBatchSolverParameters(MainSystem& mainSystem, const py::list& parameters, std::vector<BatchSolverParameter>& batchParameters, const STDstring& functionName)
+{
+	for (auto item : parameters)
+	{
+		py::list list(py::reinterpret_borrow<py::object>(item));
+		BatchSolverParameter parameter;
+		parameter.itemNumber = EXUstd::InvalidIndex;
+		parameter.component = EXUstd::InvalidIndex;
+		if (list.size() == 3 || list.size() == 4)
+		{
+			parameter.itemType = py::cast<STDstring>(list[0]);
+			parameter.itemIndex = list[1];
+			parameter.parameterName = py::cast<STDstring>(list[2]);
+			if (list.size() == 4) { parameter.component = py::cast<Index>(list[3]); }
+		}
+		if (parameter.itemType != "Node" && parameter.itemType != "Object" && parameter.itemType != "Marker" &&
+			parameter.itemType != "Load" && parameter.itemType != "Sensor")
+		{
+			PyError(functionName + ": parameters must be a list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component], itemType being 'Node', 'Object', 'Marker', 'Load' or 'Sensor'");
+			return false;
+		}
+		if (parameter.itemType == "Node") { parameter.itemNumber = EPyUtils::GetNodeIndexSafely(parameter.itemIndex); }
+		else if (parameter.itemType == "Object") { parameter.itemNumber = EPyUtils::GetObjectIndexSafely(parameter.itemIndex); }
+		else if (parameter.itemType == "Marker") { parameter.itemNumber = EPyUtils::GetMarkerIndexSafely(parameter.itemIndex); }
+		else if (parameter.itemType == "Load") { parameter.itemNumber = EPyUtils::GetLoadIndexSafely(parameter.itemIndex); }
+		else { parameter.itemNumber = EPyUtils::GetSensorIndexSafely(parameter.itemIndex); }
+		py::object value = GetBatchSolverParameter(mainSystem, parameter); //raises error for invalid item numbers or parameter names
+		if (parameter.component != EXUstd::InvalidIndex && (!py::isinstance<py::sequence>(value) || py::isinstance<py::str>(value) ||
+			parameter.component >= (Index)py::len(value)))
+		{
+			PyError(functionName + ": invalid component " + EXUstd::ToString(parameter.component) + " of parameter '" + parameter.parameterName + "'");
+			return false;
+		}
+		batchParameters.push_back(parameter);
+	}
+	return true;
+}
+
+//! parse sensorNumbers and compute number of result values per system: sum of sensor value sizes or number of ODE2 coordinates (no sensors); returns false on error
+bool ParseBatchSolverSensors(MainSystem& mainSystem, const py::list& sensorNumbers, ArrayIndex& sensors, Index& numberOfValues, const STDstring& functionName)
+{
+	numberOfValues = 0;
+	const CSystemData& cSystemData = mainSystem.GetCSystem()->GetSystemData();
+	Vector sensorValues;
+	for (auto item : sensorNumbers)
+	{
+		Index sensorNumber = EPyUtils::GetSensorIndexSafely(py::reinterpret_borrow<py::object>(item));
+		if (sensorNumber >= cSystemData.GetCSensors().NumberOfItems())
+		{
+			PyError(functionName + ": invalid sensor number " + EXUstd::ToString(sensorNumber));
+			return false;
+		}
+		cSystemData.GetCSensors()[sensorNumber]->GetSensorValues(cSystemData, sensorValues, ConfigurationType::Initial);
+		numberOfValues += sensorValues.NumberOfItems();
+		sensors.Append(sensorNumber);
+	}
+	if (sensors.NumberOfItems() == 0) { numberOfValues = cSystemData.GetNumberOfCoordinatesODE2(); }
+	return true;
+}
+
+//! write current sensor values (or ODE2 coordinates if sensors is empty) of system into row; row contains NaN, if success=false; does not need python GIL
+void WriteBatchSolverValues(const CSystemData& data, const ArrayIndex& sensors, Index numberOfValues, bool success, Real* row)
+{
+	if (success && sensors.NumberOfItems() != 0)
+	{
+		Vector currentValues;
+		Index cnt = 0;
+		for (Index sensorNumber : sensors)
+		{
+			data.GetCSensors()[sensorNumber]->GetSensorValues(data, currentValues, ConfigurationType::Current);
+			for (Index i = 0; i < currentValues.NumberOfItems() && cnt < numberOfValues; i++) { row[cnt++] = currentValues[i]; }
+		}
+	}
+	else if (success)
+	{
+		const Vector& u = data.GetCData().GetCurrent().ODE2Coords;
+		for (Index i = 0; i < numberOfValues; i++) { row[i] = u[i]; }
+	}
+	else
+	{
+		for (Index i = 0; i < numberOfValues; i++) { row[i] = std::numeric_limits<Real>::quiet_NaN(); }
+	}
+}
+
+//! settings used for system copies: no output, files or python commands; solver type set as in SolveDynamic;
+//! parallelization is done over the copies, therefore every copy runs single-threaded
+SimulationSettings GetBatchSolverSettings(const SimulationSettings& simulationSettings, DynamicSolverType solverType)
+{
+	SimulationSettings settings = simulationSettings;
+	settings.numberOfThreads = 1;
+	settings.displayStatistics = false;
+	settings.displayComputationTime = false;
+	settings.solutionSettings.writeSolutionToFile = false;
+	settings.timeIntegration.verboseMode = 0;
+	settings.timeIntegration.verboseModeFile = 0;
+	settings.timeIntegration.preStepPyExecute = "";
+	settings.staticSolver.verboseMode = 0;
+	settings.staticSolver.verboseModeFile = 0;
+	settings.staticSolver.preStepPyExecute = "";
+	if (solverType == DynamicSolverType::TrapezoidalIndex2)
+	{
+		settings.timeIntegration.generalizedAlpha.useNewmark = true;
+		settings.timeIntegration.generalizedAlpha.useIndex2Constraints = true;
+	}
+	if (IsBatchSolverExplicit(solverType)) { settings.timeIntegration.explicitIntegration.dynamicSolverType = solverType; }
+	return settings;
+}
+
+//! run Task(threadNumber, task) for task = 0 .. numberOfTasks-1 in numberOfThreads threads without python GIL;
+//! every thread takes the next task until all tasks are done; Task must not throw;
+//! std::thread is used, as solvers of the copies may enter the TaskManager themselves (which cannot be nested in TaskManager tasks) and
+//! the TaskManager is not available in all builds
+void RunBatchSolverThreads(Index numberOfThreads, Index numberOfTasks, const std::function<void(Index, Index)>& Task)
+{
+	std::atomic<Index> nextTask(0);
+	auto Worker = [&](Index threadNumber)
+	{
+		threadWithoutPythonGIL = true;
+		globalTimersSuspended = true; //solvers of all threads would reset and measure the same global timers
+		for (Index task = nextTask++; task < numberOfTasks; task = nextTask++)
+		{
+			Task(threadNumber, task);
+		}
+		threadWithoutPythonGIL = false;
+		globalTimersSuspended = false;
+	};
+
+	py::gil_scoped_release release;
+	std::vector<std::thread> threads;
+	for (Index k = 0; k < numberOfThreads; k++) { threads.push_back(std::thread(Worker, k)); }
+	for (auto& thread : threads) { thread.join(); }
+}
+
+//! number of threads: all hardware threads if numberOfThreads=0, but at least one and not more than numberOfTasks
+Index GetBatchSolverNumberOfThreads(Index numberOfThreads, Index numberOfTasks)
+{
+	if (numberOfThreads == 0) { numberOfThreads = (Index)std::thread::hardware_concurrency(); }
+	return EXUstd::Maximum((Index)1, EXUstd::Minimum(numberOfThreads, numberOfTasks));
+}
+
+//! create new solver according to solver type
+MainSolverBase* NewBatchSolver(DynamicSolverType solverType, bool staticSolver)
+{
+	if (staticSolver) { return new MainSolverStatic(); }
+	else if (IsBatchSolverExplicit(solverType)) { return new MainSolverExplicit(); }
+	return new MainSolverImplicitSecondOrder();
+}
+
+py::array_t<Real> PySolveBatch(MainSystem& mainSystem, const SimulationSettings& simulationSettings, const py::list& parameters,
+	const py::array_t<Real>& parameterValues, const py::list& sensorNumbers, DynamicSolverType solverType, bool staticSolver, Index numberOfThreads)
+{
+	if (!mainSystem.GetFlagSystemIsConsistent())
+	{
+		PyError("SolveBatch: system is not consistent; call Assemble() before SolveBatch(...)");
+		return py::array_t<Real>();
+	}
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//parse and check parameters and sensors
+	std::vector<BatchSolverParameter> batchParameters; //std::vector, as ResizableArray copies items with memcpy
+	if (!ParseBatchSolverParameters(mainSystem, parameters, batchParameters, "SolveBatch")) { return py::array_t<Real>(); }
+
+	if (parameterValues.ndim() != 2 || (Index)parameterValues.shape(1) != (Index)batchParameters.size())
+	{
+		PyError(STDstring("SolveBatch: parameterValues must be an array with shape (numberOfVariants, ") + EXUstd::ToString((Index)batchParameters.size()) + ")");
+		return py::array_t<Real>();
+	}
+	Index numberOfVariants = (Index)parameterValues.shape(0);
+	Index numberOfParameters = (Index)batchParameters.size();
+
+	//copy values, such that worker threads do not access python objects
+	Vector variantValues(numberOfVariants*numberOfParameters);
+	auto valuesAccess = parameterValues.unchecked<2>();
+	for (Index i = 0; i < numberOfVariants; i++)
+	{
+		for (Index j = 0; j < numberOfParameters; j++)
+		{
+			variantValues[i*numberOfParameters + j] = valuesAccess(i, j);
+		}
+	}
+
+	ArrayIndex sensors;
+	Index numberOfValues = 0;
+	if (!ParseBatchSolverSensors(mainSystem, sensorNumbers, sensors, numberOfValues, "SolveBatch")) { return py::array_t<Real>(); }
+
+	py::array_t<Real> result({ numberOfVariants, numberOfValues });
+	Real* resultData = result.mutable_data();
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//settings and per thread system copies and solvers
+	SimulationSettings settings = GetBatchSolverSettings(simulationSettings, solverType);
+	numberOfThreads = GetBatchSolverNumberOfThreads(numberOfThreads, numberOfVariants);
+
+	ResizableArray<MainSystem*> systems;
+	ResizableArray<MainSolverBase*> solvers;
+	std::vector<std::vector<Real*>> parametersData; //direct access to parameters per copy
+	for (Index k = 0; k < numberOfThreads; k++)
+	{
+		systems.Append(NewMainSystemCopy(mainSystem));
+		solvers.Append(NewBatchSolver(solverType, staticSolver));
+		parametersData.push_back(GetBatchSolverParametersData(*systems[k], batchParameters));
+	}
+
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//worker threads take next variant until all variants are solved
+	RunBatchSolverThreads(numberOfThreads, numberOfVariants, [&](Index threadNumber, Index variant)
+	{
+		MainSystem& system = *systems[threadNumber];
+		MainSolverBase& solver = *solvers[threadNumber];
+
+		//Assemble() and solver do not need the GIL; python user functions and error messages acquire it
+		bool success = true;
+		try
+		{
+			SetBatchSolverParameters(system, batchParameters, parametersData[threadNumber], variantValues.GetDataPointer() + variant*numberOfParameters);
+			system.Assemble();
+			success = system.GetFlagSystemIsConsistent() && solver.SolveSystem(system, settings);
+		}
+		catch (...) { success = false; } //exceptions must not leave thread
+
+		WriteBatchSolverValues(system.GetCSystem()->GetSystemData(), sensors, numberOfValues, success, resultData + variant * numberOfValues);
+	});
+
+	for (Index k = 0; k < numberOfThreads; k++)
+	{
+		delete solvers[k];
+		DeleteMainSystemCopy(systems[k]);
+	}
+
+	return result;
+}
+
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+//  MainVectorizedSystems
+//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+void MainVectorizedSystems::Clear()
+{
+	for (Index k = 0; k < systems.NumberOfItems(); k++)
+	{
+		if (solvers[k]->GetCSolver().IsAdvanceMode()) { solvers[k]->FinalizeSolver(*systems[k], settings); }
+		delete solvers[k];
+		DeleteMainSystemCopy(systems[k]);
+	}
+	systems.Flush();
+	solvers.Flush();
+	failed.Flush();
+	actions.clear();
+	actionsData.clear();
+	sensors.Flush();
+	numberOfObservations = 0;
+}
+
+bool MainVectorizedSystems::Initialize(MainSystem& mainSystem, Index numberOfCopies, const SimulationSettings& simulationSettings, const py::list& actionParameters,
+	const py::list& sensorNumbers, DynamicSolverType solverType, Index numberOfThreadsInit)
+{
+	Clear();
+	if (!mainSystem.GetFlagSystemIsConsistent())
+	{
+		PyError("VectorizedSystems::Initialize: system is not consistent; call Assemble() before Initialize(...)");
+		return false;
+	}
+	if (numberOfCopies == 0)
+	{
+		PyError("VectorizedSystems::Initialize: numberOfCopies must be positive");
+		return false;
+	}
+	if (!ParseBatchSolverParameters(mainSystem, actionParameters, actions, "VectorizedSystems::Initialize") ||
+		!ParseBatchSolverSensors(mainSystem, sensorNumbers, sensors, numberOfObservations, "VectorizedSystems::Initialize"))
+	{
+		Clear();
+		return false;
+	}
+
+	settings = GetBatchSolverSettings(simulationSettings, solverType);
+	numberOfThreads = GetBatchSolverNumberOfThreads(numberOfThreadsInit, numberOfCopies);
+
+	for (Index k = 0; k < numberOfCopies; k++)
+	{
+		MainSystem* system = NewMainSystemCopy(mainSystem);
+		system->Assemble();
+		systems.Append(system);
+		solvers.Append(NewBatchSolver(solverType, false));
+		actionsData.push_back(GetBatchSolverParametersData(*system, actions));
+		failed.Append(!system->GetFlagSystemIsConsistent());
+	}
+	return true;
+}
+
+py::array_t<Real> MainVectorizedSystems::Reset()
+{
+	for (Index k = 0; k < systems.NumberOfItems(); k++)
+	{
+		if (solvers[k]->GetCSolver().IsAdvanceMode()) { solvers[k]->FinalizeSolver(*systems[k], settings); }
+		systems[k]->Assemble(); //resets to initial values
+		failed[k] = !systems[k]->GetFlagSystemIsConsistent();
+	}
+	return GetObservations();
+}
+
+py::array_t<Real> MainVectorizedSystems::Step(const py::array_t<Real, py::array::c_style | py::array::forcecast>& actionValues, Real timeIncrement)
+{
+	Index numberOfCopies = NumberOfCopies();
+	Index numberOfActions = NumberOfActions();
+	if (numberOfCopies == 0)
+	{
+		PyError("VectorizedSystems::Step: call Initialize(...) before Step(...)");
+		return py::array_t<Real>();
+	}
+	if (actionValues.ndim() != 2 || (Index)actionValues.shape(0) != numberOfCopies || (Index)actionValues.shape(1) != numberOfActions)
+	{
+		PyError(STDstring("VectorizedSystems::Step: actions must be an array with shape (") + EXUstd::ToString(numberOfCopies) + ", " + EXUstd::ToString(numberOfActions) + ")");
+		return py::array_t<Real>();
+	}
+
+	const Real* actionValuesData = actionValues.data();
+	py::array_t<Real> observations({ numberOfCopies, numberOfObservations });
+	Real* observationsData = observations.mutable_data();
+
+	//actions are written directly into the parameters of the copies by the worker threads (GIL only for actions without direct access)
+	RunBatchSolverThreads(numberOfThreads, numberOfCopies, [&](Index threadNumber, Index k)
+	{
+		if (!failed[k])
+		{
+			try
+			{
+				SetBatchSolverParameters(*systems[k], actions, actionsData[k], actionValuesData + k * numberOfActions);
+				failed[k] = !solvers[k]->Advance(*systems[k], settings, timeIncrement);
+			}
+			catch (...) { failed[k] = true; }
+		}
+		WriteBatchSolverValues(systems[k]->GetCSystem()->GetSystemData(), sensors, numberOfObservations, !failed[k], observationsData + k * numberOfObservations);
+	});
+
+	return observations;
+}
+
+py::array_t<Real> MainVectorizedSystems::GetObservations() const
+{
+	py::array_t<Real> observations({ NumberOfCopies(), numberOfObservations });
+	Real* observationsData = observations.mutable_data();
+	for (Index k = 0; k < NumberOfCopies(); k++)
+	{
+		WriteBatchSolverValues(systems[k]->GetCSystem()->GetSystemData(), sensors, numberOfObservations, !failed[k], observationsData + k * numberOfObservations);
+	}
+	return observations;
+}
+
+py::array_t<Real> MainVectorizedSystems::GetTimes() const
+{
+	py::array_t<Real> times(NumberOfCopies());
+	Real* timesData = times.mutable_data();
+	for (Index k = 0; k < NumberOfCopies(); k++)
+	{
+		timesData[k] = systems[k]->GetCSystem()->GetSystemData().GetCData().GetCurrent().GetTime();
+	}
+	return times;
+}
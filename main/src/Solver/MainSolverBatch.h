@@ -0,0 +1,100 @@
+/** ***********************************************************************************************
+* @file			MainSolverBatch.h
+* @brief		Batch solver: solves many variants of one assembled MainSystem in parallel threads
+* @details		Details:
+* 				- every worker thread owns a copy of the MainSystem (created from the item dictionaries) and a solver
+*               - per variant, parameter overrides are written directly into the parameters of the copy (python interface and GIL
+*                 only for parameters without direct Real access), the copy is assembled and solved without GIL; the worker then continues with the next variant
+*               - plain std::threads are used instead of the TaskManager: the TaskManager is not enabled in all builds and
+*                 solvers enter it themselves for multithreaded item loops, which cannot be nested in TaskManager tasks
+*               - results (final sensor values or ODE2 coordinates) are written into one preallocated numpy array
+*               - MainVectorizedSystems: N copies of one MainSystem are advanced in lockstep by Step(...) with one row of
+*                 actions per copy; observations (sensor values) are returned as one (N x ny) numpy array
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef MAINSOLVERBATCH__H
+#define MAINSOLVERBATCH__H
+
+#include <vector>
+#include "Solver/MainSolverBase.h"
+
+//! parameter which is modified per variant in PySolveBatch or per action in MainVectorizedSystems
+class BatchSolverParameter
+{
+public:
+	STDstring itemType;			//!< 'Node', 'Object', 'Marker', 'Load' or 'Sensor'
+	py::object itemIndex;		//!< item number or NodeIndex, ObjectIndex, ...
+	Index itemNumber;			//!< item number converted from itemIndex
+	STDstring parameterName;	//!< parameter name as in GetObjectParameter(...)
+	Index component;			//!< component of vector parameter or EXUstd::InvalidIndex for scalar parameter
+};
+
+//! create a new (unassembled) MainSystem containing copies of all items of source, not linked to SystemContainer and renderer;
+//! sensors do not write files and do not store data internally; needs python GIL
+MainSystem* NewMainSystemCopy(MainSystem& source);
+
+//! delete MainSystem created with NewMainSystemCopy(...); needs python GIL
+void DeleteMainSystemCopy(MainSystem* mainSystem);
+
+//! solve numberOfVariants = parameterValues.shape[0] variants of assembled mainSystem with numberOfThreads threads;
+//! parameters: list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] with itemType 'Node', 'Object', 'Marker', 'Load' or 'Sensor';
+//! variant i sets parameter j to parameterValues[i,j]; returns array with one row per variant, containing the final values of sensors or ODE2 coordinates (if sensorNumbers is empty);
+//! rows of failed variants contain NaN
+py::array_t<Real> PySolveBatch(MainSystem& mainSystem, const SimulationSettings& simulationSettings, const py::list& parameters,
+	const py::array_t<Real>& parameterValues, const py::list& sensorNumbers, DynamicSolverType solverType, bool staticSolver, Index numberOfThreads);
+
+//! N copies of one assembled MainSystem, advanced together with solver.Advance(...) in parallel threads;
+//! actions (N x nu) are applied to parameters of the copies, observations (N x ny) are the current sensor values of the copies
+class MainVectorizedSystems
+{
+private:
+	ResizableArray<MainSystem*> systems;			//!< system copies; created with NewMainSystemCopy
+	ResizableArray<MainSolverBase*> solvers;		//!< one solver per copy, run in advance mode
+	std::vector<BatchSolverParameter> actions;		//!< parameters which are set by actions (std::vector, as ResizableArray copies items with memcpy)
+	std::vector<std::vector<Real*>> actionsData;	//!< per copy: direct access to parameters of actions; nullptr: parameter is set via python interface
+	ResizableArray<bool> failed;					//!< true, if copy failed in Advance(...) since last Reset()
+	ArrayIndex sensors;								//!< sensor numbers for observations
+	Index numberOfObservations;						//!< number of observation values per copy
+	Index numberOfThreads;							//!< number of worker threads
+	SimulationSettings settings;					//!< settings used for all copies
+
+public:
+	MainVectorizedSystems() : numberOfObservations(0), numberOfThreads(1) {}
+	MainVectorizedSystems(const MainVectorizedSystems&) = delete;
+	MainVectorizedSystems& operator=(const MainVectorizedSystems&) = delete;
+	~MainVectorizedSystems() { Clear(); }
+
+	//! delete all copies and solvers; needs python GIL
+	void Clear();
+
+	//! create numberOfCopies copies of assembled mainSystem; actions: list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] as in SolveBatch;
+	//! observations are the concatenated values of sensors in sensorNumbers or the ODE2 coordinates (if sensorNumbers is empty); returns true on success
+	bool Initialize(MainSystem& mainSystem, Index numberOfCopies, const SimulationSettings& simulationSettings, const py::list& actionParameters,
+		const py::list& sensorNumbers, DynamicSolverType solverType, Index numberOfThreadsInit);
+
+	//! finalize solvers and reset all copies to initial values; returns observations
+	py::array_t<Real> Reset();
+
+	//! set action values (shape (N, nu)) in copies and advance all copies by timeIncrement; returns observations; rows of failed copies contain NaN
+	py::array_t<Real> Step(const py::array_t<Real, py::array::c_style | py::array::forcecast>& actionValues, Real timeIncrement);
+
+	//! return current observations (shape (N, ny)); rows of failed copies contain NaN
+	py::array_t<Real> GetObservations() const;
+
+	//! return current simulation times of copies
+	py::array_t<Real> GetTimes() const;
+
+	Index NumberOfCopies() const { return systems.NumberOfItems(); }
+	Index NumberOfActions() const { return (Index)actions.size(); }
+	Index NumberOfObservations() const { return numberOfObservations; }
+};
+
+#endif
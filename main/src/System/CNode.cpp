@@ -97,17 +97,17 @@ LinkedDataVector CNodeODE2::GetInitialCoordinateVector_tt() const
 
 LinkedDataVector CNodeODE2::GetVisualizationCoordinateVector() const
 {
-	return LinkedDataVector(computationalData->visualizationState.ODE2Coords, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
+	return LinkedDataVector(computationalData->GetVisualization().ODE2Coords, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
 }
 
 LinkedDataVector CNodeODE2::GetVisualizationCoordinateVector_t() const
 {
-	return LinkedDataVector(computationalData->visualizationState.ODE2Coords_t, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
+	return LinkedDataVector(computationalData->GetVisualization().ODE2Coords_t, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
 }
 
 LinkedDataVector CNodeODE2::GetVisualizationCoordinateVector_tt() const
 {
-	return LinkedDataVector(computationalData->visualizationState.ODE2Coords_tt, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
+	return LinkedDataVector(computationalData->GetVisualization().ODE2Coords_tt, globalODE2CoordinateIndex, GetNumberOfODE2Coordinates());
 }
 
 //+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
@@ -134,6 +134,6 @@ LinkedDataVector CNodeData::GetInitialCoordinateVector() const
 //! read visualization coordinates (displacements)
 LinkedDataVector CNodeData::GetVisualizationCoordinateVector() const
 {
-	return LinkedDataVector(computationalData->visualizationState.dataCoords, globalDataCoordinateIndex, GetNumberOfDataCoordinates());
+	return LinkedDataVector(computationalData->GetVisualization().dataCoords, globalDataCoordinateIndex, GetNumberOfDataCoordinates());
 }
 
@@ -70,6 +70,42 @@ Real CObjectConstraint::GetCurrentAEcoordinate(Index localIndex) const
 	return cSystemData->GetCData().GetCurrent().AECoords[globalAECoordinateIndex + localIndex]; 
 }
 
+void CObjectConnector::ComputeJacobianFromForceJacobian(const Matrix& forceJacobian, const ResizableMatrix& jacobian0, const ResizableMatrix& jacobian1, ResizableMatrix& jacobian) const
+{
+	Index n0 = jacobian0.NumberOfColumns(); //special case: COGround has (0,0) Jacobian
+	Index n1 = jacobian1.NumberOfColumns();
+	Index nForce = forceJacobian.NumberOfRows();
+
+	jacobian.SetNumberOfRowsAndColumns(n0 + n1, n0 + n1);
+	jacobian.SetAll(0.);
+
+	//G^T*forceJacobian*G with G = [-jacobian0, jacobian1]; column i and row k of G are accessed directly, as G is not assembled
+	for (Index i = 0; i < n0 + n1; i++)
+	{
+		const ResizableMatrix& Ji = (i < n0) ? jacobian0 : jacobian1;
+		Index ci = (i < n0) ? i : i - n0;
+		Real si = (i < n0) ? -1. : 1.;
+		for (Index k = 0; k < n0 + n1; k++)
+		{
+			const ResizableMatrix& Jk = (k < n0) ? jacobian0 : jacobian1;
+			Index ck = (k < n0) ? k : k - n0;
+			Real sk = (k < n0) ? -1. : 1.;
+
+			Real value = 0;
+			for (Index a = 0; a < nForce; a++)
+			{
+				Real Fa = 0; //(forceJacobian*G)(a, k)
+				for (Index b = 0; b < nForce; b++)
+				{
+					Fa += forceJacobian(a, b) * Jk(b, ck);
+				}
+				value += Ji(a, ci) * Fa;
+			}
+			jacobian(i, k) = si * sk * value;
+		}
+	}
+}
+
 void CObjectSuperElement::GetAccessFunctionSuperElement(AccessFunctionType accessType, const Matrix& weightingMatrix, const ArrayIndex& meshNodeNumbers, Matrix& value) const
 { 
 	//CHECKandTHROWstring("ERROR: illegal call to CObjectSuperElement::GetAccessFunctionSuperElement"); 
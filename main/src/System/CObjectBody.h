@@ -119,6 +119,9 @@ public:
 	//! compute object massmatrix to massMatrix ==> only possible for bodies!!!
 	virtual void ComputeMassMatrix(Matrix& massMatrix) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeMassMatrix"); }
 
+	//! return true, if mass matrix is constant (independent of coordinates and time); solvers then compute the system mass matrix only once
+	virtual bool HasConstantMassMatrix() const { return false; }
+
 }; //CObjectBody
 
 
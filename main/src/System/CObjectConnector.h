@@ -67,6 +67,10 @@ public:
 	//! Return true, if connector is time dependent (default is false); used for userFunctions in constraints, e.g., to drive offsets, etc.
 	virtual bool IsTimeDependent() const { return false; }
 
+	//! contact broad phase: return true and the circle radius (including offset), if connector is a contact of a circle (position marker 0) with cable segments (marker 1 with segment points in vectorValue);
+	//! such a connector must only act, if one of its first data coordinates (contact states) is <= 0
+	virtual bool GetContactCircleRadius(Real& radius) const { return false; }
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	//specific Connector/Marker functions!
 	//! compute left-hand-side (LHS) of second order ordinary differential equations (ODE) to 'ode2Lhs'; provides time t for user functions
@@ -78,6 +82,11 @@ public:
 	//! compute derivative of right-hand-side (LHS) w.r.t q of second order ordinary differential equations (ODE) [optional w.r.t. ODE2_t variables as well, if flag ODE2_ODE2_t_function set in GetAvailableJacobians()]; jacobian [and jacobianODE2_t] has dimension GetODE2Size() x GetODE2Size(); this is the local tangent stiffness matrix;
 	virtual void ComputeJacobianODE2_ODE2(ResizableMatrix& jacobian, ResizableMatrix& jacobian_ODE2_t, const MarkerDataStructure& markerData) const { CHECKandTHROWstring("ERROR: illegal call to CObjectConnector::ComputeODE2LHSJacobian"); }
 
+	//! for connectors with position and orientation markers: compute markerForces = [f0, torque0, f1, torque1] (global coordinates; ODE2 LHS = -G^T*markerForces with G containing position and rotation jacobians of markers)
+	//! and the derivative of markerForces w.r.t. [v0, omega0, v1, omega1] (velocities and global angular velocities of markers) in markerForcesJacobian_t;
+	//! used to add the derivatives of coordinate-dependent marker jacobians (e.g. rigid body markers) to ComputeJacobianODE2_ODE2; returns false, if not available ==> such connectors are differentiated numerically
+	virtual bool ComputeMarkerForces(const MarkerDataStructure& markerData, ResizableVector& markerForces, ResizableMatrix& markerForcesJacobian_t) const { return false; }
+
 	//! compute derivative of algebraic equations w.r.t. ODE2 in jacobian [and w.r.t. ODE2_t coordinates in jacobian_t if flag ODE2_t_AE_function is set] [and w.r.t. AE coordinates if flag AE_AE_function is set in GetAvailableJacobians()]; jacobian[_t] has dimension GetAlgebraicEquationsSize() x (GetODE2Size() + GetODE1Size() [+GetAlgebraicEquationsSize()]); q are the system coordinates; markerData provides according marker information to compute jacobians
 	virtual void ComputeJacobianAE(ResizableMatrix& jacobian, ResizableMatrix& jacobian_t, ResizableMatrix& jacobian_AE, const MarkerDataStructure& markerData, Real t) const { CHECKandTHROWstring("ERROR: illegal call to CObject::ComputeJacobianAE"); }
 
@@ -108,6 +117,11 @@ public:
 	//! function called after discontinuous iterations have been completed for one step (e.g. to finalize history variables and set initial values for next step)
 	virtual void PostDiscontinuousIterationStep() {};
 
+protected:
+	//! compute local connector jacobian = G^T*forceJacobian*G with G=[-jacobian0, jacobian1], using the marker jacobians jacobian0/1 (positionJacobian or coordinate jacobian); 
+	//! forceJacobian is the derivative of the connector force w.r.t. relative marker coordinates (or velocities); implementation in CObjectBody.cpp
+	void ComputeJacobianFromForceJacobian(const Matrix& forceJacobian, const ResizableMatrix& jacobian0, const ResizableMatrix& jacobian1, ResizableMatrix& jacobian) const;
+
 private:
 	//the following functions are not available for connectors, because they need the markerData structure
 	//they could be called via the base class, therefore exceptions are thrown!
@@ -16,6 +16,7 @@
 #define CSENSOR__H
 
 #include <ostream>
+#include <memory> //for std::shared_ptr of internal storage
 
 #include "Utilities/ReleaseAssert.h"
 #include "Utilities/BasicDefinitions.h"
@@ -27,8 +28,13 @@
 class CSensor
 {
 protected: 
+	//! sensor values stored in memory, if storeInternal=true; contiguous rows [time, values...]; shared with numpy arrays returned by GetSensorStoredData(...),
+	//! which keep the memory alive; the storage is never reallocated in place, but replaced by a new array if it needs to grow or is re-initialized
+	std::shared_ptr<ResizableArray<Real>> internalStorage;
+	Index internalStorageColumns;			//!< number of columns (incl. time) of one row in internalStorage
 
 public: 
+	CSensor() : internalStorage(std::make_shared<ResizableArray<Real>>()), internalStorageColumns(0) {}
 	virtual ~CSensor() {} //added for correct deletion of derived classes
 
 	//! clone object; specifically for copying instances of derived class, for automatic memory management e.g. in ObjectContainer
@@ -106,6 +112,12 @@ public:
 		return false;
 	}
 
+	//! if true, sensor values are stored in internalStorage during simulation
+	virtual bool GetStoreInternalFlag() const {
+		CHECKandTHROWstring("Invalid call to CSensor::GetStoreInternalFlag");
+		return false;
+	}
+
 	////! time period used to output sensor values (e.g.: 0 ... always, 0.01 .. every 10 milliseconds, ...)
 	//virtual Real GetFileWritingInterval() const {
 	//	CHECKandTHROWstring("Invalid call to CSensor::GetFileWritingInterval");
@@ -116,6 +128,65 @@ public:
 		CHECKandTHROWstring("Invalid call to CSensor::FileWritingInterval"); return "";
 	}
 
+	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+	//internal storage of sensor values (storeInternal=true)
+
+	//! prepare internal storage for rows with numberOfValues sensor values (+time); memory for reservedRows is allocated in advance,
+	//! such that no reallocation is needed during simulation; if append=true, existing rows are kept (if number of values did not change)
+	void InitializeInternalStorage(Index numberOfValues, Index reservedRows, bool append)
+	{
+		//new storage: previously returned arrays keep the data of the previous simulation
+		if (!append || internalStorageColumns != numberOfValues + 1) { internalStorage = std::make_shared<ResizableArray<Real>>(); }
+		internalStorageColumns = numberOfValues + 1;
+		EnlargeInternalStorage(internalStorage->NumberOfItems() + reservedRows * internalStorageColumns);
+	}
+
+	//! enlarge allocated memory of internal storage to at least minSize items; data is copied to a new storage,
+	//! such that memory referenced by previously returned arrays stays valid
+	void EnlargeInternalStorage(Index minSize)
+	{
+		if (minSize <= internalStorage->MaxNumberOfItems()) { return; }
+		std::shared_ptr<ResizableArray<Real>> newStorage = std::make_shared<ResizableArray<Real>>();
+		newStorage->SetMaxNumberOfItems(minSize);
+		newStorage->CopyFrom(*internalStorage);
+		internalStorage = newStorage;
+	}
+
+	//! append one row [time, values] to internal storage; storage is enlarged automatically (doubled), if reserved rows are exceeded
+	void StoreValuesInternal(Real time, const Vector& values)
+	{
+		CHECKandTHROW(values.NumberOfItems() + 1 == internalStorageColumns, "CSensor::StoreValuesInternal: number of sensor values changed during simulation");
+		if (internalStorage->NumberOfItems() + internalStorageColumns > internalStorage->MaxNumberOfItems())
+		{
+			EnlargeInternalStorage(2 * internalStorage->NumberOfItems() + internalStorageColumns);
+		}
+		internalStorage->Append(time);
+		for (Real value : values) { internalStorage->Append(value); }
+	}
+
+	//! replace internal storage by data of a checkpoint with numberOfColumns per row; memory reserved by InitializeInternalStorage(...) is kept
+	//! and a new storage is used, such that previously returned arrays keep their data
+	void SetInternalStorage(Index numberOfColumns, const ResizableArray<Real>& data)
+	{
+		std::shared_ptr<ResizableArray<Real>> newStorage = std::make_shared<ResizableArray<Real>>();
+		newStorage->SetMaxNumberOfItems(EXUstd::Maximum(internalStorage->MaxNumberOfItems(), data.NumberOfItems()));
+		newStorage->CopyFrom(data);
+		internalStorage = newStorage;
+		internalStorageColumns = numberOfColumns;
+	}
+
+	//! data of internal storage; row-wise with GetInternalStorageColumns() per row
+	const ResizableArray<Real>& GetInternalStorage() const { return *internalStorage; }
+
+	//! shared pointer to internal storage, used to keep memory alive for arrays referencing the storage
+	const std::shared_ptr<ResizableArray<Real>>& GetInternalStorageShared() const { return internalStorage; }
+
+	//! number of columns (incl. time) per row of internal storage; 0, if not initialized
+	Index GetInternalStorageColumns() const { return internalStorageColumns; }
+
+	//! number of rows (= stored time points) in internal storage
+	Index GetInternalStorageRows() const { return internalStorageColumns ? internalStorage->NumberOfItems() / internalStorageColumns : 0; }
+
 	//++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 	virtual void Print(std::ostream& os) const
 	{
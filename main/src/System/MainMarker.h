@@ -63,6 +63,8 @@ public:
 	virtual py::object GetParameter(const STDstring& parameterName) const { SysError("Invalid call to MainMarker::GetParameter"); return py::object(); }
 	//! Set (write) parameter 'parameterName' to 'value' via pybind / pyhton interface instead of writing the whole dictionary with SetWithDictionary(...)
 	virtual void SetParameter(const STDstring& parameterName, const py::object& value) { SysError("Invalid call to MainMarker::SetParameter(...)"); }
+	//! get pointer to data and number of Real values of parameter 'parameterName' for direct access (parameter handles); returns false if parameter is not Real-valued or has no fixed size
+	virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) { return false; }
 
 };
 
@@ -79,6 +79,8 @@ public:
 	virtual py::object GetParameter(const STDstring& parameterName) const { SysError("Illegal call to MainObject::GetParameter"); return py::object(); }
 	//! Set (write) parameter 'parameterName' to 'value' via pybind / pyhton interface instead of writing the whole dictionary with SetWithDictionary(...)
 	virtual void SetParameter(const STDstring& parameterName, const py::object& value) { SysError("Illegal call to MainObject::SetParameter(...)"); }
+	//! get pointer to data and number of Real values of parameter 'parameterName' for direct access (parameter handles); returns false if parameter is not Real-valued or has no fixed size
+	virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) { return false; }
 
 	//! provide requested nodeType for objects; used for automatic checks in CheckSystemIntegrity()
 	virtual Node::Type GetRequestedNodeType() const { SysError("Illegal call to MainObject::GetRequestedNodeType"); return Node::_None; }
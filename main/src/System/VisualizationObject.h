@@ -31,8 +31,15 @@ class VisualizationObject
 {
 protected:
 	bool show; //true: shall be drawn; false: do not draw; will be initialized in specialized class
+	bool parametersHaveChanged = false; //true: parameters have been changed, e.g. by SetObjectParameter(...); retained graphics data needs to be regenerated
 public:
 	virtual ~VisualizationObject() {} //added for correct deletion of derived classes
+
+	//! signal that parameters (e.g. graphicsData or color) have been changed, such that retained graphics data is regenerated at next visualization update
+	virtual void ParametersHaveChanged() { parametersHaveChanged = true; }
+
+	//! return true, if parameters have been changed since last call; resets flag
+	bool ResetParametersHaveChanged() { bool changed = parametersHaveChanged; parametersHaveChanged = false; return changed; }
 	//! compute graphics update by adding graphics items to graphicsData in VisualizationSystem
 	virtual void UpdateGraphics(const VisualizationSettings& visualizationSettings, VisualizationSystem* vSystem, Index itemNumber) {};
 	
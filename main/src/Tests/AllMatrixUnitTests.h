@@ -357,6 +357,175 @@ const lest::test matrix_specific_test[] =
 
         m.SetMatrix(2, 3, { 1.1,2.2,3.3,4.4,5.5,6.6 });
         EXPECT(m.IsSquare() == false);
+    },
+    CASE("GeneralMatrixEXUdense: Factorize, Solve (LU with pivoting, Cholesky, LDLT)")
+    {
+        Vector rhs({ 1, 2, 3 });
+        Vector x;
+        Vector residual;
+        GeneralMatrixEXUdense gm;
+
+        //non-symmetric, zero first diagonal entry ==> requires pivoting
+        Matrix a(3, 3, { 0, 2, 1,  1, 1, 0,  3, 0, 4 });
+        gm.SetMatrix(a);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-14);
+
+        //symmetric positive definite ==> Cholesky
+        a.SetMatrix(3, 3, { 4, 1, 2,  1, 3, 0,  2, 0, 5 });
+        gm.SetMatrix(a);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-14);
+
+        //symmetric indefinite (saddle point) ==> Cholesky fails, LDLT is used
+        a.SetMatrix(3, 3, { 2, 0, 1,  0, 2, 1,  1, 1, 0 });
+        gm.SetMatrix(a);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-14);
+
+        //symmetric with zero first diagonal entry ==> LDLT fails without pivoting, LU is used
+        a.SetMatrix(3, 3, { 0, 1, 2,  1, 0, 1,  2, 1, 3 });
+        gm.SetMatrix(a);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-14);
+
+        //larger matrices: blocked LU with parallel trailing matrix update, LDLT
+        Index nLarge = 400;
+        Matrix aLarge(nLarge, nLarge);
+        Vector rhsLarge(nLarge);
+        for (Index i = 0; i < nLarge; i++)
+        {
+            rhsLarge[i] = 1. + (Real)(i % 7);
+            for (Index j = 0; j < nLarge; j++) { aLarge(i, j) = (i == j) ? 4. : 1. / (Real)(1 + i + 2 * j); }
+        }
+        gm.SetNumberOfThreads(4);
+        gm.SetMatrix(aLarge);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhsLarge, x);
+        MultMatrixVector(aLarge, x, residual);
+        residual -= rhsLarge;
+        EXPECT(residual.GetL2Norm() < 1e-12);
+
+        for (Index i = 0; i < nLarge; i++)
+        {
+            for (Index j = 0; j < nLarge; j++) { aLarge(i, j) = (i == j) ? ((i % 2) ? 4. : -4.) : 1. / (Real)(2 + i + j); }
+        }
+        gm.SetMatrix(aLarge);
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhsLarge, x);
+        MultMatrixVector(aLarge, x, residual);
+        residual -= rhsLarge;
+        EXPECT(residual.GetL2Norm() < 1e-12);
+
+        //singular matrix
+        a.SetMatrix(3, 3, { 1, 2, 3,  2, 4, 6,  1, 0, 1 });
+        gm.SetMatrix(a);
+        EXPECT(gm.Factorize() != 0);
+    }
+
+    CASE("GeneralMatrixEigenSparseIterative: Factorize, Solve (GMRES, BiCGSTAB, CG)")
+    {
+        Vector rhs({ 1, 2, 3 });
+        Vector x;
+        Vector residual;
+        GeneralMatrixEigenSparseIterative gm;
+
+        //symmetric indefinite (saddle point) with zero diagonal entry ==> regularized pivot in preconditioner
+        Matrix a(3, 3, { 2, 0, 1,  0, 2, 1,  1, 1, 0 });
+        gm.SetIterativeSolverParameters(IterativeSolverType::GMRES, PreconditionerType::ILU0, 1e-14, 100, 10, 2);
+        gm.SetNumberOfRowsAndColumns(3, 3);
+        gm.SetMatrix(a);
+        gm.FinalizeMatrix();
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-12);
+
+        gm.SetIterativeSolverParameters(IterativeSolverType::BiCGSTAB, PreconditionerType::BlockJacobi, 1e-14, 100, 10, 2);
+        gm.SetNumberOfRowsAndColumns(3, 3);
+        gm.SetMatrix(a);
+        gm.FinalizeMatrix();
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-12);
+
+        //symmetric positive definite ==> CG
+        a.SetMatrix(3, 3, { 4, 1, 2,  1, 3, 0,  2, 0, 5 });
+        gm.SetIterativeSolverParameters(IterativeSolverType::CG, PreconditionerType::Jacobi, 1e-14, 100, 10, 2);
+        gm.SetNumberOfRowsAndColumns(3, 3);
+        gm.SetMatrix(a);
+        gm.FinalizeMatrix();
+        EXPECT(gm.Factorize() == 0);
+        gm.Solve(rhs, x);
+        MultMatrixVector(a, x, residual);
+        residual -= rhs;
+        EXPECT(residual.GetL2Norm() < 1e-12);
+        EXPECT(gm.GetNonConvergedCount() == 0);
+        EXPECT(gm.GetPreconditionerCount() == 3);
+    }
+
+    CASE("SparseEigenSolver: ComputeSymmetric, ComputeGyroscopic (shift-invert Krylov-Schur)")
+    {
+        //fixed-free spring chain with unit masses: lambda_k = 2-2*cos((2k-1)*pi/(2n+1))
+        const Index n = 8;
+        EigenTripletVector triplets;
+        for (Index i = 0; i < n; i++)
+        {
+            triplets.push_back(EigenTriplet(i, i, (i == n - 1) ? 1. : 2.));
+            if (i > 0) { triplets.push_back(EigenTriplet(i, i - 1, -1.)); triplets.push_back(EigenTriplet(i - 1, i, -1.)); }
+        }
+        EigenSparseMatrix K(n, n), M(n, n);
+        K.setFromTriplets(triplets.begin(), triplets.end());
+        M.setIdentity();
+
+        SparseEigenSolver eigenSolver;
+        for (Index nev : {(Index)3, n}) //partial and full spectrum
+        {
+            eigenSolver.SetParameters(nev, 0., 1e-12, true);
+            EXPECT(eigenSolver.ComputeSymmetric(K, M) == SparseEigenSolver::success);
+            EXPECT(eigenSolver.GetEigenValues().size() == nev);
+            for (Index k = 0; k < nev; k++)
+            {
+                Real lambda = 2. - 2.*cos((2.*k + 1.)*EXUstd::pi / (2.*n + 1.));
+                EXPECT(fabs(eigenSolver.GetEigenValues()[k] - lambda) < 1e-12);
+                SparseEigenSolver::DenseVector phi = eigenSolver.GetEigenVectors().col(k);
+                EXPECT((K*phi - lambda * phi).norm() < 1e-10);
+                EXPECT(fabs(phi.norm() - 1.) < 1e-12); //mass-normalized
+            }
+        }
+
+        //isotropic rotor: (lambda^2 + lambda*f*G + k)*phi = 0, G=[[0,-1],[1,0]], k=4, f=3 ==> lambda = +-1i, +-4i
+        EigenSparseMatrix K2(2, 2), G2(2, 2), M2(2, 2);
+        triplets.clear();
+        triplets.push_back(EigenTriplet(0, 1, -1.));
+        triplets.push_back(EigenTriplet(1, 0, 1.));
+        G2.setFromTriplets(triplets.begin(), triplets.end());
+        M2.setIdentity();
+        K2 = 4.*M2;
+        eigenSolver.SetParameters(2, 0., 1e-12, true);
+        EXPECT(eigenSolver.ComputeGyroscopic(K2, G2, M2, 3.) == SparseEigenSolver::success);
+        EXPECT(eigenSolver.GetComplexEigenValues().size() == 2);
+        for (Index k = 0; k < 2; k++)
+        {
+            std::complex<Real> lambda = eigenSolver.GetComplexEigenValues()[k];
+            EXPECT(fabs(lambda.real()) < 1e-12);
+            EXPECT(fabs(fabs(lambda.imag()) - 1.) < 1e-12);
+        }
     }
 };
 
@@ -31,6 +31,8 @@ using namespace EXUstd;
 #include "Linalg/ResizableVector.h"
 
 #include "Linalg/Matrix.h"
+#include "Linalg/LinearSolver.h"
+#include "Linalg/SparseEigenSolver.h"
 using namespace EXUmath;
 
 #define PerformUnitTests
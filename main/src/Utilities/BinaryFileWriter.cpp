@@ -0,0 +1,158 @@
+/** ***********************************************************************************************
+* @file			BinaryFileWriter.cpp
+* @brief		Implementation of double-buffered binary file output with background writer thread
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include <cstring> //memcpy
+
+#include "Utilities/BasicFunctions.h"
+#include "Utilities/BinaryFileWriter.h"
+
+//! open file (append or overwrite) and start writer thread; returns false if file could not be opened
+bool BinaryFileWriter::Open(const STDstring& fileName, bool append, bool singlePrecisionInit, Index bufferSizeInit)
+{
+	Close(); //in case that writer is reused
+
+	initialFileSize = 0;
+	if (append)
+	{
+		std::ifstream existingFile(fileName, std::ifstream::binary | std::ifstream::ate);
+		if (existingFile.is_open()) { initialFileSize = (Index)existingFile.tellg(); }
+	}
+
+	auto fileMode = std::ofstream::out | std::ofstream::binary;
+	if (append) { fileMode |= std::ofstream::app; }
+	file.open(fileName, fileMode);
+	if (!file.is_open()) { return false; }
+
+	singlePrecision = singlePrecisionInit;
+	bufferSize = (size_t)EXUstd::Maximum(bufferSizeInit, (Index)1);
+	frontBuffer.clear();
+	backBuffer.clear();
+	frontBuffer.reserve(bufferSize + sizeof(double)); //avoid reallocation for small writes; larger writes may exceed buffer size
+	backBuffer.reserve(bufferSize + sizeof(double));
+
+	backBufferPending = false;
+	terminateWriter = false;
+	writeFailed = false;
+	writerThread = std::thread(&BinaryFileWriter::WriterThreadFunction, this);
+	return true;
+}
+
+//! main loop of writer thread: wait for pending back buffer and write it to file
+void BinaryFileWriter::WriterThreadFunction()
+{
+	std::unique_lock<std::mutex> lock(bufferMutex);
+	while (true)
+	{
+		bufferCondition.wait(lock, [this] { return backBufferPending || terminateWriter; });
+		if (backBufferPending)
+		{
+			//backBuffer is not touched by producer as long as backBufferPending==true ==> write without lock
+			lock.unlock();
+			file.write(backBuffer.data(), backBuffer.size());
+			bool success = file.good();
+			backBuffer.clear(); //keeps capacity
+			lock.lock();
+
+			if (!success) { writeFailed = true; }
+			backBufferPending = false;
+			bufferCondition.notify_all();
+		}
+		else { break; } //terminateWriter and all data written
+	}
+}
+
+//! hand over front buffer to writer thread; waits, if back buffer has not been written yet
+void BinaryFileWriter::SwapBuffers()
+{
+	{
+		std::unique_lock<std::mutex> lock(bufferMutex);
+		bufferCondition.wait(lock, [this] { return !backBufferPending; });
+		std::swap(frontBuffer, backBuffer); //backBuffer is empty after writing
+		backBufferPending = true;
+	}
+	bufferCondition.notify_all();
+}
+
+//! return true, if writer thread could not write to file; may be delayed up to one buffer
+bool BinaryFileWriter::WriteFailed()
+{
+	std::lock_guard<std::mutex> lock(bufferMutex);
+	return writeFailed;
+}
+
+//! append raw bytes (e.g. file header)
+void BinaryFileWriter::WriteBytes(const void* data, size_t numberOfBytes)
+{
+	size_t oldSize = frontBuffer.size();
+	frontBuffer.resize(oldSize + numberOfBytes);
+	memcpy(frontBuffer.data() + oldSize, data, numberOfBytes);
+	CheckBufferSize();
+}
+
+//! append Real values with precision of file
+void BinaryFileWriter::WriteReals(const Real* data, Index numberOfValues)
+{
+	size_t oldSize = frontBuffer.size();
+	if (singlePrecision)
+	{
+		frontBuffer.resize(oldSize + numberOfValues * sizeof(float));
+		char* dest = frontBuffer.data() + oldSize;
+		for (Index i = 0; i < numberOfValues; i++)
+		{
+			float value = (float)data[i];
+			memcpy(dest + i * sizeof(float), &value, sizeof(float));
+		}
+	}
+	else
+	{
+		frontBuffer.resize(oldSize + numberOfValues * sizeof(double));
+		for (Index i = 0; i < numberOfValues; i++) //Real may differ from double
+		{
+			double value = (double)data[i];
+			memcpy(frontBuffer.data() + oldSize + i * sizeof(double), &value, sizeof(double));
+		}
+	}
+	CheckBufferSize();
+}
+
+//! hand over all buffered data to writer thread and wait until it is written to file
+void BinaryFileWriter::Flush()
+{
+	if (!writerThread.joinable()) { return; }
+
+	if (frontBuffer.size() != 0) { SwapBuffers(); }
+	{
+		std::unique_lock<std::mutex> lock(bufferMutex);
+		bufferCondition.wait(lock, [this] { return !backBufferPending; });
+	}
+	file.flush(); //writer thread is idle
+}
+
+//! flush data, terminate writer thread and close file
+void BinaryFileWriter::Close()
+{
+	if (writerThread.joinable())
+	{
+		Flush();
+		{
+			std::lock_guard<std::mutex> lock(bufferMutex);
+			terminateWriter = true;
+		}
+		bufferCondition.notify_all();
+		writerThread.join();
+	}
+	if (file.is_open()) { file.close(); }
+	frontBuffer.clear();
+	backBuffer.clear();
+}
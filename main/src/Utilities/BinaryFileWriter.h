@@ -0,0 +1,98 @@
+/** ***********************************************************************************************
+* @class		BinaryFileWriter
+* @brief		Double-buffered binary file output with background writer thread
+* @details		Details:
+* 				- values are appended to a front buffer, which is handed over to a writer thread as soon as it exceeds bufferSize
+*               - while the writer thread writes the back buffer to disk, the front buffer is filled again;
+*                 the producer (solver) only waits if the writer thread did not finish the previous buffer yet
+*               - Real values are written in native byte order as double (8 bytes) or float (4 bytes, singlePrecision)
+*               - Close() (or the destructor) writes remaining data and terminates the writer thread
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef BINARYFILEWRITER__H
+#define BINARYFILEWRITER__H
+
+#include <fstream>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <cstdint>
+
+#include "Utilities/BasicDefinitions.h" //defines Real, Index, STDstring
+
+//! binary output file, written by a background thread using two buffers
+class BinaryFileWriter
+{
+private:
+	std::ofstream file;					//!< binary output file; only accessed by writer thread after Open(...)
+	bool singlePrecision;				//!< if true, Real values are stored as float, otherwise as double
+	size_t bufferSize;					//!< size in bytes, at which the front buffer is handed over to the writer thread
+	std::vector<char> frontBuffer;		//!< buffer filled by producer
+	std::vector<char> backBuffer;		//!< buffer written to file by writer thread
+	bool backBufferPending;				//!< true, as long as backBuffer contains data not yet written to file
+	bool terminateWriter;				//!< signal for writer thread to finish
+	bool writeFailed;					//!< set by writer thread, if writing to file failed
+	Index initialFileSize;				//!< size in bytes of existing file at Open(...) in append mode; 0 otherwise
+	std::thread writerThread;
+	std::mutex bufferMutex;				//!< protects backBufferPending, terminateWriter and writeFailed
+	std::condition_variable bufferCondition;
+
+	//! main loop of writer thread: wait for pending back buffer and write it to file
+	void WriterThreadFunction();
+
+	//! hand over front buffer to writer thread; waits, if back buffer has not been written yet
+	void SwapBuffers();
+
+	//! swap buffers if front buffer is full
+	void CheckBufferSize() { if (frontBuffer.size() >= bufferSize) { SwapBuffers(); } }
+
+public:
+	BinaryFileWriter() : singlePrecision(false), bufferSize(0), backBufferPending(false), terminateWriter(false), writeFailed(false), initialFileSize(0) {}
+	BinaryFileWriter(const BinaryFileWriter&) = delete;
+	BinaryFileWriter& operator=(const BinaryFileWriter&) = delete;
+	~BinaryFileWriter() { Close(); }
+
+	//! open file (append or overwrite) and start writer thread; returns false if file could not be opened
+	bool Open(const STDstring& fileName, bool append, bool singlePrecisionInit, Index bufferSizeInit);
+
+	//! size in bytes of existing file when opened in append mode; 0 for new or overwritten files
+	Index GetInitialFileSize() const { return initialFileSize; }
+
+	//! return true, if file is open
+	bool IsOpen() const { return file.is_open(); }
+
+	//! return true, if writer thread could not write to file; may be delayed up to one buffer
+	bool WriteFailed();
+
+	//! size in bytes of Real values in file
+	Index GetRealSize() const { return singlePrecision ? (Index)sizeof(float) : (Index)sizeof(double); }
+
+	//! append raw bytes (e.g. file header)
+	void WriteBytes(const void* data, size_t numberOfBytes);
+
+	//! append integer as 8 byte value (e.g. for file header)
+	void WriteInt64(int64_t value) { WriteBytes(&value, sizeof(value)); }
+
+	//! append Real values with precision of file
+	void WriteReals(const Real* data, Index numberOfValues);
+
+	//! append single Real value with precision of file
+	void WriteReal(Real value) { WriteReals(&value, 1); }
+
+	//! hand over all buffered data to writer thread and wait until it is written to file
+	void Flush();
+
+	//! flush data, terminate writer thread and close file
+	void Close();
+};
+
+#endif
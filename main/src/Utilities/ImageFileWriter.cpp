@@ -0,0 +1,234 @@
+/** ***********************************************************************************************
+* @file			ImageFileWriter.cpp
+* @brief		Implementation of frame recording pipeline with background encoder/writer thread
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+
+#include <cstring> //memcmp
+#include <chrono>
+
+#include "Utilities/BasicFunctions.h"
+#include "Utilities/ImageFileWriter.h"
+
+//! allocate numberOfBuffers frame buffers (if not yet done) and start writer thread
+void ImageFileWriter::Open(Index numberOfBuffers)
+{
+	if (IsOpen()) { return; }
+
+	numberOfBuffers = EXUstd::Maximum(numberOfBuffers, (Index)1);
+	while ((Index)framePool.size() < numberOfBuffers)
+	{
+		framePool.push_back(new ImageFrame());
+	}
+	freeFrames = framePool;
+	pendingFrames.clear();
+
+	writerBusy = false;
+	terminateWriter = false;
+	numberOfWrittenFrames = 0;
+	numberOfDroppedFrames = 0;
+	numberOfFailedFrames = 0;
+	writerThread = std::thread(&ImageFileWriter::WriterThreadFunction, this);
+}
+
+//! main loop of writer thread: wait for pending frames and write them
+void ImageFileWriter::WriterThreadFunction()
+{
+	std::unique_lock<std::mutex> lock(frameMutex);
+	while (true)
+	{
+		frameCondition.wait(lock, [this] { return pendingFrames.size() != 0 || terminateWriter; });
+		if (pendingFrames.size() != 0)
+		{
+			ImageFrame* frame = pendingFrames.front();
+			pendingFrames.pop_front();
+			writerBusy = true;
+
+			//frame is not touched by renderer until it is returned to freeFrames ==> write without lock
+			lock.unlock();
+			bool success;
+			if (frame->format == ImageFileFormat::RAW) { success = WriteRawFrame(*frame); }
+			else { success = WriteTGAFile(*frame); }
+			lock.lock();
+
+			if (success) { numberOfWrittenFrames++; }
+			else { numberOfFailedFrames++; }
+			freeFrames.push_back(frame);
+			writerBusy = false;
+			frameCondition.notify_all();
+		}
+		else { break; } //terminateWriter and all frames written
+	}
+}
+
+//! get free frame buffer; waits up to timeOutMilliseconds for a buffer to become free; returns nullptr and counts dropped frame otherwise
+ImageFrame* ImageFileWriter::AcquireFrame(Index timeOutMilliseconds)
+{
+	std::unique_lock<std::mutex> lock(frameMutex);
+	if (!frameCondition.wait_for(lock, std::chrono::milliseconds(timeOutMilliseconds), [this] { return freeFrames.size() != 0; }))
+	{
+		numberOfDroppedFrames++;
+		return nullptr;
+	}
+	ImageFrame* frame = freeFrames.back();
+	freeFrames.pop_back();
+	return frame;
+}
+
+//! hand over frame (acquired with AcquireFrame) to writer thread
+void ImageFileWriter::SubmitFrame(ImageFrame* frame)
+{
+	{
+		std::lock_guard<std::mutex> lock(frameMutex);
+		pendingFrames.push_back(frame);
+	}
+	frameCondition.notify_all();
+}
+
+//! wait until all submitted frames are written
+void ImageFileWriter::Flush()
+{
+	if (!IsOpen()) { return; }
+
+	std::unique_lock<std::mutex> lock(frameMutex);
+	frameCondition.wait(lock, [this] { return pendingFrames.size() == 0 && !writerBusy; });
+}
+
+//! write remaining frames, terminate writer thread, close raw stream and free buffers
+void ImageFileWriter::Close()
+{
+	if (writerThread.joinable())
+	{
+		Flush();
+		{
+			std::lock_guard<std::mutex> lock(frameMutex);
+			terminateWriter = true;
+		}
+		frameCondition.notify_all();
+		writerThread.join();
+	}
+	if (rawStream.is_open()) { rawStream.close(); }
+	rawStreamFileName.clear();
+
+	for (ImageFrame* frame : framePool) { delete frame; }
+	framePool.clear();
+	freeFrames.clear();
+}
+
+//! number of frames written since Open(...)
+Index ImageFileWriter::GetNumberOfWrittenFrames()
+{
+	std::lock_guard<std::mutex> lock(frameMutex);
+	return numberOfWrittenFrames;
+}
+
+//! number of frames dropped since Open(...) (no free buffer within timeout)
+Index ImageFileWriter::GetNumberOfDroppedFrames()
+{
+	std::lock_guard<std::mutex> lock(frameMutex);
+	return numberOfDroppedFrames;
+}
+
+//! number of frames which could not be written since Open(...)
+Index ImageFileWriter::GetNumberOfFailedFrames()
+{
+	std::lock_guard<std::mutex> lock(frameMutex);
+	return numberOfFailedFrames;
+}
+
+//! write frame to raw video stream (opened or reopened if file name changed); returns false on failure
+bool ImageFileWriter::WriteRawFrame(const ImageFrame& frame)
+{
+	if (!rawStream.is_open() || rawStreamFileName != frame.fileName)
+	{
+		if (rawStream.is_open()) { rawStream.close(); }
+		CheckPathAndCreateDirectories(frame.fileName);
+		rawStream.open(frame.fileName, std::ofstream::out | std::ofstream::binary);
+		rawStreamFileName = frame.fileName;
+	}
+	if (!rawStream.is_open()) { return false; }
+
+	rawStream.write(frame.pixels.data(), frame.pixels.size());
+	return rawStream.good();
+}
+
+//! write single frame as .tga file (format TGA or TGARLE); returns false, if file could not be written
+bool ImageFileWriter::WriteTGAFile(const ImageFrame& frame)
+{
+	std::ofstream imageFile;
+	CheckPathAndCreateDirectories(frame.fileName);
+	imageFile.open(frame.fileName, std::ofstream::out | std::ofstream::binary);
+	if (!imageFile.is_open()) { return false; }
+
+	bool useRLE = (frame.format == ImageFileFormat::TGARLE);
+	//file header for .tga (targa) images: image type 2 (uncompressed true-color) or 10 (run-length encoded true-color), 24 bits per pixel
+	unsigned char header[18] = { 0, 0, (unsigned char)(useRLE ? 10 : 2), 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		(unsigned char)(frame.width & 0xFF), (unsigned char)((frame.width >> 8) & 0xFF),
+		(unsigned char)(frame.height & 0xFF), (unsigned char)((frame.height >> 8) & 0xFF), 24, 0 };
+	imageFile.write((const char*)header, sizeof(header));
+
+	if (!useRLE)
+	{
+		imageFile.write(frame.pixels.data(), frame.pixels.size());
+	}
+	else
+	{
+		//run-length encoding per row: run packets (identical pixels) and raw packets, each with up to 128 pixels
+		std::vector<char> packet;
+		packet.reserve(frame.width * 3 + frame.width / 128 + 1);
+		for (Index row = 0; row < frame.height; row++)
+		{
+			const char* rowPixels = frame.pixels.data() + row * frame.width * 3;
+			packet.clear();
+			Index i = 0;
+			while (i < frame.width)
+			{
+				Index runLength = 1;
+				while (i + runLength < frame.width && runLength < 128 && memcmp(rowPixels + 3 * i, rowPixels + 3 * (i + runLength), 3) == 0) { runLength++; }
+
+				if (runLength > 1)
+				{
+					packet.push_back((char)(0x80 | (runLength - 1)));
+					packet.insert(packet.end(), rowPixels + 3 * i, rowPixels + 3 * i + 3);
+					i += runLength;
+				}
+				else
+				{
+					//raw packet: collect pixels until next run of at least 2 identical pixels
+					Index rawLength = 1;
+					while (i + rawLength < frame.width && rawLength < 128 &&
+						!(i + rawLength + 1 < frame.width && memcmp(rowPixels + 3 * (i + rawLength), rowPixels + 3 * (i + rawLength + 1), 3) == 0))
+					{
+						rawLength++;
+					}
+					packet.push_back((char)(rawLength - 1));
+					packet.insert(packet.end(), rowPixels + 3 * i, rowPixels + 3 * (i + rawLength));
+					i += rawLength;
+				}
+			}
+			imageFile.write(packet.data(), packet.size());
+		}
+	}
+
+	bool success = imageFile.good();
+	imageFile.close();
+	return success;
+}
+
+//! convert format name 'TGA', 'TGA-RLE' or 'RAW' into ImageFileFormat; returns false for unknown names
+bool ImageFileWriter::GetImageFileFormat(const STDstring& formatName, ImageFileFormat& format)
+{
+	if (formatName == "TGA") { format = ImageFileFormat::TGA; }
+	else if (formatName == "TGA-RLE") { format = ImageFileFormat::TGARLE; }
+	else if (formatName == "RAW") { format = ImageFileFormat::RAW; }
+	else { return false; }
+	return true;
+}
@@ -0,0 +1,125 @@
+/** ***********************************************************************************************
+* @class		ImageFileWriter
+* @brief		Frame recording pipeline: pool of reusable pixel buffers and background encoder/writer thread
+* @details		Details:
+* 				- the renderer acquires a free frame buffer from the pool, reads the pixels into it and submits it;
+*                 a writer thread encodes the frames in submission order and returns the buffers to the pool
+*               - if all buffers are in use, AcquireFrame(...) waits up to a timeout (backpressure) and returns nullptr
+*                 afterwards; such frames are counted as dropped frames
+*               - formats: uncompressed .tga, run-length encoded .tga (lossless) or one raw video stream (BGR, 8 bit per channel)
+*               - Close() (or the destructor) writes remaining frames and terminates the writer thread
+*
+* @author		agent
+* @date			2026-10-18 (created)
+* @copyright	This file is part of Exudyn. Exudyn is free software: you can redistribute it and/or modify it under the terms of the Exudyn license. See 'LICENSE.txt' for more details.
+* @note			Bug reports, support and further information:
+* 				- email: johannes.gerstmayr@uibk.ac.at
+* 				- weblink: missing
+*
+*
+************************************************************************************************ */
+#ifndef IMAGEFILEWRITER__H
+#define IMAGEFILEWRITER__H
+
+#include <fstream>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "Utilities/BasicDefinitions.h" //defines Real, Index, STDstring
+
+//! file format for saved frames
+enum class ImageFileFormat {
+	TGA = 0,		//!< uncompressed targa image, one file per frame
+	TGARLE = 1,		//!< run-length encoded targa image (lossless compression), one file per frame
+	RAW = 2			//!< all frames appended to one raw video stream (BGR, 8 bit per channel, rows bottom-up)
+};
+
+//! one frame: pixel data in BGR format (3 bytes per pixel, rows bottom-up, as delivered by glReadPixels) and file name
+class ImageFrame
+{
+public:
+	std::vector<char> pixels;	//!< pixel data; buffer is reused for consecutive frames
+	Index width;				//!< image width in pixels
+	Index height;				//!< image height in pixels
+	STDstring fileName;			//!< file name including extension; for RAW format, the name of the video stream
+	ImageFileFormat format;		//!< file format
+
+	ImageFrame() : width(0), height(0), format(ImageFileFormat::TGA) {}
+
+	//! resize pixel buffer for given image size (memory is only allocated if the buffer grows)
+	void SetSize(Index widthInit, Index heightInit)
+	{
+		width = widthInit;
+		height = heightInit;
+		pixels.resize(width * height * 3);
+	}
+};
+
+//! frame recording pipeline with pool of frame buffers and background writer thread
+class ImageFileWriter
+{
+private:
+	std::vector<ImageFrame*> framePool;		//!< all frame buffers (owned)
+	std::vector<ImageFrame*> freeFrames;	//!< frame buffers available for AcquireFrame(...)
+	std::deque<ImageFrame*> pendingFrames;	//!< submitted frames, written in this order
+	bool writerBusy;						//!< true, while writer thread encodes a frame
+	bool terminateWriter;					//!< signal for writer thread to finish
+	Index numberOfWrittenFrames;			//!< number of frames written since Open(...)
+	Index numberOfDroppedFrames;			//!< number of frames dropped since Open(...) (no free buffer within timeout)
+	Index numberOfFailedFrames;				//!< number of frames which could not be written (e.g. invalid file name)
+	std::ofstream rawStream;				//!< raw video stream; only accessed by writer thread
+	STDstring rawStreamFileName;			//!< file name of currently open raw video stream
+	std::thread writerThread;
+	std::mutex frameMutex;					//!< protects freeFrames, pendingFrames, writerBusy, terminateWriter and counters
+	std::condition_variable frameCondition;
+
+	//! main loop of writer thread: wait for pending frames and write them
+	void WriterThreadFunction();
+
+	//! write frame to raw video stream (opened or reopened if file name changed); returns false on failure
+	bool WriteRawFrame(const ImageFrame& frame);
+
+public:
+	ImageFileWriter() : writerBusy(false), terminateWriter(false), numberOfWrittenFrames(0), numberOfDroppedFrames(0), numberOfFailedFrames(0) {}
+	ImageFileWriter(const ImageFileWriter&) = delete;
+	ImageFileWriter& operator=(const ImageFileWriter&) = delete;
+	~ImageFileWriter() { Close(); }
+
+	//! allocate numberOfBuffers frame buffers (if not yet done) and start writer thread
+	void Open(Index numberOfBuffers);
+
+	//! return true, if writer thread is running
+	bool IsOpen() const { return writerThread.joinable(); }
+
+	//! get free frame buffer; waits up to timeOutMilliseconds for a buffer to become free; returns nullptr and counts dropped frame otherwise
+	ImageFrame* AcquireFrame(Index timeOutMilliseconds);
+
+	//! hand over frame (acquired with AcquireFrame) to writer thread
+	void SubmitFrame(ImageFrame* frame);
+
+	//! wait until all submitted frames are written
+	void Flush();
+
+	//! write remaining frames, terminate writer thread, close raw stream and free buffers
+	void Close();
+
+	//! number of frames written since Open(...)
+	Index GetNumberOfWrittenFrames();
+
+	//! number of frames dropped since Open(...) (no free buffer within timeout)
+	Index GetNumberOfDroppedFrames();
+
+	//! number of frames which could not be written since Open(...)
+	Index GetNumberOfFailedFrames();
+
+	//! write single frame as .tga file (format TGA or TGARLE); returns false, if file could not be written
+	static bool WriteTGAFile(const ImageFrame& frame);
+
+	//! convert format name 'TGA', 'TGA-RLE' or 'RAW' into ImageFileFormat; returns false for unknown names
+	static bool GetImageFileFormat(const STDstring& formatName, ImageFileFormat& format);
+};
+
+#endif
@@ -124,6 +124,7 @@ public:
     Index NumberOfItems() const { return dataSize; }	//!< number of ('T') items in vector ('SlimArray<3> v;' ==> NumberOfItems() returns 3).
     Index MaxNumberOfItems() const { return dataSize; }	//!< number of ('T') items in vector; for COMPATIBILITY with 'class ResizeableArray' ('SlimArray<3> v;' ==> Size() returns 3).
     T* GetDataPointer() { return &data[0]; }			//!< return pointer to first data containing T* items.
+    const T* GetDataPointer() const { return &data[0]; }	//!< return pointer to first data containing T* items, const version.
 
     //! set all items in array to 'scalarValue'
     void SetAll(const T& scalarValue) {
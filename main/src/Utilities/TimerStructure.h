@@ -39,6 +39,7 @@
 
 class TimerStructure;
 extern TimerStructure globalTimers;
+extern thread_local bool globalTimersSuspended; //!< set true in threads which must not access globalTimers (e.g. batch solver threads), as timers are not thread-safe
 
 //!special timer structure to measure time spent at certain parts of code
 //! put a global variable of this class somewhere to allow micro-timing of functions at any place
@@ -70,18 +71,21 @@ public:
 	//!reset timers( e.g. before starting simulation):
 	void Reset()
 	{
+		if (globalTimersSuspended) { return; }
 		for (auto& item : counters) { item = 0; }
 	}
 
 	//! start measurement
 	void StartTimer(Index counterIndex)
 	{
+		if (globalTimersSuspended) { return; }
 		counters[counterIndex] -= EXUstd::GetTimeInSeconds();
 	}
 
 	//! stop measurement
 	void StopTimer(Index counterIndex)
 	{
+		if (globalTimersSuspended) { return; }
 		counters[counterIndex] += EXUstd::GetTimeInSeconds();
 	}
 
@@ -100,8 +100,9 @@ sLenum += DefLatexStartClass(sectionName = pyClass,
 #keep this list synchronized with the accoring enum structure in C++!!!
 [s1,sL1] = AddEnumValue(pyClass, 'GeneralizedAlpha', 'an implicit solver for index 3 problems; allows to set variables also for Newmark and trapezoidal implicit index 2 solvers'); s+=s1; sLenum+=sL1
 [s1,sL1] = AddEnumValue(pyClass, 'TrapezoidalIndex2', 'an implicit solver for index 3 problems with index2 reduction; uses generalized alpha solver with settings for Newmark with index2 reduction'); s+=s1; sLenum+=sL1
-[s1,sL1] = AddEnumValue(pyClass, 'ExplicitEuler', '[NOT IMPLEMENTED YET] an explicit first order solver for systems without constraints'); s+=s1; sLenum+=sL1
-[s1,sL1] = AddEnumValue(pyClass, 'RK45', '[NOT IMPLEMENTED YET] an explicit Runge Kutta solver of 4th order for systems without constraints; includes adaptive step selection'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'ExplicitEuler', 'an explicit first order solver; constraints are solved on acceleration level and projected after every step'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'RK45', 'an explicit embedded Runge Kutta solver of 5th order (Dormand-Prince) with 4th order error estimate for adaptive step selection'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'RK4', 'classical explicit Runge Kutta solver of 4th order with constant step size'); s+=s1; sLenum+=sL1
 
 s +=	'		.export_values();\n\n'
 sLenum += DefLatexFinishClass()
@@ -119,6 +120,40 @@ sLenum += DefLatexStartClass(sectionName = pyClass,
 [s1,sL1] = AddEnumValue(pyClass, '_None', 'no value; used, e.g., if no solver is selected'); s+=s1; sLenum+=sL1
 [s1,sL1] = AddEnumValue(pyClass, 'EXUdense', 'use dense matrices and according solvers for densly populated matrices (usually the CPU time grows cubically with the number of unknowns)'); s+=s1; sLenum+=sL1
 [s1,sL1] = AddEnumValue(pyClass, 'EigenSparse', 'use sparse matrices and according solvers; additional overhead for very small systems; specifically, memory allocation is performed during a factorization process'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'EigenSparseIterative', 'use sparse matrices and preconditioned iterative (Krylov) solvers for the system Jacobian; avoids fill-in of direct factorization for large systems; see linearSolverSettings'); s+=s1; sLenum+=sL1
+
+s +=	'		.export_values();\n\n'
+sLenum += DefLatexFinishClass()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++
+pyClass = 'IterativeSolverType'
+
+descriptionStr = 'This section shows the ' + pyClass + ' structure, which is used for selecting the Krylov method of the iterative linear solver (LinearSolverType.EigenSparseIterative).\n\n'
+
+s +=	'  py::enum_<' + pyClass + '>(m, "' + pyClass + '")\n'
+sLenum += DefLatexStartClass(sectionName = pyClass, 
+                            description=descriptionStr, 
+                            subSection=True)
+#keep this list synchronized with the accoring enum structure in C++!!!
+[s1,sL1] = AddEnumValue(pyClass, 'GMRES', 'restarted GMRES; for general (non-symmetric) matrices'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'BiCGSTAB', 'BiCGSTAB; for general (non-symmetric) matrices, short recurrences'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'CG', 'conjugate gradient; only for symmetric positive definite matrices'); s+=s1; sLenum+=sL1
+
+s +=	'		.export_values();\n\n'
+sLenum += DefLatexFinishClass()
+#+++++++++++++++++++++++++++++++++++++++++++++++++++
+pyClass = 'PreconditionerType'
+
+descriptionStr = 'This section shows the ' + pyClass + ' structure, which is used for selecting the preconditioner of the iterative linear solver (LinearSolverType.EigenSparseIterative).\n\n'
+
+s +=	'  py::enum_<' + pyClass + '>(m, "' + pyClass + '")\n'
+sLenum += DefLatexStartClass(sectionName = pyClass, 
+                            description=descriptionStr, 
+                            subSection=True)
+#keep this list synchronized with the accoring enum structure in C++!!!
+[s1,sL1] = AddEnumValue(pyClass, '_None', 'no preconditioner'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'Jacobi', 'diagonal (Jacobi) preconditioner'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'BlockJacobi', 'block diagonal preconditioner with dense LU factorization of diagonal blocks'); s+=s1; sLenum+=sL1
+[s1,sL1] = AddEnumValue(pyClass, 'ILU0', 'incomplete LU factorization without fill-in'); s+=s1; sLenum+=sL1
 
 s +=	'		.export_values();\n\n'
 sLenum += DefLatexFinishClass()
@@ -156,9 +191,25 @@ sL+=sL1; #s+=s1;  #this function is defined in __init__.py ==> do not add to cpp
                                ); sL+=sL1
                 
 [s1,sL1] = DefPyFunctionAccess(pyName='ComputeODE2Eigenvalues', 
-                               description='Simple interface to scipy eigenvalue solver for eigenvalue analysis of the second order differential equations part in mbs, mapped from module \\texttt{solver}; for details on the python interface see \\refSection{sec:solver:ComputeODE2Eigenvalues}',
-                               argList=['mbs', 'simulationSettings', 'useSparseSolver', 'numberOfEigenvalues', 'setInitialValues', 'convert2Frequencies'],
-                               defaultArgs=['','exudyn.SimulationSettings()','False','-1','True','False']); sL+=sL1
+                               description='Simple interface to scipy eigenvalue solver (dense or sparse mode) or optionally to the internal sparse eigenvalue solver for eigenvalue analysis of the second order differential equations part in mbs, mapped from module \\texttt{solver}; for details on the python interface see \\refSection{sec:solver:ComputeODE2Eigenvalues}',
+                               argList=['mbs', 'simulationSettings', 'useSparseSolver', 'numberOfEigenvalues', 'setInitialValues', 'convert2Frequencies', 'useInternalSparseSolver'],
+                               defaultArgs=['','exudyn.SimulationSettings()','False','-1','True','False','False']); sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass='', pyName='ComputeSparseEigenvalues', cName='PyComputeSparseEigenvalues', 
+                               description='Compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the symmetric eigenvalue problem K*phi = lambda*M*phi with a sparse shift-invert Lanczos solver (C++, no scipy); stiffnessMatrix and massMatrix are sparse matrices given as numpy arrays with rows [row, column, value] (sparse format of FEM module, duplicates are summed up); tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenValues sorted ascending and eigenvectors in columns; the numpy arrays own the solver results (no copy)',
+                               argList=['stiffnessMatrix', 'massMatrix', 'numberOfEigenvalues', 'shift', 'tolerance', 'computeEigenVectors'],
+                               defaultArgs=['', '', '', '0.', '1e-12', 'true']); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass='', pyName='ComputeSparseGyroscopicEigenvalues', cName='PyComputeSparseGyroscopicEigenvalues', 
+                               description='Compute numberOfEigenvalues complex eigenvalues closest to (real) shift and eigenvectors of the gyroscopic eigenvalue problem (lambda**2*M + lambda*gyroscopicFactor*G + K)*phi = 0, e.g., for Campbell diagrams with gyroscopicFactor being the rotation speed; uses a sparse shift-invert Arnoldi solver for the according first order system; matrices are given as numpy arrays with rows [row, column, value] (sparse format of FEM module); returns [eigenValues, eigenVectors] as complex numpy arrays with eigenValues sorted by distance to shift and eigenvectors (normalized to length 1) in columns',
+                               argList=['stiffnessMatrix', 'gyroscopicMatrix', 'massMatrix', 'gyroscopicFactor', 'numberOfEigenvalues', 'shift', 'tolerance', 'computeEigenVectors'],
+                               defaultArgs=['', '', '', '', '', '0.', '1e-12', 'false']); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass='', pyName='SolveBatch', cName='PySolveBatch', 
+                               description='Solve numberOfVariants=parameterValues.shape[0] variants of the assembled system mbs in parallel threads (C++ threads, no python multiprocessing); every thread works on its own copy of mbs; parameters is a list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] (for vector parameters) with itemType being \'Node\', \'Object\', \'Marker\', \'Load\' or \'Sensor\'; variant i solves the system with parameter j set to parameterValues[i,j]; solverType selects the dynamic solver as in SolveDynamic, staticSolver=True uses the static solver; numberOfThreads=0 uses all hardware threads; returns a numpy array with one row per variant, containing the concatenated final values of sensors in sensorNumbers or the final ODE2 coordinates if sensorNumbers is empty; rows of failed variants contain NaN; sensors in the copies do not write to files; python user functions are called with the python GIL and therefore are not executed in parallel',
+                               argList=['mbs', 'simulationSettings', 'parameters', 'parameterValues', 'sensorNumbers', 'solverType', 'staticSolver', 'numberOfThreads'],
+                               defaultArgs=['', '', '', '', 'py::list()', 'DynamicSolverType::GeneralizedAlpha', 'false', '0'],
+                               example="values = np.array([[k, 0.1] for k in np.linspace(100,200,1000)])\\\\ results = exu.SolveBatch(mbs, simulationSettings, [['Object', 1, 'stiffness'], ['Node', 0, 'initialCoordinates', 0]], values, [sensorNumber])"); s+=s1; sL+=sL1
 
 [s1,sL1] = DefPyFunctionAccess(cClass='', pyName='SetOutputPrecision', cName='PySetOutputPrecision', 
                                 description="Set the precision (integer) for floating point numbers written to console (reset when simulation is started!)",
@@ -378,6 +429,12 @@ sL+=DefLatexStartClass(classStr+': Node', 'This section provides functions for a
 #                                isLambdaFunction = True
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='AddNodes', cName='PyAddNodes', 
+                                description="add nodes with same type and parameters as pyObject (python node class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per node, which sets node-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); node names are generated automatically; all nodes are added in one pass; Real-valued parameters in parameterArrays are written directly into the nodes, while the other parameters of every node are still set from the dictionary of pyObject, such that the creation time per node grows with the number of parameters in pyObject; returns python range of (global) node numbers of newly added nodes",
+                                argList=['pyObject', 'parameterArrays'],
+                                example = "masses = np.linspace(1,2,1000)\\\\positions = np.array([[i,0,0] for i in range(1000)])\\\\nodeRange = mbs.AddNodes(NodePoint(), {'referenceCoordinates': positions})"
+                                ); s+=s1; sL+=sL1
+
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetNodeNumber', cName='PyGetNodeNumber', 
                                 description="get node's number by name (string)",
                                 argList=['nodeName'],
@@ -451,6 +508,12 @@ sL += DefLatexStartClass(classStr+': Object', 'This section provides functions f
 #                                isLambdaFunction = True
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='AddObjects', cName='PyAddObjects', 
+                                description="add objects with same type and parameters as pyObject (python object class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per object, which sets object-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); object names are generated automatically; all objects are added in one pass; Real-valued parameters in parameterArrays are written directly into the objects, while the other parameters of every object are still set from the dictionary of pyObject, such that the creation time per object grows with the number of parameters in pyObject; returns python range of (global) object numbers of newly added objects",
+                                argList=['pyObject', 'parameterArrays'],
+                                example = "objectRange = mbs.AddObjects(MassPoint(), {'nodeNumber': np.array(nodeRange), 'physicsMass': masses})"
+                                ); s+=s1; sL+=sL1
+
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetObjectNumber', cName='PyGetObjectNumber', 
                                 description="get object's number by name (string)",
                                 argList=['objectName'],
@@ -531,6 +594,12 @@ sL += DefLatexStartClass(classStr+': Marker', 'This section provides functions f
 #                                isLambdaFunction = True
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='AddMarkers', cName='PyAddMarkers', 
+                                description="add markers with same type and parameters as pyObject (python marker class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per marker, which sets marker-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); marker names are generated automatically; all markers are added in one pass; Real-valued parameters in parameterArrays are written directly into the markers, while the other parameters of every marker are still set from the dictionary of pyObject, such that the creation time per marker grows with the number of parameters in pyObject; returns python range of (global) marker numbers of newly added markers",
+                                argList=['pyObject', 'parameterArrays'],
+                                example = "markerRange = mbs.AddMarkers(MarkerNodePosition(), {'nodeNumber': np.array(nodeRange)})"
+                                ); s+=s1; sL+=sL1
+
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetMarkerNumber', cName='PyGetMarkerNumber', 
                                 description="get marker's number by name (string)",
                                 argList=['markerName'],
@@ -587,6 +656,12 @@ sL += DefLatexStartClass(classStr+': Load', 'This section provides functions for
 #                                isLambdaFunction = True
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='AddLoads', cName='PyAddLoads', 
+                                description="add loads with same type and parameters as pyObject (python load class or dictionary); parameterArrays is a dictionary of parameterName: numpy array (or list) with one row per load, which sets load-specific (scalar or vector) parameters; integer arrays are converted to integer values (e.g. for item numbers); load names are generated automatically; all loads are added in one pass; Real-valued parameters in parameterArrays are written directly into the loads, while the other parameters of every load are still set from the dictionary of pyObject, such that the creation time per load grows with the number of parameters in pyObject; returns python range of (global) load numbers of newly added loads",
+                                argList=['pyObject', 'parameterArrays'],
+                                example = "loadRange = mbs.AddLoads(LoadForceVector(loadVector=[0,-9.81,0]), {'markerNumber': np.array(markerRange)})"
+                                ); s+=s1; sL+=sL1
+
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetLoadNumber', cName='PyGetLoadNumber', 
                                 description="get load's number by name (string)",
                                 argList=['loadName'],
@@ -677,6 +752,11 @@ sL += DefLatexStartClass(classStr+': Sensor', 'This section provides functions f
                                 argList=['sensorNumber', 'configuration']
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetSensorStoredData', cName='PyGetSensorStoredData', 
+                                description="get sensor's internally stored data as read-only numpy array with rows [time, sensorValue[0], sensorValue[1], ...] (requires storeInternal=True in sensor); the array directly accesses the sensor's memory without copying and keeps this memory alive; if the storage is re-initialized (next simulation), enlarged or the system is reset, the sensor continues in new memory and the array keeps the rows available at the time of the call",
+                                argList=['sensorNumber']
+                                ); s+=s1; sL+=sL1
+
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetSensorParameter', cName='PyGetSensorParameter', 
                                 description="get sensors's parameter from sensorNumber and parameterName; parameter names can be found for the specific items in the reference manual",
                                 argList=['sensorNumber', 'parameterName']
@@ -689,6 +769,31 @@ sL += DefLatexStartClass(classStr+': Sensor', 'This section provides functions f
 
 sL += DefLatexFinishClass() #Sensors
 
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+#PARAMETER HANDLES
+s += "\n//        PARAMETER HANDLES:\n"
+sL += DefLatexStartClass(classStr+': Parameter handles', 'This section provides functions for fast reading and writing of Real-valued parameters of many items, e.g., in pre-step user functions. A parameter handle resolves the item type and parameter name once; SetParameters and GetParameters then write and read values directly in the parameter structures of the items, without string comparison and without a python call per item. Handles are only available for parameters with Real values of fixed size (scalars, Vector3D, Matrix3D, ...) and are deleted by mbs.Reset().', subSection=True)
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetParameterHandle', cName='PyGetParameterHandle', 
+                                description="create a handle (integer) for fast access to the Real-valued parameter 'parameterName' of items with itemType being 'Node', 'Object', 'Marker', 'Load' or 'Sensor'",
+                                argList=['itemType', 'parameterName'],
+                                example = "hStiffness = mbs.GetParameterHandle('Object', 'stiffness')"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='SetParameters', cName='PySetParameters', 
+                                description="set parameter of handle for all items in itemNumbers (list or numpy array of int) to values (numpy array with one row per item; 1D array for scalar parameters)",
+                                argList=['handle', 'itemNumbers', 'values'],
+                                example = "mbs.SetParameters(hStiffness, springNumbers, 1000*np.ones(len(springNumbers)))"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetParameters', cName='PyGetParameters', 
+                                description="get parameter of handle for all items in itemNumbers (list or numpy array of int) as numpy array with one row per item (1D array for scalar parameters)",
+                                argList=['handle', 'itemNumbers'],
+                                example = "stiffness = mbs.GetParameters(hStiffness, springNumbers)"
+                                ); s+=s1; sL+=sL1
+
+sL += DefLatexFinishClass() #Parameter handles
+
 #now finalize pybind class, but do nothing on latex side (sL1 ignored)
 [s1,sL1] = DefPyFinishClass('MainSystem'); s+=s1 #; sL+=sL1
 
@@ -862,6 +967,47 @@ sL += DefLatexStartClass(pyClassStr+': Access coordinates', '\label{sec:mbs:syst
                                 example = "mbs.systemData.SetDataCoordinates(dataCurrent)"
                                 ); s+=s1; sL+=sL1
 
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetODE2CoordinatesView', cName='GetODE2CoordsView', 
+                                description="get zero-copy view (SystemStateView) on ODE2 system coordinates (displacements) for given configuration (default: exu.Configuration.Current); numpy arrays obtained from the view (np.asarray(view) or view[...]) link to the system state and allow to read and write coordinates in place; after mbs.Assemble() or mbs.Reset(), the view becomes invalid (check with view.IsValid()) and arrays obtained from it are not linked to the system state anymore (their memory is kept alive by the view); views on the visualization configuration (exu.ConfigurationType.Visualization) are not available, as the renderer swaps the visualization state buffers",
+                                options='py::keep_alive<0, 1>()',
+                                argList=['configuration'],
+                                defaultArgs=['exu.ConfigurationType::Current'],
+                                example = "uView = mbs.systemData.GetODE2CoordinatesView()\\\\u = np.asarray(uView) \\#no copy\\\\uView[0] += 0.01 \\#modifies current coordinates"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetODE2Coordinates_tView', cName='GetODE2Coords_tView', 
+                                description="get zero-copy view (SystemStateView) on ODE2 system coordinates (velocities) for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView",
+                                options='py::keep_alive<0, 1>()',
+                                argList=['configuration'],
+                                defaultArgs=['exu.ConfigurationType::Current']
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetODE1CoordinatesView', cName='GetODE1CoordsView', 
+                                description="get zero-copy view (SystemStateView) on ODE1 system coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView",
+                                options='py::keep_alive<0, 1>()',
+                                argList=['configuration'],
+                                defaultArgs=['exu.ConfigurationType::Current']
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetAECoordinatesView', cName='GetAECoordsView', 
+                                description="get zero-copy view (SystemStateView) on algebraic equations (AE) system coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView",
+                                options='py::keep_alive<0, 1>()',
+                                argList=['configuration'],
+                                defaultArgs=['exu.ConfigurationType::Current']
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetDataCoordinatesView', cName='GetDataCoordsView', 
+                                description="get zero-copy view (SystemStateView) on system data coordinates for given configuration (default: exu.Configuration.Current); see GetODE2CoordinatesView",
+                                options='py::keep_alive<0, 1>()',
+                                argList=['configuration'],
+                                defaultArgs=['exu.ConfigurationType::Current']
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetStateVersion', cName='GetStateVersion', 
+                                description="get state version of system; the state version changes with mbs.Assemble() or mbs.Reset(), which may reallocate system state vectors and invalidate views on state vectors"
+                                ); s+=s1; sL+=sL1
+
+
 
 
 [s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetSystemState', cName='PyGetSystemState', 
@@ -916,6 +1062,52 @@ sL += DefLatexFinishClass()
 [s1,sL1] = DefPyFinishClass('SystemData'); s+=s1 #; sL+=sL1
 
 
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+pyClassStr = 'VectorizedSystems'
+classStr = 'Main'+pyClassStr
+[s1,sL1] = DefPyStartClass(classStr,pyClassStr, 'The VectorizedSystems structure holds N copies of one assembled system, which are advanced together in parallel threads (C++ threads, no python multiprocessing), e.g., for reinforcement learning with many environments. Every call of Step(...) applies one row of actions per copy and advances all copies with solver.Advance(...); observations are the current values of the selected sensors of all copies, returned as one numpy array. Python user functions are called with the python GIL and therefore are not executed in parallel.' +
+        ' \\\\ \n Usage: \\\\ \\small \n\\texttt{vs = exu.VectorizedSystems()\\\\ vs.Initialize(mbs, 100, simulationSettings, [[\'Load\', 0, \'load\']], [sensorNumber])\\\\ observations = vs.Reset()\\\\ for i in range(1000):\\\\ \\phantom{XXXX}observations = vs.Step(actions, 0.01)}\n')
+s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='Initialize', cName='Initialize', 
+                                description="create numberOfCopies copies of the assembled system mbs; actions is a list of [itemType, itemNumber, parameterName] or [itemType, itemNumber, parameterName, component] as in SolveBatch, defining the parameters which are set by Step(...); observations are the concatenated current values of sensors in sensorNumbers or the ODE2 coordinates if sensorNumbers is empty; solverType selects the dynamic solver as in SolveDynamic; numberOfThreads=0 uses all hardware threads; returns True on success",
+                                argList=['mbs', 'numberOfCopies', 'simulationSettings', 'actions', 'sensorNumbers', 'solverType', 'numberOfThreads'],
+                                defaultArgs=['', '', '', '', 'py::list()', 'DynamicSolverType::GeneralizedAlpha', '0']
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='Reset', cName='Reset', 
+                                description="finalize solvers and reset all copies to their initial values (actions set in previous steps are kept); returns observations as numpy array with shape (numberOfCopies, numberOfObservations)"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='Step', cName='Step', 
+                                description="set actions (numpy array with shape (numberOfCopies, numberOfActions)) in all copies and advance all copies by timeIncrement in parallel; returns observations as numpy array with shape (numberOfCopies, numberOfObservations); rows of copies which failed (e.g. no convergence) contain NaN until Reset() is called",
+                                argList=['actions', 'timeIncrement'],
+                                example="actions = np.zeros((vs.NumberOfCopies(), vs.NumberOfActions()))\\\\observations = vs.Step(actions, 0.01)"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetObservations', cName='GetObservations', 
+                                description="return current observations as numpy array with shape (numberOfCopies, numberOfObservations)"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='GetTimes', cName='GetTimes', 
+                                description="return numpy array with current simulation time of every copy"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='NumberOfCopies', cName='NumberOfCopies', 
+                                description="return number of system copies"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='NumberOfActions', cName='NumberOfActions', 
+                                description="return number of actions per copy"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='NumberOfObservations', cName='NumberOfObservations', 
+                                description="return number of observation values per copy"
+                                ); s+=s1; sL+=sL1
+
+[s1,sL1] = DefPyFinishClass('VectorizedSystems'); s+=s1; sL+=sL1
+
+
 
 #[s1,sL1] = DefPyFunctionAccess(cClass=classStr, pyName='', cName='', 
 #                                description='',
@@ -771,6 +771,8 @@ def WriteFile(parseInfo, parameterList, typeConversion):
 
     parameterReadStr = ''  # functions and checks to read (get) parameters
     parameterWriteStr = '' # functions and checks to write (set) parameters
+    parameterAccessStr = '' # direct pointer access to Real-valued parameters (parameter handles)
+    realParameterSizes = {'Real':1, 'UReal':1, 'Vector2D':2, 'Vector3D':3, 'Vector4D':4, 'Vector6D':6, 'Vector7D':7, 'Matrix3D':9} #parameter types with fixed number of Real values
 
     for parameter in parameterList:
         i = DestinationNr(parameter['destination']) #sList: [sParamComp, sParamMain, sComp, sMain, sVisu]
@@ -907,8 +909,8 @@ def WriteFile(parseInfo, parameterList, typeConversion):
                     if IsASetSafelyParameter(parameter['type']):
                         parWrite+='EPyUtils::Set' + parameter['type'] + 'Safely(value, '
                         parWrite+=destStr + '); /*! AUTO:  safely cast to C++ type*/'
-                    elif parameter['type'] == 'BodyGraphicsData': #special conversion routine
-                        parWrite+='' #not implemented right now!
+                    elif parameter['type'] == 'BodyGraphicsData': #special conversion routine, using dictionary conversion
+                        parWrite+='py::dict d; d["' + pyName + '"] = value; PyWriteBodyGraphicsData(d, "' + pyName + '", ' + destStr + '); /*! AUTO: convert to BodyGraphicsData*/'
                     elif IsItemIndex(parameter['type']):
                         parWrite+=destStr + ' = ' + 'EPyUtils::Get'+parameter['type']+'Safely'
                         parWrite+='(value); /* AUTO:  read out dictionary, check if correct index used and store (converted) Index to C++ type*/'
@@ -927,9 +929,20 @@ def WriteFile(parseInfo, parameterList, typeConversion):
                     else:
                         parameterReadStr += 'if (parameterName.compare("' + pyName + '") == 0) { return py::cast(' + parRead + ');} //! AUTO: get parameter\n        else '
                 
+                elif parameter['type'] == 'BodyGraphicsData': #special conversion routine
+                    parameterReadStr += 'if (parameterName.compare("' + pyName + '") == 0) { return PyGetBodyGraphicsDataDictionary(' + destStr + ');} //! AUTO: get parameter\n        else '
+
                 if parWrite != '':
                     parameterWriteStr += 'if (parameterName.compare("' + pyName + '") == 0) { ' + parWrite + '; } //! AUTO: get parameter\n        else '
 
+                #direct access only for parameters in parameter structure, not for visualization or read-only parameters
+                if (parameter['type'] in realParameterSizes) and (parameter['destination'].find('P') != -1) and (vPrefix == '') and (parameter['cFlags'].find('R') == -1):
+                    if realParameterSizes[parameter['type']] == 1:
+                        accessStr = 'data = &(' + destStr + ');'
+                    else:
+                        accessStr = 'data = ' + destStr + '.GetDataPointer();'
+                    parameterAccessStr += 'if (parameterName.compare("' + pyName + '") == 0) { ' + accessStr + ' size = ' + str(realParameterSizes[parameter['type']]) + '; return true; } //! AUTO: direct access\n        else '
+
                 #pybind access goes via function in MainSystem/ObjectFactory class, e.g.:
                 #   AddMarker(dict) --> return markerNumber
                 #   SetMarker(int index (markerNameStr on Python side), dict)
@@ -1034,6 +1047,14 @@ def WriteFile(parseInfo, parameterList, typeConversion):
 #            sList[3] += '        GetCObject()->ParametersHaveChanged();\n'
     sList[3] += '    }\n\n'
 
+    if parameterAccessStr != '':
+        sList[3] += '    //! AUTO:  direct (pointer) access to Real-valued parameter for parameter handles; returns false if parameter is not available\n'
+        sList[3] += '    virtual bool GetRealParameterAccess(const STDstring& parameterName, Real*& data, Index& size) override \n'
+        sList[3] += '    {\n        '
+        sList[3] += parameterAccessStr
+        sList[3] += ' {return false;}\n'
+        sList[3] += '    }\n\n'
+
 
     #.def("__repr__", &Vector2::toString);
 
@@ -388,7 +388,7 @@ def WriteFile(parseInfo, parameterList, typeConversion):
     sDictGet += '  }\n'
     sDictSet += '  }\n'
 
-    if parseInfo['class'].find('Solver') == -1 or parseInfo['class'] == 'StaticSolverSettings':
+    if parseInfo['class'].find('Solver') == -1 or parseInfo['class'].find('Settings') != -1: #settings (e.g. StaticSolverSettings) need dictionary access
         sGetSetDictionarys += sDictGet
         sGetSetDictionarys += sDictSet
         #s += '  //! AUTO: read access to structure; converting into dictionary\n'
@@ -409,7 +409,7 @@ def WriteFile(parseInfo, parameterList, typeConversion):
         
     #output each parameter
     for parameter in parameterList:
-        if (parameter['lineType'].find('V') != -1) and (parameter['lineType'].find('L') == -1) and (parameter['type']!='TemporaryComputationData') and (parameter['type'].find('std::ofstream')==-1) and (parameter['type'].find('userFunction')==-1): #only if it is a member variable; some types not printable
+        if (parameter['lineType'].find('V') != -1) and (parameter['lineType'].find('L') == -1) and (parameter['type']!='TemporaryComputationData') and (parameter['type'].find('std::ofstream')==-1) and (parameter['type'].find('BinaryFileWriter')==-1) and (parameter['type'].find('userFunction')==-1): #only if it is a member variable; some types not printable
             paramStr = parameter['cplusplusName']
             typeStr = TypeConversion(parameter['type'], typeConversion)
             refChar = ''
@@ -40,7 +40,7 @@ classDescription = "General settings for exporting the solution (results) of a s
 #V|F, pythonName, 		cplusplusName,   size, type,					defaultValue,args,cFlags, parameterDescription
 V,  writeSolutionToFile,			,    , bool, 						   true,      ,      P		, "flag (true/false), which determines if (global) solution vector is written to file"
 V,  appendToFile,			        ,  	, bool, 					   false,     ,      P	  , "flag (true/false); if true, solution and solverInformation is appended to existing file (otherwise created)"
-V,  writeFileHeader,			     ,  	, bool, 						true,      ,      P	  , "flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration)"
+V,  writeFileHeader,			     ,  	, bool, 						true,      ,      P	  , "flag (true/false); if true, file header is written (turn off, e.g. for multiple runs of time integration); not used for binarySolutionFile, which always has a header"
 V,  writeFileFooter,			     ,  	, bool, 						true,      ,      P	  , "flag (true/false); if true, information at end of simulation is written: convergence, total solution time, statistics"
 V,  solutionWritePeriod,			,  	, UReal, 						0.01,  		,      P     , "time span (period), determines how often the solution is written during a simulation"
 #
@@ -57,6 +57,9 @@ V,  coordinatesSolutionFileName,, 	  , FileName,                "coordinatesSolu
 V,  solverInformationFileName,  , 	  , FileName,                "solverInformation.txt",   ,P		, "filename and (relative) path of text file showing detailed information during solving; detail level according to yourSolver.verboseModeFile; if solutionSettings.appendToFile is true, the information is appended in every solution step; directory will be created if it does not exist"
 V,  solutionInformation,	     ,    , String,                "",       ,      P	  , "special information added to header of solution file (e.g. parameters and settings, modes, ...)"
 V,  outputPrecision,            , 	  , Index,                 10,       ,       P		, "precision for floating point numbers written to solution and sensor files"
+V,  binarySolutionFile,         , 	  , bool,                  false,    ,       P		, "flag (true/false); if true, the coordinates solution file is written in binary format: a fixed header of 128 bytes (8 characters EXUDYNSF, followed by 15 int64 values: version, bytes per real, isStatic flag, system coordinates [nODE2, nODE1, nAlgebraic, nData], written coordinates [nODE2, nVel2, nAcc2, nODE1, nVel1, nAlgebraic, nData] and number of planned steps) followed by frames [time, coordinates...] of raw float64 (or float32) values in native byte order; the file is written from a background thread with double buffering, such that the solver does not wait for the disk; read the file with utilities.LoadBinarySolutionFile(...); outputPrecision and solutionInformation are not used; with appendToFile=True, frames are appended to an existing (non-empty) file without writing the header again, which requires the same number of coordinates and precision"
+V,  binarySinglePrecision,      , 	  , bool,                  false,    ,       P		, "flag (true/false); if true, values in the binary solution file (binarySolutionFile=True) are stored as float32 (including time), otherwise as float64"
+V,  binaryBufferSize,           , 	  , UInt,                  4194304,  ,       P		, "size of each of the two buffers in bytes used for the binary solution file; data is handed over to the writer thread whenever a buffer exceeds this size"
 V,  recordImagesInterval,       , 	  , Real,                  -1.,      ,       P    ,  "record frames (images) during solving: amount of time to wait until next image (frame) is recorded; set recordImages = -1. if no images shall be recorded; set, e.g., recordImages = 0.01 to record an image every 10 milliseconds (requires that the time steps / load steps are sufficiently small!); for file names, etc., see VisualizationSettings.exportImages"
 #
 writeFile=SimulationSettings.h
@@ -71,6 +74,8 @@ V,  relativeEpsilon,      ,  		     ,      UReal, 			   1e-7,        ,      P	 ,
 V,  minimumCoordinateSize,,  		     ,      UReal, 			   1e-2,        ,      P	 , "minimum size of coordinates in relative differentiation parameter"
 V,  doSystemWideDifferentiation,,    ,      bool, 			   false,          ,      P    , "true: system wide differentiation (e.g. all ODE2 equations w.r.t. all ODE2 coordinates); false: only local (object) differentiation"
 V,  addReferenceCoordinatesToEpsilon,, ,    bool, 			   false,          ,      P    , "true: for the size estimation of the differentiation parameter, the reference coordinate $q^{Ref}_i$ is added to ODE2 coordinates --> see; false: only the current coordinate is used for size estimation of the differentiation parameter"
+V,  useColumnCompression,,     ,        bool, 			   false,          ,      P    , "true: system wide numerical jacobians (doSystemWideDifferentiation=true for ODE2 equations, and numerical AE jacobians) perturb structurally orthogonal columns together (Curtis-Powell-Reid compression), using the sparsity pattern given by the object coordinate lists; this reduces the number of residual evaluations from the number of coordinates to the number of column colors; dependencies not represented in the coordinate lists (e.g. loads with user functions depending on other coordinates) are not captured; false: every column is differentiated separately"
+V,  useAnalyticJacobians,,     ,        bool, 			   false,          ,      P    , "true: local ODE2 jacobians (w.r.t. ODE2 coordinates and velocities) of objects which provide jacobian functions (see GetAvailableJacobians(); e.g. ANCFCable2D, RigidBody with Euler parameters and ConnectorSpringDamper using automatic differentiation, ConnectorCartesianSpringDamper, ConnectorCoordinateSpringDamper and ContactSpheresTriangleMesh) are computed analytically instead of numerical differentiation; connectors are only differentiated analytically, if their markers have jacobians which do not depend on coordinates (e.g. mass points, point nodes, coordinates), otherwise numerical differentiation is used; ContactSpheresTriangleMesh is also differentiated analytically for rigid body markers, for which the derivatives of the marker jacobians are added by numerical differentiation of the marker jacobians; not used with doSystemWideDifferentiation"
 #
 writeFile=SimulationSettings.h
 
@@ -100,6 +105,8 @@ V,  maximumSolutionNorm,	  ,  		 ,       UReal, 					1e38,  ,  P		, "this is the
 V,  maxDiscontinuousIterations,	,  	 ,     Index, 					5,     , P		, "maximum number of discontinuous (post Newton) iterations"
 V,  ignoreMaxDiscontinuousIterations,	,,     bool, 					true,     , P		, "continue solver if maximum number of discontinuous (post Newton) iterations is reached (ignore tolerance)"
 V,  discontinuousIterationTolerance,  , ,    UReal, 					1,     ,  P		, "absolute tolerance for discontinuous (post Newton) iterations; the errors represent absolute residuals and can be quite high"
+V,  useContactBroadPhase,	   ,  	 ,     bool, 					false,     , P		, "true: once per step, bounding boxes of all circles and cable segments of circle-cable contacts (ContactCircleCable2D, ContactFrictionCircleCable2D) are computed (once per marker) and overlapping circle-cable pairs are found by sweep-and-prune; contacts of non-overlapping pairs, which are not in contact, skip the discontinuous (post Newton) iteration, such that gap functions are only evaluated for candidates; the bounding boxes are enlarged by contactBroadPhaseMargin and twice the distance which circle and cable travel with their current velocities within one step"
+V,  contactBroadPhaseMargin,    ,  	 ,     UReal, 					0,     , P		, "additional distance added to circle radius and offset in contact broad phase (useContactBroadPhase); must be larger than unexpected changes of distance between circle and cable within one step (e.g. due to large accelerations)"
 #
 V,  stepInformation,	       ,  	    ,       Index, 			      2  ,   ,  P, "0 ... only current step time, 1 ... show time to go, 2 ... show newton iterations (Nit) per step, 3 ... show discontinuous iterations (Dit) and newton jacobians (jac) per step"
 #
@@ -120,6 +127,20 @@ V,  computeInitialAccelerations,	,     ,     bool, 				  true,    , P		, "true:
 #
 writeFile=SimulationSettings.h
 
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+class = ExplicitIntegrationSettings
+appendToFile=True
+writePybindIncludes = True
+classDescription = "Settings for explicit solvers, like explicit Euler, RK4 or the embedded Runge-Kutta method RK45 (Dormand-Prince); constraints are solved on acceleration level (index 1) with position and velocity projection after every step."
+#V|F, pythonName, 		cplusplusName,   size, type,					defaultValue,args, cFlags, parameterDescription
+V,  dynamicSolverType,	     ,  		      ,     DynamicSolverType, 	"DynamicSolverType::RK45",   , P		, "selection of explicit solver: exu.DynamicSolverType.ExplicitEuler (1st order), exu.DynamicSolverType.RK4 (classical Runge-Kutta, constant step size) or exu.DynamicSolverType.RK45 (Dormand-Prince, adaptive step size if adaptiveStep=True)"
+V,  useConstantMassMatrix,	 ,  		      ,     bool, 				  false,   , P		, "true: mass matrix is only computed and factorized once at the start of the simulation; only used for systems without constraints (nAE=0); the user is responsible that the mass matrix is really constant"
+V,  useConstraintProjection,	 ,  		      ,     bool, 				  true,   , P		, "true: after every step, position level constraints and velocity level constraints are projected in order to avoid drift of the acceleration level formulation"
+V,  absoluteTolerance,	     ,  		      ,     UReal, 				1e-8,   , P		, "absolute tolerance for error estimate of adaptive RK45 solver"
+V,  relativeTolerance,	     ,  		      ,     UReal, 				1e-8,   , P		, "relative tolerance for error estimate of adaptive RK45 solver; error is normalized by absoluteTolerance + relativeTolerance*|coordinate|"
+#
+writeFile=SimulationSettings.h
+
 #++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 class = TimeIntegrationSettings
 appendToFile=True
@@ -132,10 +153,12 @@ V,  endTime,				    , 	 	, UReal, 			        1	, 		,  P, "end time of time integ
 V,  numberOfSteps,		    , 	 	, UInt, 			        100	, 	,	 P, "number of steps in time integration; stepsize is computed from (endTime-startTime)/numberOfSteps"
 V,  adaptiveStep,			 , 	 	, bool, 			        true,   ,  P, "true: use step reduction if step fails; false: constant step size"
 V,  minimumStepSize,	    ,  		, UReal, 		           1e-8,   ,  P, "lower limit of time step size, before integrator stops"
+V,  reuseConstantMassMatrix, ,  		, bool, 			        true,   ,  P, "true: if all bodies have a constant mass matrix (e.g. mass points, 2D rigid bodies, ANCFCable2D or GenericODE2 without massMatrixUserFunction), the system mass matrix is computed only once at the beginning of time integration and reused in all steps and Newton iterations; the mass matrix is recomputed, if object parameters are changed with SetObjectParameter, ModifyObject or parameter handles (e.g. in preStepFunction); changes of mass parameters by other means (e.g. in C++) are not detected"
 #
 V,  verboseMode,	      ,  	  , Index, 			        0  ,    ,   P, "0 ... no output, 1 ... show short step information every 2 seconds (error), 2 ... show every step information, 3 ... show also solution vector, 4 ... show also mass matrix and jacobian (implicit methods), 5 ... show also Jacobian inverse (implicit methods)"
 V,  verboseModeFile,	    ,  	  , Index, 			        0  ,    ,   P, "same behaviour as verboseMode, but outputs all solver information to file"
 V,  generalizedAlpha,    ,     , GeneralizedAlphaSettings,  ,   ,   PS, "parameters for generalized-alpha, implicit trapezoidal rule or Newmark (options only apply for these methods)"
+V,  explicitIntegration, ,     , ExplicitIntegrationSettings,  ,   ,   PS, "parameters for explicit solvers (options only apply for ExplicitEuler, RK4 and RK45)"
 V,  preStepPyExecute,		 , 	 	, String, 			        ""	, 		,   P, "DEPRECATED, use preStepFunction in simulation settings; Python code to be executed prior to every step and after last step, e.g. for postprocessing"
 #
 writeFile=SimulationSettings.h
@@ -165,6 +188,23 @@ V,  preStepPyExecute,		   , 	 	     ,       String, 			     ""	, 		 ,P, "Python
 #
 writeFile=SimulationSettings.h
 
+#++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+class = LinearSolverSettings
+appendToFile=True
+writePybindIncludes = True
+classDescription = "Settings for linear solver, both dense and sparse (Eigen)."
+#V|F, pythonName, 		cplusplusName,   size, type,					defaultValue,args, cFlags, parameterDescription
+V,  reuseAnalyzedPattern,   ,  		   ,      bool, 					  false,    ,P		, "true: in sparse mode (EigenSparse), the symbolic analysis (COLAMD ordering and analyzePattern) of the system Jacobian is only performed, if the sparsity pattern changed since the last factorization; the pattern is compared exactly, therefore this flag is safe for systems with changing pattern (e.g. contact), but it adds a small overhead in these cases; false: symbolic analysis is done in every factorization"
+V,  fixedPatternAssembly,   ,  		   ,      bool, 					  false,    ,P		, "true: in sparse mode (EigenSparse), the sparsity pattern of system Jacobian and mass matrix is kept after the first assembly and later updates (Jacobian, mass matrix) add their values directly into the compressed sparse matrix, using a scatter map of value positions which is recorded from the local-to-global (LTG) coordinate lists; this avoids sorting, summation and reallocation of triplets in every update; entries which are not contained in the pattern (e.g. changed connectivity in contact) are detected and the pattern is extended automatically; false: matrices are rebuilt from triplets in every update"
+V,  iterativeSolverType,    ,  		   ,      IterativeSolverType,   "IterativeSolverType::GMRES",    ,P		, "Krylov method for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.IterativeSolverType.GMRES (restarted GMRES, general matrices), exu.IterativeSolverType.BiCGSTAB (general matrices, less memory than GMRES) or exu.IterativeSolverType.CG (conjugate gradient, only for symmetric positive definite matrices, e.g., static problems without constraints)"
+V,  preconditionerType,     ,  		   ,      PreconditionerType,    "PreconditionerType::ILU0",      ,P		, "preconditioner for linearSolverType = exu.LinearSolverType.EigenSparseIterative: exu.PreconditionerType.ILU0 (incomplete LU without fill-in), exu.PreconditionerType.BlockJacobi (dense LU of diagonal blocks of size iterativeBlockSize), exu.PreconditionerType.Jacobi (diagonal) or exu.PreconditionerType._None; the preconditioner is only recomputed, if the Newton solver updates the Jacobian; zero pivots (e.g. due to constraints) are regularized"
+V,  iterativeTolerance,     ,  		   ,      UReal, 					  1e-10,    ,P		, "relative tolerance for iterative solver (EigenSparseIterative): iterations stop, if the norm of the linear residual is smaller than iterativeTolerance times the norm of the right-hand-side; must be considerably smaller than the Newton tolerance"
+V,  iterativeMaxIterations, ,  		   ,      UInt, 					  1000,     ,P		, "maximum number of iterations of iterative solver (EigenSparseIterative) per solve; if tolerance is not reached, the last iterate is used and the Newton method decides on convergence; non-converged solves are counted in solver statistics"
+V,  gmresRestart,           ,  		   ,      UInt, 					  50,       ,P		, "dimension of Krylov subspace of restarted GMRES; larger values improve convergence, but need more memory (gmresRestart vectors of system size)"
+V,  iterativeBlockSize,     ,  		   ,      UInt, 					  6,        ,P		, "size of diagonal blocks for exu.PreconditionerType.BlockJacobi, e.g. 6 for rigid bodies with Euler parameters or 3 for 3D finite element nodes"
+#
+writeFile=SimulationSettings.h
+
 #++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 class = SimulationSettings
 appendToFile=True
@@ -175,7 +215,8 @@ classDescription = "General Settings for simulation; according settings for solu
 V,  timeIntegration,                ,  		        , TimeIntegrationSettings, 	  , , PS		, "time integration parameters"
 V,  solutionSettings,				     , 	 	        , SolutionSettings,  	        , , PS   , "settings for solution files"
 V,  staticSolver,				        , 	 	        , StaticSolverSettings,  		  , , PS	   , "static solver parameters"
-V,  linearSolverType,				     , 	 	        , LinearSolverType,    "LinearSolverType::EXUdense", , P	   , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense matrix inverse), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), ... (enumeration type)"
+V,  linearSolverType,				     , 	 	        , LinearSolverType,    "LinearSolverType::EXUdense", , P	   , "selection of numerical linear solver: exu.LinearSolverType.EXUdense (dense LU factorization with partial pivoting, Cholesky factorization for symmetric positive definite matrices), exu.LinearSolverType.EigenSparse (sparse matrix LU-factorization), exu.LinearSolverType.EigenSparseIterative (sparse matrix with preconditioned iterative solver, see linearSolverSettings), ... (enumeration type)"
+V,  linearSolverSettings,				  , 	 	        , LinearSolverSettings,  		  , , PS	   , "linear solver parameters (used for dense and sparse solvers)"
 V,  cleanUpMemory,                  , 	           , bool,                false   , , P		, "true: solvers will free memory at exit (recommended for large systems); false: keep allocated memory for repeated computations to increase performance"
 V,  displayStatistics,              , 	           , bool,                false   , , P		, "display general computation information at end of time step (steps, iterations, function calls, step rejections, ..."
 V,  displayComputationTime,         , 	           , bool,                false   , , P		, "display computation time statistics at end of solving"
@@ -332,6 +373,9 @@ V,      saveImageTimeOut,               , 	             ,     Index,        "500
 V,      saveImageFileName,              , 	             ,     FileName,     "images/frame",         , P,      "filename (without extension!) and (relative) path for image file(s) with consecutive numbering (e.g., frame0000.tga, frame0001.tga,...); ; directory will be created if it does not exist"
 V,      saveImageFileCounter,           , 	             ,     Index,        0,                      , P,      "current value of the counter which is used to consecutively save frames (images) with consecutive numbers"
 V,      saveImageSingleFile,            , 	             ,     bool,         false,                  , P,      "true: only save single files with given filename, not adding numbering; false: add numbering to files, see saveImageFileName"
+V,      saveImageFormat,                , 	             ,     String,       "TGA",                  , P,      "format of saved frames: 'TGA' = uncompressed .tga files; 'TGA-RLE' = run-length encoded (lossless compressed) .tga files, usually much smaller; 'RAW' = all frames are appended to one raw video stream saveImageFileName+'.bgr' with 3 bytes (blue, green, red) per pixel and rows bottom-up; frame size is the window size, which must not change during recording; convert e.g. with: ffmpeg -f rawvideo -pixel_format bgr24 -video_size 1024x768 -i frame.bgr -vf vflip video.mp4"
+V,      saveImageAsynchronous,          , 	             ,     bool,         true,                   , P,      "true: pixels are read into a pool of reusable buffers and frames are encoded and written to files by a background thread, such that renderer and solver do not wait for disk output; all files are written after SC.RedrawAndSaveImage() or exu.StopRenderer(); false: frames are written directly by the renderer"
+V,      saveImageQueueSize,             , 	             ,     UInt,         8,                      , P,      "number of frame buffers for saveImageAsynchronous; if all buffers wait for being written, the renderer waits up to saveImageTimeOut for a free buffer (which slows down the solver); otherwise the frame is dropped and the number of dropped frames is reported when the renderer is stopped"
 #
 writeFile=VisualizationSettings.h
 
@@ -497,6 +541,7 @@ V,      writeSolution,              , 	             ,     Real,         0.,
 V,      overhead,                   , 	             ,     Real,         0.,                     ,   P,    "overhead, such as initialization, copying and some matrix-vector multiplication"
 V,      python,                     , 	             ,     Real,         0.,                     ,   P,    "time spent for python functions"
 V,      visualization,              , 	             ,     Real,         0.,                     ,   P,    "time spent for visualization in computation thread"
+V,      visualizationWait,          , 	             ,     Real,         0.,                     ,   P,    "time which the computation thread waits for the renderer, if the queue of images to be recorded is full (part of visualization; not counted in sum)"
 F,      Reset,                      ,                ,     void,         "*this = CSolverTimer(); useTimer = useSolverTimer;", "bool useSolverTimer", P, "reset solver timings to initial state by assigning default values; useSolverTimer sets the useTimer flag"
 F,      Sum,                        ,                ,     Real,         ,                       ,   CDPV,    "compute sum of all timers (except for those counted multiple, e.g., jacobians"
 F,      StartTimer,                 ,                ,     void,         ,                       "Real& value",   DP,    "start timer function for a given variable; subtracts current CPU time from value"
@@ -522,6 +567,8 @@ V,      startAE,                    , 	             ,     Index,        0,
 V,      systemJacobian,             , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse system jacobian"
 V,      systemMassMatrix,           , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse system matrix"
 V,      jacobianAE,                 , 	             ,     GeneralMatrix*, nullptr,             ,    ,    "link to dense or sparse algebraic equations jacobian"
+V,      constantMassMatrix,         , 	             ,     bool,         false,                  ,   P,    "true, if system mass matrix is constant and only computed once; set during initialization of solver"
+V,      massMatrixComputed,         , 	             ,     bool,         false,                  ,   P,    "true, if constant system mass matrix has already been computed and is available in systemMassMatrix"
 #
 V,      systemResidual,             , 	             ,     ResizableVector, ,                    ,   P,    "system residual vector (vectors will be linked to this vector!)"
 V,      newtonSolution,             , 	             ,     ResizableVector, ,                    ,   P,    "Newton decrement (computed from residual and jacobian)"
@@ -535,7 +582,7 @@ V,      aAlgorithmic,               , 	             ,     ResizableVector, ,
 #
 V,      tempCompData,               , 	             ,     TemporaryComputationData, ,           ,    ,    "temporary data used during item-related residual and jacobian computation; duplicated for parallel computation"
 #private members:
-Vp,     linearSolverType,           , 	             ,     LinearSolverType,,                    ,    ,    "contains linear solver type value; cannot be accessed directly, because a change requires new linking of system matrices"
+Vp,     linearSolverType,           , 	             ,     LinearSolverType, "LinearSolverType::EXUdense",,    ,    "contains linear solver type value; cannot be accessed directly, because a change requires new linking of system matrices"
 #DENSE:
 Vp,     systemJacobianDense,        , 	             ,     GeneralMatrixEXUdense,,               ,    ,    "dense system jacobian"
 Vp,     systemMassMatrixDense,      , 	             ,     GeneralMatrixEXUdense,,               ,    ,    "dense mass matrix"
@@ -544,6 +591,7 @@ Vp,     jacobianAEdense,            , 	             ,     GeneralMatrixEXUdense,
 Vp,     systemJacobianSparse,       , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse system jacobian"
 Vp,     systemMassMatrixSparse,     , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse mass matrix"
 Vp,     jacobianAEsparse,           , 	             ,     GeneralMatrixEigenSparse,,            ,    ,    "sparse AE jacobian"
+Vp,     systemJacobianSparseIterative,, 	             ,     GeneralMatrixEigenSparseIterative,,   ,    ,    "sparse system jacobian, solved with preconditioned iterative solver (EigenSparseIterative); mass matrix and AE jacobian are sparse"
 #
 #now done with addConstructor flag; F,      SolverLocalData,            ,                ,     ,             "SetLinearSolverType(LinearSolverType::EXUdense);", ,   P,  "for safety, data is linked immediately to dense matrices"
 F,      CleanUpMemory,              ,                ,     void,         ,                       ,    DP,  "if desired, temporary data is cleaned up to safe memory"
@@ -578,6 +626,11 @@ V,      newtonStepsCount,           , 	             ,     Index,        0,
 V,      newtonJacobiCount,          , 	             ,     Index,        0,                      ,   P,    "count total Newton jacobian computations"
 V,      rejectedModifiedNewtonSteps,, 	             ,     Index,        0,                      ,   P,    "count the number of rejected modified Newton steps (switch to full Newton)"
 V,      discontinuousIterationsCount,, 	             ,     Index,        0,                      ,   P,    "count total number of discontinuous iterations (min. 1 per step)"
+V,      patternAnalysisCount,       , 	             ,     Index,        0,                      ,   P,    "count symbolic analyses (ordering, analyzePattern) of the sparse system Jacobian; with linearSolverSettings.reuseAnalyzedPattern, this is the number of pattern cache misses"
+V,      patternReuseCount,          , 	             ,     Index,        0,                      ,   P,    "count factorizations of the sparse system Jacobian, which reused the previously analyzed sparsity pattern (pattern cache hits)"
+V,      linearSolverIterationsCount,, 	             ,     Index,        0,                      ,   P,    "count total number of iterations of iterative linear solver (EigenSparseIterative)"
+V,      linearSolverNonConvergedCount,, 	             ,     Index,        0,                      ,   P,    "count number of solves of iterative linear solver (EigenSparseIterative), which did not reach linearSolverSettings.iterativeTolerance"
+V,      preconditionerCount,        , 	             ,     Index,        0,                      ,   P,    "count number of preconditioner computations of iterative linear solver (EigenSparseIterative)"
 #
 F,      ToString,                   ,                ,     String,       ,                       ,   CDPV,  "convert iteration statistics to string; used for displayStatistics option"
 #
@@ -639,6 +692,7 @@ classDescription = "Solver internal structure for output files. This structure i
 V,      solutionFile,               , 	             ,     std::ofstream,,                       ,    ,    "solution file with coordinate data"
 V,      solverFile,                 , 	             ,     std::ofstream,,                       ,    ,    "file with detailed solver information"
 V,      sensorFileList,             , 	             ,     std::vector<std::ofstream*>,,         ,    ,    "files for sensor output; the ofstream list corresponds exactly to the sensors in the computationalSystem (i.e., sensorFileList[0] is the ofstream for sensor 0, etc.); file lists need to be closed and deleted at end of simulation!"
+V,      binarySolutionFile,         , 	             ,     BinaryFileWriter*, nullptr,          ,    ,    "binary solution file writer with background thread, if solutionSettings.binarySolutionFile=True; nullptr otherwise; needs to be closed and deleted at end of simulation!"
 #
 #F,      InitializeData,             ,                ,     void,         "*this = SolverOutputData();",,P, "initialize SolverOutputData by assigning default values"
 #
@@ -735,6 +789,7 @@ FvL,    ComputeJacobianAE,           ,                ,    void,        ,
 #
 FvL,    ComputeODE2RHS,              ,                ,    void,        ,                       "MainSystem& mainSystem",   DGPV,    "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)"
 FvL,    ComputeAlgebraicEquations,   ,                ,    void,        ,                       "MainSystem& mainSystem, bool velocityLevel=false",   DGPV,    "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)"
+FvL,    ComputeODE2Eigenvalues,      ,                ,    py::list,    ,                       "MainSystem& mainSystem, Index numberOfEigenvalues, Real shift=0., Real tolerance=1e-12, bool computeEigenVectors=true",   DGPV,    "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)"
 #
 #
 writeFile=MainSolver.h
@@ -825,6 +880,9 @@ FvL,    PostInitializeSolverSpecific,,                ,    void,        ,
 FvL,    SolveSystem,                 ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "solve System: InitializeSolver, SolveSteps, FinalizeSolver"
 FvL,    FinalizeSolver,              ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "write concluding information (timer statistics, messages) and close files"
 FvL,    SolveSteps,                  ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "main solver part: calls multiple InitializeStep(...)/ DiscontinuousIteration(...)/ FinishStep(...); do step reduction if necessary; return true if success, false else"
+FvL,    Advance,                     ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings, Real timeIncrement",   GPV,    "stepwise time integration, e.g., for control in the loop: perform steps from current time to current time + timeIncrement; the solver is initialized at the first call and solver data, factorizations, files and threads are kept until FinalizeSolver(...) is called; step size follows from simulationSettings (endTime-startTime)/numberOfSteps, reduced such that timeIncrement is an integer multiple; states and parameters may be modified between calls (but do not call Assemble()); return true if success, false else"
+FvL,    SaveCheckpoint,              ,                ,    bool,        ,                       "const MainSystem& mainSystem, const STDstring& fileName",   CGPV,    "write binary checkpoint file with all system states (reference, initial, current, startOfStep, visualization) and solver data needed to continue time integration (aAlgorithmic, step size, time, step and iteration counters), e.g., between calls to Advance(...); also stores values of sensors with storeInternal=True; NOT stored are item parameters (which may contain user functions and graphics data), LTG lists and jacobians: for restart, the model must be rebuilt by the same script and assembled before LoadCheckpoint(...); return true on success"
+FvL,    LoadCheckpoint,              ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings, const STDstring& fileName",   GPV,    "load checkpoint written by SaveCheckpoint(...) into assembled system with identical structure (same items and coordinates); the solver is initialized for Advance(...) if needed and the next call to Advance(...) continues from the loaded states; return true on success"
 #
 FvL,    UpdateCurrentTime,           ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "update currentTime (and load factor); MUST be overwritten in special solver class"
 FvL,    InitializeStep,              ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "initialize static step / time step; python-functions; do some outputs, checks, etc."
@@ -862,6 +920,101 @@ FvL,    ComputeJacobianAE,           ,                ,    void,        ,
 #
 FvL,    ComputeODE2RHS,              ,                ,    void,        ,                       "MainSystem& mainSystem",   DGPV,    "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)"
 FvL,    ComputeAlgebraicEquations,   ,                ,    void,        ,                       "MainSystem& mainSystem, bool velocityLevel=false",   DGPV,    "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)"
+FvL,    ComputeODE2Eigenvalues,      ,                ,    py::list,    ,                       "MainSystem& mainSystem, Index numberOfEigenvalues, Real shift=0., Real tolerance=1e-12, bool computeEigenVectors=true",   DGPV,    "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)"
+#
+#
+writeFile=MainSolver.h
+
+
+class = MainSolverExplicit
+parentClass="MainSolverBase"
+appendToFile=True
+writePybindIncludes = True
+#linkedClass = "cSolver" #not needed any more
+classDescription = "PyBind interface (trampoline) class for explicit time integration solvers (explicit Euler, RK4, RK45). The solver type is selected in timeIntegration.explicitIntegration.dynamicSolverType. Constraints are solved on acceleration level and projected after every step. NOTE that except from SolveSystem(...), these functions are only intended for experienced users and they need to be handled with care, as unexpected crashes may happen if used not appropriately."
+#V|F,   pythonName, 		          cplusplusName,      size, type,	      defaultValue,            args,           cFlags, parameterDescription
+VL,     timer,                    cSolver.timer , 	       ,     CSolverTimer,      ,                  ,   PS,    "timer which measures the CPU time of solver sub functions"
+VL,     it,                       cSolver.it    , 	       ,     SolverIterationData, ,                ,   PS,    "all information about iterations (steps, discontinuous iteration, newton,...)"
+VL,     conv,                     cSolver.conv  , 	       ,     SolverConvergenceData, ,              ,   PS,    "all information about tolerances, errors and residua"
+VL,     output,                   cSolver.output, 	       ,     SolverOutputData,  ,                  ,   PS,    "output modes and timers for exporting solver information and solution"
+VL,     newton,                   cSolver.newton, 	       ,     NewtonSettings,    ,                  ,   PS,    "copy of newton settings from timeint or staticSolver"
+#these structures cannot be accessed directly via pybind:
+#VL,     data,                        , 	             ,     SolverLocalData,   ,                  ,   P,    "local solver vectors and matrices"
+#VL,     file,                      , 	             ,     SolverFileData,  ,                  ,   P,    "output files for solver information and solution"
+#++++++++++++++++++++++++++++++++++++++++++++++
+#specialized variables for CSolverExplicitTimeInt:
+#
+V,      cSolver,                     , 	             ,     CSolverExplicitTimeInt,,                  ,    ,    "link to C++ CSolver, not accessible from Python"
+#
+V,      isInitialized,               , 	             ,     bool,              ,                  ,    ,   "variable is used to see, if system is initialized ==> avoid crashes; DO not change these variables: can easily lead to crash! "
+V,      initializedSystemSizes,      , 	             ,     Index4,            ,                  ,    ,   "index-array contains 4 integers: nODE2, nODE1, nAE and nData of initialization: this guaranties, that no function is called with wrong system sizes; DO not change these variables: can easily lead to crash! "
+#++++++++++++++++++++++++++++++++++++++++++++++
+#specialized functions for CSolverExplicitTimeInt:
+F,      MainSolverExplicit,          ,               ,     ,                  "isInitialized = false;",,,  "constructor, in order to set valid state (settings not initialized at beginning)"
+Fv,     GetCSolver,                  ,                ,    const CSolverBase& ,            "return cSolver;",,C,  "const access to cSolver"
+Fv,     GetCSolver,                  ,                ,    CSolverBase& ,                  "return cSolver;",,,  "reference access to cSolver"
+FvL,    CheckInitialized,            ,               ,     bool,              ,                  "const MainSystem& mainSystem",   DGPV,  "check if MainSolver and MainSystem are correctly initialized ==> otherwise raise SysError"
+#++++++++++++++++++++++++++++++++++++++++++++++
+#this should be exactly the same as MainSolverImplicitSecondOrder
+#general functions:
+FvL,    GetSolverName,               ,                ,    "std::string", ,                     ,   CGPV,    "get solver name - needed for output file header and visualization window"
+FvL,    IsStaticSolver,              ,                ,    bool,        ,                       ,   CGPV,    "return true, if static solver; needs to be overwritten in derived class"
+FvL,    GetSimulationEndTime,        ,                ,    Real,        ,                       "const SimulationSettings& simulationSettings",   CGPV,    "compute simulation end time (depends on static or time integration solver)"
+FvL,    ReduceStepSize,              ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings, Index severity",   GPV,    "reduce step size (1..normal, 2..severe problems); return true, if reduction was successful"
+FvL,    IncreaseStepSize,            ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "increase step size if convergence is good"
+#initialization functions:
+FvL,    InitializeSolver,            ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   DGPV,    "initialize solverSpecific,data,it,conv; set/compute initial conditions (solver-specific!); initialize output files"
+FvL,    PreInitializeSolverSpecific, ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "pre-initialize for solver specific tasks; called at beginning of InitializeSolver, right after Solver data reset"
+FvL,    InitializeSolverOutput,      ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "initialize output files; called from InitializeSolver()"
+FvL,    InitializeSolverPreChecks,   ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "check if system is solvable; initialize dense/sparse computation modes"
+FvL,    InitializeSolverData,        ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "initialize all data,it,conv; called from InitializeSolver()"
+FvL,    InitializeSolverInitialConditions, ,          ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "set/compute initial conditions (solver-specific!); called from InitializeSolver()"
+FvL,    PostInitializeSolverSpecific,,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "post-initialize for solver specific tasks; called at the end of InitializeSolver"
+#++++++++++++++++++++++++++++++++++
+#solve functions:
+FvL,    SolveSystem,                 ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "solve System: InitializeSolver, SolveSteps, FinalizeSolver"
+FvL,    FinalizeSolver,              ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "write concluding information (timer statistics, messages) and close files"
+FvL,    SolveSteps,                  ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "main solver part: calls multiple InitializeStep(...)/ DiscontinuousIteration(...)/ FinishStep(...); do step reduction if necessary; return true if success, false else"
+FvL,    Advance,                     ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings, Real timeIncrement",   GPV,    "stepwise time integration, e.g., for control in the loop: perform steps from current time to current time + timeIncrement; the solver is initialized at the first call and solver data, factorizations, files and threads are kept until FinalizeSolver(...) is called; step size follows from simulationSettings (endTime-startTime)/numberOfSteps, reduced such that timeIncrement is an integer multiple; states and parameters may be modified between calls (but do not call Assemble()); return true if success, false else"
+FvL,    SaveCheckpoint,              ,                ,    bool,        ,                       "const MainSystem& mainSystem, const STDstring& fileName",   CGPV,    "write binary checkpoint file with all system states (reference, initial, current, startOfStep, visualization) and solver data needed to continue time integration (aAlgorithmic, step size, time, step and iteration counters), e.g., between calls to Advance(...); also stores values of sensors with storeInternal=True; NOT stored are item parameters (which may contain user functions and graphics data), LTG lists and jacobians: for restart, the model must be rebuilt by the same script and assembled before LoadCheckpoint(...); return true on success"
+FvL,    LoadCheckpoint,              ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings, const STDstring& fileName",   GPV,    "load checkpoint written by SaveCheckpoint(...) into assembled system with identical structure (same items and coordinates); the solver is initialized for Advance(...) if needed and the next call to Advance(...) continues from the loaded states; return true on success"
+FvL,    UpdateCurrentTime,           ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "update currentTime (and load factor); MUST be overwritten in special solver class"
+FvL,    InitializeStep,              ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "initialize static step / time step; python-functions; do some outputs, checks, etc."
+FvL,    FinishStep,                  ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "finish static step / time step; write output of results to file"
+FvL,    DiscontinuousIteration,      ,                ,    bool,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "perform discontinuousIteration for static step / time step; CALLS ComputeNewtonResidual"
+FvL,    Newton,                      ,                ,    bool,        , "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "perform Newton method for given solver method"
+FvL,    ComputeNewtonResidual,       ,                ,    void,        , "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "compute residual for Newton method (e.g. static or time step); store result in systemResidual"
+FvL,    ComputeNewtonUpdate,         ,                ,    void,        ,                       "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "compute update for currentState from newtonSolution (decrement from residual and jacobian)"
+FvL,    ComputeNewtonJacobian,       ,                ,    void,        , "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "compute jacobian for newton method of given solver method; store result in systemJacobian"
+#output functions:
+FvL,    WriteSolutionFileHeader,     ,                ,    void,        , "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "write unique file header, depending on static/ dynamic simulation"
+FvL,    WriteCoordinatesToFile,      ,                ,    void,        , "MainSystem& mainSystem, const SimulationSettings& simulationSettings",   GPV,    "write unique coordinates solution file"
+FvL,    IsVerboseCheck,              ,                ,    bool,        ,                                   "Index level",   CGPV,    "return true, if file or console output is at or above the given level"
+FvL,    VerboseWrite,                ,                ,    void,        ,                                "Index level, const std::string& str",   GPV,    "write to console and/or file in case of level"
+
+#special functions to access residua and system matrices
+FvL,    GetODE2size,                 ,                ,    Index,       ,                                ,   CGP,    "number of ODE2 equations in solver"
+FvL,    GetODE1size,                 ,                ,    Index,       ,                                ,   CGP,    "number of ODE1 equations in solver (not yet implemented)"
+FvL,    GetAEsize,                   ,                ,    Index,       ,                                ,   CGP,    "number of algebraic equations in solver"
+FvL,    GetDataSize,                 ,                ,    Index,       ,                                ,   CGP,    "number of data (history) variables in solver"
+#
+FvL,    GetSystemJacobian,           ,                ,    NumpyMatrix, ,                       ,   CDGPV,    "get locally stored / last computed system jacobian of solver"
+FvL,    GetSystemMassMatrix,         ,                ,    NumpyMatrix, ,                       ,   CDGPV,    "get locally stored / last computed mass matrix of solver"
+FvL,    GetSystemResidual,           ,                ,    NumpyVector, ,                       ,   CDGPV,    "get locally stored / last computed system residual"
+FvL,    GetNewtonSolution,           ,                ,    NumpyVector, ,                       ,   CDGPV,    "get locally stored / last computed solution (=increment) of Newton"
+FvL,    SetSystemJacobian,           ,                ,    void,        ,                       "const py::array_t<Real>& systemJacobian",   DGPV,      "set locally stored system jacobian of solver; must have size nODE2+nODE1+nAE"
+FvL,    SetSystemMassMatrix,         ,                ,    void,        ,                       "const py::array_t<Real>& systemMassMatrix",   DGPV,    "set locally stored mass matrix of solver; must have size nODE2+nODE1+nAE"
+FvL,    SetSystemResidual,           ,                ,    void,        ,                       "const Vector& systemResidual",   DGPV,    "set locally stored system residual; must have size nODE2+nODE1+nAE"
+#
+#special functions for interaction with mainSystem:
+FvL,    ComputeMassMatrix,           ,                ,    void,        ,                       "MainSystem& mainSystem, Real scalarFactor=1.",   DGPV,    "compute systemMassMatrix (multiplied with factor) in cSolver and return mass matrix"
+FvL,    ComputeJacobianODE2RHS,      ,                ,    void,        ,                       "MainSystem& mainSystem, Real scalarFactor=1.",   DGPV,    "set systemJacobian to zero and add jacobian (multiplied with factor) of ODE2RHS to systemJacobian in cSolver"
+FvL,    ComputeJacobianODE2RHS_t,    ,                ,    void,        ,                       "MainSystem& mainSystem, Real scalarFactor=1.",   DGPV,    "add jacobian of ODE2RHS_t (multiplied with factor) to systemJacobian in cSolver"
+FvL,    ComputeJacobianAE,           ,                ,    void,        ,                       "MainSystem& mainSystem, Real scalarFactor_ODE2=1., Real scalarFactor_ODE2_t=1., bool velocityLevel=false",   DGPV,    "add jacobian of algebraic equations (multiplied with factor) to systemJacobian in cSolver; the scalarFactors are scaling the derivatives w.r.t. ODE2 coordinates and w.r.t. ODE2_t (velocity) coordinates; if velocityLevel == true, the constraints are evaluated at velocity level"
+#
+FvL,    ComputeODE2RHS,              ,                ,    void,        ,                       "MainSystem& mainSystem",   DGPV,    "compute the RHS of ODE2 equations in systemResidual in range(0,nODE2)"
+FvL,    ComputeAlgebraicEquations,   ,                ,    void,        ,                       "MainSystem& mainSystem, bool velocityLevel=false",   DGPV,    "compute the algebraic equations in systemResidual in range(nODE2+nODE1, nODE2+nODE1+nAE)"
+FvL,    ComputeODE2Eigenvalues,      ,                ,    py::list,    ,                       "MainSystem& mainSystem, Index numberOfEigenvalues, Real shift=0., Real tolerance=1e-12, bool computeEigenVectors=true",   DGPV,    "compute numberOfEigenvalues eigenvalues closest to shift (shift=0: lowest eigenvalues) and mass-normalized eigenvectors of the ODE2 part (mass and stiffness matrix at initial values, constraints are not considered) with a sparse shift-invert Lanczos solver; sparse system matrices are used directly if linearSolverType is sparse; tolerance is the relative residual of Ritz pairs; returns [eigenValues, eigenVectors] with eigenvectors in columns as numpy arrays, which own the solver results (no copy)"
 #
 #
 writeFile=MainSolver.h